@@ -15,6 +15,8 @@
 //@HEADER
 #ifndef KOKKOSBATCHED_HOSTLEVEL_GEMM_IMPL_HPP
 #define KOKKOSBATCHED_HOSTLEVEL_GEMM_IMPL_HPP
+#include <limits>
+#include <vector>
 #include <Kokkos_Core.hpp>
 #include <KokkosBatched_Util.hpp>  // Trans, BatchLayout
 #include <KokkosKernels_ExecSpaceUtils.hpp>
@@ -62,6 +64,179 @@ constexpr KOKKOS_INLINE_FUNCTION size_t kk_gemm_dbl_buf_alpha_in_fma_thresh() {
 #endif  // __CUDAACC_RDC__
 }
 
+/// \brief BatchedDblBufGemm with TILE_M x TILE_N x TILE_K tiles. Bounds are
+/// only checked if C and K are not whole numbers of tiles, and alpha is applied
+/// in the fma for large C, as in the SQUARE heuristic.
+template <int TILE_M, int TILE_N, int TILE_K, typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
+          typename BatchedGemmHandleType, typename ScalarType, typename AViewType, typename BViewType,
+          typename CViewType>
+int BatchedDblBufGemmWithTiles(BatchedGemmHandleType *const handle, const size_t c_m, const size_t c_n,
+                               const size_t c_k, const ScalarType alpha, const AViewType &A, const BViewType &B,
+                               const ScalarType beta, const CViewType &C) {
+  const bool alpha_in_fma = c_m >= kk_gemm_dbl_buf_alpha_in_fma_thresh();
+  if (c_m % TILE_M == 0 && c_n % TILE_N == 0 && c_k % TILE_K == 0) {
+    if (alpha_in_fma)
+      return BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                               BViewType, CViewType, BoundsCheck::No, AlphaTag::Yes, TILE_M, TILE_N, TILE_K>(
+                 handle, alpha, A, B, beta, C)
+          .invoke();
+    return BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                             BViewType, CViewType, BoundsCheck::No, AlphaTag::No, TILE_M, TILE_N, TILE_K>(
+               handle, alpha, A, B, beta, C)
+        .invoke();
+  }
+  if (alpha_in_fma)
+    return BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                             BViewType, CViewType, BoundsCheck::Yes, AlphaTag::Yes, TILE_M, TILE_N, TILE_K>(
+               handle, alpha, A, B, beta, C)
+        .invoke();
+  return BatchedDblBufGemm<ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType, ScalarType, AViewType,
+                           BViewType, CViewType, BoundsCheck::Yes, AlphaTag::No, TILE_M, TILE_N, TILE_K>(
+             handle, alpha, A, B, beta, C)
+      .invoke();
+}
+
+/// \brief Runs one KK_AUTOTUNE candidate:
+///   KK_SERIAL       variant 0: Algo::Gemm::Unblocked, variant 1: Algo::Gemm::Blocked
+///   KK_SERIAL_RANK0 variant 0: Algo::Gemm::Unblocked
+///   KK_DBLBUF       variant 0: the default tiles, variant 1: 16x16x4 tiles (GPUs only)
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim, typename BatchedGemmHandleType,
+          typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+int BatchedGemmTunedImpl([[maybe_unused]] BatchedGemmHandleType *const handle,
+                         const BatchedGemmTuningTable::Entry &entry, [[maybe_unused]] const size_t c_m,
+                         [[maybe_unused]] const size_t c_n, [[maybe_unused]] const size_t c_k, const ScalarType alpha,
+                         const AViewType &A, const BViewType &B, const ScalarType beta, const CViewType &C) {
+  using exec_space      = typename CViewType::execution_space;
+  constexpr bool on_gpu = KokkosKernels::Impl::is_gpu_exec_space_v<exec_space>;
+
+  if (entry.algo_type == BaseKokkosBatchedAlgos::KK_SERIAL && entry.variant == 0) {
+    return BatchedSerialGemm<ArgTransA, ArgTransB, Algo::Gemm::Unblocked, ArgBatchSzDim, ResultsPerThread::Rank2,
+                             ScalarType, AViewType, BViewType, CViewType>(alpha, A, B, beta, C)
+        .invoke();
+  } else if (entry.algo_type == BaseKokkosBatchedAlgos::KK_SERIAL && entry.variant == 1) {
+    return BatchedSerialGemm<ArgTransA, ArgTransB, Algo::Gemm::Blocked, ArgBatchSzDim, ResultsPerThread::Rank2,
+                             ScalarType, AViewType, BViewType, CViewType>(alpha, A, B, beta, C)
+        .invoke();
+  } else if (entry.algo_type == GemmKokkosBatchedAlgos::KK_SERIAL_RANK0 && entry.variant == 0) {
+    return BatchedSerialGemm<ArgTransA, ArgTransB, Algo::Gemm::Unblocked, ArgBatchSzDim, ResultsPerThread::Rank0,
+                             ScalarType, AViewType, BViewType, CViewType>(alpha, A, B, beta, C)
+        .invoke();
+  } else if (entry.algo_type == GemmKokkosBatchedAlgos::KK_DBLBUF && (entry.variant == 0 || entry.variant == 1)) {
+    if constexpr (on_gpu) {
+      if (entry.variant == 0)
+        return BatchedDblBufGemmWithTiles<kk_gemm_dbl_buf_tile_m<exec_space>(), kk_gemm_dbl_buf_tile_n<exec_space>(),
+                                          kk_gemm_dbl_buf_tile_k<exec_space>(), ArgTransA, ArgTransB, ArgBatchSzDim>(
+            handle, c_m, c_n, c_k, alpha, A, B, beta, C);
+      return BatchedDblBufGemmWithTiles<16, 16, 4, ArgTransA, ArgTransB, ArgBatchSzDim>(handle, c_m, c_n, c_k, alpha,
+                                                                                      A, B, beta, C);
+    }
+  }
+  std::ostringstream os;
+  os << "KokkosBatched::BatchedGemm with kernelAlgoType = KK_AUTOTUNE does not support algo_type = "
+     << entry.algo_type << ", variant = " << entry.variant << " on " << exec_space::name() << "." << std::endl;
+  KokkosKernels::Impl::throw_runtime_exception(os.str());
+  return -1;
+}
+
+/// \brief KK_AUTOTUNE: looks up the signature of the call in the handle's
+/// tuning table, tuning it first if needed, and runs the selected kernel.
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim, typename BatchedGemmHandleType,
+          typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+int BatchedGemmAutotune(BatchedGemmHandleType *const handle, const ScalarType alpha, const AViewType &A,
+                        const BViewType &B, const ScalarType beta, const CViewType &C) {
+  using entry_type          = BatchedGemmTuningTable::Entry;
+  using exec_space          = typename CViewType::execution_space;
+  using view_scalar_type    = typename CViewType::non_const_value_type;
+  using layout_type         = typename CViewType::array_layout;
+  constexpr bool on_gpu     = KokkosKernels::Impl::is_gpu_exec_space_v<exec_space>;
+  constexpr bool batch_left = std::is_same<ArgBatchSzDim, BatchLayout::Left>::value;
+  constexpr bool a_trans    = std::is_same<ArgTransA, Trans::Transpose>::value;
+  constexpr bool b_trans    = std::is_same<ArgTransB, Trans::Transpose>::value;
+
+  const size_t c_b = batch_left ? C.extent(0) : C.extent(2);
+  const size_t c_m = batch_left ? C.extent(1) : C.extent(0);
+  const size_t c_n = batch_left ? C.extent(2) : C.extent(1);
+  const size_t c_k = batch_left ? A.extent(a_trans ? 1 : 2) : A.extent(a_trans ? 0 : 1);
+
+  entry_type entry;
+  if (c_b == 0 || c_m == 0 || c_n == 0)
+    return BatchedGemmTunedImpl<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, entry, c_m, c_n, c_k, alpha, A, B, beta,
+                                                                     C);
+
+  std::ostringstream key;
+  key << exec_space::name() << "/" << Kokkos::ArithTraits<view_scalar_type>::name() << "/"
+      << (std::is_same<layout_type, Kokkos::LayoutLeft>::value
+              ? "LayoutLeft"
+              : (std::is_same<layout_type, Kokkos::LayoutRight>::value ? "LayoutRight" : "LayoutStride"))
+      << "/" << (batch_left ? "BatchLeft" : "BatchRight") << "/" << (a_trans ? "T" : "N") << (b_trans ? "T" : "N")
+      << "/" << c_m << "x" << c_n << "x" << c_k << "x" << c_b;
+
+  BatchedGemmTuningTable &table = handle->get_tuning_table();
+  if (!table.find(key.str(), entry)) {
+    std::vector<entry_type> candidates = {{BaseKokkosBatchedAlgos::KK_SERIAL, 0},
+                                          {BaseKokkosBatchedAlgos::KK_SERIAL, 1},
+                                          {GemmKokkosBatchedAlgos::KK_SERIAL_RANK0, 0}};
+    if (on_gpu) {
+      candidates.push_back({GemmKokkosBatchedAlgos::KK_DBLBUF, 0});
+      candidates.push_back({GemmKokkosBatchedAlgos::KK_DBLBUF, 1});
+    }
+
+    // Time the candidates on a copy of C, so that C is only updated once.
+    // The copy is reset before each call, so that with beta != 0 every
+    // call sees the values of C and not the result of the previous call.
+    using scratch_view_type = Kokkos::View<view_scalar_type ***, layout_type, typename CViewType::device_type>;
+    scratch_view_type original(Kokkos::view_alloc(Kokkos::WithoutInitializing, "BatchedGemm::Autotune::C0"),
+                               C.layout());
+    scratch_view_type scratch(Kokkos::view_alloc(Kokkos::WithoutInitializing, "BatchedGemm::Autotune::C"),
+                              C.layout());
+    Kokkos::deep_copy(original, C);
+    const CViewType scratchC(scratch.data(), C.layout());
+
+    constexpr int n_reps = 3;
+    entry.seconds        = -1.0;
+    for (auto &candidate : candidates) {
+      try {
+        Kokkos::deep_copy(scratch, original);
+        BatchedGemmTunedImpl<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, candidate, c_m, c_n, c_k, alpha, A, B, beta,
+                                                                  scratchC);
+        exec_space().fence();
+        Kokkos::Timer timer;
+        candidate.seconds = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < n_reps; ++rep) {
+          Kokkos::deep_copy(scratch, original);
+          timer.reset();
+          BatchedGemmTunedImpl<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, candidate, c_m, c_n, c_k, alpha, A, B,
+                                                                    beta, scratchC);
+          exec_space().fence();
+          candidate.seconds = std::min(candidate.seconds, timer.seconds());
+        }
+      } catch (const std::runtime_error &error) {
+        // e.g. the KK_DBLBUF tiles need a larger team than the execution
+        // space supports
+        if (handle->enableDebug) std::cout << "KK_AUTOTUNE skipped: " << error.what() << std::endl;
+        continue;
+      }
+      if (handle->enableDebug) {
+        std::cout << "KK_AUTOTUNE " << key.str() << " algo_type:" << candidate.algo_type
+                  << " variant:" << candidate.variant << " seconds:" << candidate.seconds << std::endl;
+      }
+      if (entry.seconds < 0.0 || candidate.seconds < entry.seconds) entry = candidate;
+    }
+    if (entry.seconds < 0.0) {
+      std::ostringstream os;
+      os << "KokkosBatched::BatchedGemm with kernelAlgoType = KK_AUTOTUNE found no kernel for " << key.str() << "."
+         << std::endl;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+
+    table.insert(key.str(), entry);
+    if (!handle->get_tuning_file().empty()) table.save(handle->get_tuning_file());
+  }
+
+  return BatchedGemmTunedImpl<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, entry, c_m, c_n, c_k, alpha, A, B, beta,
+                                                                   C);
+}
+
 template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim, typename BatchedGemmHandleType,
           typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
 int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha, const AViewType &A, const BViewType &B,
@@ -266,6 +441,12 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
                 .invoke();
       break;
 
+    case GemmKokkosBatchedAlgos::KK_AUTOTUNE:
+      // SIMD views were rejected above
+      if constexpr (!is_vector<ViewValueType>::value)
+        ret = Impl::BatchedGemmAutotune<ArgTransA, ArgTransB, ArgBatchSzDim>(handle, alpha, A, B, beta, C);
+      break;
+
     default:
       std::ostringstream os;
       os << "KokkosBatched::BatchedGemm does not support kernelAlgoType = "
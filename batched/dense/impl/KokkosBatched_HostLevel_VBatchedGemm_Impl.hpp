@@ -0,0 +1,244 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_IMPL_HPP
+#define KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_IMPL_HPP
+#include <array>
+#include <map>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_Util.hpp>  // Trans
+#include <KokkosKernels_ExecSpaceUtils.hpp>
+#include <KokkosKernels_Error.hpp>
+
+#include "KokkosBatched_HostLevel_Gemm_Handle.hpp"  // BatchedGemmHandle
+#include "KokkosBatched_Gemm_Serial_Internal.hpp"
+#include "KokkosBatched_Gemm_TeamVector_Internal.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+/// \brief Strides (s0, s1) of op(X), a rows x cols matrix whose stored form
+/// is column-major and contiguous.
+template <typename ArgTrans>
+inline void vbatched_gemm_strides(const int rows, const int cols, int &s0, int &s1) {
+  if constexpr (std::is_same<ArgTrans, Trans::NoTranspose>::value) {
+    s0 = 1;
+    s1 = rows;
+  } else {
+    s0 = cols;
+    s1 = 1;
+  }
+}
+
+/// \brief The entries of a bucket share m, n and k, so that their strides
+/// are known on the host.
+struct VBatchedGemmBucket {
+  int m, n, k;
+  int as0, as1, bs0, bs1;
+  int begin, end;
+};
+
+/// \brief One entry of the bucket per thread, with SerialGemmInternal.
+template <typename ArgMode, typename ScalarType, typename PermViewType, typename OffsetViewType, typename AViewType,
+          typename BViewType, typename CViewType>
+struct VBatchedSerialGemmFunctor {
+  VBatchedGemmBucket bucket;
+  ScalarType alpha, beta;
+  PermViewType perm;
+  OffsetViewType aOffsets, bOffsets, cOffsets;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int l) const {
+    const int e = perm(l);
+    KokkosBatched::Impl::SerialGemmInternal<ArgMode>::invoke(
+        KokkosBlas::Impl::OpID(), KokkosBlas::Impl::OpID(), bucket.m, bucket.n, bucket.k, alpha,
+        A.data() + aOffsets(e), bucket.as0, bucket.as1, B.data() + bOffsets(e), bucket.bs0, bucket.bs1, beta,
+        C.data() + cOffsets(e), 1, bucket.m);
+  }
+};
+
+/// \brief One entry of the bucket per team, with TeamVectorGemmInternal.
+/// Team threads run over the rows of C and vector lanes over its columns;
+/// if transposed, C^T = op(B)^T op(A)^T is computed instead, so that the
+/// threads run over the longer dimension of wide matrices.
+template <typename ScalarType, typename PermViewType, typename OffsetViewType, typename AViewType, typename BViewType,
+          typename CViewType>
+struct VBatchedTeamVectorGemmFunctor {
+  VBatchedGemmBucket bucket;
+  bool transposed;
+  ScalarType alpha, beta;
+  PermViewType perm;
+  OffsetViewType aOffsets, bOffsets, cOffsets;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int e = perm(member.league_rank());
+    const auto pA = A.data() + aOffsets(e);
+    const auto pB = B.data() + bOffsets(e);
+    const auto pC = C.data() + cOffsets(e);
+    if (transposed)
+      TeamVectorGemmInternal<Algo::Gemm::Unblocked>::invoke(member, bucket.n, bucket.m, bucket.k, alpha, pB,
+                                                            bucket.bs1, bucket.bs0, pA, bucket.as1, bucket.as0, beta,
+                                                            pC, bucket.m, 1);
+    else
+      TeamVectorGemmInternal<Algo::Gemm::Unblocked>::invoke(member, bucket.m, bucket.n, bucket.k, alpha, pA,
+                                                            bucket.as0, bucket.as1, pB, bucket.bs0, bucket.bs1, beta,
+                                                            pC, 1, bucket.m);
+  }
+};
+
+template <typename ArgTransA, typename ArgTransB, typename BatchedGemmHandleType, typename ScalarType,
+          typename DimViewType, typename OffsetViewType, typename AViewType, typename BViewType, typename CViewType>
+int VBatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha, const DimViewType &m,
+                     const DimViewType &n, const DimViewType &k, const AViewType &A, const OffsetViewType &aOffsets,
+                     const BViewType &B, const OffsetViewType &bOffsets, const ScalarType beta, const CViewType &C,
+                     const OffsetViewType &cOffsets) {
+  static_assert(Kokkos::is_view<AViewType>::value, "AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<BViewType>::value, "BViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<CViewType>::value, "CViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 1, "AViewType must have rank 1.");
+  static_assert(static_cast<int>(BViewType::rank) == 1, "BViewType must have rank 1.");
+  static_assert(static_cast<int>(CViewType::rank) == 1, "CViewType must have rank 1.");
+  static_assert(static_cast<int>(DimViewType::rank) == 1, "DimViewType must have rank 1.");
+  static_assert(static_cast<int>(OffsetViewType::rank) == 1, "OffsetViewType must have rank 1.");
+  static_assert(std::is_same<ArgTransA, Trans::NoTranspose>::value || std::is_same<ArgTransA, Trans::Transpose>::value,
+                "ArgTransA must be either Trans::Transpose or Trans::NoTranspose.");
+  static_assert(std::is_same<ArgTransB, Trans::NoTranspose>::value || std::is_same<ArgTransB, Trans::Transpose>::value,
+                "ArgTransB must be either Trans::Transpose or Trans::NoTranspose.");
+
+  using exec_space        = typename CViewType::execution_space;
+  using perm_view_type    = Kokkos::View<int *, typename CViewType::device_type>;
+  constexpr bool on_gpu   = KokkosKernels::Impl::is_gpu_exec_space_v<exec_space>;
+  constexpr bool on_a64fx = KokkosKernels::Impl::kk_is_a64fx_mem_space<typename exec_space::memory_space>();
+  using serial_mode_type  = std::conditional_t<on_gpu || on_a64fx, Algo::Gemm::Unblocked, Algo::Gemm::Blocked>;
+
+  const size_t batchSz = cOffsets.extent(0);
+  if (m.extent(0) != cOffsets.extent(0) || n.extent(0) != cOffsets.extent(0) || k.extent(0) != cOffsets.extent(0) ||
+      aOffsets.extent(0) != cOffsets.extent(0) || bOffsets.extent(0) != cOffsets.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBatched::VBatchedGemm: m, n, k, aOffsets, bOffsets and cOffsets must have the same extent"
+       << " (cOffsets has " << cOffsets.extent(0) << ")" << std::endl;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const int algo_type = handle->get_kernel_algo_type();
+  switch (algo_type) {
+    case BaseHeuristicAlgos::SQUARE:
+    case BaseHeuristicAlgos::TALL:
+    case BaseHeuristicAlgos::WIDE:
+    case BaseKokkosBatchedAlgos::KK_SERIAL:
+    case GemmKokkosBatchedAlgos::KK_TEAMVECTOR:
+      break;
+    default:
+      std::ostringstream os;
+      os << "KokkosBatched::VBatchedGemm does not support kernelAlgoType = " << handle->get_kernel_algo_type_str()
+         << "." << std::endl;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+      break;
+  }
+
+  // Sort the entries into buckets of identical (m, n, k). Entries with an
+  // empty C are dropped.
+  auto mHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m);
+  auto nHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), n);
+  auto kHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), k);
+  std::map<std::array<int, 3>, std::vector<int>> sizes;
+  for (size_t e = 0; e < batchSz; e++) {
+    if (mHost(e) < 0 || nHost(e) < 0 || kHost(e) < 0) {
+      std::ostringstream os;
+      os << "KokkosBatched::VBatchedGemm: entry " << e << " has negative dimensions (" << mHost(e) << ", "
+         << nHost(e) << ", " << kHost(e) << ")" << std::endl;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    if (mHost(e) == 0 || nHost(e) == 0) continue;
+    sizes[{int(mHost(e)), int(nHost(e)), int(kHost(e))}].push_back(int(e));
+  }
+
+  std::vector<VBatchedGemmBucket> buckets;
+  int numEntries = 0;
+  for (const auto &size : sizes) numEntries += size.second.size();
+  perm_view_type perm(Kokkos::view_alloc(Kokkos::WithoutInitializing, "VBatchedGemm::perm"), numEntries);
+  auto permHost = Kokkos::create_mirror_view(perm);
+  int begin     = 0;
+  for (const auto &size : sizes) {
+    VBatchedGemmBucket bucket;
+    bucket.m = size.first[0];
+    bucket.n = size.first[1];
+    bucket.k = size.first[2];
+    vbatched_gemm_strides<ArgTransA>(bucket.m, bucket.k, bucket.as0, bucket.as1);
+    vbatched_gemm_strides<ArgTransB>(bucket.k, bucket.n, bucket.bs0, bucket.bs1);
+    bucket.begin = begin;
+    for (const int e : size.second) permHost(begin++) = e;
+    bucket.end = begin;
+    buckets.push_back(bucket);
+  }
+  Kokkos::deep_copy(perm, permHost);
+
+  // Dispatch each bucket to a fixed-size kernel. The kernels are queued on
+  // the same execution space instance, without fences in between.
+  using serial_functor_type = VBatchedSerialGemmFunctor<serial_mode_type, ScalarType, perm_view_type, OffsetViewType,
+                                                        AViewType, BViewType, CViewType>;
+  using team_functor_type =
+      VBatchedTeamVectorGemmFunctor<ScalarType, perm_view_type, OffsetViewType, AViewType, BViewType, CViewType>;
+  exec_space exec;
+  for (const auto &bucket : buckets) {
+    const auto bucketPerm = Kokkos::subview(perm, Kokkos::make_pair(bucket.begin, bucket.end));
+    const int count       = bucket.end - bucket.begin;
+
+    // Heuristics: on host, one entry per thread. On GPUs, small square
+    // matrices are also solved one entry per thread; larger or tall ones by a
+    // team, and wide ones by a team on the transposed problem. KK_TEAMVECTOR
+    // always uses a team, also transposed for wide matrices.
+    const bool tall = bucket.m >= 2 * bucket.n, wide = bucket.n >= 2 * bucket.m;
+    bool useTeam = false, transposed = false;
+    if (algo_type == GemmKokkosBatchedAlgos::KK_TEAMVECTOR) {
+      useTeam    = true;
+      transposed = wide;
+    } else if (algo_type != BaseKokkosBatchedAlgos::KK_SERIAL && on_gpu) {
+      useTeam    = tall || wide || bucket.m >= 16;
+      transposed = wide;
+    }
+
+    if (handle->enableDebug) {
+      std::cout << "VBatchedGemm bucket m:" << bucket.m << " n:" << bucket.n << " k:" << bucket.k
+                << " count:" << count << " useTeam:" << useTeam << " transposed:" << transposed << std::endl;
+    }
+
+    if (useTeam) {
+      team_functor_type functor{bucket, transposed, alpha, beta, bucketPerm, aOffsets, bOffsets, cOffsets, A, B, C};
+      if (handle->teamSz > 0 && handle->vecLen > 0) {
+        Kokkos::TeamPolicy<exec_space> policy(exec, count, handle->teamSz, handle->vecLen);
+        Kokkos::parallel_for("KokkosBatched::VBatchedGemm::TeamVector", policy, functor);
+      } else {
+        Kokkos::TeamPolicy<exec_space> policy(exec, count, Kokkos::AUTO, Kokkos::AUTO);
+        Kokkos::parallel_for("KokkosBatched::VBatchedGemm::TeamVector", policy, functor);
+      }
+    } else {
+      serial_functor_type functor{bucket, alpha, beta, bucketPerm, aOffsets, bOffsets, cOffsets, A, B, C};
+      Kokkos::parallel_for("KokkosBatched::VBatchedGemm::Serial", Kokkos::RangePolicy<exec_space>(exec, 0, count),
+                           functor);
+    }
+  }
+  return 0;
+}
+}  // namespace Impl
+}  // namespace KokkosBatched
+#endif  // KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_IMPL_HPP
@@ -35,6 +35,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator+(const Vector<SI
   return _mm512_add_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator+(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_add_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator+(
@@ -62,6 +68,34 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 2) operator+(const Vector<SIMD<double>, 2> &a,
+                                                                 const Vector<SIMD<double>, 2> &b) {
+  return vaddq_f64(a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 4) operator+(const Vector<SIMD<float>, 4> &a,
+                                                                const Vector<SIMD<float>, 4> &b) {
+  return vaddq_f32(a, b);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH) operator+(
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a,
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &b) {
+  return svadd_x(svptrue_b64(), a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH) operator+(
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a,
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &b) {
+  return svadd_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator+(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -211,6 +245,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator-(const Vector<SI
   return _mm512_sub_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator-(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_sub_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator-(
@@ -238,6 +278,34 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 2) operator-(const Vector<SIMD<double>, 2> &a,
+                                                                 const Vector<SIMD<double>, 2> &b) {
+  return vsubq_f64(a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 4) operator-(const Vector<SIMD<float>, 4> &a,
+                                                                const Vector<SIMD<float>, 4> &b) {
+  return vsubq_f32(a, b);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH) operator-(
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a,
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &b) {
+  return svsub_x(svptrue_b64(), a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH) operator-(
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a,
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &b) {
+  return svsub_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator-(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -290,6 +358,49 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(const Vector<SI
 }
 #endif
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_AVX)
+#if defined(__AVX512F__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator-(const Vector<SIMD<double>, 8> &a) {
+  return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(_mm512_set1_pd(-0.0))));
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator-(const Vector<SIMD<float>, 16> &a) {
+  return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(_mm512_set1_ps(-0.0f))));
+}
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(const Vector<SIMD<double>, 4> &a) {
+  return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+}
+#endif
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 2) operator-(const Vector<SIMD<double>, 2> &a) {
+  return vnegq_f64(a);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 4) operator-(const Vector<SIMD<float>, 4> &a) {
+  return vnegq_f32(a);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH) operator-(
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a) {
+  return svneg_x(svptrue_b64(), a);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH) operator-(
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a) {
+  return svneg_x(svptrue_b32(), a);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator-(const Vector<SIMD<T>, l> &a) {
   Vector<SIMD<T>, l> r_val;
@@ -398,6 +509,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator*(const Vector<SI
   return _mm512_mul_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator*(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_mul_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator*(
@@ -444,6 +561,34 @@ static Vector<SIMD<Kokkos::complex<double> >, 2> operator*(const Vector<SIMD<Kok
 #endif
 #endif
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 2) operator*(const Vector<SIMD<double>, 2> &a,
+                                                                 const Vector<SIMD<double>, 2> &b) {
+  return vmulq_f64(a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 4) operator*(const Vector<SIMD<float>, 4> &a,
+                                                                const Vector<SIMD<float>, 4> &b) {
+  return vmulq_f32(a, b);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH) operator*(
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a,
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &b) {
+  return svmul_x(svptrue_b64(), a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH) operator*(
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a,
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &b) {
+  return svmul_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator*(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -628,6 +773,12 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator/(const Vector<SI
   return _mm512_div_pd(a, b);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator/(const Vector<SIMD<float>, 16> &a,
+                                                                 const Vector<SIMD<float>, 16> &b) {
+  return _mm512_div_ps(a, b);
+}
+
 #if !defined(KOKKOS_COMPILER_GNU)
 KOKKOS_FORCEINLINE_FUNCTION
 static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator/(
@@ -686,6 +837,34 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 2) operator
 #endif
 #endif
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 2) operator/(const Vector<SIMD<double>, 2> &a,
+                                                                 const Vector<SIMD<double>, 2> &b) {
+  return vdivq_f64(a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 4) operator/(const Vector<SIMD<float>, 4> &a,
+                                                                const Vector<SIMD<float>, 4> &b) {
+  return vdivq_f32(a, b);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH) operator/(
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a,
+    const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &b) {
+  return svdiv_x(svptrue_b64(), a, b);
+}
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH) operator/(
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a,
+    const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &b) {
+  return svdiv_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l) operator/(const Vector<SIMD<T>, l> &a,
                                                                                         const Vector<SIMD<T>, l> &b) {
@@ -43,6 +43,45 @@ KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l) sqrt(con
   return r_val;
 }
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_AVX)
+#if defined(__AVX512F__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 8) sqrt(const Vector<SIMD<double>, 8> &a) {
+  return _mm512_sqrt_pd(a);
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 16) sqrt(const Vector<SIMD<float>, 16> &a) {
+  return _mm512_sqrt_ps(a);
+}
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4) sqrt(const Vector<SIMD<double>, 4> &a) {
+  return _mm256_sqrt_pd(a);
+}
+#endif
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 2) sqrt(const Vector<SIMD<double>, 2> &a) {
+  return vsqrtq_f64(a);
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 4) sqrt(const Vector<SIMD<float>, 4> &a) {
+  return vsqrtq_f32(a);
+}
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH)
+sqrt(const Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> &a) {
+  return svsqrt_x(svptrue_b64(), a);
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH)
+sqrt(const Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> &a) {
+  return svsqrt_x(svptrue_b32(), a);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l) cbrt(const Vector<SIMD<T>, l> &a) {
   typedef Kokkos::ArithTraits<T> ats;
@@ -41,6 +41,87 @@ KOKKOSBATCHED_RELATION_OPERATOR(>=)
 KOKKOSBATCHED_RELATION_OPERATOR(==)
 KOKKOSBATCHED_RELATION_OPERATOR(!=)
 
+// vector, vector with native compares
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_AVX) && defined(__AVX512F__)
+#define KOKKOSBATCHED_AVX512_RELATION_OPERATOR(op, T, l, suffix, pred)                          \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, l> operator op(const Vector<SIMD<T>, l> &a,   \
+                                                                 const Vector<SIMD<T>, l> &b) { \
+    const auto mask = _mm512_cmp_##suffix##_mask(a, b, pred);                                   \
+    Vector<SIMD<bool>, l> r_val;                                                                \
+    for (int i = 0; i < l; ++i) r_val[i] = (mask >> i) & 1;                                     \
+    return r_val;                                                                               \
+  }
+
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(<, double, 8, pd, _CMP_LT_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(>, double, 8, pd, _CMP_GT_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(<=, double, 8, pd, _CMP_LE_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(>=, double, 8, pd, _CMP_GE_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(==, double, 8, pd, _CMP_EQ_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(!=, double, 8, pd, _CMP_NEQ_UQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(<, float, 16, ps, _CMP_LT_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(>, float, 16, ps, _CMP_GT_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(<=, float, 16, ps, _CMP_LE_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(>=, float, 16, ps, _CMP_GE_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(==, float, 16, ps, _CMP_EQ_OQ)
+KOKKOSBATCHED_AVX512_RELATION_OPERATOR(!=, float, 16, ps, _CMP_NEQ_UQ)
+
+#undef KOKKOSBATCHED_AVX512_RELATION_OPERATOR
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+#define KOKKOSBATCHED_NEON_RELATION_OPERATOR(op, T, l, bits, cmp, test)                         \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, l> operator op(const Vector<SIMD<T>, l> &a,   \
+                                                                 const Vector<SIMD<T>, l> &b) { \
+    uint##bits##_t mask[l];                                                                     \
+    vst1q_u##bits(mask, cmp(a, b));                                                             \
+    Vector<SIMD<bool>, l> r_val;                                                                \
+    for (int i = 0; i < l; ++i) r_val[i] = mask[i] test;                                        \
+    return r_val;                                                                               \
+  }
+
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(<, double, 2, 64, vcltq_f64, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(>, double, 2, 64, vcgtq_f64, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(<=, double, 2, 64, vcleq_f64, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(>=, double, 2, 64, vcgeq_f64, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(==, double, 2, 64, vceqq_f64, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(!=, double, 2, 64, vceqq_f64, == 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(<, float, 4, 32, vcltq_f32, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(>, float, 4, 32, vcgtq_f32, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(<=, float, 4, 32, vcleq_f32, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(>=, float, 4, 32, vcgeq_f32, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(==, float, 4, 32, vceqq_f32, != 0)
+KOKKOSBATCHED_NEON_RELATION_OPERATOR(!=, float, 4, 32, vceqq_f32, == 0)
+
+#undef KOKKOSBATCHED_NEON_RELATION_OPERATOR
+#endif
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+#define KOKKOSBATCHED_SVE_RELATION_OPERATOR(op, T, l, bits, cmp)                                  \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, l> operator op(const Vector<SIMD<T>, l> &a,     \
+                                                                 const Vector<SIMD<T>, l> &b) {   \
+    uint##bits##_t mask[l];                                                                       \
+    svst1_u##bits(svptrue_b##bits(), mask, svdup_n_u##bits##_z(cmp(svptrue_b##bits(), a, b), 1)); \
+    Vector<SIMD<bool>, l> r_val;                                                                  \
+    for (int i = 0; i < l; ++i) r_val[i] = mask[i] != 0;                                          \
+    return r_val;                                                                                 \
+  }
+
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(<, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmplt)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(>, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmpgt)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(<=, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmple)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(>=, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmpge)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(==, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmpeq)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(!=, double, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH, 64, svcmpne)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(<, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmplt)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(>, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmpgt)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(<=, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmple)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(>=, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmpge)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(==, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmpeq)
+KOKKOSBATCHED_SVE_RELATION_OPERATOR(!=, float, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH, 32, svcmpne)
+
+#undef KOKKOSBATCHED_SVE_RELATION_OPERATOR
+#endif
+
 // vector, scalar
 #undef KOKKOSBATCHED_RELATION_OPERATOR
 #define KOKKOSBATCHED_RELATION_OPERATOR(op)                                                                   \
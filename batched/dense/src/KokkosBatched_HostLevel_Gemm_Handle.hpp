@@ -17,6 +17,10 @@
 #ifndef KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP
 #define KOKKOSBATCHED_HOSTLEVEL_GEMM_HANDLE_DECL_HPP
 
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
 #include "KokkosBatched_Kernel_Handle.hpp"
 
 namespace KokkosBatched {
@@ -36,6 +40,7 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
   KK_SERIAL_RANK0,
   KK_SERIAL_SHMEM,
   KK_DBLBUF,
+  KK_AUTOTUNE,
   N
 };
 }
@@ -44,7 +49,84 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
   "GemmTplAlgos::CUBLAS", "GemmTplAlgos::MAGMA", "GemmKokkosBatchedAlgos::KK_TEAM",     \
       "GemmKokkosBatchedAlgos::KK_TEAMVECTOR", "GemmKokkosBatchedAlgos::KK_SERIALSIMD", \
       "GemmKokkosBatchedAlgos::KK_TEAMSIMD", "GemmKokkosBatchedAlgos::KK_SERIAL_RANK0", \
-      "GemmKokkosBatchedAlgos::KK_SERIAL_SHMEM", "GemmKokkosBatchedAlgos::KK_DBLBUF"
+      "GemmKokkosBatchedAlgos::KK_SERIAL_SHMEM", "GemmKokkosBatchedAlgos::KK_DBLBUF",   \
+      "GemmKokkosBatchedAlgos::KK_AUTOTUNE"
+
+/// \brief Kernels selected by KK_AUTOTUNE, keyed by the signature of the
+/// BatchedGemm call: execution space, scalar type, layouts, transposes, m, n,
+/// k and batch size. See BatchedGemmHandle for details. The table is shared by
+/// all handles of the process, so its members lock a mutex.
+class BatchedGemmTuningTable {
+ public:
+  /// \brief A KK algorithm type, a variant of it (serial mode or tile sizes)
+  /// and its measured time per call.
+  struct Entry {
+    int algo_type  = BaseKokkosBatchedAlgos::KK_SERIAL;
+    int variant    = 0;
+    double seconds = 0.0;
+  };
+
+  bool find(const std::string &key, Entry &entry) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(key);
+    if (it == _entries.end()) return false;
+    entry = it->second;
+    return true;
+  }
+
+  void insert(const std::string &key, const Entry &entry) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries[key] = entry;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+  }
+
+  /// \brief Merges the entries of a file written by save() into the table.
+  /// \return false if the file could not be opened
+  bool load(const std::string &filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) return false;
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::string line;
+    while (std::getline(file, line)) {
+      if (line.empty() || line[0] == '#') continue;
+      std::istringstream is(line);
+      std::string key;
+      Entry entry;
+      if (is >> key >> entry.algo_type >> entry.variant >> entry.seconds) _entries[key] = entry;
+    }
+    return true;
+  }
+
+  /// \brief Writes the table as text, one "signature algo_type variant
+  /// seconds" line per entry.
+  void save(const std::string &filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+      std::ostringstream os;
+      os << "KokkosBatched::BatchedGemmTuningTable: cannot open " << filename << " for writing." << std::endl;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    file << "# KokkosBatched::BatchedGemm tuning table: signature algo_type variant seconds" << std::endl;
+    for (const auto &entry : _entries)
+      file << entry.first << " " << entry.second.algo_type << " " << entry.second.variant << " "
+           << entry.second.seconds << std::endl;
+  }
+
+ private:
+  std::map<std::string, Entry> _entries;
+  mutable std::mutex _mutex;
+};
+
 // clang-format off
 /// \brief Handle for selecting runtime behavior of the BatchedGemm interface.
 ///
@@ -82,6 +164,14 @@ enum GEMM_KOKKOS_BATCHED_ALGOS : int {
 ///                                          Uses a tuned functor with tiling and double buffering
 ///                                          via shared memory and register buffers.
 ///                                          KK_DBLBUF generally performs better on GPUs when M, N >= 24.
+///                          KK_AUTOTUNE     The first time a signature (execution space, scalar type,
+///                                          layouts, transposes, M, N, K and batch size) is seen,
+///                                          time the KK_SERIAL (Unblocked and Blocked), KK_SERIAL_RANK0
+///                                          and, on GPUs, KK_DBLBUF (two tile sizes) kernels on a copy
+///                                          of C and keep the fastest in the tuning table. Later calls
+///                                          with the same signature run the stored kernel directly.
+///                                          The table is shared by all handles of the process; see
+///                                          set_tuning_file to persist it across runs.
 /// \param teamSz      Specifies the team size that will affect any KK algorithm which uses
 ///                    TeamPolicy (default, Kokkos::AUTO).
 ///                    Note: Only applied if useAlgo_type == KK_*
@@ -145,7 +235,25 @@ class BatchedGemmHandle : public BatchedKernelHandle {
 
   std::string get_kernel_algo_type_str() const { return gemm_algo_type_strs[_kernelAlgoType]; }
 
+  /// \brief The table of kernels selected by KK_AUTOTUNE.
+  BatchedGemmTuningTable &get_tuning_table() const { return _get_tuning_table_singleton(); }
+
+  /// \brief Loads the tuning table from filename, if it exists, and saves
+  /// the table back to it whenever KK_AUTOTUNE tunes a new signature.
+  void set_tuning_file(const std::string &filename) {
+    _tuningFile = filename;
+    if (!filename.empty()) get_tuning_table().load(filename);
+  }
+
+  const std::string &get_tuning_file() const { return _tuningFile; }
+
  private:
+  static BatchedGemmTuningTable &_get_tuning_table_singleton() {
+    static BatchedGemmTuningTable tuningTableGlobalStorage;
+    return tuningTableGlobalStorage;
+  }
+
+  std::string _tuningFile;
   const char *gemm_algo_type_strs[GemmKokkosBatchedAlgos::N] = {BASE_ALGO_STRS, GEMM_ALGO_STRS};
 };
 
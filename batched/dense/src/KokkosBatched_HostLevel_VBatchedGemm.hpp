@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_HPP
+#define KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_HPP
+
+#include "KokkosBatched_HostLevel_VBatchedGemm_Impl.hpp"
+
+namespace KokkosBatched {
+// clang-format off
+/// \brief Non-blocking solve of general matrix multiply on a batch of
+/// matrices of varying sizes.
+///
+///        C_i = alpha * op(A_i) * op(B_i) + beta * C_i
+///
+/// where C_i is m(i) x n(i) and op(A_i) is m(i) x k(i). Each matrix is stored
+/// column-major and contiguous in a 1-rank view, at the given offset: A_i is
+/// m(i) x k(i) (k(i) x m(i) if transposed), B_i is k(i) x n(i) (n(i) x k(i)
+/// if transposed) and C_i is m(i) x n(i).
+///
+/// The entries are sorted into buckets of identical (m, n, k), and each bucket
+/// is dispatched to a fixed-size kernel. All the kernels are queued on the
+/// same execution space instance. Copying m, n and k to the host and sorting
+/// them is blocking.
+///
+/// \tparam ArgTransA      Specifies what op does to A:
+///
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam ArgTransB      Specifies what op does to B:
+///
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam ScalarType     Specifies the scalar type of alpha and beta
+/// \tparam DimViewType    1-rank Kokkos::View of integers
+/// \tparam OffsetViewType 1-rank Kokkos::View of integers
+/// \tparam AViewType      1-rank Kokkos::View
+/// \tparam BViewType      1-rank Kokkos::View
+/// \tparam CViewType      1-rank Kokkos::View
+///
+/// \param handle [in]     A handle which specifies how to invoke the batched
+///                        gemm. Supported kernelAlgoTypes:
+///                          SQUARE, TALL, WIDE Select the kernel of each bucket from its shape:
+///                                             on host, SerialGemm via RangePolicy(bucket size).
+///                                             On GPUs, small square buckets use SerialGemm via
+///                                             RangePolicy(bucket size); larger or tall ones
+///                                             TeamVectorGemm via TeamPolicy(bucket size), and
+///                                             wide ones TeamVectorGemm on C^T = op(B)^T op(A)^T.
+///                          KK_SERIAL          SerialGemm     via RangePolicy(bucket size)
+///                          KK_TEAMVECTOR      TeamVectorGemm via TeamPolicy(bucket size)
+///                        See struct BatchedGemmHandle for details.
+/// \param alpha [in]      Input coefficient used for multiplication with A
+/// \param m [in]          Number of rows of each C_i
+/// \param n [in]          Number of columns of each C_i
+/// \param k [in]          Inner dimension of each product
+/// \param A [in]          Values of all the A_i
+/// \param aOffsets [in]   Offset of each A_i in A
+/// \param B [in]          Values of all the B_i
+/// \param bOffsets [in]   Offset of each B_i in B
+/// \param beta [in]       Input coefficient used for multiplication with C
+/// \param C [in/out]      Values of all the C_i
+/// \param cOffsets [in]   Offset of each C_i in C
+/// \return 0 upon success, non-zero otherwise
+///
+/// Usage Example:
+///   VBatchedGemm<ArgTransA, ArgTransB>(handle, alpha, m, n, k, A, aOffsets,
+///                                      B, bOffsets, beta, C, cOffsets);
+// clang-format on
+template <typename ArgTransA, typename ArgTransB, typename BatchedGemmHandleType, typename ScalarType,
+          typename DimViewType, typename OffsetViewType, typename AViewType, typename BViewType, typename CViewType>
+inline int VBatchedGemm(BatchedGemmHandleType *const handle, const ScalarType alpha, const DimViewType &m,
+                        const DimViewType &n, const DimViewType &k, const AViewType &A, const OffsetViewType &aOffsets,
+                        const BViewType &B, const OffsetViewType &bOffsets, const ScalarType beta, const CViewType &C,
+                        const OffsetViewType &cOffsets) {
+  return Impl::VBatchedGemmImpl<ArgTransA, ArgTransB>(handle, alpha, m, n, k, A, aOffsets, B, bOffsets, beta, C,
+                                                      cOffsets);
+}
+}  // namespace KokkosBatched
+#endif  // KOKKOSBATCHED_HOSTLEVEL_VBATCHEDGEMM_HPP
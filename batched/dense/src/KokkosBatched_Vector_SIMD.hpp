@@ -25,8 +25,21 @@
 #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || defined(__SYCL_DEVICE_ONLY__)
 // compiler bug with AVX in some architectures
 #undef KOKKOSBATCHED_IMPL_ENABLE_AVX
+#undef KOKKOSBATCHED_IMPL_ENABLE_NEON
+#undef KOKKOSBATCHED_IMPL_ENABLE_SVE
 #else
 #define KOKKOSBATCHED_IMPL_ENABLE_AVX
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define KOKKOSBATCHED_IMPL_ENABLE_NEON
+#endif
+// SVE vectors can only be class members with a fixed length
+// (-msve-vector-bits); 128-bit SVE is covered by NEON.
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+    (__ARM_FEATURE_SVE_BITS == 256 || __ARM_FEATURE_SVE_BITS == 512)
+#define KOKKOSBATCHED_IMPL_ENABLE_SVE
+#define KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH (__ARM_FEATURE_SVE_BITS / 64)
+#define KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH (__ARM_FEATURE_SVE_BITS / 32)
+#endif
 #endif
 
 namespace KokkosBatched {
@@ -87,6 +100,20 @@ class Vector<SIMD<T>, l> {
   KOKKOS_INLINE_FUNCTION
   void storeUnaligned(value_type *p) const { storeAligned(p); }
 
+  /// \brief Loads the first n values of p, for the tail of an array whose
+  /// length is not a multiple of vector_length; the other lanes are zero.
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  /// \brief Stores the first n lanes to p.
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return _data[i]; }
 };
@@ -180,6 +207,17 @@ class Vector<SIMD<float>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -269,6 +307,17 @@ class Vector<SIMD<double>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -380,6 +429,17 @@ class Vector<SIMD<float>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -495,6 +555,17 @@ class Vector<SIMD<double>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
@@ -573,7 +644,20 @@ class Vector<SIMD<double>, 4> {
 
   inline void storeUnaligned(value_type *p) const { _mm256_storeu_pd(p, _data); }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm256_maskload_pd(p, tail_mask(n));
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const { _mm256_maskstore_pd(p, tail_mask(n), _data); }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+
+ private:
+  // lanes i < n have their sign bit set
+  inline static __m256i tail_mask(const int n) {
+    return _mm256_set_epi64x(n > 3 ? -1 : 0, n > 2 ? -1 : 0, n > 1 ? -1 : 0, n > 0 ? -1 : 0);
+  }
 };
 
 template <>
@@ -648,6 +732,15 @@ class Vector<SIMD<Kokkos::complex<double> >, 2> {
 
   inline void storeUnaligned(value_type *p) const { _mm256_storeu_pd((mag_type *)p, _data); }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 }  // namespace KokkosBatched
@@ -720,7 +813,93 @@ class Vector<SIMD<double>, 8> {
 
   inline void storeUnaligned(value_type *p) const { _mm512_storeu_pd(p, _data); }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_pd(tail_mask(n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const { _mm512_mask_storeu_pd(p, tail_mask(n), _data); }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+
+ private:
+  inline static __mmask8 tail_mask(const int n) {
+    return n >= vector_length ? __mmask8(0xFF) : (n <= 0 ? __mmask8(0) : __mmask8((1u << n) - 1));
+  }
+};
+
+template <>
+class Vector<SIMD<float>, 16> {
+ public:
+  using type       = Vector<SIMD<float>, 16>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 16 };
+  typedef __m512 data_type __attribute__((aligned(64)));
+
+  inline static const char *label() { return "AVX512"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = _mm512_setzero_ps(); }
+  inline Vector(const value_type &val) { _data = _mm512_set1_ps(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const __m512 &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const __m512 &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator __m512() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = _mm512_load_ps(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = _mm512_loadu_ps(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { _mm512_store_ps(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { _mm512_storeu_ps(p, _data); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_ps(tail_mask(n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const { _mm512_mask_storeu_ps(p, tail_mask(n), _data); }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+
+ private:
+  inline static __mmask16 tail_mask(const int n) {
+    return n >= vector_length ? __mmask16(0xFFFF) : (n <= 0 ? __mmask16(0) : __mmask16((1u << n) - 1));
+  }
 };
 
 template <>
@@ -789,6 +968,15 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 
   inline void storeUnaligned(value_type *p) const { _mm512_storeu_pd((mag_type *)p, _data); }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i) (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
 };
 }  // namespace KokkosBatched
@@ -796,6 +984,306 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 #endif /* #if defined(__AVX512F__) */
 #endif /* #if defined(KOKKOSBATCHED_IMPL_ENABLE_AVX) */
 
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON)
+#include <arm_neon.h>
+
+namespace KokkosBatched {
+
+template <>
+class Vector<SIMD<double>, 2> {
+ public:
+  using type       = Vector<SIMD<double>, 2>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = 2 };
+  typedef float64x2_t data_type;
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = vdupq_n_f64(0); }
+  inline Vector(const value_type &val) { _data = vdupq_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float64x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float64x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float64x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = vld1q_f64(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = vld1q_f64(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { vst1q_f64(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { vst1q_f64(p, _data); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = vdupq_n_f64(0);
+    for (int i = 0; i < vector_length && i < n; ++i) (*this)[i] = p[i];
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, 4> {
+ public:
+  using type       = Vector<SIMD<float>, 4>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 4 };
+  typedef float32x4_t data_type;
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = vdupq_n_f32(0); }
+  inline Vector(const value_type &val) { _data = vdupq_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float32x4_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float32x4_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float32x4_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = vld1q_f32(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = vld1q_f32(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { vst1q_f32(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { vst1q_f32(p, _data); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = vdupq_n_f32(0);
+    for (int i = 0; i < vector_length && i < n; ++i) (*this)[i] = p[i];
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+}  // namespace KokkosBatched
+#endif /* #if defined(KOKKOSBATCHED_IMPL_ENABLE_NEON) */
+
+#if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE)
+#include <arm_sve.h>
+
+namespace KokkosBatched {
+namespace Impl {
+typedef svfloat64_t sve_float64_t __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+typedef svfloat32_t sve_float32_t __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+}  // namespace Impl
+
+template <>
+class Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH> {
+ public:
+  using type       = Vector<SIMD<double>, KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = KOKKOSBATCHED_IMPL_SVE_DOUBLE_LENGTH };
+  typedef Impl::sve_float64_t data_type;
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f64(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const data_type &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const data_type &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator data_type() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f64(svptrue_b64(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = svld1_f64(svptrue_b64(), p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { svst1_f64(svptrue_b64(), p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { svst1_f64(svptrue_b64(), p, _data); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = svld1_f64(svwhilelt_b64(0, n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const { svst1_f64(svwhilelt_b64(0, n), p, _data); }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+
+template <>
+class Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH> {
+ public:
+  using type       = Vector<SIMD<float>, KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = KOKKOSBATCHED_IMPL_SVE_FLOAT_LENGTH };
+  typedef Impl::sve_float32_t data_type;
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f32(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const data_type &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const data_type &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator data_type() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f32(svptrue_b32(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = svld1_f32(svptrue_b32(), p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { svst1_f32(svptrue_b32(), p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { svst1_f32(svptrue_b32(), p, _data); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = svld1_f32(svwhilelt_b32(0, n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const { svst1_f32(svwhilelt_b32(0, n), p, _data); }
+
+  inline value_type &operator[](const int &i) const { return reinterpret_cast<value_type *>(&_data)[i]; }
+};
+}  // namespace KokkosBatched
+#endif /* #if defined(KOKKOSBATCHED_IMPL_ENABLE_SVE) */
+
 #include "KokkosBatched_Vector_SIMD_Arith.hpp"
 #include "KokkosBatched_Vector_SIMD_Logical.hpp"
 #include "KokkosBatched_Vector_SIMD_Relation.hpp"
@@ -14,6 +14,7 @@
 //
 //@HEADER
 #include "gtest/gtest.h"
+#include <cstdio>
 #include "Kokkos_Core.hpp"
 #include "Kokkos_Random.hpp"
 
@@ -227,6 +228,33 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
             algo_type == GemmKokkosBatchedAlgos::KK_SERIAL_RANK0 || algo_type == GemmKokkosBatchedAlgos::KK_DBLBUF) {
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+        } else if (algo_type == GemmKokkosBatchedAlgos::KK_AUTOTUNE) {
+          // The first call tunes the signature, the next ones run the stored
+          // kernel, and all of them are checked against the reference gemm.
+          // beta != 0 checks that the tuning runs did not update C.
+          using execution_space = typename DeviceType::execution_space;
+          auto& table           = batchedGemmHandle.get_tuning_table();
+          impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
+              &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+          const size_t tableSize = table.size();
+          impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
+              &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+          impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
+              &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.0, 0.0);
+          // alpha and beta are not part of the signature
+          EXPECT_EQ(table.size(), tableSize);
+          const std::string fname = std::string("batched_gemm_tuning_") + execution_space::name() + ".txt";
+          if (N > 0) ASSERT_GT(tableSize, 0u);
+          table.save(fname);
+          table.clear();
+          batchedGemmHandle.set_tuning_file(fname);
+          EXPECT_EQ(table.size(), tableSize);
+          // The kernel loaded from the file gives the same result too
+          impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
+              &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2, matCdim1, matCdim2, 1.5, 3.0);
+          EXPECT_EQ(table.size(), tableSize);
+          batchedGemmHandle.set_tuning_file("");
+          std::remove(fname.c_str());
         } else if (algo_type == BaseHeuristicAlgos::SQUARE) {
           // Invoke 4 times to ensure we cover all paths for alpha and beta
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType, ParamTagType>(
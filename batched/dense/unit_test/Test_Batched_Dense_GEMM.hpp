@@ -8,6 +8,7 @@
 #include "Test_Batched_BatchedGemm.hpp"
 #include "Test_Batched_BatchedGemm_Real.hpp"
 #include "Test_Batched_BatchedGemm_Complex.hpp"
+#include "Test_Batched_VBatchedGemm.hpp"
 
 // Team Kernels
 #include "Test_Batched_TeamGemm.hpp"
@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include <array>
+#include <random>
+#include <vector>
+#include "Kokkos_Core.hpp"
+
+#include "KokkosBatched_HostLevel_VBatchedGemm.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace VBatchedGemm {
+// Square, tall and wide entries of several sizes, some repeated and some
+// empty, in no particular order.
+inline std::vector<std::array<int, 3>> mixed_sizes() {
+  return {{5, 5, 5},  {17, 17, 4}, {40, 6, 9},  {3, 31, 7},
+          {5, 5, 5},  {0, 4, 3},   {6, 2, 0},   {17, 17, 4},
+          {1, 1, 1},  {24, 50, 3}, {40, 6, 9},  {33, 33, 33}};
+}
+
+template <typename DeviceType, typename ScalarType, typename TransA, typename TransB>
+void impl_test_vbatched_gemm(const int algo_type, const std::vector<std::array<int, 3>> &sizes = mixed_sizes(),
+                             const int teamSize = 0, const int vecLength = 0) {
+  using view_type   = Kokkos::View<ScalarType *, DeviceType>;
+  using dim_type    = Kokkos::View<int *, DeviceType>;
+  using offset_type = Kokkos::View<size_t *, DeviceType>;
+  using ats         = Kokkos::ArithTraits<ScalarType>;
+
+  constexpr bool transA = std::is_same<TransA, Trans::Transpose>::value;
+  constexpr bool transB = std::is_same<TransB, Trans::Transpose>::value;
+
+  const int N = sizes.size();
+
+  dim_type m("m", N), n("n", N), k("k", N);
+  offset_type aOffsets("aOffsets", N), bOffsets("bOffsets", N), cOffsets("cOffsets", N);
+  auto mHost        = Kokkos::create_mirror_view(m);
+  auto nHost        = Kokkos::create_mirror_view(n);
+  auto kHost        = Kokkos::create_mirror_view(k);
+  auto aOffsetsHost = Kokkos::create_mirror_view(aOffsets);
+  auto bOffsetsHost = Kokkos::create_mirror_view(bOffsets);
+  auto cOffsetsHost = Kokkos::create_mirror_view(cOffsets);
+  size_t aSize = 0, bSize = 0, cSize = 0;
+  for (int e = 0; e < N; e++) {
+    mHost(e)        = sizes[e][0];
+    nHost(e)        = sizes[e][1];
+    kHost(e)        = sizes[e][2];
+    aOffsetsHost(e) = aSize;
+    bOffsetsHost(e) = bSize;
+    cOffsetsHost(e) = cSize;
+    aSize += mHost(e) * kHost(e);
+    bSize += kHost(e) * nHost(e);
+    cSize += mHost(e) * nHost(e);
+  }
+
+  view_type A("A", aSize), B("B", bSize), C("C", cSize);
+  auto AHost = Kokkos::create_mirror_view(A);
+  auto BHost = Kokkos::create_mirror_view(B);
+  auto CHost = Kokkos::create_mirror_view(C);
+  std::mt19937 rng(13718);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (size_t i = 0; i < aSize; i++) AHost(i) = ScalarType(dist(rng));
+  for (size_t i = 0; i < bSize; i++) BHost(i) = ScalarType(dist(rng));
+  for (size_t i = 0; i < cSize; i++) CHost(i) = ScalarType(dist(rng));
+
+  Kokkos::deep_copy(m, mHost);
+  Kokkos::deep_copy(n, nHost);
+  Kokkos::deep_copy(k, kHost);
+  Kokkos::deep_copy(aOffsets, aOffsetsHost);
+  Kokkos::deep_copy(bOffsets, bOffsetsHost);
+  Kokkos::deep_copy(cOffsets, cOffsetsHost);
+  Kokkos::deep_copy(A, AHost);
+  Kokkos::deep_copy(B, BHost);
+  Kokkos::deep_copy(C, CHost);
+
+  // Host reference, with column-major entries
+  const ScalarType alpha(1.5), beta(-0.5);
+  std::vector<ScalarType> expected(cSize);
+  for (int e = 0; e < N; e++) {
+    const int me = mHost(e), ne = nHost(e), ke = kHost(e);
+    const ScalarType *a = AHost.data() + aOffsetsHost(e), *b = BHost.data() + bOffsetsHost(e);
+    for (int j = 0; j < ne; j++) {
+      for (int i = 0; i < me; i++) {
+        ScalarType sum(0);
+        for (int p = 0; p < ke; p++)
+          sum += (transA ? a[p + i * ke] : a[i + p * me]) * (transB ? b[j + p * ne] : b[p + j * ke]);
+        const size_t ij = cOffsetsHost(e) + i + j * me;
+        expected[ij]    = alpha * sum + beta * CHost(ij);
+      }
+    }
+  }
+
+  BatchedGemmHandle handle(algo_type, teamSize, vecLength);
+  VBatchedGemm<TransA, TransB>(&handle, alpha, m, n, k, A, aOffsets, B, bOffsets, beta, C, cOffsets);
+  Kokkos::fence();
+  Kokkos::deep_copy(CHost, C);
+
+  const typename ats::mag_type eps = 1.0e3 * ats::epsilon();
+  for (size_t i = 0; i < cSize; i++) EXPECT_NEAR_KK(CHost(i), expected[i], eps);
+}
+}  // namespace VBatchedGemm
+}  // namespace Test
+
+template <typename DeviceType, typename ScalarType, typename TransA, typename TransB>
+int test_vbatched_gemm() {
+  Test::VBatchedGemm::impl_test_vbatched_gemm<DeviceType, ScalarType, TransA, TransB>(BaseHeuristicAlgos::SQUARE);
+  Test::VBatchedGemm::impl_test_vbatched_gemm<DeviceType, ScalarType, TransA, TransB>(
+      BaseKokkosBatchedAlgos::KK_SERIAL);
+  Test::VBatchedGemm::impl_test_vbatched_gemm<DeviceType, ScalarType, TransA, TransB>(
+      GemmKokkosBatchedAlgos::KK_TEAMVECTOR);
+  // Wide entries only, so that every bucket runs the transposed TeamVector
+  // kernel, with the team size and vector length set by the handle
+  Test::VBatchedGemm::impl_test_vbatched_gemm<DeviceType, ScalarType, TransA, TransB>(
+      GemmKokkosBatchedAlgos::KK_TEAMVECTOR, {{3, 31, 7}, {2, 40, 5}, {3, 31, 7}, {8, 20, 1}, {1, 9, 12}}, 1, 1);
+  return 0;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, batched_scalar_vbatched_gemm_nt_nt_double) {
+  test_vbatched_gemm<TestDevice, double, Trans::NoTranspose, Trans::NoTranspose>();
+}
+TEST_F(TestCategory, batched_scalar_vbatched_gemm_t_nt_double) {
+  test_vbatched_gemm<TestDevice, double, Trans::Transpose, Trans::NoTranspose>();
+}
+TEST_F(TestCategory, batched_scalar_vbatched_gemm_nt_t_double) {
+  test_vbatched_gemm<TestDevice, double, Trans::NoTranspose, Trans::Transpose>();
+}
+TEST_F(TestCategory, batched_scalar_vbatched_gemm_t_t_double) {
+  test_vbatched_gemm<TestDevice, double, Trans::Transpose, Trans::Transpose>();
+}
+#endif
@@ -151,11 +151,15 @@ int test_batched_vector_math() {
 #if defined(KOKKOSKERNELS_INST_FLOAT)
 TEST_F(TestCategory, batched_vector_math_simd_float3) { test_batched_vector_math<TestDevice, SIMD<float>, 3>(); }
 TEST_F(TestCategory, batched_vector_math_simd_float8) { test_batched_vector_math<TestDevice, SIMD<float>, 8>(); }
+TEST_F(TestCategory, batched_vector_math_simd_float4) { test_batched_vector_math<TestDevice, SIMD<float>, 4>(); }
+TEST_F(TestCategory, batched_vector_math_simd_float16) { test_batched_vector_math<TestDevice, SIMD<float>, 16>(); }
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
 TEST_F(TestCategory, batched_vector_math_simd_double3) { test_batched_vector_math<TestDevice, SIMD<double>, 3>(); }
 TEST_F(TestCategory, batched_vector_math_simd_double4) { test_batched_vector_math<TestDevice, SIMD<double>, 4>(); }
+TEST_F(TestCategory, batched_vector_math_simd_double2) { test_batched_vector_math<TestDevice, SIMD<double>, 2>(); }
+TEST_F(TestCategory, batched_vector_math_simd_double8) { test_batched_vector_math<TestDevice, SIMD<double>, 8>(); }
 #endif
 
 // using namespace Test;
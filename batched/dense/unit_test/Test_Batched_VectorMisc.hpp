@@ -138,6 +138,19 @@ void impl_test_batched_vector_misc() {
       EXPECT_EQ(all_true, false);
       EXPECT_EQ(any_true, true);
     }
+    {
+      // partial loads zero the trailing lanes and partial stores leave them untouched
+      value_type src[vector_length], dst[vector_length];
+      for (int i = 0; i < vector_length; ++i) src[i] = a[i];
+      for (int n = 0; n <= vector_length; ++n) {
+        c.loadUnaligned(src, n);
+        for (int i = 0; i < vector_length; ++i) EXPECT_EQ(c[i], i < n ? src[i] : value_type(0));
+
+        for (int i = 0; i < vector_length; ++i) dst[i] = value_type(-2);
+        c.storeUnaligned(dst, n);
+        for (int i = 0; i < vector_length; ++i) EXPECT_EQ(dst[i], i < n ? src[i] : value_type(-2));
+      }
+    }
     {
       value_type min_a = a[0], max_a = a[0], sum_a = 0, prod_a = 1;
       for (int i = 0; i < vector_length; ++i) {
@@ -171,11 +184,15 @@ int test_batched_vector_misc() {
 #if defined(KOKKOSKERNELS_INST_FLOAT)
 TEST_F(TestCategory, batched_vector_misc_simd_float3) { test_batched_vector_misc<TestDevice, SIMD<float>, 3>(); }
 TEST_F(TestCategory, batched_vector_misc_simd_float8) { test_batched_vector_misc<TestDevice, SIMD<float>, 8>(); }
+TEST_F(TestCategory, batched_vector_misc_simd_float4) { test_batched_vector_misc<TestDevice, SIMD<float>, 4>(); }
+TEST_F(TestCategory, batched_vector_misc_simd_float16) { test_batched_vector_misc<TestDevice, SIMD<float>, 16>(); }
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
 TEST_F(TestCategory, batched_vector_misc_simd_double3) { test_batched_vector_misc<TestDevice, SIMD<double>, 3>(); }
 TEST_F(TestCategory, batched_vector_misc_simd_double4) { test_batched_vector_misc<TestDevice, SIMD<double>, 4>(); }
+TEST_F(TestCategory, batched_vector_misc_simd_double2) { test_batched_vector_misc<TestDevice, SIMD<double>, 2>(); }
+TEST_F(TestCategory, batched_vector_misc_simd_double8) { test_batched_vector_misc<TestDevice, SIMD<double>, 8>(); }
 #endif
 
 // #if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT)
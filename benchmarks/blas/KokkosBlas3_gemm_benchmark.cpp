@@ -102,13 +102,13 @@ static void KokkosBlas3_GEMM(benchmark::State& state) {
   } else {
     state.counters["Memory Layout in B: LayoutRight"] = 1;
   }
+  state.counters["Scalar: " + Kokkos::ArithTraits<Scalar>::name()] = 1;
 }
 
-template <typename ExecSpace>
-void run(const blas3_gemm_params& params) {
-  using LL     = Kokkos::LayoutLeft;
-  using LR     = Kokkos::LayoutRight;
-  using Scalar = double;
+template <typename ExecSpace, typename Scalar>
+void run_scalar(const blas3_gemm_params& params) {
+  using LL = Kokkos::LayoutLeft;
+  using LR = Kokkos::LayoutRight;
 
   const auto name      = "KokkosBlas3_GEMM";
   const auto arg_names = std::vector<std::string>{"m", "n", "k"};
@@ -124,6 +124,13 @@ void run(const blas3_gemm_params& params) {
                                              params.repeat);
 }
 
+template <typename ExecSpace>
+void run(const blas3_gemm_params& params) {
+  // double and float run different host micro-kernels
+  run_scalar<ExecSpace, double>(params);
+  run_scalar<ExecSpace, float>(params);
+}
+
 int main(int argc, char** argv) {
   const auto params     = blas3_gemm_params::get_params(argc, argv);
   const int num_threads = params.use_openmp;
@@ -0,0 +1,91 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+#include "KokkosKernels_SimpleUtils.hpp"
+
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+namespace {
+
+enum class Scan { ParallelScan, SinglePass, SinglePassFused };
+
+// Exclusive scan of n values. ParallelScan and SinglePass scan an array filled
+// with the values; SinglePassFused computes them in the scan itself, as a
+// count + scan sequence would.
+template <typename Value, Scan scan>
+void run_scan(benchmark::State& state) {
+  using execution_space = Kokkos::DefaultExecutionSpace;
+  using view_type       = Kokkos::View<Value*, execution_space>;
+
+  const size_t n = state.range(0);
+  view_type arr(Kokkos::view_alloc(Kokkos::WithoutInitializing, "arr"), n + 1);
+
+  execution_space exec;
+  for (auto _ : state) {
+    if constexpr (scan != Scan::SinglePassFused) {
+      state.PauseTiming();
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<execution_space>(exec, 0, n), KOKKOS_LAMBDA(const size_t i) { arr(i) = i % 3; });
+      exec.fence();
+      state.ResumeTiming();
+    }
+    if constexpr (scan == Scan::ParallelScan) {
+      Kokkos::parallel_scan("ParallelScan", Kokkos::RangePolicy<execution_space>(exec, 0, n + 1),
+                            KokkosKernels::Impl::ExclusiveParallelPrefixSum<view_type>(arr));
+    } else if constexpr (scan == Scan::SinglePass) {
+      KokkosKernels::Impl::single_pass_exclusive_scan_impl(
+          exec, n + 1, KokkosKernels::Impl::ExclusivePrefixSumCount<view_type>{arr}, arr, false, false);
+    } else {
+      KokkosKernels::Impl::kk_single_pass_exclusive_scan(
+          exec, n, KOKKOS_LAMBDA(const size_t i) { return Value(i % 3); }, arr);
+    }
+    exec.fence();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * sizeof(Value));
+}
+
+}  // namespace
+
+// Arg: number of elements. Sizes up to 1e10 can be requested with
+// --benchmark_filter and a larger range on devices with enough memory.
+#define KOKKOSKERNELS_PREFIX_SUM_BENCHMARK(VALUE, SCAN)     \
+  BENCHMARK_TEMPLATE2(run_scan, VALUE, SCAN)                \
+      ->ArgName("n")                                        \
+      ->RangeMultiplier(10)                                 \
+      ->Range(1000000, 1000000000)                          \
+      ->UseRealTime()                                       \
+      ->Unit(benchmark::kMillisecond);
+
+KOKKOSKERNELS_PREFIX_SUM_BENCHMARK(int64_t, Scan::ParallelScan)
+KOKKOSKERNELS_PREFIX_SUM_BENCHMARK(int64_t, Scan::SinglePass)
+KOKKOSKERNELS_PREFIX_SUM_BENCHMARK(int64_t, Scan::SinglePassFused)
+
+int main(int argc, char** argv) {
+  Kokkos::initialize(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  KokkosKernelsBenchmark::add_benchmark_context(true);
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  benchmark::Shutdown();
+  Kokkos::finalize();
+  return 0;
+}
@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include "KokkosKernels_Sorting.hpp"
+
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+namespace {
+
+enum class Sorter { Radix, Bitonic };
+
+// Sort n random keys (below maxKey) on the device; the keys are refilled
+// outside of the timed region before every iteration.
+template <typename Key, Sorter sorter>
+void run_sort(benchmark::State& state) {
+  using execution_space = Kokkos::DefaultExecutionSpace;
+  using view_type       = Kokkos::View<Key*, execution_space>;
+
+  const size_t n   = state.range(0);
+  const Key maxKey = state.range(1) ? Key(state.range(1)) : Kokkos::ArithTraits<Key>::max();
+  view_type source("source keys", n);
+  view_type keys("keys", n);
+  Kokkos::Random_XorShift64_Pool<execution_space> pool(13718);
+  Kokkos::fill_random(source, pool, maxKey);
+
+  execution_space exec;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Kokkos::deep_copy(exec, keys, source);
+    exec.fence();
+    state.ResumeTiming();
+    if constexpr (sorter == Sorter::Radix)
+      KokkosKernels::radixSort(exec, keys);
+    else
+      KokkosKernels::bitonicSort<view_type, execution_space, size_t>(keys);
+    exec.fence();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * sizeof(Key));
+}
+
+}  // namespace
+
+// Args: number of keys, bound on the keys (0: the whole range of the key type)
+#define KOKKOSKERNELS_SORTING_BENCHMARK(KEY, SORTER)                                      \
+  BENCHMARK_TEMPLATE2(run_sort, KEY, SORTER)                                              \
+      ->ArgNames({"n", "max_key"})                                                        \
+      ->ArgsProduct({benchmark::CreateRange(1 << 16, 1 << 24, 4), {1 << 10, 1 << 20, 0}}) \
+      ->UseRealTime()                                                                     \
+      ->Unit(benchmark::kMillisecond);
+
+KOKKOSKERNELS_SORTING_BENCHMARK(uint32_t, Sorter::Radix)
+KOKKOSKERNELS_SORTING_BENCHMARK(uint32_t, Sorter::Bitonic)
+KOKKOSKERNELS_SORTING_BENCHMARK(uint64_t, Sorter::Radix)
+KOKKOSKERNELS_SORTING_BENCHMARK(uint64_t, Sorter::Bitonic)
+
+int main(int argc, char** argv) {
+  Kokkos::initialize(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  KokkosKernelsBenchmark::add_benchmark_context(true);
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  benchmark::Shutdown();
+  Kokkos::finalize();
+  return 0;
+}
@@ -59,16 +59,19 @@ struct StiffChemistry {
   }
 };
 
-template <class ode_type, class mat_type, class vec_type, class scalar_type>
+template <class ode_type, class mat_type, class vec_type, class count_type, class scalar_type>
 struct BDF_Solve_wrapper {
   const ode_type my_ode;
   const scalar_type t_start, t_end, dt, max_step;
   const vec_type y0, y_new;
   const mat_type temp, temp2;
+  const KokkosODE::Experimental::Jacobian_reuse_params reuse_params;
+  const count_type counts;
 
   BDF_Solve_wrapper(const ode_type& my_ode_, const scalar_type& t_start_, const scalar_type& t_end_,
                     const scalar_type& dt_, const scalar_type& max_step_, const vec_type& y0_, const vec_type& y_new_,
-                    const mat_type& temp_, const mat_type& temp2_)
+                    const mat_type& temp_, const mat_type& temp2_,
+                    const KokkosODE::Experimental::Jacobian_reuse_params& reuse_params_, const count_type& counts_)
       : my_ode(my_ode_),
         t_start(t_start_),
         t_end(t_end_),
@@ -77,7 +80,9 @@ struct BDF_Solve_wrapper {
         y0(y0_),
         y_new(y_new_),
         temp(temp_),
-        temp2(temp2_) {}
+        temp2(temp2_),
+        reuse_params(reuse_params_),
+        counts(counts_) {}
 
   KOKKOS_FUNCTION void operator()(const int idx) const {
     auto subTemp  = Kokkos::subview(temp, Kokkos::ALL(), Kokkos::ALL(), idx);
@@ -85,7 +90,8 @@ struct BDF_Solve_wrapper {
     auto subY0    = Kokkos::subview(y0, Kokkos::ALL(), idx);
     auto subYnew  = Kokkos::subview(y_new, Kokkos::ALL(), idx);
 
-    KokkosODE::Experimental::BDFSolve(my_ode, t_start, t_end, dt, max_step, subY0, subYnew, subTemp, subTemp2);
+    KokkosODE::Experimental::BDFSolve(my_ode, t_start, t_end, dt, max_step, subY0, subYnew, subTemp, subTemp2,
+                                      reuse_params, &counts(0, idx), &counts(1, idx));
   }
 };
 
@@ -95,9 +101,10 @@ struct bdf_input_parameters {
   int num_odes;
   int repeat;
   bool verbose;
+  int jacobian_age;
 
-  bdf_input_parameters(const int num_odes_, const int repeat_, const bool verbose_)
-      : num_odes(num_odes_), repeat(repeat_), verbose(verbose_){};
+  bdf_input_parameters(const int num_odes_, const int repeat_, const bool verbose_, const int jacobian_age_)
+      : num_odes(num_odes_), repeat(repeat_), verbose(verbose_), jacobian_age(jacobian_age_){};
 };
 
 template <class execution_space>
@@ -106,6 +113,7 @@ void run_ode_chem(benchmark::State& state, const bdf_input_parameters& inputs) {
   using KAT         = Kokkos::ArithTraits<scalar_type>;
   using vec_type    = Kokkos::View<scalar_type**, execution_space>;
   using mat_type    = Kokkos::View<scalar_type***, execution_space>;
+  using count_type  = Kokkos::View<int**, execution_space>;
 
   StiffChemistry mySys{};
 
@@ -127,6 +135,10 @@ void run_ode_chem(benchmark::State& state, const bdf_input_parameters& inputs) {
   }
 
   mat_type temp("buffer1", neqs, 23 + 2 * neqs + 4, num_odes), temp2("buffer2", 6, 7, num_odes);
+  count_type counts("Jacobian evaluations and factorizations", 2, num_odes);
+
+  KokkosODE::Experimental::Jacobian_reuse_params reuse_params{};
+  reuse_params.max_age = inputs.jacobian_age;
 
   if (verbose) {
     std::cout << "Number of problems solved in parallel: " << num_odes << std::endl;
@@ -146,7 +158,8 @@ void run_ode_chem(benchmark::State& state, const bdf_input_parameters& inputs) {
     Kokkos::deep_copy(y_new, KAT::zero());
     Kokkos::deep_copy(temp, KAT::zero());
     Kokkos::deep_copy(temp2, KAT::zero());
-    BDF_Solve_wrapper bdf_wrapper(mySys, t_start, t_end, dt, (t_end - t_start) / 10, y0, y_new, temp, temp2);
+    BDF_Solve_wrapper bdf_wrapper(mySys, t_start, t_end, dt, (t_end - t_start) / 10, y0, y_new, temp, temp2,
+                                  reuse_params, counts);
     state.ResumeTiming();
 
     // Actually run the time integrator
@@ -156,6 +169,18 @@ void run_ode_chem(benchmark::State& state, const bdf_input_parameters& inputs) {
   double run_time = time.seconds();
   std::cout << "Run time: " << run_time << std::endl;
 
+  // Average number of Jacobian evaluations
+  // and factorizations per ode.
+  auto counts_h            = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  double jacobian_evals    = 0;
+  double num_factorization = 0;
+  for (int odeIdx = 0; odeIdx < num_odes; ++odeIdx) {
+    jacobian_evals += counts_h(0, odeIdx);
+    num_factorization += counts_h(1, odeIdx);
+  }
+  state.counters["jacobian_evals"] = jacobian_evals / num_odes;
+  state.counters["factorizations"] = num_factorization / num_odes;
+
   Kokkos::deep_copy(y0_h, y0);
   double error;
   for (int odeIdx = 0; odeIdx < num_odes; ++odeIdx) {
@@ -182,6 +207,8 @@ void print_options() {
   std::cerr << "\t[Optional] --repeat      :: how many times to repeat overall test" << std::endl;
   std::cerr << "\t[Optional] --verbose     :: enable verbose output" << std::endl;
   std::cerr << "\t[Optional] --n           :: number of ode problems to solve" << std::endl;
+  std::cerr << "\t[Optional] --jacobian_age :: number of steps a Jacobian is reused for, 0 disables reuse"
+            << std::endl;
 }  // print_options
 
 int parse_inputs(bdf_input_parameters& params, int argc, char** argv) {
@@ -190,6 +217,8 @@ int parse_inputs(bdf_input_parameters& params, int argc, char** argv) {
       ++i;
     } else if (benchmark::check_arg_int(i, argc, argv, "--repeat", params.repeat)) {
       ++i;
+    } else if (benchmark::check_arg_int(i, argc, argv, "--jacobian_age", params.jacobian_age)) {
+      ++i;
     } else if (benchmark::check_arg_bool(i, argc, argv, "--verbose", params.verbose)) {
     } else {
       std::cerr << "Unrecognized command line argument #" << i << ": " << argv[i] << std::endl;
@@ -216,20 +245,20 @@ int main(int argc, char** argv) {
     benchmark::parse_common_options(argc, argv, common_params);
 
     std::string bench_name = "KokkosODE_BDF_Stiff_Chem";
-    bdf_input_parameters params(1000, 1, false);
+    bdf_input_parameters params(1000, 1, false, KokkosODE::Experimental::Jacobian_reuse_params{}.max_age);
     parse_inputs(params, argc, argv);
 
     if (0 < common_params.repeat) {
       benchmark::RegisterBenchmark(bench_name.c_str(), run_benchmark_wrapper<Kokkos::DefaultExecutionSpace>, params)
           ->UseRealTime()
-          ->ArgNames({"n"})
-          ->Args({params.num_odes})
+          ->ArgNames({"n", "jacobian_age"})
+          ->Args({params.num_odes, params.jacobian_age})
           ->Iterations(common_params.repeat);
     } else {
       benchmark::RegisterBenchmark(bench_name.c_str(), run_benchmark_wrapper<Kokkos::DefaultExecutionSpace>, params)
           ->UseRealTime()
-          ->ArgNames({"n"})
-          ->Args({params.num_odes});
+          ->ArgNames({"n", "jacobian_age"})
+          ->Args({params.num_odes, params.jacobian_age});
     }
 
     benchmark::RunSpecifiedBenchmarks();
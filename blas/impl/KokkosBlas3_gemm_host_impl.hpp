@@ -0,0 +1,444 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_GEMM_HOST_IMPL_HPP_
+#define KOKKOSBLAS3_GEMM_HOST_IMPL_HPP_
+
+/// \file KokkosBlas3_gemm_host_impl.hpp
+/// \brief Native gemm for host execution spaces, in the style of BLIS:
+/// blocks of op(A) and op(B) are packed into panels sized for the caches,
+/// and C is computed by a register-blocked micro-kernel, explicitly
+/// vectorized for AVX2, AVX-512 and NEON.
+
+#include <mutex>
+#include <Kokkos_Core.hpp>
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Singleton.hpp"
+
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && !defined(__SYCL_DEVICE_ONLY__)
+#if defined(__AVX512F__)
+#define KOKKOSBLAS_IMPL_HOST_GEMM_AVX512
+#include <immintrin.h>
+#elif defined(__AVX2__) && defined(__FMA__)
+#define KOKKOSBLAS_IMPL_HOST_GEMM_AVX2
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define KOKKOSBLAS_IMPL_HOST_GEMM_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Register tile (mr x nr) of the micro-kernel, and cache blocks: a packed
+// mc x kc block of op(A) stays in L2, and a kc x nr panel of the packed
+// kc x nc block of op(B) stays in L1.
+template <class Scalar>
+struct HostGemmBlocking {
+  static constexpr int mr = 4;
+  static constexpr int nr = 4;
+  static constexpr int kc = 256;
+  static constexpr int mc = 16 * mr;
+  static constexpr int nc = 512 * nr;
+};
+
+template <>
+struct HostGemmBlocking<double> {
+#if defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX512)
+  static constexpr int mr = 16;
+  static constexpr int nr = 8;
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX2)
+  static constexpr int mr = 8;
+  static constexpr int nr = 6;
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_NEON)
+  static constexpr int mr = 8;
+  static constexpr int nr = 4;
+#else
+  static constexpr int mr = 4;
+  static constexpr int nr = 4;
+#endif
+  static constexpr int kc = 256;
+  static constexpr int mc = 12 * mr;
+  static constexpr int nc = 512 * nr;
+};
+
+template <>
+struct HostGemmBlocking<float> {
+#if defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX512)
+  static constexpr int mr = 32;
+  static constexpr int nr = 8;
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX2)
+  static constexpr int mr = 16;
+  static constexpr int nr = 6;
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_NEON)
+  static constexpr int mr = 16;
+  static constexpr int nr = 4;
+#else
+  static constexpr int mr = 8;
+  static constexpr int nr = 4;
+#endif
+  static constexpr int kc = 384;
+  static constexpr int mc = 12 * mr;
+  static constexpr int nc = 512 * nr;
+};
+
+// ab = Ap * Bp, where Ap is a packed kc x mr panel of op(A) (mr entries per
+// k), Bp a packed kc x nr panel of op(B) (nr entries per k), and ab is
+// mr x nr, column-major.
+template <class Scalar, int mr, int nr>
+KOKKOS_INLINE_FUNCTION void host_gemm_micro_kernel_generic(const int kc, const Scalar* Ap, const Scalar* Bp,
+                                                           Scalar* ab) {
+  for (int i = 0; i < mr * nr; ++i) ab[i] = Kokkos::ArithTraits<Scalar>::zero();
+  for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+    for (int j = 0; j < nr; ++j) {
+      const Scalar b = Bp[j];
+      for (int i = 0; i < mr; ++i) ab[j * mr + i] += Ap[i] * b;
+    }
+  }
+}
+
+template <class Scalar>
+struct HostGemmMicroKernel {
+  static constexpr int mr = HostGemmBlocking<Scalar>::mr;
+  static constexpr int nr = HostGemmBlocking<Scalar>::nr;
+
+  KOKKOS_INLINE_FUNCTION static void compute(const int kc, const Scalar* Ap, const Scalar* Bp, Scalar* ab) {
+    host_gemm_micro_kernel_generic<Scalar, mr, nr>(kc, Ap, Bp, ab);
+  }
+};
+
+// The micro-kernels below keep the mr x nr tile of C in vector registers:
+// each step of k loads mr entries of A and broadcasts the nr entries of B.
+template <>
+struct HostGemmMicroKernel<double> {
+  static constexpr int mr = HostGemmBlocking<double>::mr;
+  static constexpr int nr = HostGemmBlocking<double>::nr;
+
+  KOKKOS_INLINE_FUNCTION static void compute(const int kc, const double* Ap, const double* Bp, double* ab) {
+#if defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX512)
+    __m512d c0[nr], c1[nr];
+    for (int j = 0; j < nr; ++j) c0[j] = c1[j] = _mm512_setzero_pd();
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      const __m512d a0 = _mm512_loadu_pd(Ap), a1 = _mm512_loadu_pd(Ap + 8);
+      for (int j = 0; j < nr; ++j) {
+        const __m512d b = _mm512_set1_pd(Bp[j]);
+        c0[j]           = _mm512_fmadd_pd(a0, b, c0[j]);
+        c1[j]           = _mm512_fmadd_pd(a1, b, c1[j]);
+      }
+    }
+    for (int j = 0; j < nr; ++j) {
+      _mm512_storeu_pd(ab + j * mr, c0[j]);
+      _mm512_storeu_pd(ab + j * mr + 8, c1[j]);
+    }
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX2)
+    __m256d c0[nr], c1[nr];
+    for (int j = 0; j < nr; ++j) c0[j] = c1[j] = _mm256_setzero_pd();
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      const __m256d a0 = _mm256_loadu_pd(Ap), a1 = _mm256_loadu_pd(Ap + 4);
+      for (int j = 0; j < nr; ++j) {
+        const __m256d b = _mm256_broadcast_sd(Bp + j);
+        c0[j]           = _mm256_fmadd_pd(a0, b, c0[j]);
+        c1[j]           = _mm256_fmadd_pd(a1, b, c1[j]);
+      }
+    }
+    for (int j = 0; j < nr; ++j) {
+      _mm256_storeu_pd(ab + j * mr, c0[j]);
+      _mm256_storeu_pd(ab + j * mr + 4, c1[j]);
+    }
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_NEON)
+    float64x2_t c[4][nr];
+    for (int r = 0; r < 4; ++r)
+      for (int j = 0; j < nr; ++j) c[r][j] = vdupq_n_f64(0.0);
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      float64x2_t a[4];
+      for (int r = 0; r < 4; ++r) a[r] = vld1q_f64(Ap + 2 * r);
+      for (int j = 0; j < nr; ++j)
+        for (int r = 0; r < 4; ++r) c[r][j] = vfmaq_n_f64(c[r][j], a[r], Bp[j]);
+    }
+    for (int j = 0; j < nr; ++j)
+      for (int r = 0; r < 4; ++r) vst1q_f64(ab + j * mr + 2 * r, c[r][j]);
+#else
+    host_gemm_micro_kernel_generic<double, mr, nr>(kc, Ap, Bp, ab);
+#endif
+  }
+};
+
+template <>
+struct HostGemmMicroKernel<float> {
+  static constexpr int mr = HostGemmBlocking<float>::mr;
+  static constexpr int nr = HostGemmBlocking<float>::nr;
+
+  KOKKOS_INLINE_FUNCTION static void compute(const int kc, const float* Ap, const float* Bp, float* ab) {
+#if defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX512)
+    __m512 c0[nr], c1[nr];
+    for (int j = 0; j < nr; ++j) c0[j] = c1[j] = _mm512_setzero_ps();
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      const __m512 a0 = _mm512_loadu_ps(Ap), a1 = _mm512_loadu_ps(Ap + 16);
+      for (int j = 0; j < nr; ++j) {
+        const __m512 b = _mm512_set1_ps(Bp[j]);
+        c0[j]          = _mm512_fmadd_ps(a0, b, c0[j]);
+        c1[j]          = _mm512_fmadd_ps(a1, b, c1[j]);
+      }
+    }
+    for (int j = 0; j < nr; ++j) {
+      _mm512_storeu_ps(ab + j * mr, c0[j]);
+      _mm512_storeu_ps(ab + j * mr + 16, c1[j]);
+    }
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_AVX2)
+    __m256 c0[nr], c1[nr];
+    for (int j = 0; j < nr; ++j) c0[j] = c1[j] = _mm256_setzero_ps();
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      const __m256 a0 = _mm256_loadu_ps(Ap), a1 = _mm256_loadu_ps(Ap + 8);
+      for (int j = 0; j < nr; ++j) {
+        const __m256 b = _mm256_broadcast_ss(Bp + j);
+        c0[j]          = _mm256_fmadd_ps(a0, b, c0[j]);
+        c1[j]          = _mm256_fmadd_ps(a1, b, c1[j]);
+      }
+    }
+    for (int j = 0; j < nr; ++j) {
+      _mm256_storeu_ps(ab + j * mr, c0[j]);
+      _mm256_storeu_ps(ab + j * mr + 8, c1[j]);
+    }
+#elif defined(KOKKOSBLAS_IMPL_HOST_GEMM_NEON)
+    float32x4_t c[4][nr];
+    for (int r = 0; r < 4; ++r)
+      for (int j = 0; j < nr; ++j) c[r][j] = vdupq_n_f32(0.0f);
+    for (int p = 0; p < kc; ++p, Ap += mr, Bp += nr) {
+      float32x4_t a[4];
+      for (int r = 0; r < 4; ++r) a[r] = vld1q_f32(Ap + 4 * r);
+      for (int j = 0; j < nr; ++j)
+        for (int r = 0; r < 4; ++r) c[r][j] = vfmaq_n_f32(c[r][j], a[r], Bp[j]);
+    }
+    for (int j = 0; j < nr; ++j)
+      for (int r = 0; r < 4; ++r) vst1q_f32(ab + j * mr + 4 * r, c[r][j]);
+#else
+    host_gemm_micro_kernel_generic<float, mr, nr>(kc, Ap, Bp, ab);
+#endif
+  }
+};
+
+// Buffer for the packed blocks of op(B), kept between calls so that
+// repeated gemms do not allocate it each time. It only grows, and is freed
+// by Kokkos::finalize. A call holds the mutex while it uses the buffer.
+template <class Scalar, class MemorySpace>
+struct HostGemmPackedBuffer {
+  Kokkos::View<Scalar*, MemorySpace> view;
+  std::mutex mutex;
+
+  static HostGemmPackedBuffer& get_instance() {
+    static KokkosKernels::Impl::Singleton<HostGemmPackedBuffer> s;
+    static std::mutex init_mutex;
+    std::lock_guard<std::mutex> lock(init_mutex);
+    return s.get();
+  }
+};
+
+// C = beta*C + alpha*op(A)*op(B) on a host execution space.
+//
+// For each kc x nc block of op(B), the block is packed into panels of nr
+// columns (in parallel over the panels), then the teams of the compute
+// kernel each pack one mc x kc block of op(A) into panels of mr rows in
+// their scratch memory, and multiply it by their share of the panels of B.
+// Threads are spread over the blocks of rows of C (ic loop) first, and over
+// the panels of columns (jc loop) when there are fewer blocks of rows than
+// threads. Packing zero-pads the edges, so the micro-kernel always computes
+// a full mr x nr tile, of which only the part inside of C is written.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType, int TransposeA, int TransposeB>
+struct HostGemm {
+  typedef typename CViewType::non_const_value_type scalar_type;
+  typedef Kokkos::ArithTraits<scalar_type> ATS;
+  typedef HostGemmBlocking<scalar_type> blocking;
+  typedef HostGemmMicroKernel<scalar_type> micro_kernel;
+  typedef Kokkos::View<scalar_type*, typename ExecSpace::memory_space> packed_view_type;
+  typedef HostGemmPackedBuffer<scalar_type, typename ExecSpace::memory_space> packed_buffer_type;
+  typedef Kokkos::View<scalar_type*, typename ExecSpace::scratch_memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      scratch_view_type;
+  typedef typename Kokkos::TeamPolicy<ExecSpace>::member_type member_type;
+
+  static constexpr int mr = blocking::mr;
+  static constexpr int nr = blocking::nr;
+  static constexpr int mc = blocking::mc;
+  static constexpr int kc = blocking::kc;
+  static constexpr int nc = blocking::nc;
+
+  struct PackBTag {};
+  struct ComputeTag {};
+
+  scalar_type alpha, beta;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+  packed_view_type Bp;
+  int M, N, K;
+
+  // Current block of op(B), set by run() before each launch
+  int jc, nc_cur, pc, kc_cur, num_j_groups;
+  scalar_type beta_cur;
+
+  HostGemm(const scalar_type& alpha_, const AViewType& A_, const BViewType& B_, const scalar_type& beta_,
+           const CViewType& C_)
+      : alpha(alpha_), beta(beta_), A(A_), B(B_), C(C_) {
+    M = C.extent_int(0);
+    N = C.extent_int(1);
+    K = TransposeA == 0 ? A.extent_int(1) : A.extent_int(0);
+  }
+
+  KOKKOS_INLINE_FUNCTION scalar_type opA(const int i, const int p) const {
+    if constexpr (TransposeA == 0)
+      return A(i, p);
+    else if constexpr (TransposeA == 1)
+      return A(p, i);
+    else
+      return ATS::conj(A(p, i));
+  }
+
+  KOKKOS_INLINE_FUNCTION scalar_type opB(const int p, const int j) const {
+    if constexpr (TransposeB == 0)
+      return B(p, j);
+    else if constexpr (TransposeB == 1)
+      return B(j, p);
+    else
+      return ATS::conj(B(j, p));
+  }
+
+  // Packs the panel-th panel of nr columns of the current block of op(B)
+  KOKKOS_INLINE_FUNCTION void operator()(const PackBTag&, const int panel) const {
+    scalar_type* dst = Bp.data() + panel * nr * kc_cur;
+    const int j0     = jc + panel * nr;
+    const int n      = Kokkos::min(nr, N - j0);
+    for (int p = 0; p < kc_cur; ++p) {
+      for (int j = 0; j < nr; ++j) dst[p * nr + j] = j < n ? opB(pc + p, j0 + j) : ATS::zero();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ComputeTag&, const member_type& team) const {
+    const int ic     = (team.league_rank() / num_j_groups) * mc;
+    const int group  = team.league_rank() % num_j_groups;
+    const int mc_cur = Kokkos::min(mc, M - ic);
+
+    // Pack the block of op(A) into panels of mr rows
+    scratch_view_type Ap(team.team_scratch(1), mc * kc);
+    const int num_i_panels = (mc_cur + mr - 1) / mr;
+    for (int ip = 0; ip < num_i_panels; ++ip) {
+      scalar_type* dst = Ap.data() + ip * mr * kc_cur;
+      const int i0     = ic + ip * mr;
+      const int m      = Kokkos::min(mr, M - i0);
+      for (int p = 0; p < kc_cur; ++p) {
+        for (int i = 0; i < mr; ++i) dst[p * mr + i] = i < m ? opA(i0 + i, pc + p) : ATS::zero();
+      }
+    }
+
+    // Multiply it by this team's share of the panels of B
+    const int num_j_panels = (nc_cur + nr - 1) / nr;
+    const int jp_begin     = (num_j_panels * group) / num_j_groups;
+    const int jp_end       = (num_j_panels * (group + 1)) / num_j_groups;
+    scalar_type ab[mr * nr];
+    for (int jp = jp_begin; jp < jp_end; ++jp) {
+      const int j0 = jc + jp * nr;
+      const int n  = Kokkos::min(nr, N - j0);
+      for (int ip = 0; ip < num_i_panels; ++ip) {
+        const int i0 = ic + ip * mr;
+        const int m  = Kokkos::min(mr, M - i0);
+        micro_kernel::compute(kc_cur, Ap.data() + ip * mr * kc_cur, Bp.data() + jp * nr * kc_cur, ab);
+        if (beta_cur == ATS::zero()) {
+          for (int j = 0; j < n; ++j)
+            for (int i = 0; i < m; ++i) C(i0 + i, j0 + j) = alpha * ab[j * mr + i];
+        } else {
+          for (int j = 0; j < n; ++j)
+            for (int i = 0; i < m; ++i) C(i0 + i, j0 + j) = beta_cur * C(i0 + i, j0 + j) + alpha * ab[j * mr + i];
+        }
+      }
+    }
+  }
+
+  void run(const ExecSpace& space) {
+    if (M == 0 || N == 0 || K == 0) return;
+    const int concurrency  = space.concurrency();
+    const int num_i_blocks = (M + mc - 1) / mc;
+    const size_t packed_size = size_t(kc) * ((Kokkos::min(nc, N) + nr - 1) / nr) * nr;
+
+    // Reuse the cached buffer for op(B), unless a concurrent gemm holds it
+    packed_buffer_type& buffer = packed_buffer_type::get_instance();
+    std::unique_lock<std::mutex> lock(buffer.mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+      if (buffer.view.extent(0) < packed_size)
+        buffer.view = packed_view_type(
+            Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "KokkosBlas::gemm packed B"), packed_size);
+      Bp = buffer.view;
+    } else {
+      Bp = packed_view_type(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "KokkosBlas::gemm packed B"),
+                            packed_size);
+    }
+    const int scratch_size = scratch_view_type::shmem_size(mc * kc);
+    for (jc = 0; jc < N; jc += nc) {
+      nc_cur                 = Kokkos::min(nc, N - jc);
+      const int num_j_panels = (nc_cur + nr - 1) / nr;
+      num_j_groups = Kokkos::max(1, Kokkos::min(num_j_panels, (concurrency + num_i_blocks - 1) / num_i_blocks));
+      for (pc = 0; pc < K; pc += kc) {
+        kc_cur   = Kokkos::min(kc, K - pc);
+        beta_cur = pc == 0 ? beta : ATS::one();
+        Kokkos::parallel_for("KokkosBlas::gemm[HostPackB]",
+                             Kokkos::RangePolicy<ExecSpace, PackBTag>(space, 0, num_j_panels), *this);
+        Kokkos::parallel_for("KokkosBlas::gemm[HostCompute]",
+                             Kokkos::TeamPolicy<ExecSpace, ComputeTag>(space, num_i_blocks * num_j_groups, 1)
+                                 .set_scratch_size(1, Kokkos::PerTeam(scratch_size)),
+                             *this);
+      }
+    }
+    // The next call may reuse the buffer as soon as the lock is released
+    if (lock.owns_lock()) space.fence("KokkosBlas::gemm: release packed B");
+    Bp = packed_view_type();
+  }
+};
+
+template <class ExecSpace, class AViewType, class BViewType, class CViewType, int TransposeA, int TransposeB>
+void HostGemm_Run(const ExecSpace& space, typename CViewType::const_value_type& alpha, const AViewType& A,
+                  const BViewType& B, typename CViewType::const_value_type& beta, const CViewType& C) {
+  HostGemm<ExecSpace, AViewType, BViewType, CViewType, TransposeA, TransposeB> gemm(alpha, A, B, beta, C);
+  gemm.run(space);
+}
+
+template <class ExecSpace, class AViewType, class BViewType, class CViewType, int TransposeA>
+void HostGemm_DispatchB(const ExecSpace& space, const char transB[], typename CViewType::const_value_type& alpha,
+                        const AViewType& A, const BViewType& B, typename CViewType::const_value_type& beta,
+                        const CViewType& C) {
+  if (transB[0] == 'N' || transB[0] == 'n')
+    HostGemm_Run<ExecSpace, AViewType, BViewType, CViewType, TransposeA, 0>(space, alpha, A, B, beta, C);
+  else if (transB[0] == 'T' || transB[0] == 't')
+    HostGemm_Run<ExecSpace, AViewType, BViewType, CViewType, TransposeA, 1>(space, alpha, A, B, beta, C);
+  else
+    HostGemm_Run<ExecSpace, AViewType, BViewType, CViewType, TransposeA, 2>(space, alpha, A, B, beta, C);
+}
+
+// C = beta*C + alpha*op(A)*op(B) with HostGemm. A, B and C must have the
+// same value type.
+template <class ExecSpace, class AViewType, class BViewType, class CViewType>
+void HostGemm_Invoke(const ExecSpace& space, const char transA[], const char transB[],
+                     typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,
+                     typename CViewType::const_value_type& beta, const CViewType& C) {
+  if (transA[0] == 'N' || transA[0] == 'n')
+    HostGemm_DispatchB<ExecSpace, AViewType, BViewType, CViewType, 0>(space, transB, alpha, A, B, beta, C);
+  else if (transA[0] == 'T' || transA[0] == 't')
+    HostGemm_DispatchB<ExecSpace, AViewType, BViewType, CViewType, 1>(space, transB, alpha, A, B, beta, C);
+  else
+    HostGemm_DispatchB<ExecSpace, AViewType, BViewType, CViewType, 2>(space, transB, alpha, A, B, beta, C);
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_GEMM_HOST_IMPL_HPP_
@@ -19,6 +19,7 @@
 
 #include <Kokkos_Core.hpp>
 #include "KokkosKernels_Macros.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
 
 #ifdef KOKKOS_ENABLE_CXX14
 #ifdef KOKKOS_COMPILER_GNU
@@ -373,6 +374,49 @@ struct impl_update_matrix_block<TeamHandle, ViewType, ViewTypeScratch, Kokkos::L
   }
 };
 
+// Same as impl_update_matrix_block, but only the entries of the upper
+// (Upper = true) or lower triangle of A are written. Used for the blocks of
+// C crossing the diagonal when only one triangle is computed.
+template <class TeamHandle, class ViewType, class ViewTypeScratch, int blockDim_i, int blockDim_j, bool Upper>
+struct impl_update_matrix_triangle_block {
+  typedef typename ViewType::non_const_value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ATV;
+
+  KOKKOS_INLINE_FUNCTION
+  static void update(const TeamHandle& team, const value_type& beta, const ViewType& A, const value_type& alpha,
+                     const ViewTypeScratch& A_scr, const int& offset_i, const int& offset_j) {
+    const int range_i = offset_i + blockDim_i <= A.extent_int(0) ? blockDim_i : A.extent_int(0) % blockDim_i;
+    const int range_j = offset_j + blockDim_j <= A.extent_int(1) ? blockDim_j : A.extent_int(1) % blockDim_j;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, range_i), [&](const int i) {
+      const int idx_i = offset_i + i;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, range_j), [&](const int j) {
+        const int idx_j = offset_j + j;
+        if (Upper ? idx_i > idx_j : idx_i < idx_j) return;
+        if (beta == ATV::zero())
+          A(idx_i, idx_j) = alpha * A_scr(i, j);
+        else
+          A(idx_i, idx_j) = beta * A(idx_i, idx_j) + alpha * A_scr(i, j);
+      });
+    });
+  }
+};
+
+// Read-only view of a symmetric matrix of which only the upper (Upper = true)
+// or lower triangle is stored, so that it can be passed to GEMMImpl as A or B.
+template <class ViewType, bool Upper>
+struct impl_symmetric_matrix {
+  typedef typename ViewType::non_const_value_type non_const_value_type;
+  typedef typename ViewType::array_layout array_layout;
+
+  ViewType A;
+
+  KOKKOS_INLINE_FUNCTION int extent_int(const int r) const { return A.extent_int(r); }
+
+  KOKKOS_INLINE_FUNCTION non_const_value_type operator()(const int i, const int j) const {
+    return (Upper ? i <= j : i >= j) ? A(i, j) : A(j, i);
+  }
+};
+
 // Compute a single A block 8 B block, also do an in-place no-additional
 // blocking team GEMM
 template <class TeamHandle, class ViewTypeA, class ViewTypeB, class ViewTypeC>
@@ -461,8 +505,61 @@ struct impl_gemm_label<2, 2> {
   static constexpr const char* label = "KokkosBlas::gemm[CC]";
 };
 
+// Block sizes and launch parameters of GEMMImpl, shared by gemm and the
+// other level 3 kernels built on GEMMImpl
+template <class ExecSpace, class ScalarA, class ScalarB, class ScalarC>
+struct impl_gemm_tiling {
+  static constexpr int blockA0 = 24;
+  static constexpr int blockB1 = 64;
+  static constexpr int blockA1 =
+      (sizeof(ScalarA) * blockA0 * 16 + sizeof(ScalarB) * 16 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 < 24000)
+          ? 16
+      : (sizeof(ScalarA) * blockA0 * 8 + sizeof(ScalarB) * 8 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 < 24000)
+          ? 8
+      : (sizeof(ScalarA) * blockA0 * 4 + sizeof(ScalarB) * 4 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 < 24000)
+          ? 4
+          : 16;
+
+  static int vector_length() {
+    int vector_length     = blockB1 / 4;
+    int max_vector_length = KokkosKernels::Impl::kk_get_max_vector_size<ExecSpace>();
+    if (vector_length > max_vector_length) vector_length = max_vector_length;
+    return vector_length;
+  }
+
+  static int team_size() {
+    int team_size = 1;
+#if defined(KOKKOS_ENABLE_CUDA)
+    if (std::is_same<ExecSpace, Kokkos::Cuda>::value) team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+    if (std::is_same<ExecSpace, Kokkos::HIP>::value) team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_ROCM)
+    if (std::is_same<ExecSpace, Kokkos::ROCm>::value) team_size = blockA0;
+#endif
+#if defined(KOKKOS_ENABLE_SYCL)
+    if (std::is_same<ExecSpace, Kokkos::Experimental::SYCL>::value) team_size = blockA0;
+#endif
+    return team_size;
+  }
+
+  // GEMMImplType is a GEMMImpl with these block sizes
+  template <class GEMMImplType>
+  static int scratch_level() {
+    const int scratch_memory_size = GEMMImplType::ViewTypeAScratch::required_allocation_size() +
+                                    GEMMImplType::ViewTypeBScratch::required_allocation_size() +
+                                    GEMMImplType::ViewTypeCScratch::required_allocation_size();
+    return scratch_memory_size < 24000 ? 0 : 1;
+  }
+};
+
+// C = beta*C + alpha*op(A)*op(B), one team per blockA0 x blockB1 block of C.
+// With TriangleC = 1 (resp. 2), only the upper (resp. lower) triangle of C
+// is computed and written: the blocks entirely in the other triangle are
+// skipped, which halves the work when C is square.
 template <class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC, int blockA0, int blockA1, int blockB1,
-          int TransposeA, int TransposeB>
+          int TransposeA, int TransposeB, int TriangleC = 0>
 struct GEMMImpl {
   ViewTypeA A;
   ViewTypeB B;
@@ -494,7 +591,8 @@ struct GEMMImpl {
     beta          = beta_;
   }
 
-  void run(const ExecSpace& space, int team_size, int vector_length, int scr_level) {
+  void run(const ExecSpace& space, int team_size, int vector_length, int scr_level,
+           const char* label = impl_gemm_label<TransposeA, TransposeB>::label) {
     scratch_level = scr_level;
     int scratch_memory_size =
         ViewTypeAScratch::shmem_size() + ViewTypeBScratch::shmem_size() + ViewTypeCScratch::shmem_size();
@@ -513,8 +611,7 @@ struct GEMMImpl {
                                                                        vector_length);
 #endif
 
-    Kokkos::parallel_for(impl_gemm_label<TransposeA, TransposeB>::label,
-                         policy.set_scratch_size(scratch_level, Kokkos::PerTeam(scratch_memory_size)), *this);
+    Kokkos::parallel_for(label, policy.set_scratch_size(scratch_level, Kokkos::PerTeam(scratch_memory_size)), *this);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -524,6 +621,9 @@ struct GEMMImpl {
     const int num_blocks  = num_blocks_1;
     const int i_offset    = (league_rank / num_blocks) * blockA0;
     const int j_offset    = (league_rank % num_blocks) * blockB1;
+    // Skip the blocks outside of the triangle, they are not written
+    if (TriangleC == 1 && i_offset > j_offset + blockB1 - 1) return;
+    if (TriangleC == 2 && i_offset + blockA0 - 1 < j_offset) return;
 
     ViewTypeAScratch A_scr(team.team_scratch(scratch_level));
     ViewTypeBScratch B_scr(team.team_scratch(scratch_level));
@@ -560,9 +660,18 @@ struct GEMMImpl {
       team.team_barrier();
     }
     // Write back the C block from scratch to main memory
-    impl_update_matrix_block<typename Kokkos::TeamPolicy<ExecSpace>::member_type, ViewTypeC, ViewTypeCScratch,
-                             typename ViewTypeC::array_layout, blockA0, blockB1>::update(team, beta, C, alpha, C_scr,
-                                                                                         i_offset, j_offset);
+    const bool crossesDiagonal = TriangleC == 1   ? i_offset + blockA0 - 1 > j_offset
+                                 : TriangleC == 2 ? i_offset < j_offset + blockB1 - 1
+                                                  : false;
+    if (crossesDiagonal) {
+      impl_update_matrix_triangle_block<typename Kokkos::TeamPolicy<ExecSpace>::member_type, ViewTypeC,
+                                        ViewTypeCScratch, blockA0, blockB1,
+                                        TriangleC == 1>::update(team, beta, C, alpha, C_scr, i_offset, j_offset);
+    } else {
+      impl_update_matrix_block<typename Kokkos::TeamPolicy<ExecSpace>::member_type, ViewTypeC, ViewTypeCScratch,
+                               typename ViewTypeC::array_layout, blockA0, blockB1>::update(team, beta, C, alpha,
+                                                                                           C_scr, i_offset, j_offset);
+    }
   }
 };
 
@@ -23,6 +23,7 @@
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include "KokkosBlas3_gemm_impl.hpp"
 #include "KokkosBlas3_gemm_dotbased_impl.hpp"
+#include "KokkosBlas3_gemm_host_impl.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
 #endif
 
@@ -109,6 +110,18 @@ struct GEMM {
     const bool A_is_tr         = ((transA[0] == 'T') || (transA[0] == 't') || (transA[0] == 'C') || (transA[0] == 'c'));
     const bool B_is_tr         = ((transB[0] == 'T') || (transB[0] == 't') || (transB[0] == 'C') || (transB[0] == 'c'));
 
+    // On host execution spaces, use the packed, register-blocked kernel when
+    // A, B and C have the same scalar type
+    if constexpr (!KokkosKernels::Impl::is_gpu_exec_space_v<execution_space> && std::is_same_v<ScalarA, ScalarC> &&
+                  std::is_same_v<ScalarB, ScalarC>) {
+      const int K = static_cast<int>(A_is_tr ? A.extent(0) : A.extent(1));
+      if (K > 0) {
+        HostGemm_Invoke(space, transA, transB, alpha, A, B, beta, C);
+        Kokkos::Profiling::popRegion();
+        return;
+      }
+    }
+
     // NOTE: these thresholds were copied from TPL CUBLAS, and may need to be
     // retuned
     constexpr int numDotsLayoutLeftThreshold  = 1600;
@@ -124,46 +137,20 @@ struct GEMM {
 
     } else {
       // Define Blocking sizes (this will be used for scratch spaces)
-      static constexpr int blockA0 = 24;
-      static constexpr int blockB1 = 64;
-      static constexpr int blockA1 =
-          (sizeof(ScalarA) * blockA0 * 16 + sizeof(ScalarB) * 16 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 <
-           24000)
-              ? 16
-          : (sizeof(ScalarA) * blockA0 * 8 + sizeof(ScalarB) * 8 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 <
-             24000)
-              ? 8
-          : (sizeof(ScalarA) * blockA0 * 4 + sizeof(ScalarB) * 4 * blockB1 + sizeof(ScalarC) * blockA0 * blockB1 <
-             24000)
-              ? 4
-              : 16;
-      int vector_length     = blockB1 / 4;
-      int max_vector_length = KokkosKernels::Impl::kk_get_max_vector_size<execution_space>();
-      if (vector_length > max_vector_length) vector_length = max_vector_length;
+      typedef KokkosBlas::Impl::impl_gemm_tiling<execution_space, ScalarA, ScalarB, ScalarC> tiling;
+      static constexpr int blockA0 = tiling::blockA0;
+      static constexpr int blockB1 = tiling::blockB1;
+      static constexpr int blockA1 = tiling::blockA1;
+      const int vector_length      = tiling::vector_length();
 
       // Compute scratch space size
       typedef KokkosBlas::Impl::GEMMImpl<execution_space, AViewType, BViewType, CViewType, blockA0, blockA1, blockB1, 0,
                                          0>
           gemm_dummy_type;
-      const int scratch_memory_size = gemm_dummy_type::ViewTypeAScratch::required_allocation_size() +
-                                      gemm_dummy_type::ViewTypeBScratch::required_allocation_size() +
-                                      gemm_dummy_type::ViewTypeCScratch::required_allocation_size();
-      const int scratch_level = scratch_memory_size < 24000 ? 0 : 1;
+      const int scratch_level = tiling::template scratch_level<gemm_dummy_type>();
 
       // Figure out Team Sizes
-      int team_size = 1;
-#if defined(KOKKOS_ENABLE_CUDA)
-      if (std::is_same<execution_space, Kokkos::Cuda>::value) team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_HIP)
-      if (std::is_same<execution_space, Kokkos::HIP>::value) team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_ROCM)
-      if (std::is_same<execution_space, Kokkos::ROCm>::value) team_size = blockA0;
-#endif
-#if defined(KOKKOS_ENABLE_SYCL)
-      if (std::is_same<execution_space, Kokkos::Experimental::SYCL>::value) team_size = blockA0;
-#endif
+      const int team_size = tiling::team_size();
 
       // Call the correct kernel
       if ((transA[0] == 'N' || transA[0] == 'n') && (transB[0] == 'N' || transB[0] == 'n')) {
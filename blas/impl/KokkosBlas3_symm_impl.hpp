@@ -0,0 +1,77 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYMM_IMPL_HPP_
+#define KOKKOSBLAS3_SYMM_IMPL_HPP_
+
+/// \file KokkosBlas3_symm_impl.hpp
+/// \brief Native symmetric matrix-matrix multiply. It runs the GEMM team
+/// tiling (GEMMImpl), with the missing triangle of A read from the stored one.
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas3_gemm_impl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+template <class execution_space, class AViewType, class BViewType, class CViewType, bool Left, bool Upper>
+void Symm_Run(const execution_space& space, const char* label, typename CViewType::const_value_type& alpha,
+              const AViewType& A, const BViewType& B, typename CViewType::const_value_type& beta, const CViewType& C) {
+  using symmetric_type = impl_symmetric_matrix<AViewType, Upper>;
+  using scalar_a       = typename AViewType::non_const_value_type;
+  using scalar_b       = typename BViewType::non_const_value_type;
+  using scalar_c       = typename CViewType::non_const_value_type;
+  using tiling         = impl_gemm_tiling<execution_space, scalar_a, scalar_b, scalar_c>;
+  if constexpr (Left) {
+    using gemm_type = GEMMImpl<execution_space, symmetric_type, BViewType, CViewType, tiling::blockA0,
+                               tiling::blockA1, tiling::blockB1, 0, 0>;
+    gemm_type gemm(alpha, symmetric_type{A}, B, beta, C);
+    gemm.run(space, tiling::team_size(), tiling::vector_length(), tiling::template scratch_level<gemm_type>(), label);
+  } else {
+    using gemm_type = GEMMImpl<execution_space, BViewType, symmetric_type, CViewType, tiling::blockA0,
+                               tiling::blockA1, tiling::blockB1, 0, 0>;
+    gemm_type gemm(alpha, B, symmetric_type{A}, beta, C);
+    gemm.run(space, tiling::team_size(), tiling::vector_length(), tiling::template scratch_level<gemm_type>(), label);
+  }
+}
+
+// C = beta*C + alpha*A*B (side "L") or beta*C + alpha*B*A (side "R"), where
+// A is symmetric and only its uplo triangle is referenced.
+template <class execution_space, class AViewType, class BViewType, class CViewType>
+void Symm_Invoke(const execution_space& space, const char side[], const char uplo[],
+                 typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,
+                 typename CViewType::const_value_type& beta, const CViewType& C) {
+  const bool left  = (side[0] == 'L') || (side[0] == 'l');
+  const bool upper = (uplo[0] == 'U') || (uplo[0] == 'u');
+  if (left && upper)
+    Symm_Run<execution_space, AViewType, BViewType, CViewType, true, true>(space, "KokkosBlas::symm[LU]", alpha, A, B,
+                                                                            beta, C);
+  else if (left)
+    Symm_Run<execution_space, AViewType, BViewType, CViewType, true, false>(space, "KokkosBlas::symm[LL]", alpha, A,
+                                                                             B, beta, C);
+  else if (upper)
+    Symm_Run<execution_space, AViewType, BViewType, CViewType, false, true>(space, "KokkosBlas::symm[RU]", alpha, A,
+                                                                             B, beta, C);
+  else
+    Symm_Run<execution_space, AViewType, BViewType, CViewType, false, false>(space, "KokkosBlas::symm[RL]", alpha, A,
+                                                                              B, beta, C);
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSBLAS3_SYMM_IMPL_HPP_
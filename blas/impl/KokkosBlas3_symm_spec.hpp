@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYMM_SPEC_HPP_
+#define KOKKOSBLAS3_SYMM_SPEC_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosBlas3_symm_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class execution_space, class AVT, class BVT, class CVT>
+struct symm_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization availability
+// KokkosBlas::Impl::SYMM.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSBLAS3_SYMM_ETI_SPEC_AVAIL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                           \
+  template <>                                                                                            \
+  struct symm_eti_spec_avail<EXEC_SPACE,                                                                 \
+                             Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                             Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                             Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                          Kokkos::MemoryTraits<Kokkos::Unmanaged> > > {                  \
+    enum : bool { value = true };                                                                        \
+  };
+
+#include <KokkosBlas3_symm_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosBlas3_symm_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// symm
+//
+
+// Unification layer of KokkosBlas::symm
+template <class execution_space, class AViewType, class BViewType, class CViewType,
+          bool tpl_spec_avail = symm_tpl_spec_avail<execution_space, AViewType, BViewType, CViewType>::value,
+          bool eti_spec_avail = symm_eti_spec_avail<execution_space, AViewType, BViewType, CViewType>::value>
+struct SYMM {
+  static void symm(const execution_space& space, const char side[], const char uplo[],
+                   typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,
+                   typename CViewType::const_value_type& beta, const CViewType& C);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+template <class execution_space, class AViewType, class BViewType, class CViewType>
+struct SYMM<execution_space, AViewType, BViewType, CViewType, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static void symm(const execution_space& space, const char side[], const char uplo[],
+                   typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,
+                   typename CViewType::const_value_type& beta, const CViewType& C) {
+    static_assert(Kokkos::is_view<AViewType>::value, "AViewType must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<BViewType>::value, "BViewType must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<CViewType>::value, "CViewType must be a Kokkos::View.");
+    static_assert(static_cast<int>(AViewType::rank) == 2, "AViewType must have rank 2.");
+    static_assert(static_cast<int>(BViewType::rank) == 2, "BViewType must have rank 2.");
+    static_assert(static_cast<int>(CViewType::rank) == 2, "CViewType must have rank 2.");
+
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY ? "KokkosBlas::symm[ETI]"
+                                                                     : "KokkosBlas::symm[noETI]");
+    Symm_Invoke(space, side, uplo, alpha, A, B, beta, C);
+    Kokkos::Profiling::popRegion();
+  }
+};
+#endif  //! defined(KOKKOSKERNELS_ETI_ONLY) ||
+        //! KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization of
+// KokkosBlas::Impl::SYMM.  This is NOT for users!!!
+// All the declarations of full specializations go in this header
+// file.  We may spread out definitions (see _INST macro below) across
+// one or more .cpp files.
+//
+#define KOKKOSBLAS3_SYMM_ETI_SPEC_DECL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                             \
+  extern template struct SYMM<EXEC_SPACE,                                                                 \
+                              Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                              Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                              Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                              false, true>;
+
+#define KOKKOSBLAS3_SYMM_ETI_SPEC_INST(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                      \
+  template struct SYMM<EXEC_SPACE,                                                                 \
+                       Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                       Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                       Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                       false, true>;
+
+#include <KokkosBlas3_symm_tpl_spec_decl.hpp>
+#include <generated_specializations_hpp/KokkosBlas3_symm_eti_spec_decl.hpp>
+
+#endif  // KOKKOSBLAS3_SYMM_SPEC_HPP_
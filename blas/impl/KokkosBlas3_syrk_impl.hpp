@@ -0,0 +1,96 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYRK_IMPL_HPP_
+#define KOKKOSBLAS3_SYRK_IMPL_HPP_
+
+/// \file KokkosBlas3_syrk_impl.hpp
+/// \brief Native symmetric and Hermitian rank-k updates. They run the GEMM
+/// team tiling (GEMMImpl) with B = A, and compute only one triangle of C.
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas3_gemm_impl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// herk leaves the imaginary part of the diagonal of C zero
+template <class CViewType>
+struct HerkRealDiagonalFunctor {
+  using scalar_type = typename CViewType::non_const_value_type;
+
+  CViewType C;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    C(i, i) = scalar_type(Kokkos::ArithTraits<scalar_type>::real(C(i, i)));
+  }
+};
+
+template <class execution_space, class AViewType, class CViewType, int TransposeA, int TransposeB, int TriangleC>
+void Syrk_Run(const execution_space& space, const char* label, typename CViewType::const_value_type& alpha,
+              const AViewType& A, typename CViewType::const_value_type& beta, const CViewType& C) {
+  using scalar_a  = typename AViewType::non_const_value_type;
+  using scalar_c  = typename CViewType::non_const_value_type;
+  using tiling    = impl_gemm_tiling<execution_space, scalar_a, scalar_a, scalar_c>;
+  using gemm_type = GEMMImpl<execution_space, AViewType, AViewType, CViewType, tiling::blockA0, tiling::blockA1,
+                             tiling::blockB1, TransposeA, TransposeB, TriangleC>;
+  gemm_type gemm(alpha, A, A, beta, C);
+  gemm.run(space, tiling::team_size(), tiling::vector_length(), tiling::template scratch_level<gemm_type>(), label);
+}
+
+// C = beta*C + alpha*A*A^T (trans "N") or beta*C + alpha*A^T*A (trans "T"),
+// with conjugate transposes instead if hermitian. Only the uplo triangle of
+// C is referenced.
+template <class execution_space, class AViewType, class CViewType>
+void Syrk_Invoke(const execution_space& space, const char uplo[], const char trans[],
+                 typename CViewType::const_value_type& alpha, const AViewType& A,
+                 typename CViewType::const_value_type& beta, const CViewType& C, const bool hermitian) {
+  const bool upper   = (uplo[0] == 'U') || (uplo[0] == 'u');
+  const bool noTrans = (trans[0] == 'N') || (trans[0] == 'n');
+  if (noTrans && !hermitian) {
+    if (upper)
+      Syrk_Run<execution_space, AViewType, CViewType, 0, 1, 1>(space, "KokkosBlas::syrk[UN]", alpha, A, beta, C);
+    else
+      Syrk_Run<execution_space, AViewType, CViewType, 0, 1, 2>(space, "KokkosBlas::syrk[LN]", alpha, A, beta, C);
+  } else if (!hermitian) {
+    if (upper)
+      Syrk_Run<execution_space, AViewType, CViewType, 1, 0, 1>(space, "KokkosBlas::syrk[UT]", alpha, A, beta, C);
+    else
+      Syrk_Run<execution_space, AViewType, CViewType, 1, 0, 2>(space, "KokkosBlas::syrk[LT]", alpha, A, beta, C);
+  } else if (noTrans) {
+    if (upper)
+      Syrk_Run<execution_space, AViewType, CViewType, 0, 2, 1>(space, "KokkosBlas::herk[UN]", alpha, A, beta, C);
+    else
+      Syrk_Run<execution_space, AViewType, CViewType, 0, 2, 2>(space, "KokkosBlas::herk[LN]", alpha, A, beta, C);
+  } else {
+    if (upper)
+      Syrk_Run<execution_space, AViewType, CViewType, 2, 0, 1>(space, "KokkosBlas::herk[UC]", alpha, A, beta, C);
+    else
+      Syrk_Run<execution_space, AViewType, CViewType, 2, 0, 2>(space, "KokkosBlas::herk[LC]", alpha, A, beta, C);
+  }
+  if constexpr (Kokkos::ArithTraits<typename CViewType::non_const_value_type>::is_complex) {
+    if (hermitian)
+      Kokkos::parallel_for("KokkosBlas::herk[RealDiagonal]",
+                           Kokkos::RangePolicy<execution_space>(space, 0, C.extent(0)),
+                           HerkRealDiagonalFunctor<CViewType>{C});
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSBLAS3_SYRK_IMPL_HPP_
@@ -0,0 +1,124 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYRK_SPEC_HPP_
+#define KOKKOSBLAS3_SYRK_SPEC_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosBlas3_syrk_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template <class execution_space, class AVT, class CVT>
+struct syrk_eti_spec_avail {
+  enum : bool { value = false };
+};
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization availability
+// KokkosBlas::Impl::SYRK.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSBLAS3_SYRK_ETI_SPEC_AVAIL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                           \
+  template <>                                                                                            \
+  struct syrk_eti_spec_avail<EXEC_SPACE,                                                                 \
+                             Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                          Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                             Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                          Kokkos::MemoryTraits<Kokkos::Unmanaged> > > {                  \
+    enum : bool { value = true };                                                                        \
+  };
+
+#include <KokkosBlas3_syrk_tpl_spec_avail.hpp>
+#include <generated_specializations_hpp/KokkosBlas3_syrk_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// syrk
+//
+
+// Unification layer of KokkosBlas::syrk and KokkosBlas::herk: with
+// hermitian, op(A) is the conjugate transpose and alpha, beta are real.
+template <class execution_space, class AViewType, class CViewType,
+          bool tpl_spec_avail = syrk_tpl_spec_avail<execution_space, AViewType, CViewType>::value,
+          bool eti_spec_avail = syrk_eti_spec_avail<execution_space, AViewType, CViewType>::value>
+struct SYRK {
+  static void syrk(const execution_space& space, const char uplo[], const char trans[],
+                   typename CViewType::const_value_type& alpha, const AViewType& A,
+                   typename CViewType::const_value_type& beta, const CViewType& C, const bool hermitian);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+template <class execution_space, class AViewType, class CViewType>
+struct SYRK<execution_space, AViewType, CViewType, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
+  static void syrk(const execution_space& space, const char uplo[], const char trans[],
+                   typename CViewType::const_value_type& alpha, const AViewType& A,
+                   typename CViewType::const_value_type& beta, const CViewType& C, const bool hermitian) {
+    static_assert(Kokkos::is_view<AViewType>::value, "AViewType must be a Kokkos::View.");
+    static_assert(Kokkos::is_view<CViewType>::value, "CViewType must be a Kokkos::View.");
+    static_assert(static_cast<int>(AViewType::rank) == 2, "AViewType must have rank 2.");
+    static_assert(static_cast<int>(CViewType::rank) == 2, "CViewType must have rank 2.");
+
+    Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY ? "KokkosBlas::syrk[ETI]"
+                                                                     : "KokkosBlas::syrk[noETI]");
+    Syrk_Invoke(space, uplo, trans, alpha, A, beta, C, hermitian);
+    Kokkos::Profiling::popRegion();
+  }
+};
+#endif  //! defined(KOKKOSKERNELS_ETI_ONLY) ||
+        //! KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+
+//
+// Macro for declaration of full specialization of
+// KokkosBlas::Impl::SYRK.  This is NOT for users!!!
+// All the declarations of full specializations go in this header
+// file.  We may spread out definitions (see _INST macro below) across
+// one or more .cpp files.
+//
+#define KOKKOSBLAS3_SYRK_ETI_SPEC_DECL(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                             \
+  extern template struct SYRK<EXEC_SPACE,                                                                 \
+                              Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                              Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                              false, true>;
+
+#define KOKKOSBLAS3_SYRK_ETI_SPEC_INST(SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE)                      \
+  template struct SYRK<EXEC_SPACE,                                                                 \
+                       Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                       Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>,       \
+                                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                     \
+                       false, true>;
+
+#include <KokkosBlas3_syrk_tpl_spec_decl.hpp>
+#include <generated_specializations_hpp/KokkosBlas3_syrk_eti_spec_decl.hpp>
+
+#endif  // KOKKOSBLAS3_SYRK_SPEC_HPP_
@@ -20,20 +20,31 @@
 /**
  * \file KokkosBlas3_trmm_impl.hpp
  * \brief Implementation of triangular matrix multiply
+ *
+ * SerialTrmm_Invoke calls the serial batched TRMM. BlockedTrmm_Invoke
+ * multiplies by the diagonal blocks of A with SerialTrmm_Invoke, one column
+ * (or row) of B per thread, and adds the off-diagonal blocks with
+ * KokkosBlas::gemm.
  */
 
 #include "KokkosKernels_config.h"
 #include "Kokkos_Core.hpp"
 #include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosBlas3_gemm.hpp"
 #include "KokkosBatched_Trmm_Decl.hpp"
 #include "KokkosBatched_Trmm_Serial_Impl.hpp"
 
 namespace KokkosBlas {
 namespace Impl {
 
+// tolower is not available on the device
+KOKKOS_INLINE_FUNCTION char trmm_tolower(const char c) { return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c; }
+
 template <class AViewType, class BViewType>
-void SerialTrmm_Invoke(const char side[], const char uplo[], const char trans[], const char /*diag*/[],
-                       typename BViewType::const_value_type& alpha, const AViewType& A, const BViewType& B) {
+KOKKOS_INLINE_FUNCTION void SerialTrmm_Invoke(const char side[], const char uplo[], const char trans[],
+                                              const char /*diag*/[], typename BViewType::const_value_type& alpha,
+                                              const AViewType& A, const BViewType& B) {
   using KokkosBatched::Algo;
   using KokkosBatched::Diag;
   using KokkosBatched::SerialTrmmInternalLeftLower;
@@ -41,7 +52,7 @@ void SerialTrmm_Invoke(const char side[], const char uplo[], const char trans[],
   using KokkosBatched::SerialTrmmInternalRightLower;
   using KokkosBatched::SerialTrmmInternalRightUpper;
 
-  char _side = tolower(side[0]), _uplo = tolower(uplo[0]), _trans = tolower(trans[0]);
+  char _side = trmm_tolower(side[0]), _uplo = trmm_tolower(uplo[0]), _trans = trmm_tolower(trans[0]);
   //__diag = tolower(diag[0]);
   bool do_conj = true;
 
@@ -112,6 +123,93 @@ void SerialTrmm_Invoke(const char side[], const char uplo[], const char trans[],
         Diag::Unit::use_unit_diag, do_conj, A.extent(1), A.extent(0), B.extent(0), B.extent(1), alpha, A.data(),
         A.stride(1), A.stride(0), B.data(), B.stride(0), B.stride(1));
 }
+
+// Multiplies a column (side "L") or a row (side "R") of the block row/column
+// B by a diagonal block A of the triangular matrix, per index.
+template <class AViewType, class BViewType>
+struct TrmmDiagonalBlockFunctor {
+  char side, uplo, trans, diag;
+  AViewType A;
+  BViewType B;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    const typename BViewType::non_const_value_type one(1);
+    if (side == 'L' || side == 'l') {
+      SerialTrmm_Invoke(&side, &uplo, &trans, &diag, one, A,
+                        Kokkos::subview(B, Kokkos::ALL, Kokkos::make_pair(i, i + 1)));
+    } else {
+      SerialTrmm_Invoke(&side, &uplo, &trans, &diag, one, A,
+                        Kokkos::subview(B, Kokkos::make_pair(i, i + 1), Kokkos::ALL));
+    }
+  }
+};
+
+// Blocked TRMM running on the execution space. B is scaled by alpha, then
+// each block row (side "L") or block column (side "R") of B is multiplied by
+// the diagonal block of op(A) in place, and the products with the
+// off-diagonal blocks are added with one gemm. Blocks are visited in the
+// order that leaves the blocks of B still needed by the gemms unmodified.
+// AViewType and BViewType must have the same layout, LayoutLeft or
+// LayoutRight.
+template <class execution_space, class AViewType, class BViewType>
+void BlockedTrmm_Invoke(const execution_space& space, const char side[], const char uplo[], const char trans[],
+                        const char diag[], typename BViewType::const_value_type& alpha, const AViewType& A,
+                        const BViewType& B) {
+  using scalar_type = typename BViewType::non_const_value_type;
+  using KAT         = Kokkos::ArithTraits<scalar_type>;
+  using range_type  = Kokkos::pair<int, int>;
+  using functor_type =
+      TrmmDiagonalBlockFunctor<decltype(Kokkos::subview(A, range_type(), range_type())),
+                               decltype(Kokkos::subview(B, range_type(), range_type()))>;
+  constexpr int blockSize = 64;
+
+  if (alpha == KAT::zero()) {
+    Kokkos::deep_copy(space, B, KAT::zero());
+    return;
+  }
+  if (alpha != KAT::one()) KokkosBlas::scal(space, B, alpha, B);
+
+  const bool left    = (side[0] == 'L') || (side[0] == 'l');
+  const bool noTrans = (trans[0] == 'N') || (trans[0] == 'n');
+  // op(A) is lower triangular if A is lower and not transposed, or upper and transposed
+  const bool lower = ((uplo[0] == 'L') || (uplo[0] == 'l')) == noTrans;
+  // U*B and B*L read the blocks of B after the current one, L*B and B*U the
+  // blocks before it
+  const bool forward   = left != lower;
+  const int k          = A.extent(0);
+  const int m          = B.extent(0);
+  const int n          = B.extent(1);
+  const int numBlocks  = (k + blockSize - 1) / blockSize;
+  const range_type all = range_type(0, left ? n : m);
+  // Block (rows, cols) of op(A), to be passed to gemm with trans
+  auto opA = [&](const range_type rows, const range_type cols) {
+    return noTrans ? Kokkos::subview(A, rows, cols) : Kokkos::subview(A, cols, rows);
+  };
+
+  for (int b = 0; b < numBlocks; b++) {
+    const int kb = forward ? b : numBlocks - 1 - b;
+    const range_type diagRange(kb * blockSize, Kokkos::min((kb + 1) * blockSize, k));
+    // Blocks of B not overwritten yet
+    const range_type rest = forward ? range_type(diagRange.second, k) : range_type(0, diagRange.first);
+    auto Akk              = Kokkos::subview(A, diagRange, diagRange);
+    if (left) {
+      auto Bk = Kokkos::subview(B, diagRange, all);
+      Kokkos::parallel_for("KokkosBlas::trmm[DiagonalBlock]", Kokkos::RangePolicy<execution_space>(space, 0, n),
+                           functor_type{side[0], uplo[0], trans[0], diag[0], Akk, Bk});
+      if (rest.first < rest.second)
+        KokkosBlas::gemm(space, trans, "N", KAT::one(), opA(diagRange, rest), Kokkos::subview(B, rest, all),
+                         KAT::one(), Bk);
+    } else {
+      auto Bk = Kokkos::subview(B, all, diagRange);
+      Kokkos::parallel_for("KokkosBlas::trmm[DiagonalBlock]", Kokkos::RangePolicy<execution_space>(space, 0, m),
+                           functor_type{side[0], uplo[0], trans[0], diag[0], Akk, Bk});
+      if (rest.first < rest.second)
+        KokkosBlas::gemm(space, "N", trans, KAT::one(), Kokkos::subview(B, all, rest), opA(rest, diagRange),
+                         KAT::one(), Bk);
+    }
+  }
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // KOKKOSBLAS3_TRMM_IMPL_HPP_
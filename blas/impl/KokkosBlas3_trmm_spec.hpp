@@ -75,7 +75,7 @@ struct TRMM {
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 template <class execution_space, class AVIT, class BVIT>
 struct TRMM<execution_space, AVIT, BVIT, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void trmm(const execution_space& /*space*/, const char side[], const char uplo[], const char trans[],
+  static void trmm(const execution_space& space, const char side[], const char uplo[], const char trans[],
                    const char diag[], typename BVIT::const_value_type& alpha, const AVIT& A, const BVIT& B) {
     static_assert(Kokkos::is_view<AVIT>::value, "AVIT must be a Kokkos::View.");
     static_assert(Kokkos::is_view<BVIT>::value, "BVIT must be a Kokkos::View.");
@@ -85,20 +85,27 @@ struct TRMM<execution_space, AVIT, BVIT, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRA
     Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY ? "KokkosBlas::trmm[ETI]"
                                                                      : "KokkosBlas::trmm[noETI]");
 
-    typename AVIT::HostMirror host_A = Kokkos::create_mirror_view(A);
-    typename BVIT::HostMirror host_B = Kokkos::create_mirror_view(B);
-
-    // Copy A to host_A and B to host_B
-    // no-op if A and B MemorySpace is HostSpace
-    Kokkos::deep_copy(host_A, A);
-    Kokkos::deep_copy(host_B, B);
-
-    SerialTrmm_Invoke<typename AVIT::HostMirror, typename BVIT::HostMirror>(side, uplo, trans, diag, alpha, host_A,
-                                                                            host_B);
-
-    // Copy host_B to B
-    // no-op if B's MemorySpace is HostSpace
-    Kokkos::deep_copy(B, host_B);
+    using layout_type = typename BVIT::array_layout;
+    if constexpr (std::is_same_v<typename AVIT::array_layout, layout_type> &&
+                  (std::is_same_v<layout_type, Kokkos::LayoutLeft> ||
+                   std::is_same_v<layout_type, Kokkos::LayoutRight>)) {
+      BlockedTrmm_Invoke(space, side, uplo, trans, diag, alpha, A, B);
+    } else {
+      typename AVIT::HostMirror host_A = Kokkos::create_mirror_view(A);
+      typename BVIT::HostMirror host_B = Kokkos::create_mirror_view(B);
+
+      // Copy A to host_A and B to host_B
+      // no-op if A and B MemorySpace is HostSpace
+      Kokkos::deep_copy(host_A, A);
+      Kokkos::deep_copy(host_B, B);
+
+      SerialTrmm_Invoke<typename AVIT::HostMirror, typename BVIT::HostMirror>(side, uplo, trans, diag, alpha, host_A,
+                                                                              host_B);
+
+      // Copy host_B to B
+      // no-op if B's MemorySpace is HostSpace
+      Kokkos::deep_copy(B, host_B);
+    }
 
     Kokkos::Profiling::popRegion();
   }
@@ -22,11 +22,16 @@
 /// RHSs) \brief Sequential fall-back implementation calls the exisiting serial
 /// batched TRSM. \brief Two sequential fall-back implementations for conjugate
 /// transpose case are \brief also based on the exisiting serial batched TRSM.
+/// \brief The blocked implementation solves with the diagonal blocks of A
+/// using the serial TRSM, one RHS per thread, and updates the remaining RHSs
+/// with KokkosBlas::gemm.
 
 #include "KokkosKernels_config.h"
 #include "Kokkos_Core.hpp"
 #include "Kokkos_ArithTraits.hpp"
 #include "KokkosBlas1_set_impl.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosBlas3_gemm.hpp"
 #include "KokkosBatched_Trsm_Decl.hpp"
 #include "KokkosBatched_Trsm_Serial_Impl.hpp"
 
@@ -34,9 +39,11 @@ namespace KokkosBlas {
 namespace Impl {
 
 template <typename ScalarType, typename ValueType>
-int SerialTrsmInternalLeftLowerConj(const bool use_unit_diag, const int m, const int n, const ScalarType alpha,
-                                    const ValueType* KOKKOS_RESTRICT A, const int as0, const int as1,
-                                    /**/ ValueType* KOKKOS_RESTRICT B, const int bs0, const int bs1) {
+KOKKOS_INLINE_FUNCTION int SerialTrsmInternalLeftLowerConj(const bool use_unit_diag, const int m, const int n,
+                                                           const ScalarType alpha, const ValueType* KOKKOS_RESTRICT A,
+                                                           const int as0, const int as1,
+                                                           /**/ ValueType* KOKKOS_RESTRICT B, const int bs0,
+                                                           const int bs1) {
   typedef Kokkos::ArithTraits<ValueType> AT;
 
   const ScalarType one(1.0), zero(0.0);
@@ -67,9 +74,11 @@ int SerialTrsmInternalLeftLowerConj(const bool use_unit_diag, const int m, const
 }
 
 template <typename ScalarType, typename ValueType>
-int SerialTrsmInternalLeftUpperConj(const bool use_unit_diag, const int m, const int n, const ScalarType alpha,
-                                    const ValueType* KOKKOS_RESTRICT A, const int as0, const int as1,
-                                    /**/ ValueType* KOKKOS_RESTRICT B, const int bs0, const int bs1) {
+KOKKOS_INLINE_FUNCTION int SerialTrsmInternalLeftUpperConj(const bool use_unit_diag, const int m, const int n,
+                                                           const ScalarType alpha, const ValueType* KOKKOS_RESTRICT A,
+                                                           const int as0, const int as1,
+                                                           /**/ ValueType* KOKKOS_RESTRICT B, const int bs0,
+                                                           const int bs1) {
   typedef Kokkos::ArithTraits<ValueType> AT;
 
   const ScalarType one(1.0), zero(0.0);
@@ -103,8 +112,9 @@ int SerialTrsmInternalLeftUpperConj(const bool use_unit_diag, const int m, const
 }
 
 template <class AViewType, class BViewType>
-void SerialTrsm_Invoke(const char side[], const char uplo[], const char trans[], const char diag[],
-                       typename BViewType::const_value_type& alpha, const AViewType& A, const BViewType& B) {
+KOKKOS_INLINE_FUNCTION void SerialTrsm_Invoke(const char side[], const char uplo[], const char trans[],
+                                              const char diag[], typename BViewType::const_value_type& alpha,
+                                              const AViewType& A, const BViewType& B) {
   using KokkosBatched::Algo;
   using KokkosBatched::Diag;
 
@@ -245,6 +255,91 @@ void SerialTrsm_Invoke(const char side[], const char uplo[], const char trans[],
                                     A.stride(0), A.stride(1), B.data(), B.stride(1), B.stride(0));
 }
 
+// Solves with a diagonal block A of the triangular matrix, for one column
+// (side "L") or one row (side "R") of the block row/column B per index.
+template <class AViewType, class BViewType>
+struct TrsmDiagonalBlockFunctor {
+  char side, uplo, trans, diag;
+  AViewType A;
+  BViewType B;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const int i) const {
+    const typename BViewType::non_const_value_type one(1);
+    if (side == 'L' || side == 'l') {
+      SerialTrsm_Invoke(&side, &uplo, &trans, &diag, one, A,
+                        Kokkos::subview(B, Kokkos::ALL, Kokkos::make_pair(i, i + 1)));
+    } else {
+      SerialTrsm_Invoke(&side, &uplo, &trans, &diag, one, A,
+                        Kokkos::subview(B, Kokkos::make_pair(i, i + 1), Kokkos::ALL));
+    }
+  }
+};
+
+// Blocked TRSM running on the execution space. B is scaled by alpha, then
+// op(A) is traversed in blocks of blockSize rows/columns in the order of the
+// substitution: each diagonal block is solved with SerialTrsm_Invoke, in
+// parallel over the RHSs, and the solution is eliminated from the RHSs that
+// are not solved yet with one gemm. AViewType and BViewType must have the
+// same layout, LayoutLeft or LayoutRight, so that their blocks are valid
+// (ETI'd) gemm arguments.
+template <class execution_space, class AViewType, class BViewType>
+void BlockedTrsm_Invoke(const execution_space& space, const char side[], const char uplo[], const char trans[],
+                        const char diag[], typename BViewType::const_value_type& alpha, const AViewType& A,
+                        const BViewType& B) {
+  using scalar_type = typename BViewType::non_const_value_type;
+  using KAT         = Kokkos::ArithTraits<scalar_type>;
+  using range_type  = Kokkos::pair<int, int>;
+  using functor_type =
+      TrsmDiagonalBlockFunctor<decltype(Kokkos::subview(A, range_type(), range_type())),
+                               decltype(Kokkos::subview(B, range_type(), range_type()))>;
+  constexpr int blockSize = 64;
+
+  if (alpha == KAT::zero()) {
+    Kokkos::deep_copy(space, B, KAT::zero());
+    return;
+  }
+  if (alpha != KAT::one()) KokkosBlas::scal(space, B, alpha, B);
+
+  const bool left    = (side[0] == 'L') || (side[0] == 'l');
+  const bool noTrans = (trans[0] == 'N') || (trans[0] == 'n');
+  // op(A) is lower triangular if A is lower and not transposed, or upper and transposed
+  const bool lower = ((uplo[0] == 'L') || (uplo[0] == 'l')) == noTrans;
+  // Forward substitution for L*X = B and X*U = B, backward otherwise
+  const bool forward   = left == lower;
+  const int k          = A.extent(0);
+  const int m          = B.extent(0);
+  const int n          = B.extent(1);
+  const int numBlocks  = (k + blockSize - 1) / blockSize;
+  const range_type all = range_type(0, left ? n : m);
+  // Block (rows, cols) of op(A), to be passed to gemm with trans
+  auto opA = [&](const range_type rows, const range_type cols) {
+    return noTrans ? Kokkos::subview(A, rows, cols) : Kokkos::subview(A, cols, rows);
+  };
+
+  for (int b = 0; b < numBlocks; b++) {
+    const int kb = forward ? b : numBlocks - 1 - b;
+    const range_type diagRange(kb * blockSize, Kokkos::min((kb + 1) * blockSize, k));
+    // RHSs left to solve
+    const range_type rest = forward ? range_type(diagRange.second, k) : range_type(0, diagRange.first);
+    auto Akk              = Kokkos::subview(A, diagRange, diagRange);
+    if (left) {
+      auto Xk = Kokkos::subview(B, diagRange, all);
+      Kokkos::parallel_for("KokkosBlas::trsm[DiagonalBlock]", Kokkos::RangePolicy<execution_space>(space, 0, n),
+                           functor_type{side[0], uplo[0], trans[0], diag[0], Akk, Xk});
+      if (rest.first < rest.second)
+        KokkosBlas::gemm(space, trans, "N", -KAT::one(), opA(rest, diagRange), Xk, KAT::one(),
+                         Kokkos::subview(B, rest, all));
+    } else {
+      auto Xk = Kokkos::subview(B, all, diagRange);
+      Kokkos::parallel_for("KokkosBlas::trsm[DiagonalBlock]", Kokkos::RangePolicy<execution_space>(space, 0, m),
+                           functor_type{side[0], uplo[0], trans[0], diag[0], Akk, Xk});
+      if (rest.first < rest.second)
+        KokkosBlas::gemm(space, "N", trans, -KAT::one(), Xk, opA(diagRange, rest), KAT::one(),
+                         Kokkos::subview(B, all, rest));
+    }
+  }
+}
+
 }  // namespace Impl
 }  // namespace KokkosBlas
 #endif  // KOKKOSBLAS3_TRSM_IMPL_HPP_
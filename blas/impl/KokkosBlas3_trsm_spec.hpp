@@ -80,7 +80,7 @@ struct TRSM {
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 template <class execution_space, class AViewType, class BViewType>
 struct TRSM<execution_space, AViewType, BViewType, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY> {
-  static void trsm(const execution_space& /*space*/, const char side[], const char uplo[], const char trans[],
+  static void trsm(const execution_space& space, const char side[], const char uplo[], const char trans[],
                    const char diag[], typename BViewType::const_value_type& alpha, const AViewType& A,
                    const BViewType& B) {
     static_assert(Kokkos::is_view<AViewType>::value, "AViewType must be a Kokkos::View.");
@@ -91,16 +91,23 @@ struct TRSM<execution_space, AViewType, BViewType, false, KOKKOSKERNELS_IMPL_COM
     Kokkos::Profiling::pushRegion(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY ? "KokkosBlas::trsm[ETI]"
                                                                      : "KokkosBlas::trsm[noETI]");
 
-    typename AViewType::HostMirror h_A = Kokkos::create_mirror_view(A);
-    typename BViewType::HostMirror h_B = Kokkos::create_mirror_view(B);
+    using layout_type = typename BViewType::array_layout;
+    if constexpr (std::is_same_v<typename AViewType::array_layout, layout_type> &&
+                  (std::is_same_v<layout_type, Kokkos::LayoutLeft> ||
+                   std::is_same_v<layout_type, Kokkos::LayoutRight>)) {
+      BlockedTrsm_Invoke(space, side, uplo, trans, diag, alpha, A, B);
+    } else {
+      typename AViewType::HostMirror h_A = Kokkos::create_mirror_view(A);
+      typename BViewType::HostMirror h_B = Kokkos::create_mirror_view(B);
 
-    Kokkos::deep_copy(h_A, A);
-    Kokkos::deep_copy(h_B, B);
+      Kokkos::deep_copy(h_A, A);
+      Kokkos::deep_copy(h_B, B);
 
-    SerialTrsm_Invoke<typename AViewType::HostMirror, typename BViewType::HostMirror>(side, uplo, trans, diag, alpha,
-                                                                                      h_A, h_B);
+      SerialTrsm_Invoke<typename AViewType::HostMirror, typename BViewType::HostMirror>(side, uplo, trans, diag,
+                                                                                        alpha, h_A, h_B);
 
-    Kokkos::deep_copy(B, h_B);
+      Kokkos::deep_copy(B, h_B);
+    }
 
     Kokkos::Profiling::popRegion();
   }
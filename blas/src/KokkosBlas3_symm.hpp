@@ -0,0 +1,147 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYMM_HPP_
+#define KOKKOSBLAS3_SYMM_HPP_
+
+/// \file KokkosBlas3_symm.hpp
+
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosBlas3_symm_spec.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Symmetric matrix multiply:
+///
+///        C = beta * C + alpha * A * B if side == "L" or "l"
+///        C = beta * C + alpha * B * A if side == "R" or "r"
+///
+/// A is symmetric, and only its uplo triangle is referenced. The native
+/// implementation uses the same team tiling as KokkosBlas::gemm, and reads
+/// the other triangle of A from the stored one while loading the tiles of A.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input symmetric matrix, as a 2-D Kokkos::View
+/// \tparam BViewType Input M-by-N matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output M-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+/// or a queue to execute the kernel on
+/// \param side  [in] "L" or "l" indicates matrix A is on the left of B
+///                   "R" or "r" indicates matrix A is on the right of B
+/// \param uplo  [in] "U" or "u" if the upper triangle of A is stored,
+///                   "L" or "l" if the lower triangle of A is stored
+/// \param alpha [in] Input coefficient of A * B
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+///                   If side == "L" or "l", matrix A is M-by-M; otherwise,
+///                   matrix A is N-by-N
+/// \param B [in]     Input M-by-N matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output M-by-N matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class BViewType, class CViewType>
+void symm(const execution_space& space, const char side[], const char uplo[],
+          typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,
+          typename CViewType::const_value_type& beta, const CViewType& C) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "symm: execution_space must be a Kokkos::execution_space.");
+  static_assert(Kokkos::is_view_v<AViewType>, "symm: AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view_v<BViewType>, "symm: BViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view_v<CViewType>, "symm: CViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 2, "symm: AViewType must have rank 2.");
+  static_assert(static_cast<int>(BViewType::rank) == 2, "symm: BViewType must have rank 2.");
+  static_assert(static_cast<int>(CViewType::rank) == 2, "symm: CViewType must have rank 2.");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename AViewType::memory_space>::accessible,
+                "symm: execution_space cannot access data in AViewType");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename BViewType::memory_space>::accessible,
+                "symm: execution_space cannot access data in BViewType");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename CViewType::memory_space>::accessible,
+                "symm: execution_space cannot access data in CViewType");
+
+  // Check validity of indicator argument
+  bool valid_side = (side[0] == 'L') || (side[0] == 'l') || (side[0] == 'R') || (side[0] == 'r');
+  bool valid_uplo = (uplo[0] == 'U') || (uplo[0] == 'u') || (uplo[0] == 'L') || (uplo[0] == 'l');
+  if (!valid_side) {
+    std::ostringstream os;
+    os << "KokkosBlas::symm: side = '" << side[0] << "'. "
+       << "Valid values include 'L' or 'l' (A is on the left of B), "
+          "'R' or 'r' (A is on the right of B).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (!valid_uplo) {
+    std::ostringstream os;
+    os << "KokkosBlas::symm: uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (upper triangle of A is stored), "
+          "'L' or 'l' (lower triangle of A is stored).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const bool is_A_left = (side[0] == 'L' || side[0] == 'l');
+
+  int64_t A_m = A.extent(0);
+  int64_t A_n = A.extent(1);
+  int64_t B_m = B.extent(0);
+  int64_t B_n = B.extent(1);
+  int64_t C_m = C.extent(0);
+  int64_t C_n = C.extent(1);
+
+  // Ensure that A is square, that B and C have the same dimensions, and that
+  // we can legally perform A*B or B*A
+  if (A_m != A_n || B_m != C_m || B_n != C_n || (is_A_left ? B_m : B_n) != A_n) {
+    std::ostringstream os;
+    os << "KokkosBlas::symm: Dimensions of A, B and C do not match: "
+       << "side: " << side[0] << " A: " << A.extent(0) << " x " << A.extent(1) << " B: " << B.extent(0) << " x "
+       << B.extent(1) << " C: " << C.extent(0) << " x " << C.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Return if degenerated matrices are provided
+  if (C_m == 0 || C_n == 0) return;
+
+  using AViewInternalType = Kokkos::View<typename AViewType::const_value_type**, typename AViewType::array_layout,
+                                         typename AViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using BViewInternalType = Kokkos::View<typename BViewType::const_value_type**, typename BViewType::array_layout,
+                                         typename BViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType = Kokkos::View<typename CViewType::non_const_value_type**, typename CViewType::array_layout,
+                                         typename CViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  KokkosBlas::Impl::SYMM<execution_space, AViewInternalType, BViewInternalType, CViewInternalType>::symm(
+      space, side, uplo, alpha, A, B, beta, C);
+}
+
+/// \brief Symmetric matrix multiply, on the execution space of C
+///
+/// \param side  [in] "L" or "l" indicates matrix A is on the left of B
+///                   "R" or "r" indicates matrix A is on the right of B
+/// \param uplo  [in] "U" or "u" if the upper triangle of A is stored,
+///                   "L" or "l" if the lower triangle of A is stored
+/// \param alpha [in] Input coefficient of A * B
+/// \param A [in]     Input symmetric matrix, as a 2-D Kokkos::View
+/// \param B [in]     Input M-by-N matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output M-by-N matrix, as a 2-D Kokkos::View
+template <class AViewType, class BViewType, class CViewType>
+void symm(const char side[], const char uplo[], typename CViewType::const_value_type& alpha, const AViewType& A,
+          const BViewType& B, typename CViewType::const_value_type& beta, const CViewType& C) {
+  symm(typename CViewType::execution_space{}, side, uplo, alpha, A, B, beta, C);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_SYMM_HPP_
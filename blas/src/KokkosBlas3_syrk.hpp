@@ -0,0 +1,207 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYRK_HPP_
+#define KOKKOSBLAS3_SYRK_HPP_
+
+/// \file KokkosBlas3_syrk.hpp
+
+#include "KokkosKernels_Macros.hpp"
+#include "KokkosBlas3_syrk_spec.hpp"
+#include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+// Argument checks shared by syrk and herk
+template <class AViewType, class CViewType>
+void syrk_check_arguments(const char name[], const char uplo[], const char trans[], const char valid_trans_char,
+                          const AViewType& A, const CViewType& C) {
+  using ATS = Kokkos::ArithTraits<typename CViewType::non_const_value_type>;
+
+  bool valid_uplo  = (uplo[0] == 'U') || (uplo[0] == 'u') || (uplo[0] == 'L') || (uplo[0] == 'l');
+  bool valid_trans = (trans[0] == 'N') || (trans[0] == 'n') || (trans[0] == valid_trans_char) ||
+                     (trans[0] == valid_trans_char + ('a' - 'A'));
+  // For real matrices, "T" and "C" mean the same thing
+  if (!ATS::is_complex)
+    valid_trans = valid_trans || (trans[0] == 'T') || (trans[0] == 't') || (trans[0] == 'C') || (trans[0] == 'c');
+  if (!valid_uplo) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": uplo = '" << uplo[0] << "'. "
+       << "Valid values include 'U' or 'u' (upper triangle of C), "
+          "'L' or 'l' (lower triangle of C).";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (!valid_trans) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": trans = '" << trans[0] << "'. "
+       << "Valid values include 'N' or 'n' (No transpose) and '" << valid_trans_char << "' or '"
+       << char(valid_trans_char + ('a' - 'A')) << "'.";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const bool noTrans = (trans[0] == 'N') || (trans[0] == 'n');
+  if (C.extent(0) != C.extent(1) || (noTrans ? A.extent(0) : A.extent(1)) != C.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": Dimensions of A and C do not match: "
+       << "trans: " << trans[0] << " A: " << A.extent(0) << " x " << A.extent(1) << " C: " << C.extent(0) << " x "
+       << C.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+
+/// \brief Symmetric rank-k update:
+///
+///        C = beta * C + alpha * A * A^T if trans == "N" or "n"
+///        C = beta * C + alpha * A^T * A if trans == "T" or "t"
+///
+/// Only the uplo triangle of C is referenced and updated. The native
+/// implementation uses the same team tiling as KokkosBlas::gemm, and skips
+/// the blocks of C outside of the triangle.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output N-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+/// or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n" if A is N-by-K, "T" or "t" if A is K-by-N
+/// \param alpha [in] Input coefficient of A * A^T
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output symmetric matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class CViewType>
+void syrk(const execution_space& space, const char uplo[], const char trans[],
+          typename CViewType::const_value_type& alpha, const AViewType& A, typename CViewType::const_value_type& beta,
+          const CViewType& C) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "syrk: execution_space must be a Kokkos::execution_space.");
+  static_assert(Kokkos::is_view_v<AViewType>, "syrk: AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view_v<CViewType>, "syrk: CViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 2, "syrk: AViewType must have rank 2.");
+  static_assert(static_cast<int>(CViewType::rank) == 2, "syrk: CViewType must have rank 2.");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename AViewType::memory_space>::accessible,
+                "syrk: execution_space cannot access data in AViewType");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename CViewType::memory_space>::accessible,
+                "syrk: execution_space cannot access data in CViewType");
+
+  Impl::syrk_check_arguments("syrk", uplo, trans, 'T', A, C);
+
+  // Return if degenerated matrices are provided
+  if (C.extent(0) == 0) return;
+
+  using AViewInternalType = Kokkos::View<typename AViewType::const_value_type**, typename AViewType::array_layout,
+                                         typename AViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType = Kokkos::View<typename CViewType::non_const_value_type**, typename CViewType::array_layout,
+                                         typename CViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  KokkosBlas::Impl::SYRK<execution_space, AViewInternalType, CViewInternalType>::syrk(space, uplo, trans, alpha, A,
+                                                                                      beta, C, false);
+}
+
+/// \brief Symmetric rank-k update, on the execution space of C
+///
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n" if A is N-by-K, "T" or "t" if A is K-by-N
+/// \param alpha [in] Input coefficient of A * A^T
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output symmetric matrix, as a 2-D Kokkos::View
+template <class AViewType, class CViewType>
+void syrk(const char uplo[], const char trans[], typename CViewType::const_value_type& alpha, const AViewType& A,
+          typename CViewType::const_value_type& beta, const CViewType& C) {
+  syrk(typename CViewType::execution_space{}, uplo, trans, alpha, A, beta, C);
+}
+
+/// \brief Hermitian rank-k update:
+///
+///        C = beta * C + alpha * A * A^H if trans == "N" or "n"
+///        C = beta * C + alpha * A^H * A if trans == "C" or "c"
+///
+/// alpha and beta are real. Only the uplo triangle of C is referenced and
+/// updated, and the imaginary part of its diagonal is set to zero. For real
+/// matrices, this is the same as syrk.
+///
+/// \tparam execution_space a Kokkos execution space to run the kernels on.
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Input/Output N-by-N matrix, as a 2-D Kokkos::View
+///
+/// \param space [in] an execution space instance that may contain a stream
+/// or a queue to execute the kernel on
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n" if A is N-by-K, "C" or "c" if A is K-by-N
+/// \param alpha [in] Input coefficient of A * A^H
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output Hermitian matrix, as a 2-D Kokkos::View
+template <class execution_space, class AViewType, class CViewType>
+void herk(const execution_space& space, const char uplo[], const char trans[],
+          typename Kokkos::ArithTraits<typename CViewType::non_const_value_type>::mag_type alpha, const AViewType& A,
+          typename Kokkos::ArithTraits<typename CViewType::non_const_value_type>::mag_type beta, const CViewType& C) {
+  static_assert(Kokkos::is_execution_space_v<execution_space>,
+                "herk: execution_space must be a Kokkos::execution_space.");
+  static_assert(Kokkos::is_view_v<AViewType>, "herk: AViewType must be a Kokkos::View.");
+  static_assert(Kokkos::is_view_v<CViewType>, "herk: CViewType must be a Kokkos::View.");
+  static_assert(static_cast<int>(AViewType::rank) == 2, "herk: AViewType must have rank 2.");
+  static_assert(static_cast<int>(CViewType::rank) == 2, "herk: CViewType must have rank 2.");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename AViewType::memory_space>::accessible,
+                "herk: execution_space cannot access data in AViewType");
+  static_assert(Kokkos::SpaceAccessibility<execution_space, typename CViewType::memory_space>::accessible,
+                "herk: execution_space cannot access data in CViewType");
+
+  Impl::syrk_check_arguments("herk", uplo, trans, 'C', A, C);
+
+  // Return if degenerated matrices are provided
+  if (C.extent(0) == 0) return;
+
+  using AViewInternalType = Kokkos::View<typename AViewType::const_value_type**, typename AViewType::array_layout,
+                                         typename AViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using CViewInternalType = Kokkos::View<typename CViewType::non_const_value_type**, typename CViewType::array_layout,
+                                         typename CViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using scalar_type       = typename CViewType::non_const_value_type;
+
+  KokkosBlas::Impl::SYRK<execution_space, AViewInternalType, CViewInternalType>::syrk(
+      space, uplo, trans, scalar_type(alpha), A, scalar_type(beta), C, true);
+}
+
+/// \brief Hermitian rank-k update, on the execution space of C
+///
+/// \param uplo  [in] "U" or "u" to update the upper triangle of C,
+///                   "L" or "l" to update the lower triangle of C
+/// \param trans [in] "N" or "n" if A is N-by-K, "C" or "c" if A is K-by-N
+/// \param alpha [in] Input coefficient of A * A^H
+/// \param A [in]     Input matrix, as a 2-D Kokkos::View
+/// \param beta [in]  Input coefficient of C
+/// \param C [in,out] Input/Output Hermitian matrix, as a 2-D Kokkos::View
+template <class AViewType, class CViewType>
+void herk(const char uplo[], const char trans[],
+          typename Kokkos::ArithTraits<typename CViewType::non_const_value_type>::mag_type alpha, const AViewType& A,
+          typename Kokkos::ArithTraits<typename CViewType::non_const_value_type>::mag_type beta, const CViewType& C) {
+  herk(typename CViewType::execution_space{}, uplo, trans, alpha, A, beta, C);
+}
+
+}  // namespace KokkosBlas
+
+#endif  // KOKKOSBLAS3_SYRK_HPP_
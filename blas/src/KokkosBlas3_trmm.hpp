@@ -32,8 +32,10 @@ namespace KokkosBlas {
 ///        B = alpha * op(A) * B if side == "L" or "l"
 ///        B = alpha * B * op(A) if side == "R" or "r"
 ///
-/// This function is currently blocking when running the native implementation
-/// which only has a serial implementation.
+/// For LayoutLeft or LayoutRight A and B, the native implementation is blocked:
+/// it multiplies by the diagonal blocks of A with the serial batched kernel, in parallel
+/// over the columns (side "L") or rows (side "R") of B, and does the rest of
+/// the work with KokkosBlas::gemm.
 ///
 /// \tparam execution_space a Kokkos execution space to run the kernels on.
 /// \tparam AViewType Input matrix, as a 2-D Kokkos::View
@@ -41,8 +43,8 @@ namespace KokkosBlas {
 /// Kokkos::View
 ///
 /// \param space [in] an execution space instance that may contain a stream
-/// or a queue to execute the kernel on, this only works with TPLs at the
-/// moment. \param side  [in] "L" or "l" indicates matrix A is on the left of B
+/// or a queue to execute the kernel on
+/// \param side  [in] "L" or "l" indicates matrix A is on the left of B
 ///                   "R" or "r" indicates matrix A is on the right of B
 /// \param uplo  [in] "U" or "u" indicates matrix A is an upper triangular
 /// matrix
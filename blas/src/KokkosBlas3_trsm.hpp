@@ -30,8 +30,10 @@ namespace KokkosBlas {
 /// \brief Solve triangular linear system with multiple RHSs:
 ///        op(A)*X = alpha*B if side == "L" or "l"
 ///        X*op(A) = alpha*B if side == "R" or "r"
-/// This function is currently blocking when running the native implementation
-/// which only has a serial implementation.
+/// For LayoutLeft or LayoutRight A and B, the native implementation is blocked:
+/// it solves with the diagonal blocks of A with the serial batched kernel, in parallel
+/// over the columns (side "L") or rows (side "R") of B, and does the rest of
+/// the work with KokkosBlas::gemm.
 ///
 /// \tparam execution_space a Kokkos execution space to run the kernels on.
 /// \tparam AViewType Input matrix, as a 2-D Kokkos::View
@@ -39,8 +41,8 @@ namespace KokkosBlas {
 /// Kokkos::View
 ///
 /// \param space [in] an execution space instance that may contain a stream
-/// or a queue to execute the kernel on, this only works with TPLs at the
-/// moment. \param side  [in] "L" or "l" indicates matrix A is on the left of X
+/// or a queue to execute the kernel on
+/// \param side  [in] "L" or "l" indicates matrix A is on the left of X
 ///                   "R" or "r" indicates matrix A is on the right of X
 /// \param uplo  [in] "U" or "u" indicates matrix A upper part is stored, the
 /// other part is not referenced
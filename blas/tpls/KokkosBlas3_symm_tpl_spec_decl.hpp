@@ -0,0 +1,113 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYMM_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_SYMM_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or anything)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+#include "KokkosBlas_Host_tpl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is read by BLAS as its transpose: for LayoutRight
+// views, C^T = B^T*A (or A*B^T) is computed with the other side and the other
+// triangle of A.
+#define KOKKOSBLAS3_SYMM_BLAS(SCALAR_TYPE, BASE_SCALAR_TYPE, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)             \
+  template <class ExecSpace>                                                                                \
+  struct SYMM<ExecSpace,                                                                                    \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,               \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                       \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,               \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                       \
+              Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                     \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                       \
+              true, ETI_SPEC_AVAIL> {                                                                       \
+    typedef SCALAR_TYPE SCALAR;                                                                             \
+    typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                      \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >                                          \
+        AViewType;                                                                                          \
+    typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                      \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >                                          \
+        BViewType;                                                                                          \
+    typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                            \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >                                          \
+        CViewType;                                                                                          \
+                                                                                                            \
+    static void symm(const ExecSpace& /*space*/, const char side[], const char uplo[],                      \
+                     typename CViewType::const_value_type& alpha, const AViewType& A, const BViewType& B,   \
+                     typename CViewType::const_value_type& beta, const CViewType& C) {                      \
+      Kokkos::Profiling::pushRegion("KokkosBlas::symm[TPL_BLAS," #SCALAR_TYPE "]");                         \
+      const bool is_layout_left = std::is_same<Kokkos::LayoutLeft, LAYOUT>::value;                          \
+      const bool left           = (side[0] == 'L') || (side[0] == 'l');                                     \
+      const bool upper          = (uplo[0] == 'U') || (uplo[0] == 'u');                                     \
+      const KK_INT M            = static_cast<KK_INT>(C.extent(0));                                         \
+      const KK_INT N            = static_cast<KK_INT>(C.extent(1));                                         \
+                                                                                                            \
+      const KK_INT AST = is_layout_left ? A.stride(1) : A.stride(0), LDA = (AST == 0) ? 1 : AST;            \
+      const KK_INT BST = is_layout_left ? B.stride(1) : B.stride(0), LDB = (BST == 0) ? 1 : BST;            \
+      const KK_INT CST = is_layout_left ? C.stride(1) : C.stride(0), LDC = (CST == 0) ? 1 : CST;            \
+                                                                                                            \
+      const char side_ = (left == is_layout_left) ? 'L' : 'R';                                              \
+      const char uplo_ = (upper == is_layout_left) ? 'U' : 'L';                                             \
+      HostBlas<BASE_SCALAR_TYPE>::symm(side_, uplo_, is_layout_left ? M : N, is_layout_left ? N : M, alpha, \
+                                       reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA,            \
+                                       reinterpret_cast<const BASE_SCALAR_TYPE*>(B.data()), LDB, beta,      \
+                                       reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);                 \
+      Kokkos::Profiling::popRegion();                                                                       \
+    }                                                                                                       \
+  };
+
+#define KOKKOSBLAS3_DSYMM_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYMM_BLAS(double, double, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYMM_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYMM_BLAS(float, float, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYMM_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYMM_BLAS(Kokkos::complex<double>, std::complex<double>, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYMM_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYMM_BLAS(Kokkos::complex<float>, std::complex<float>, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYMM class for all permutations listed below
+
+KOKKOSBLAS3_DSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_SSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_SSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYMM_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYMM_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif  // KOKKOSBLAS3_SYMM_TPL_SPEC_DECL_HPP_
@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or anything)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+#include "KokkosBlas_Host_tpl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is read by BLAS as its transpose, so for LayoutRight
+// views the other triangle of C is updated with the other trans.
+#define KOKKOSBLAS3_SYRK_BLAS(SCALAR_TYPE, BASE_SCALAR_TYPE, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)                    \
+  template <class ExecSpace>                                                                                       \
+  struct SYRK<ExecSpace,                                                                                           \
+              Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                      \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                              \
+              Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                            \
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> >,                                              \
+              true, ETI_SPEC_AVAIL> {                                                                              \
+    typedef SCALAR_TYPE SCALAR;                                                                                    \
+    typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                             \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >                                                 \
+        AViewType;                                                                                                 \
+    typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>,                                   \
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> >                                                 \
+        CViewType;                                                                                                 \
+                                                                                                                   \
+    static void syrk(const ExecSpace& /*space*/, const char uplo[], const char trans[],                            \
+                     typename CViewType::const_value_type& alpha, const AViewType& A,                              \
+                     typename CViewType::const_value_type& beta, const CViewType& C, const bool hermitian) {       \
+      Kokkos::Profiling::pushRegion(hermitian ? "KokkosBlas::herk[TPL_BLAS," #SCALAR_TYPE "]"                      \
+                                              : "KokkosBlas::syrk[TPL_BLAS," #SCALAR_TYPE "]");                    \
+      const bool is_layout_left = std::is_same<Kokkos::LayoutLeft, LAYOUT>::value;                                 \
+      const bool upper          = (uplo[0] == 'U') || (uplo[0] == 'u');                                            \
+      const bool noTrans        = (trans[0] == 'N') || (trans[0] == 'n');                                          \
+      const KK_INT N            = static_cast<KK_INT>(C.extent(0));                                                \
+      const KK_INT K            = static_cast<KK_INT>(noTrans ? A.extent(1) : A.extent(0));                        \
+                                                                                                                   \
+      const KK_INT AST = is_layout_left ? A.stride(1) : A.stride(0), LDA = (AST == 0) ? 1 : AST;                   \
+      const KK_INT CST = is_layout_left ? C.stride(1) : C.stride(0), LDC = (CST == 0) ? 1 : CST;                   \
+                                                                                                                   \
+      const char uplo_  = (upper == is_layout_left) ? 'U' : 'L';                                                   \
+      const char trans_ = (noTrans == is_layout_left) ? 'N' : (hermitian ? 'C' : 'T');                             \
+      if (hermitian)                                                                                               \
+        HostBlas<BASE_SCALAR_TYPE>::herk(uplo_, trans_, N, K, Kokkos::ArithTraits<SCALAR>::real(alpha),            \
+                                         reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA,                 \
+                                         Kokkos::ArithTraits<SCALAR>::real(beta),                                  \
+                                         reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);                      \
+      else                                                                                                         \
+        HostBlas<BASE_SCALAR_TYPE>::syrk(uplo_, trans_, N, K, alpha,                                               \
+                                         reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()), LDA, beta,           \
+                                         reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()), LDC);                      \
+      Kokkos::Profiling::popRegion();                                                                              \
+    }                                                                                                              \
+  };
+
+#define KOKKOSBLAS3_DSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(double, double, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_SSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(float, float, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_ZSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(Kokkos::complex<double>, std::complex<double>, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+#define KOKKOSBLAS3_CSYRK_BLAS(LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL) \
+  KOKKOSBLAS3_SYRK_BLAS(Kokkos::complex<float>, std::complex<float>, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL)
+
+// Explicitly define the SYRK class for all permutations listed below
+
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS(Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}  // namespace Impl
+}  // namespace KokkosBlas
+#endif  // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif  // KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
@@ -271,7 +271,7 @@ void F77_BLAS_MANGLE(zgemm, ZGEMM)(const char*, const char*, KK_INT*, KK_INT*, K
                                    /* */ std::complex<double>*, KK_INT*);
 
 ///
-/// Herk
+/// Syrk
 ///
 
 void F77_BLAS_MANGLE(ssyrk, SSYRK)(const char*, const char*, KK_INT*, KK_INT*, const float*, const float*, KK_INT*,
@@ -280,13 +280,43 @@ void F77_BLAS_MANGLE(ssyrk, SSYRK)(const char*, const char*, KK_INT*, KK_INT*, c
 void F77_BLAS_MANGLE(dsyrk, DSYRK)(const char*, const char*, KK_INT*, KK_INT*, const double*, const double*, KK_INT*,
                                    const double*,
                                    /* */ double*, KK_INT*);
-void F77_BLAS_MANGLE(cherk, CHERK)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<float>*,
+void F77_BLAS_MANGLE(csyrk, CSYRK)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<float>*,
                                    const std::complex<float>*, KK_INT*, const std::complex<float>*,
                                    /* */ std::complex<float>*, KK_INT*);
-void F77_BLAS_MANGLE(zherk, ZHERK)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<double>*,
+void F77_BLAS_MANGLE(zsyrk, ZSYRK)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<double>*,
                                    const std::complex<double>*, KK_INT*, const std::complex<double>*,
                                    /* */ std::complex<double>*, KK_INT*);
 
+///
+/// Herk
+///
+
+void F77_BLAS_MANGLE(cherk, CHERK)(const char*, const char*, KK_INT*, KK_INT*, const float*,
+                                   const std::complex<float>*, KK_INT*, const float*,
+                                   /* */ std::complex<float>*, KK_INT*);
+void F77_BLAS_MANGLE(zherk, ZHERK)(const char*, const char*, KK_INT*, KK_INT*, const double*,
+                                   const std::complex<double>*, KK_INT*, const double*,
+                                   /* */ std::complex<double>*, KK_INT*);
+
+///
+/// Symm
+///
+
+void F77_BLAS_MANGLE(ssymm, SSYMM)(const char*, const char*, KK_INT*, KK_INT*, const float*, const float*, KK_INT*,
+                                   const float*, KK_INT*, const float*,
+                                   /* */ float*, KK_INT*);
+void F77_BLAS_MANGLE(dsymm, DSYMM)(const char*, const char*, KK_INT*, KK_INT*, const double*, const double*, KK_INT*,
+                                   const double*, KK_INT*, const double*,
+                                   /* */ double*, KK_INT*);
+void F77_BLAS_MANGLE(csymm, CSYMM)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<float>*,
+                                   const std::complex<float>*, KK_INT*, const std::complex<float>*, KK_INT*,
+                                   const std::complex<float>*,
+                                   /* */ std::complex<float>*, KK_INT*);
+void F77_BLAS_MANGLE(zsymm, ZSYMM)(const char*, const char*, KK_INT*, KK_INT*, const std::complex<double>*,
+                                   const std::complex<double>*, KK_INT*, const std::complex<double>*, KK_INT*,
+                                   const std::complex<double>*,
+                                   /* */ std::complex<double>*, KK_INT*);
+
 ///
 /// Trmm
 ///
@@ -420,9 +450,16 @@ void F77_BLAS_MANGLE(zscal, ZSCAL)(const KK_INT* N, const std::complex<double>*
 
 #define F77_FUNC_SSYRK F77_BLAS_MANGLE(ssyrk, SSYRK)
 #define F77_FUNC_DSYRK F77_BLAS_MANGLE(dsyrk, DSYRK)
+#define F77_FUNC_CSYRK F77_BLAS_MANGLE(csyrk, CSYRK)
+#define F77_FUNC_ZSYRK F77_BLAS_MANGLE(zsyrk, ZSYRK)
 #define F77_FUNC_CHERK F77_BLAS_MANGLE(cherk, CHERK)
 #define F77_FUNC_ZHERK F77_BLAS_MANGLE(zherk, ZHERK)
 
+#define F77_FUNC_SSYMM F77_BLAS_MANGLE(ssymm, SSYMM)
+#define F77_FUNC_DSYMM F77_BLAS_MANGLE(dsymm, DSYMM)
+#define F77_FUNC_CSYMM F77_BLAS_MANGLE(csymm, CSYMM)
+#define F77_FUNC_ZSYMM F77_BLAS_MANGLE(zsymm, ZSYMM)
+
 #define F77_FUNC_STRMM F77_BLAS_MANGLE(strmm, STRMM)
 #define F77_FUNC_DTRMM F77_BLAS_MANGLE(dtrmm, DTRMM)
 #define F77_FUNC_CTRMM F77_BLAS_MANGLE(ctrmm, CTRMM)
@@ -521,10 +558,22 @@ void HostBlas<float>::gemm(const char transa, const char transb, KK_INT m, KK_IN
   F77_FUNC_SGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
-void HostBlas<float>::herk(const char transa, const char transb, KK_INT n, KK_INT k, const float alpha, const float* a,
+void HostBlas<float>::syrk(const char uplo, const char trans, KK_INT n, KK_INT k, const float alpha, const float* a,
                            KK_INT lda, const float beta,
                            /* */ float* c, KK_INT ldc) {
-  F77_FUNC_SSYRK(&transa, &transb, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+  F77_FUNC_SSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<float>::herk(const char uplo, const char trans, KK_INT n, KK_INT k, const float alpha, const float* a,
+                           KK_INT lda, const float beta,
+                           /* */ float* c, KK_INT ldc) {
+  F77_FUNC_SSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<float>::symm(const char side, const char uplo, KK_INT m, KK_INT n, const float alpha, const float* a,
+                           KK_INT lda, const float* b, KK_INT ldb, const float beta,
+                           /* */ float* c, KK_INT ldc) {
+  F77_FUNC_SSYMM(&side, &uplo, &m, &n, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
 void HostBlas<float>::trmm(const char side, const char uplo, const char transa, const char diag, KK_INT m, KK_INT n,
@@ -624,10 +673,22 @@ void HostBlas<double>::gemm(const char transa, const char transb, KK_INT m, KK_I
   F77_FUNC_DGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
-void HostBlas<double>::herk(const char transa, const char transb, KK_INT n, KK_INT k, const double alpha,
-                            const double* a, KK_INT lda, const double beta,
+void HostBlas<double>::syrk(const char uplo, const char trans, KK_INT n, KK_INT k, const double alpha, const double* a,
+                            KK_INT lda, const double beta,
+                            /* */ double* c, KK_INT ldc) {
+  F77_FUNC_DSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<double>::herk(const char uplo, const char trans, KK_INT n, KK_INT k, const double alpha, const double* a,
+                            KK_INT lda, const double beta,
+                            /* */ double* c, KK_INT ldc) {
+  F77_FUNC_DSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+template <>
+void HostBlas<double>::symm(const char side, const char uplo, KK_INT m, KK_INT n, const double alpha, const double* a,
+                            KK_INT lda, const double* b, KK_INT ldb, const double beta,
                             /* */ double* c, KK_INT ldc) {
-  F77_FUNC_DSYRK(&transa, &transb, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+  F77_FUNC_DSYMM(&side, &uplo, &m, &n, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
 }
 template <>
 void HostBlas<double>::trmm(const char side, const char uplo, const char transa, const char diag, KK_INT m, KK_INT n,
@@ -747,14 +808,29 @@ void HostBlas<std::complex<float> >::gemm(const char transa, const char transb,
                  (const std::complex<float>*)b, &ldb, &beta, (std::complex<float>*)c, &ldc);
 }
 template <>
-void HostBlas<std::complex<float> >::herk(const char transa, const char transb, KK_INT n, KK_INT k,
+void HostBlas<std::complex<float> >::syrk(const char uplo, const char trans, KK_INT n, KK_INT k,
                                           const std::complex<float> alpha, const std::complex<float>* a, KK_INT lda,
                                           const std::complex<float> beta,
                                           /* */ std::complex<float>* c, KK_INT ldc) {
-  F77_FUNC_CHERK(&transa, &transb, &n, &k, &alpha, (const std::complex<float>*)a, &lda, &beta, (std::complex<float>*)c,
+  F77_FUNC_CSYRK(&uplo, &trans, &n, &k, &alpha, (const std::complex<float>*)a, &lda, &beta, (std::complex<float>*)c,
                  &ldc);
 }
 template <>
+void HostBlas<std::complex<float> >::herk(const char uplo, const char trans, KK_INT n, KK_INT k, const float alpha,
+                                          const std::complex<float>* a, KK_INT lda, const float beta,
+                                          /* */ std::complex<float>* c, KK_INT ldc) {
+  F77_FUNC_CHERK(&uplo, &trans, &n, &k, &alpha, (const std::complex<float>*)a, &lda, &beta, (std::complex<float>*)c,
+                 &ldc);
+}
+template <>
+void HostBlas<std::complex<float> >::symm(const char side, const char uplo, KK_INT m, KK_INT n,
+                                          const std::complex<float> alpha, const std::complex<float>* a, KK_INT lda,
+                                          const std::complex<float>* b, KK_INT ldb, const std::complex<float> beta,
+                                          /* */ std::complex<float>* c, KK_INT ldc) {
+  F77_FUNC_CSYMM(&side, &uplo, &m, &n, &alpha, (const std::complex<float>*)a, &lda, (const std::complex<float>*)b,
+                 &ldb, &beta, (std::complex<float>*)c, &ldc);
+}
+template <>
 void HostBlas<std::complex<float> >::trmm(const char side, const char uplo, const char transa, const char diag,
                                           KK_INT m, KK_INT n, const std::complex<float> alpha,
                                           const std::complex<float>* a, KK_INT lda,
@@ -890,12 +966,27 @@ void HostBlas<std::complex<double> >::gemm(const char transa, const char transb,
                  (const std::complex<double>*)b, &ldb, &beta, (std::complex<double>*)c, &ldc);
 }
 template <>
-void HostBlas<std::complex<double> >::herk(const char transa, const char transb, KK_INT n, KK_INT k,
+void HostBlas<std::complex<double> >::syrk(const char uplo, const char trans, KK_INT n, KK_INT k,
                                            const std::complex<double> alpha, const std::complex<double>* a, KK_INT lda,
                                            const std::complex<double> beta,
                                            /* */ std::complex<double>* c, KK_INT ldc) {
-  F77_FUNC_ZHERK(&transa, &transb, &n, &k, &alpha, (const std::complex<double>*)a, &lda, &beta,
-                 (std::complex<double>*)c, &ldc);
+  F77_FUNC_ZSYRK(&uplo, &trans, &n, &k, &alpha, (const std::complex<double>*)a, &lda, &beta, (std::complex<double>*)c,
+                 &ldc);
+}
+template <>
+void HostBlas<std::complex<double> >::herk(const char uplo, const char trans, KK_INT n, KK_INT k, const double alpha,
+                                           const std::complex<double>* a, KK_INT lda, const double beta,
+                                           /* */ std::complex<double>* c, KK_INT ldc) {
+  F77_FUNC_ZHERK(&uplo, &trans, &n, &k, &alpha, (const std::complex<double>*)a, &lda, &beta, (std::complex<double>*)c,
+                 &ldc);
+}
+template <>
+void HostBlas<std::complex<double> >::symm(const char side, const char uplo, KK_INT m, KK_INT n,
+                                           const std::complex<double> alpha, const std::complex<double>* a, KK_INT lda,
+                                           const std::complex<double>* b, KK_INT ldb, const std::complex<double> beta,
+                                           /* */ std::complex<double>* c, KK_INT ldc) {
+  F77_FUNC_ZSYMM(&side, &uplo, &m, &n, &alpha, (const std::complex<double>*)a, &lda, (const std::complex<double>*)b,
+                 &ldb, &beta, (std::complex<double>*)c, &ldc);
 }
 template <>
 void HostBlas<std::complex<double> >::trmm(const char side, const char uplo, const char transa, const char diag,
@@ -98,10 +98,18 @@ struct HostBlas {
                    KK_INT lda, const T *b, KK_INT ldb, const T beta,
                    /* */ T *c, KK_INT ldc);
 
-  static void herk(const char transa, const char transb, KK_INT n, KK_INT k, const T alpha, const T *a, KK_INT lda,
+  static void syrk(const char uplo, const char trans, KK_INT n, KK_INT k, const T alpha, const T *a, KK_INT lda,
                    const T beta,
                    /* */ T *c, KK_INT ldc);
 
+  static void herk(const char uplo, const char trans, KK_INT n, KK_INT k, const mag_type alpha, const T *a,
+                   KK_INT lda, const mag_type beta,
+                   /* */ T *c, KK_INT ldc);
+
+  static void symm(const char side, const char uplo, KK_INT m, KK_INT n, const T alpha, const T *a, KK_INT lda,
+                   const T *b, KK_INT ldb, const T beta,
+                   /* */ T *c, KK_INT ldc);
+
   static void trmm(const char side, const char uplo, const char transa, const char diag, KK_INT m, KK_INT n,
                    const T alpha, const T *a, KK_INT lda,
                    /* */ T *b, KK_INT ldb);
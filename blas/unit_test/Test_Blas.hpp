@@ -74,6 +74,8 @@
 #include "Test_Blas3_gemm.hpp"
 #include "Test_Blas3_trmm.hpp"
 #include "Test_Blas3_trsm.hpp"
+#include "Test_Blas3_syrk.hpp"
+#include "Test_Blas3_symm.hpp"
 
 // TPLs
 #include "Test_Blas_rocblas.hpp"
@@ -328,6 +328,9 @@ void test_gemm() {
                                                                                 beta);
         Test::impl_test_gemm<view_type_a, view_type_b, view_type_c, TestDevice>(amode, bmode, 12, 3071, 517, alpha,
                                                                                 beta);
+        // Several cache blocks of the host kernel in M and N
+        Test::impl_test_gemm<view_type_a, view_type_b, view_type_c, TestDevice>(amode, bmode, 411, 4111, 3, alpha,
+                                                                                beta);
       }
     }
   }
@@ -0,0 +1,123 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas3_symm.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// The triangle of A that is not referenced is filled with garbage, so that
+// reading it instead of the stored one shows up in the result.
+template <class ViewTypeA, class ViewTypeC, class Device>
+void impl_test_symm(const char* side, const char* uplo, int M, int N) {
+  using execution_space = typename Device::execution_space;
+  using ScalarC         = typename ViewTypeC::value_type;
+  using APT             = Kokkos::ArithTraits<ScalarC>;
+  using mag_type        = typename APT::mag_type;
+
+  const bool left  = (side[0] == 'L');
+  const bool upper = (uplo[0] == 'U');
+  const ScalarC alpha(1.5), beta(-0.5);
+  const int A_n = left ? M : N;
+
+  ViewTypeA A("A", A_n, A_n);
+  ViewTypeC B("B", M, N);
+  ViewTypeC C("C", M, N);
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  ScalarC randStart, randEnd;
+  Test::getRandomBounds(1.0, randStart, randEnd);
+  Kokkos::fill_random(A, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(B, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(C, rand_pool, randStart, randEnd);
+
+  auto h_A = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  for (int i = 0; i < A_n; i++) {
+    for (int j = 0; j < A_n; j++) {
+      if (upper ? i > j : i < j) h_A(i, j) = ScalarC(1.0e10);
+    }
+  }
+  Kokkos::deep_copy(A, h_A);
+  auto symA = [&](int i, int j) { return (upper ? i <= j : i >= j) ? h_A(i, j) : h_A(j, i); };
+  auto h_B  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto h_C0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  KokkosBlas::symm(side, uplo, alpha, A, B, beta, C);
+  auto h_C = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const mag_type eps = 1.0e4 * APT::epsilon();
+  int numErrors      = 0;
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      ScalarC ref = beta * h_C0(i, j);
+      if (left) {
+        for (int k = 0; k < M; k++) ref += alpha * symA(i, k) * h_B(k, j);
+      } else {
+        for (int k = 0; k < N; k++) ref += alpha * h_B(i, k) * symA(k, j);
+      }
+      if (APT::abs(h_C(i, j) - ref) > eps * (APT::abs(ref) + A_n)) numErrors++;
+    }
+  }
+  EXPECT_EQ(numErrors, 0) << "symm " << side << uplo << " M=" << M << " N=" << N;
+}
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_symm(const char* side, const char* uplo) {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+  Test::impl_test_symm<view_type_ll, view_type_ll, Device>(side, uplo, 0, 0);
+  Test::impl_test_symm<view_type_ll, view_type_ll, Device>(side, uplo, 101, 19);
+  Test::impl_test_symm<view_type_ll, view_type_ll, Device>(side, uplo, 19, 101);
+  Test::impl_test_symm<view_type_ll, view_type_ll, Device>(side, uplo, 131, 157);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+  Test::impl_test_symm<view_type_lr, view_type_lr, Device>(side, uplo, 0, 0);
+  Test::impl_test_symm<view_type_lr, view_type_lr, Device>(side, uplo, 101, 19);
+  Test::impl_test_symm<view_type_lr, view_type_lr, Device>(side, uplo, 19, 101);
+  Test::impl_test_symm<view_type_lr, view_type_lr, Device>(side, uplo, 131, 157);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, symm_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::symm_double");
+  test_symm<double, TestDevice>("L", "U");
+  test_symm<double, TestDevice>("L", "L");
+  test_symm<double, TestDevice>("R", "U");
+  test_symm<double, TestDevice>("R", "L");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, symm_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::symm_complex_double");
+  test_symm<Kokkos::complex<double>, TestDevice>("L", "U");
+  test_symm<Kokkos::complex<double>, TestDevice>("R", "L");
+  Kokkos::Profiling::popRegion();
+}
+#endif
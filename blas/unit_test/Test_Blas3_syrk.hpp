@@ -0,0 +1,134 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <KokkosBlas3_syrk.hpp>
+#include <KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+// Compares the uplo triangle of C against a host reference, and checks that
+// the other triangle is left untouched.
+template <class ViewTypeA, class ViewTypeC, class Device>
+void impl_test_syrk(const char* uplo, const char* trans, const bool hermitian, int N, int K) {
+  using execution_space = typename Device::execution_space;
+  using ScalarC         = typename ViewTypeC::value_type;
+  using APT             = Kokkos::ArithTraits<ScalarC>;
+  using mag_type        = typename APT::mag_type;
+
+  const bool upper   = (uplo[0] == 'U');
+  const bool noTrans = (trans[0] == 'N');
+  const mag_type alpha(1.5), beta(-0.5);
+
+  ViewTypeA A("A", noTrans ? N : K, noTrans ? K : N);
+  ViewTypeC C("C", N, N);
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  ScalarC randStart, randEnd;
+  Test::getRandomBounds(1.0, randStart, randEnd);
+  Kokkos::fill_random(A, rand_pool, randStart, randEnd);
+  Kokkos::fill_random(C, rand_pool, randStart, randEnd);
+
+  auto h_A  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto h_C0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  if (hermitian)
+    KokkosBlas::herk(uplo, trans, alpha, A, beta, C);
+  else
+    KokkosBlas::syrk(uplo, trans, ScalarC(alpha), A, ScalarC(beta), C);
+  auto h_C = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const mag_type eps = 1.0e4 * APT::epsilon();
+  int numErrors      = 0;
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      if (upper ? i > j : i < j) {
+        if (h_C(i, j) != h_C0(i, j)) numErrors++;
+        continue;
+      }
+      ScalarC ref = beta * h_C0(i, j);
+      for (int k = 0; k < K; k++) {
+        ScalarC a_ik = noTrans ? h_A(i, k) : h_A(k, i);
+        ScalarC a_jk = noTrans ? h_A(j, k) : h_A(k, j);
+        ref += alpha * a_ik * (hermitian ? APT::conj(a_jk) : a_jk);
+      }
+      if (hermitian && i == j) ref = ScalarC(APT::real(ref));
+      if (APT::abs(h_C(i, j) - ref) > eps * (APT::abs(ref) + K)) numErrors++;
+    }
+  }
+  EXPECT_EQ(numErrors, 0) << (hermitian ? "herk " : "syrk ") << uplo << trans << " N=" << N << " K=" << K;
+}
+}  // namespace Test
+
+template <class Scalar, class Device>
+int test_syrk(const char* uplo, const char* trans, const bool hermitian) {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_ll = Kokkos::View<Scalar**, Kokkos::LayoutLeft, Device>;
+  Test::impl_test_syrk<view_type_ll, view_type_ll, Device>(uplo, trans, hermitian, 0, 0);
+  Test::impl_test_syrk<view_type_ll, view_type_ll, Device>(uplo, trans, hermitian, 13, 0);
+  Test::impl_test_syrk<view_type_ll, view_type_ll, Device>(uplo, trans, hermitian, 101, 19);
+  Test::impl_test_syrk<view_type_ll, view_type_ll, Device>(uplo, trans, hermitian, 157, 131);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  using view_type_lr = Kokkos::View<Scalar**, Kokkos::LayoutRight, Device>;
+  Test::impl_test_syrk<view_type_lr, view_type_lr, Device>(uplo, trans, hermitian, 0, 0);
+  Test::impl_test_syrk<view_type_lr, view_type_lr, Device>(uplo, trans, hermitian, 13, 0);
+  Test::impl_test_syrk<view_type_lr, view_type_lr, Device>(uplo, trans, hermitian, 101, 19);
+  Test::impl_test_syrk<view_type_lr, view_type_lr, Device>(uplo, trans, hermitian, 157, 131);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syrk_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_double");
+  test_syrk<double, TestDevice>("U", "N", false);
+  test_syrk<double, TestDevice>("U", "T", false);
+  test_syrk<double, TestDevice>("L", "N", false);
+  test_syrk<double, TestDevice>("L", "T", false);
+  Kokkos::Profiling::popRegion();
+}
+TEST_F(TestCategory, herk_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::herk_double");
+  test_syrk<double, TestDevice>("U", "N", true);
+  test_syrk<double, TestDevice>("L", "C", true);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F(TestCategory, syrk_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_complex_double");
+  test_syrk<Kokkos::complex<double>, TestDevice>("U", "N", false);
+  test_syrk<Kokkos::complex<double>, TestDevice>("L", "T", false);
+  Kokkos::Profiling::popRegion();
+}
+TEST_F(TestCategory, herk_complex_double) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::herk_complex_double");
+  test_syrk<Kokkos::complex<double>, TestDevice>("U", "N", true);
+  test_syrk<Kokkos::complex<double>, TestDevice>("U", "C", true);
+  test_syrk<Kokkos::complex<double>, TestDevice>("L", "N", true);
+  test_syrk<Kokkos::complex<double>, TestDevice>("L", "C", true);
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -15,6 +15,7 @@
 //@HEADER
 #ifndef KOKKOSKERNELS_HASHMAPACCUMULATOR_HPP
 #define KOKKOSKERNELS_HASHMAPACCUMULATOR_HPP
+#include <Kokkos_Core.hpp>
 #include <Kokkos_Atomic.hpp>
 #include "KokkosKernels_Macros.hpp"
 #include <atomic>
@@ -357,6 +358,38 @@ struct HashmapAccumulator {
     return insert_success_;
   }
 
+  // used in masked spgemm, where the keys (the mask row) are known up front.
+  // The key is stored at the caller-chosen index (e.g. its position within
+  // the mask row), so no used_size counter is needed and keys[index],
+  // values[index] stay addressable by that position.
+  // Insertion is simultaneous for the threads of a team; keys must be unique.
+  KOKKOS_INLINE_FUNCTION
+  void vector_atomic_insert_into_hash_at(const key_type key, const size_type index) {
+    if (key == -1) return;
+
+    const size_type hash = compute_hash(key, hashOpRHS_);
+    keys[index]          = key;
+#ifdef KOKKOSKERNELS_CUDA_INDEPENDENT_THREADS
+    // see vector_atomic_insert_into_hash: keep the list complete while
+    // hash_begins[hash] is being exchanged.
+    hash_nexts[index] = hash_begins[hash];
+#endif
+    hash_nexts[index] = Kokkos::atomic_exchange(hash_begins + hash, index);
+  }
+
+  // lookup only, nothing is inserted.
+  // returns the index of key in keys/values, or -1 if it is not in the map.
+  KOKKOS_INLINE_FUNCTION
+  size_type find(const key_type key) {
+    if (key == -1) return -1;
+
+    const size_type hash = compute_hash(key, hashOpRHS_);
+    for (size_type i = hash_begins[hash]; i != -1; i = hash_nexts[i]) {
+      if (keys[i] == key) return i;
+    }
+    return -1;
+  }
+
   // used in the kkmem's numeric phase for second level hashmaps.
   // function to be called from device.
   // Accumulation is Add operation. It is not atomicAdd, as this
@@ -844,6 +877,233 @@ struct HashmapAccumulator {
   // private
 };  // struct HashmapAccumulator
 
+/**
+ * \brief Bump allocator over one buffer, for accumulators whose size is only
+ * known inside a kernel (see GrowableHashmapAccumulator).
+ *
+ * Allocating is one atomic add, so any number of teams can allocate
+ * concurrently; nothing is freed until reset(). allocate returns nullptr once
+ * the buffer is exhausted, and the caller must then fall back to some other
+ * path (e.g. retry the work in a later pass).
+ */
+template <typename MemorySpace>
+struct HashmapArena {
+  using memory_space = MemorySpace;
+
+  // every allocation is aligned for any key or value type
+  static constexpr size_t alignment = 16;
+
+  HashmapArena() = default;
+
+  explicit HashmapArena(size_t bytes)
+      : buffer_(Kokkos::view_alloc(Kokkos::WithoutInitializing, "HashmapArena buffer"), bytes),
+        top_("HashmapArena top") {}
+
+  KOKKOS_INLINE_FUNCTION
+  void *allocate(size_t bytes) const {
+    bytes              = (bytes + alignment - 1) / alignment * alignment;
+    const size_t begin = Kokkos::atomic_fetch_add(&top_(), bytes);
+    if (begin + bytes > buffer_.extent(0)) return nullptr;
+    return buffer_.data() + begin;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t capacity() const { return buffer_.extent(0); }
+
+  // Bytes requested since the last reset, including failed requests: the
+  // size the buffer would have needed.
+  size_t requested() const {
+    size_t top = 0;
+    if (top_.data()) Kokkos::deep_copy(top, top_);
+    return top;
+  }
+
+  void reset() const { Kokkos::deep_copy(top_, size_t(0)); }
+
+ private:
+  Kokkos::View<char *, MemorySpace> buffer_;
+  Kokkos::View<size_t, MemorySpace> top_;
+};
+
+/**
+ * \brief Lock-free open addressing accumulator (linear probing) that grows
+ * cooperatively.
+ *
+ * Unlike HashmapAccumulator, whose capacity is fixed by the chunk it is given,
+ * this map starts small and doubles into memory taken from a HashmapArena
+ * whenever a team is about to exceed 3/4 load. Growth only happens in
+ * team_reserve, between batches of insertions, so the insertions themselves
+ * never fail and never wait: an empty slot is claimed with one CAS, and
+ * values are merged with atomic adds.
+ *
+ * Usage, for every thread of a team (all calls are team-collective except
+ * the insertions):
+ *   map = GrowableHashmapAccumulator::team_create(team, capacity, arena);
+ *   for each batch of at most B keys:
+ *     if (!map.team_reserve(team, B, arena)) -> arena exhausted, fall back
+ *     insert the batch with vector_atomic_insert_mergeAtomicAdd
+ * then read the used slots (keys[i] != empty_key) of the capacity slots.
+ *
+ * \var keys:      capacity slots, empty_key when unused
+ * \var values:    capacity slots, merged with atomic adds
+ * \var capacity:  number of slots, a power of 2
+ * \var used_size: number of keys in the map, shared by the team (it lives in
+ *                 the arena)
+ */
+template <typename size_type, typename key_type, typename value_type>
+struct GrowableHashmapAccumulator {
+  static constexpr key_type empty_key = ~key_type(0);
+
+  key_type *keys;
+  value_type *values;
+  size_type capacity;
+  size_type *used_size;
+
+  KOKKOS_INLINE_FUNCTION
+  GrowableHashmapAccumulator() : keys(), values(), capacity(0), used_size() {}
+
+  KOKKOS_INLINE_FUNCTION
+  GrowableHashmapAccumulator(const size_type capacity_, key_type *keys_, value_type *values_, size_type *used_size_)
+      : keys(keys_), values(values_), capacity(capacity_), used_size(used_size_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_valid() const { return keys != nullptr; }
+
+  // number of keys the map may hold before it must grow
+  KOKKOS_INLINE_FUNCTION
+  static size_type max_load(const size_type capacity_) { return capacity_ - capacity_ / 4; }
+
+  // bytes of the keys and values of a table of capacity_ slots
+  KOKKOS_INLINE_FUNCTION
+  static size_t table_bytes(const size_type capacity_) {
+    const size_t key_bytes = (capacity_ * sizeof(key_type) + alignof(value_type) - 1) / alignof(value_type);
+    return key_bytes * alignof(value_type) + capacity_ * sizeof(value_type);
+  }
+
+  // Allocates an empty map of at least capacity_ slots (rounded up to a power
+  // of 2) from the arena. Returns an invalid map (on every thread) if the
+  // arena is exhausted.
+  template <typename team_member_t, typename arena_t>
+  KOKKOS_INLINE_FUNCTION static GrowableHashmapAccumulator team_create(const team_member_t &team,
+                                                                       const size_type capacity_,
+                                                                       const arena_t &arena) {
+    // at least 4 slots, so that max_load < capacity
+    size_type pow2 = 4;
+    while (pow2 < capacity_) pow2 *= 2;
+    char *mem = nullptr;
+    Kokkos::single(
+        Kokkos::PerTeam(team),
+        [&](char *&m) {
+          m = static_cast<char *>(arena.allocate(arena_t::alignment + table_bytes(pow2)));
+          if (m) *reinterpret_cast<size_type *>(m) = 0;
+        },
+        mem);
+    if (mem == nullptr) return GrowableHashmapAccumulator();
+    GrowableHashmapAccumulator map = from_table(pow2, mem + arena_t::alignment, reinterpret_cast<size_type *>(mem));
+    map.team_clear(team);
+    team.team_barrier();
+    return map;
+  }
+
+  // Makes room for num_new_keys more keys, doubling the table into arena
+  // memory as many times as needed and rehashing the keys in parallel. Must
+  // be called by every thread of the team, with the same num_new_keys, while
+  // no insertion is in flight. Returns false (on every thread, with the map
+  // unchanged) if the arena is exhausted.
+  template <typename team_member_t, typename arena_t>
+  KOKKOS_INLINE_FUNCTION bool team_reserve(const team_member_t &team, const size_type num_new_keys,
+                                           const arena_t &arena) {
+    team.team_barrier();
+    // read used_size on one thread and broadcast it, so that every thread
+    // takes the same branch and none inserts before the read is done
+    size_type needed = 0;
+    Kokkos::single(Kokkos::PerTeam(team), [&](size_type &n) { n = *used_size + num_new_keys; }, needed);
+    if (needed <= max_load(capacity)) return true;
+    size_type new_capacity = capacity;
+    while (max_load(new_capacity) < needed) new_capacity *= 2;
+    char *mem = nullptr;
+    Kokkos::single(
+        Kokkos::PerTeam(team), [&](char *&m) { m = static_cast<char *>(arena.allocate(table_bytes(new_capacity))); },
+        mem);
+    if (mem == nullptr) return false;
+    GrowableHashmapAccumulator grown = from_table(new_capacity, mem, used_size);
+    grown.team_clear(team);
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, capacity), [&](const size_type i) {
+      // the keys are unique and already counted
+      if (keys[i] != empty_key) grown.insert_key(keys[i], true, values[i]);
+    });
+    team.team_barrier();
+    *this = grown;
+    return true;
+  }
+
+  // Lock-free insertion, merging the values of equal keys with atomic adds.
+  // Any number of threads may insert concurrently, as long as the map holds
+  // fewer than capacity keys (which team_reserve guarantees).
+  KOKKOS_INLINE_FUNCTION
+  void vector_atomic_insert_mergeAtomicAdd(const key_type key, const value_type value) const {
+    if (insert_key(key, true, value)) Kokkos::atomic_inc(used_size);
+  }
+
+  // keys only, for symbolic phases. values may be null.
+  KOKKOS_INLINE_FUNCTION
+  void vector_atomic_insert(const key_type key) const {
+    if (insert_key(key, false, value_type())) Kokkos::atomic_inc(used_size);
+  }
+
+  // returns the slot of key, or -1 if it is not in the map
+  KOKKOS_INLINE_FUNCTION
+  size_type find(const key_type key) const {
+    for (size_type slot = hash(key), probes = 0; probes < capacity; slot = (slot + 1) & (capacity - 1), probes++) {
+      if (keys[slot] == key) return slot;
+      if (keys[slot] == empty_key) break;
+    }
+    return size_type(-1);
+  }
+
+ private:
+  static constexpr size_type hash_scalar = 107;
+
+  KOKKOS_INLINE_FUNCTION
+  static GrowableHashmapAccumulator from_table(const size_type capacity_, char *table, size_type *used_size_) {
+    const size_t key_bytes = table_bytes(capacity_) - capacity_ * sizeof(value_type);
+    return GrowableHashmapAccumulator(capacity_, reinterpret_cast<key_type *>(table),
+                                      reinterpret_cast<value_type *>(table + key_bytes), used_size_);
+  }
+
+  template <typename team_member_t>
+  KOKKOS_INLINE_FUNCTION void team_clear(const team_member_t &team) const {
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, capacity), [&](const size_type i) {
+      keys[i]   = empty_key;
+      values[i] = value_type();
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type hash(const key_type key) const { return (size_type(key) * hash_scalar) & (capacity - 1); }
+
+  // returns true if key was not in the map
+  KOKKOS_INLINE_FUNCTION
+  bool insert_key(const key_type key, const bool merge, const value_type value) const {
+    for (size_type slot = hash(key);; slot = (slot + 1) & (capacity - 1)) {
+      key_type slot_key = keys[slot];
+      bool inserted     = false;
+      if (slot_key == empty_key) {
+        slot_key = Kokkos::atomic_compare_exchange(keys + slot, empty_key, key);
+        if (slot_key == empty_key) {
+          slot_key = key;
+          inserted = true;
+        }
+      }
+      if (slot_key == key) {
+        if (merge) Kokkos::atomic_add(values + slot, value);
+        return inserted;
+      }
+    }
+  }
+};
+
 }  // namespace Experimental
 }  // namespace KokkosKernels
 
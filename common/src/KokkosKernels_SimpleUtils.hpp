@@ -17,6 +17,7 @@
 #define KOKKOSKERNELS_SIMPLEUTILS_HPP
 #include "Kokkos_Core.hpp"
 #include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
 #include <type_traits>
 
 #define KOKKOSKERNELS_MACRO_MIN(x, y) ((x) < (y) ? (x) : (y))
@@ -75,6 +76,216 @@ struct InclusiveParallelPrefixSum {
   }
 };
 
+// Transform of the single-pass scan that keeps the prefixes as they are
+struct ScanIdentityTransform {
+  template <typename T>
+  KOKKOS_INLINE_FUNCTION T operator()(const size_t, const T prefix) const {
+    return prefix;
+  }
+};
+
+/*! \brief Single-pass exclusive scan with decoupled look-back.
+ *
+ *  The input is split in tiles, taken in order by the teams through an atomic
+ *  counter. A team writes count(i) for the elements of its tile to out and
+ *  publishes the tile sum (aggregate). One thread then walks back over the
+ *  preceding tiles, adding their aggregates until it reaches a tile that has
+ *  published its inclusive prefix, and publishes its own inclusive prefix.
+ *  Finally the team scans its tile in place, which is still in cache. Every
+ *  element is read and written once, instead of twice for the reduce-then-scan
+ *  of parallel_scan. A tile only waits for tiles that were taken before it,
+ *  hence by teams that are already running, so the look-back always makes
+ *  progress. The prefixes go through transform(i, prefix) as they are
+ *  written, so that a computation on the scanned values needs no extra pass.
+ */
+template <typename ExecSpace, typename CountFunctor, typename OutView,
+          typename TransformFunctor = ScanIdentityTransform>
+struct SinglePassScanFunctor {
+  using value_type  = typename OutView::non_const_value_type;
+  using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using flags_t     = Kokkos::View<int *, typename OutView::memory_space>;
+  using sums_t      = Kokkos::View<value_type *, typename OutView::memory_space>;
+
+  // tile status
+  static constexpr int tileEmpty     = 0;
+  static constexpr int tileAggregate = 1;
+  static constexpr int tilePrefix    = 2;
+
+  size_t n;
+  size_t tileSize;
+  int numTiles;
+  bool writeTotal;
+  CountFunctor count;
+  TransformFunctor transform;
+  OutView out;
+  // flags(t) is the status of tile t, flags(numTiles) the tile counter
+  flags_t flags;
+  // aggregates in [0, numTiles), inclusive prefixes in [numTiles, 2 * numTiles)
+  sums_t sums;
+
+  SinglePassScanFunctor(size_t n_, size_t tileSize_, int numTiles_, bool writeTotal_, const CountFunctor &count_,
+                        const TransformFunctor &transform_, const OutView &out_, const flags_t &flags_,
+                        const sums_t &sums_)
+      : n(n_),
+        tileSize(tileSize_),
+        numTiles(numTiles_),
+        writeTotal(writeTotal_),
+        count(count_),
+        transform(transform_),
+        out(out_),
+        flags(flags_),
+        sums(sums_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void publish(const int tile, const int status, const value_type sum) const {
+    Kokkos::atomic_store(&sums(status == tilePrefix ? numTiles + tile : tile), sum);
+    Kokkos::memory_fence();
+    Kokkos::atomic_store(&flags(tile), status);
+  }
+
+  // Returns the sum of all the tiles before tile
+  KOKKOS_INLINE_FUNCTION
+  value_type lookback(const int tile, const value_type aggregate) const {
+    if (tile == 0) {
+      publish(tile, tilePrefix, aggregate);
+      return value_type(0);
+    }
+    publish(tile, tileAggregate, aggregate);
+    value_type exclusive(0);
+    for (int pred = tile - 1;; --pred) {
+      int status;
+      while ((status = Kokkos::atomic_load(&flags(pred))) == tileEmpty) {
+      }
+      Kokkos::memory_fence();
+      if (status == tilePrefix) {
+        exclusive += Kokkos::atomic_load(&sums(numTiles + pred));
+        break;
+      }
+      exclusive += Kokkos::atomic_load(&sums(pred));
+    }
+    publish(tile, tilePrefix, exclusive + aggregate);
+    return exclusive;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &t) const {
+    int tile;
+    Kokkos::single(
+        Kokkos::PerTeam(t), [&](int &myTile) { myTile = Kokkos::atomic_fetch_add(&flags(numTiles), 1); }, tile);
+    const size_t begin = tile * tileSize;
+    const size_t end   = KOKKOSKERNELS_MACRO_MIN(n, begin + tileSize);
+    value_type aggregate(0);
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(t, begin, end),
+        [&](const size_t i, value_type &lsum) {
+          const value_type v = count(i);
+          out(i)             = v;
+          lsum += v;
+        },
+        aggregate);
+    value_type exclusive(0);
+    Kokkos::single(
+        Kokkos::PerTeam(t), [&](value_type &tileExclusive) { tileExclusive = lookback(tile, aggregate); }, exclusive);
+    t.team_barrier();
+    Kokkos::parallel_scan(Kokkos::TeamThreadRange(t, begin, end),
+                          [&](const size_t i, value_type &partial, const bool final) {
+                            const value_type v = out(i);
+                            if (final) out(i) = transform(i, exclusive + partial);
+                            partial += v;
+                          });
+    if (writeTotal && tile == numTiles - 1) {
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { out(n) = transform(n, exclusive + aggregate); });
+    }
+  }
+};
+
+template <typename ExecSpace>
+constexpr size_t single_pass_scan_tile_size() {
+  return KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace> ? 4096 : 16384;
+}
+
+template <typename ExecSpace, typename CountFunctor, typename OutView,
+          typename TransformFunctor = ScanIdentityTransform>
+typename OutView::non_const_value_type single_pass_exclusive_scan_impl(
+    const ExecSpace &exec, size_t n, const CountFunctor &count, const OutView &out, bool writeTotal, bool returnTotal,
+    const TransformFunctor &transform = TransformFunctor()) {
+  using functor_t  = SinglePassScanFunctor<ExecSpace, CountFunctor, OutView, TransformFunctor>;
+  using value_type = typename functor_t::value_type;
+  if (n == 0) {
+    if (writeTotal) {
+      Kokkos::parallel_for(
+          "KokkosKernels::Common::SinglePassScan::Empty", Kokkos::RangePolicy<ExecSpace>(exec, 0, 1),
+          KOKKOS_LAMBDA(const size_t) { out(0) = transform(0, value_type(0)); });
+    }
+    return value_type(0);
+  }
+  const size_t tileSize = single_pass_scan_tile_size<ExecSpace>();
+  const int numTiles    = (n + tileSize - 1) / tileSize;
+  typename functor_t::flags_t flags(Kokkos::view_alloc(exec, "single pass scan flags"), numTiles + 1);
+  typename functor_t::sums_t sums(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "single pass scan sums"),
+                                  2 * numTiles);
+  Kokkos::parallel_for("KokkosKernels::Common::SinglePassScan",
+                       Kokkos::TeamPolicy<ExecSpace>(exec, numTiles, Kokkos::AUTO),
+                       functor_t(n, tileSize, numTiles, writeTotal, count, transform, out, flags, sums));
+  value_type total(0);
+  if (returnTotal) {
+    exec.fence();
+    Kokkos::deep_copy(total, Kokkos::subview(sums, 2 * numTiles - 1));
+  }
+  return total;
+}
+
+/***
+ * \brief Single-pass exclusive scan of count(i), i in [0, n), into out:
+ * out(i) = count(0) + ... + count(i - 1). If out has more than n entries,
+ * out(n) is set to the total. count is called exactly once per element, so it
+ * can compute the values being scanned (e.g. the number of entries of a row)
+ * instead of reading them from a separately filled array: counting and scanning
+ * a row map takes a single kernel. count(i) may read out(i), which allows
+ * scanning in place, but no other entry of out.
+ * \param exec: the execution space instance on which to run
+ * \param n: number of elements to scan
+ * \param count: functor with KOKKOS_INLINE_FUNCTION value_type operator()(size_t i) const
+ * \param out: output view of at least n entries
+ * \return the total (this fences exec)
+ */
+template <typename ExecSpace, typename CountFunctor, typename OutView>
+typename OutView::non_const_value_type kk_single_pass_exclusive_scan(const ExecSpace &exec, size_t n,
+                                                                     const CountFunctor &count, const OutView &out) {
+  return single_pass_exclusive_scan_impl(exec, n, count, out, out.extent(0) > n, true);
+}
+
+/***
+ * \brief As above, but stores out(i) = transform(i, prefix) instead of the
+ * prefix (and out(n) = transform(n, total)), in the same kernel. transform is
+ * called exactly once per entry written; it may write to other views, but
+ * must not read out. The total returned is not transformed.
+ * \param transform: functor with KOKKOS_INLINE_FUNCTION value_type operator()(size_t i, value_type prefix) const
+ */
+template <typename ExecSpace, typename CountFunctor, typename TransformFunctor, typename OutView>
+typename OutView::non_const_value_type kk_single_pass_exclusive_scan(const ExecSpace &exec, size_t n,
+                                                                     const CountFunctor &count,
+                                                                     const TransformFunctor &transform,
+                                                                     const OutView &out) {
+  return single_pass_exclusive_scan_impl(exec, n, count, out, out.extent(0) > n, true, transform);
+}
+
+// Element of the in-place exclusive prefix sum below: the last entry of the
+// array is treated as 0, as in ExclusiveParallelPrefixSum
+template <typename view_t>
+struct ExclusivePrefixSumCount {
+  view_t arr;
+
+  KOKKOS_INLINE_FUNCTION
+  typename view_t::non_const_value_type operator()(const size_t i) const {
+    return i == arr.extent(0) - 1 ? typename view_t::non_const_value_type(0) : arr(i);
+  }
+};
+
+// Below this length, parallel_scan is faster than the single-pass scan, which
+// needs to allocate its tile status
+constexpr size_t single_pass_scan_min_length = 1 << 18;
+
 /***
  * \brief Function performs the exclusive parallel prefix sum. That is each
  * entry holds the sum until itself.
@@ -85,6 +296,10 @@ struct InclusiveParallelPrefixSum {
 template <typename MyExecSpace, typename view_t>
 inline void kk_exclusive_parallel_prefix_sum(const MyExecSpace &exec, typename view_t::value_type num_elements,
                                              view_t arr) {
+  if (size_t(num_elements) >= single_pass_scan_min_length) {
+    single_pass_exclusive_scan_impl(exec, num_elements, ExclusivePrefixSumCount<view_t>{arr}, arr, false, false);
+    return;
+  }
   typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
   Kokkos::parallel_scan("KokkosKernels::Common::PrefixSum", my_exec_space(exec, 0, num_elements),
                         ExclusiveParallelPrefixSum<view_t>(arr));
@@ -114,6 +329,11 @@ inline void kk_exclusive_parallel_prefix_sum(typename view_t::value_type num_ele
 template <typename MyExecSpace, typename view_t>
 inline void kk_exclusive_parallel_prefix_sum(const MyExecSpace &exec, typename view_t::value_type num_elements,
                                              view_t arr, typename view_t::non_const_value_type &finalSum) {
+  if (size_t(num_elements) >= single_pass_scan_min_length) {
+    finalSum =
+        single_pass_exclusive_scan_impl(exec, num_elements, ExclusivePrefixSumCount<view_t>{arr}, arr, false, true);
+    return;
+  }
   typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
   Kokkos::parallel_scan("KokkosKernels::Common::PrefixSum", my_exec_space(exec, 0, num_elements),
                         ExclusiveParallelPrefixSum<view_t>(arr), finalSum);
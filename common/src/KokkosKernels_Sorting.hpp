@@ -20,7 +20,9 @@
 #include "Kokkos_Sort.hpp"
 #include "KokkosKernels_SimpleUtils.hpp"     //for kk_exclusive_parallel_prefix_sum
 #include "KokkosKernels_ExecSpaceUtils.hpp"  //for is_gpu_exec_space
+#include "KokkosKernels_Error.hpp"
 #include <type_traits>
+#include <utility>
 
 namespace KokkosKernels {
 
@@ -220,6 +222,314 @@ void bitonicSort(View v, const Comparator& comp) {
   }
 }
 
+namespace Impl {
+
+// One pass of the device-wide LSD radix sort: a stable counting sort of the
+// elements by one digit of their keys (or of their segment ids). The
+// elements are split into numBlocks contiguous blocks, each with its own
+// histogram. The histograms are scanned digit-major, so that each block
+// scatters its elements of a digit after those of the previous blocks.
+//
+// On host, one thread counts and scatters a block serially, with no
+// atomics. On GPUs, a team handles a block: it builds the histogram in
+// scratch, and scatters the block in chunks of one element per thread,
+// ranking each element among the elements of the chunk with the same digit
+// so that the scatter stays stable.
+template <typename ExecSpace, typename KeyView, typename ValueView, typename SegView>
+struct RadixSortPassFunctor {
+  static constexpr int radixBits = 8;
+  static constexpr int radix     = 1 << radixBits;
+  // team size and elements per block of the team passes
+  static constexpr int teamSize         = 128;
+  static constexpr size_t teamBlockSize = 16 * teamSize;
+
+  struct CountTag {};
+  struct ScanTag {};
+  struct ScatterTag {};
+  struct TeamCountTag {};
+  struct TeamScatterTag {};
+
+  using size_type        = size_t;
+  using value_type       = size_type;  // of the scan
+  using counts_t         = Kokkos::View<size_type*, ExecSpace>;
+  using member_type      = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+  using scratch_space    = typename ExecSpace::scratch_memory_space;
+  using scratch_hist_t   = Kokkos::View<unsigned*, scratch_space, Kokkos::MemoryUnmanaged>;
+  using scratch_offset_t = Kokkos::View<size_type*, scratch_space, Kokkos::MemoryUnmanaged>;
+  using scratch_digit_t  = Kokkos::View<int*, scratch_space, Kokkos::MemoryUnmanaged>;
+
+  KeyView keysIn, keysOut;
+  ValueView valuesIn, valuesOut;
+  SegView segsIn, segsOut;
+  counts_t counts;  // numBlocks x radix
+  size_type n;
+  size_type numBlocks;
+  int shift;
+  bool digitFromSegs;
+  bool hasValues;
+  bool hasSegs;
+
+  RadixSortPassFunctor(const KeyView& keysIn_, const KeyView& keysOut_, const ValueView& valuesIn_,
+                       const ValueView& valuesOut_, const SegView& segsIn_, const SegView& segsOut_,
+                       const counts_t& counts_, size_type numBlocks_, int shift_, bool digitFromSegs_,
+                       bool hasValues_, bool hasSegs_)
+      : keysIn(keysIn_),
+        keysOut(keysOut_),
+        valuesIn(valuesIn_),
+        valuesOut(valuesOut_),
+        segsIn(segsIn_),
+        segsOut(segsOut_),
+        counts(counts_),
+        n(keysIn_.extent(0)),
+        numBlocks(numBlocks_),
+        shift(shift_),
+        digitFromSegs(digitFromSegs_),
+        hasValues(hasValues_),
+        hasSegs(hasSegs_) {}
+
+  KOKKOS_INLINE_FUNCTION size_type blockBegin(size_type b) const {
+    const size_type q = n / numBlocks, r = n % numBlocks;
+    return b * q + (b < r ? b : r);
+  }
+
+  KOKKOS_INLINE_FUNCTION int digit(size_type i) const {
+    return digitFromSegs ? int((segsIn(i) >> shift) & (radix - 1)) : int((keysIn(i) >> shift) & (radix - 1));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const CountTag&, size_type b) const {
+    size_type* c = &counts(b * radix);
+    for (int d = 0; d < radix; d++) c[d] = 0;
+    const size_type end = blockBegin(b + 1);
+    for (size_type i = blockBegin(b); i < end; i++) c[digit(i)]++;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ScanTag&, size_type i, size_type& update, const bool final) const {
+    const size_type idx   = (i % numBlocks) * radix + i / numBlocks;
+    const size_type count = counts(idx);
+    if (final) counts(idx) = update;
+    update += count;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ScatterTag&, size_type b) const {
+    size_type* c        = &counts(b * radix);
+    const size_type end = blockBegin(b + 1);
+    for (size_type i = blockBegin(b); i < end; i++) move(i, c[digit(i)]++);
+  }
+
+  KOKKOS_INLINE_FUNCTION void move(size_type i, size_type pos) const {
+    keysOut(pos) = keysIn(i);
+    if (hasValues) valuesOut(pos) = valuesIn(i);
+    if (hasSegs) segsOut(pos) = segsIn(i);
+  }
+
+  static size_t countScratchSize() { return scratch_hist_t::shmem_size(radix); }
+  static size_t scatterScratchSize(int teamSize_) {
+    return scratch_offset_t::shmem_size(radix) + scratch_digit_t::shmem_size(teamSize_);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const TeamCountTag&, const member_type& t) const {
+    const size_type b = t.league_rank();
+    scratch_hist_t hist(t.team_scratch(0), radix);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, radix), [&](int d) { hist(d) = 0; });
+    t.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, blockBegin(b), blockBegin(b + 1)),
+                         [&](size_type i) { Kokkos::atomic_inc(&hist(digit(i))); });
+    t.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, radix), [&](int d) { counts(b * radix + d) = hist(d); });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const TeamScatterTag&, const member_type& t) const {
+    const size_type b = t.league_rank();
+    const int nt = t.team_size(), r = t.team_rank();
+    // offsets(d): where the next element of digit d goes
+    scratch_offset_t offsets(t.team_scratch(0), radix);
+    scratch_digit_t digits(t.team_scratch(0), nt);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, radix), [&](int d) { offsets(d) = counts(b * radix + d); });
+    const size_type end = blockBegin(b + 1);
+    for (size_type chunk = blockBegin(b); chunk < end; chunk += nt) {
+      const size_type i = chunk + r;
+      const int d       = i < end ? digit(i) : radix;
+      digits(r)         = d;
+      t.team_barrier();
+      if (i < end) {
+        size_type pos = offsets(d);
+        for (int j = 0; j < r; j++) pos += digits(j) == d;
+        move(i, pos);
+      }
+      t.team_barrier();
+      if (i < end) Kokkos::atomic_inc(&offsets(d));
+      t.team_barrier();
+    }
+  }
+};
+
+// Number of bits needed to represent the largest of the n values of v
+template <typename ExecSpace, typename View>
+int radixSignificantBits(const ExecSpace& exec, const View& v) {
+  using Unsigned = typename View::non_const_value_type;
+  Unsigned maxVal;
+  Kokkos::parallel_reduce(
+      "KokkosKernels::radixSort::max", Kokkos::RangePolicy<ExecSpace>(exec, 0, v.extent(0)),
+      KOKKOS_LAMBDA(size_t i, Unsigned & lmax) {
+        if (v(i) > lmax) lmax = v(i);
+      },
+      Kokkos::Max<Unsigned>(maxVal));
+  int bits = 0;
+  while (bits < int(8 * sizeof(Unsigned)) && (maxVal >> bits)) bits++;
+  return bits;
+}
+
+// The segment of each element, for segments [offsets(s), offsets(s+1))
+template <typename OffsetView, typename SegView>
+struct RadixSegmentIdsFunctor {
+  OffsetView offsets;
+  SegView segs;
+  RadixSegmentIdsFunctor(const OffsetView& offsets_, const SegView& segs_) : offsets(offsets_), segs(segs_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(size_t i) const {
+    // last s with offsets(s) <= i
+    size_t lo = 0, hi = offsets.extent(0) - 1;
+    while (hi - lo > 1) {
+      const size_t mid = lo + (hi - lo) / 2;
+      if (size_t(offsets(mid)) <= i)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    segs(i) = lo;
+  }
+};
+
+// Sort keys (and values, and segment ids) by (segment id, key): radix passes
+// over the low keyBits bits of the keys, then over the low segBits bits of
+// the segment ids. useTeams selects the team passes (the default on GPUs).
+template <typename ExecSpace, typename KeyView, typename ValueView, typename SegView>
+void radixSortPasses(const ExecSpace& exec, const KeyView& keys, const ValueView& values, const SegView& segs,
+                     int keyBits, int segBits, bool hasValues, bool hasSegs,
+                     bool useTeams = KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace>) {
+  using Key           = typename KeyView::non_const_value_type;
+  using Value         = typename ValueView::non_const_value_type;
+  using Seg           = typename SegView::non_const_value_type;
+  using KeyBuf        = Kokkos::View<Key*, ExecSpace>;
+  using ValBuf        = Kokkos::View<Value*, ExecSpace>;
+  using SegBuf        = Kokkos::View<Seg*, ExecSpace>;
+  using Pass          = RadixSortPassFunctor<ExecSpace, KeyBuf, ValBuf, SegBuf>;
+  using CountPolicy   = Kokkos::RangePolicy<ExecSpace, typename Pass::CountTag>;
+  using ScanPolicy    = Kokkos::RangePolicy<ExecSpace, typename Pass::ScanTag>;
+  using ScatterPolicy = Kokkos::RangePolicy<ExecSpace, typename Pass::ScatterTag>;
+  using TeamCount     = Kokkos::TeamPolicy<ExecSpace, typename Pass::TeamCountTag>;
+  using TeamScatter   = Kokkos::TeamPolicy<ExecSpace, typename Pass::TeamScatterTag>;
+  constexpr int radixBits = Pass::radixBits;
+
+  const size_t n      = keys.extent(0);
+  const int keyPasses = (keyBits + radixBits - 1) / radixBits;
+  const int segPasses = hasSegs ? (segBits + radixBits - 1) / radixBits : 0;
+  if (n <= 1 || keyPasses + segPasses == 0) return;
+
+  // Ping-pong buffers; the input views may be strided or unmanaged
+  KeyBuf keysA(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix keys A"), n);
+  KeyBuf keysB(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix keys B"), n);
+  ValBuf valuesA(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix values A"), hasValues ? n : 0);
+  ValBuf valuesB(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix values B"), hasValues ? n : 0);
+  SegBuf segsA(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix segments A"), hasSegs ? n : 0);
+  SegBuf segsB(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix segments B"), hasSegs ? n : 0);
+  Kokkos::deep_copy(exec, keysA, keys);
+  if (hasValues) Kokkos::deep_copy(exec, valuesA, values);
+  if (hasSegs) Kokkos::deep_copy(exec, segsA, segs);
+
+  // On host, one block per thread, but no more blocks than keep the
+  // histograms within n entries. With teams, blocks of teamBlockSize
+  // elements, and teams of one thread on host.
+  size_t numBlocks   = KOKKOSKERNELS_MACRO_MIN(size_t(exec.concurrency()), n / Pass::radix);
+  const int teamSize = KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace> ? Pass::teamSize : 1;
+  if (useTeams) numBlocks = (n + Pass::teamBlockSize - 1) / Pass::teamBlockSize;
+  numBlocks = KOKKOSKERNELS_MACRO_MAX(numBlocks, size_t(1));
+  typename Pass::counts_t counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix counts"),
+                                 numBlocks * Pass::radix);
+
+  for (int p = 0; p < keyPasses + segPasses; p++) {
+    const bool fromSegs = p >= keyPasses;
+    const int shift     = (fromSegs ? p - keyPasses : p) * radixBits;
+    Pass pass(keysA, keysB, valuesA, valuesB, segsA, segsB, counts, numBlocks, shift, fromSegs, hasValues, hasSegs);
+    if (useTeams) {
+      Kokkos::parallel_for(
+          "KokkosKernels::radixSort::team_count",
+          TeamCount(exec, numBlocks, teamSize).set_scratch_size(0, Kokkos::PerTeam(Pass::countScratchSize())), pass);
+    } else {
+      Kokkos::parallel_for("KokkosKernels::radixSort::count", CountPolicy(exec, 0, numBlocks), pass);
+    }
+    // device-wide scan of the histograms, digit-major
+    Kokkos::parallel_scan("KokkosKernels::radixSort::scan", ScanPolicy(exec, 0, numBlocks * Pass::radix), pass);
+    if (useTeams) {
+      Kokkos::parallel_for("KokkosKernels::radixSort::team_scatter",
+                           TeamScatter(exec, numBlocks, teamSize)
+                               .set_scratch_size(0, Kokkos::PerTeam(Pass::scatterScratchSize(teamSize))),
+                           pass);
+    } else {
+      Kokkos::parallel_for("KokkosKernels::radixSort::scatter", ScatterPolicy(exec, 0, numBlocks), pass);
+    }
+    std::swap(keysA, keysB);
+    std::swap(valuesA, valuesB);
+    std::swap(segsA, segsB);
+  }
+  Kokkos::deep_copy(exec, keys, keysA);
+  if (hasValues) Kokkos::deep_copy(exec, values, valuesA);
+}
+
+}  // namespace Impl
+
+// Device-wide LSD radix sort of unsigned integer keys (up to 64 bits).
+// Each pass sorts 8 bits with per-block histograms (built in team scratch
+// on GPUs) and a device-wide scan; only as many passes as the largest key
+// needs are run. O(n) work per pass, with 2n auxiliary storage.
+template <typename ExecSpace, typename KeyView>
+void radixSort(const ExecSpace& exec, const KeyView& keys) {
+  static_assert(std::is_integral_v<typename KeyView::value_type> && std::is_unsigned_v<typename KeyView::value_type>,
+                "radixSort: keys must be unsigned integers");
+  Kokkos::View<int*, ExecSpace> noValues;
+  Kokkos::View<uint32_t*, ExecSpace> noSegs;
+  if (keys.extent(0) <= 1) return;
+  Impl::radixSortPasses(exec, keys, noValues, noSegs, Impl::radixSignificantBits(exec, keys), 0, false, false);
+}
+
+// Device-wide LSD radix sort of unsigned integer keys (up to 64 bits),
+// permuting values along with the keys. The sort is stable.
+template <typename ExecSpace, typename KeyView, typename ValueView>
+void radixSortByKey(const ExecSpace& exec, const KeyView& keys, const ValueView& values) {
+  static_assert(std::is_integral_v<typename KeyView::value_type> && std::is_unsigned_v<typename KeyView::value_type>,
+                "radixSortByKey: keys must be unsigned integers");
+  if (keys.extent(0) != values.extent(0))
+    KokkosKernels::Impl::throw_runtime_exception("radixSortByKey: keys and values must have the same length");
+  Kokkos::View<uint32_t*, ExecSpace> noSegs;
+  if (keys.extent(0) <= 1) return;
+  Impl::radixSortPasses(exec, keys, values, noSegs, Impl::radixSignificantBits(exec, keys), 0, true, false);
+}
+
+// Segmented version of radixSortByKey: sorts each segment
+// [offsets(s), offsets(s+1)) of keys and values independently, with the
+// whole device working on all segments at once, so that a few long segments
+// do not serialize the sort. offsets(0) must be 0 and the last offset must be
+// keys.extent(0).
+template <typename ExecSpace, typename OffsetView, typename KeyView, typename ValueView>
+void segmentedRadixSortByKey(const ExecSpace& exec, const OffsetView& offsets, const KeyView& keys,
+                             const ValueView& values) {
+  static_assert(std::is_integral_v<typename KeyView::value_type> && std::is_unsigned_v<typename KeyView::value_type>,
+                "segmentedRadixSortByKey: keys must be unsigned integers");
+  using Seg = std::make_unsigned_t<typename OffsetView::non_const_value_type>;
+  if (keys.extent(0) != values.extent(0))
+    KokkosKernels::Impl::throw_runtime_exception(
+        "segmentedRadixSortByKey: keys and values must have the same length");
+  const size_t n = keys.extent(0);
+  if (n <= 1 || offsets.extent(0) < 2) return;
+  const size_t numSegments = offsets.extent(0) - 1;
+  Kokkos::View<Seg*, ExecSpace> segs(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "radix segments"), n);
+  Kokkos::parallel_for("KokkosKernels::segmentedRadixSort::segments", Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+                       Impl::RadixSegmentIdsFunctor<OffsetView, decltype(segs)>(offsets, segs));
+  int segBits = 0;
+  while (segBits < int(8 * sizeof(size_t)) && ((numSegments - 1) >> segBits)) segBits++;
+  Impl::radixSortPasses(exec, keys, values, segs, Impl::radixSignificantBits(exec, keys), segBits, true, true);
+}
+
 // Radix sort for integers, on a single thread within a team.
 // Pros: few diverging branches, so OK for sorting on a single GPU vector lane.
 // Better on CPU cores. Con: requires auxiliary storage, and this version only
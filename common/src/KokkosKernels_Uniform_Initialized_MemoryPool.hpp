@@ -209,6 +209,39 @@ class UniformMemoryPool {
     }
   }
 
+  /**
+   * \brief UniformMemoryPool constructor drawing its data and locks from a
+   * WorkspaceArena instead of allocating them. The pool must not be used after
+   * the arena scope enclosing this call is released. A null arena falls back
+   * to the allocating constructor.
+   */
+  template <typename WorkspaceArena>
+  UniformMemoryPool(const size_t num_chunks_, const size_t set_chunk_size_, const data_type initialized_value,
+                    const PoolType pool_type_, WorkspaceArena *arena)
+      : UniformMemoryPool() {
+    if (arena == nullptr) {
+      *this = UniformMemoryPool(num_chunks_, set_chunk_size_, initialized_value, pool_type_);
+      return;
+    }
+    num_set_chunks = num_chunks_;
+    chunk_size     = set_chunk_size_;
+    pool_type      = pool_type_;
+    while (num_set_chunks > num_chunks) {
+      num_chunks *= 2;
+    }
+    modular_num_chunks = num_chunks - 1;
+    overall_size       = num_chunks * chunk_size;
+    if (num_set_chunks == 0) return;
+    data_view = arena->template allocate<data_type>(overall_size);
+    data      = data_view.data();
+    Kokkos::deep_copy(data_view, initialized_value);
+    if (pool_type == ManyThread2OneChunk) {
+      chunk_locks = arena->template allocate<lock_type>(num_chunks);
+      Kokkos::deep_copy(chunk_locks, lock_type(0));
+      pchunk_locks = chunk_locks.data();
+    }
+  }
+
   /**
    * \brief UniformMemoryPool constructor
    */
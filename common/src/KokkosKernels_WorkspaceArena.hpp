@@ -0,0 +1,243 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOSKERNELS_WORKSPACEARENA_HPP
+#define KOKKOSKERNELS_WORKSPACEARENA_HPP
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosKernels {
+
+namespace Impl {
+
+// Writes one byte per alignment block, so that the pages of a fresh buffer
+// are first touched by the threads of the execution space
+struct WorkspaceFirstTouchFunctor {
+  char *data;
+  size_t stride;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const { data[i * stride] = 0; }
+};
+
+/*! \brief Persistent workspace for the temporaries of handle-driven kernels.
+ *
+ *  Kernels such as SpGEMM allocate the same large temporaries (memory pools,
+ *  accumulators) at every symbolic or numeric call. When the arena is enabled
+ *  on a KokkosKernelsHandle, these temporaries are carved out of one buffer
+ *  that lives as long as the handle, so that once the arena has grown to the
+ *  high-water mark of an iteration, further iterations allocate nothing.
+ *
+ *  Allocations are stack-like and happen on the host, between kernel
+ *  launches:
+ *
+ *    {
+ *      WorkspaceArena<ExecSpace, MemSpace>::Scope scope(arena);  // arena may be nullptr
+ *      auto tmp = arena->template allocate<int>(n);              // unmanaged view
+ *      ... kernels using tmp ...
+ *    }  // everything allocated in the scope is released
+ *
+ *  When a request does not fit in the buffer, it is served by a dedicated
+ *  overflow allocation, so allocate() never fails. When the outermost scope
+ *  is released, the overflow allocations are freed, and the next outermost
+ *  scope grows the buffer to the high-water mark before handing out memory.
+ *  Releasing a scope never allocates, so it is safe from a destructor. The
+ *  new buffer is first touched in parallel on the arena's execution space
+ *  instance, so that on NUMA hosts its pages are placed where the threads
+ *  that use them run.
+ *
+ *  Views returned by allocate() are not reference counted: they must not be
+ *  used after the scope they were allocated in is released. Memory released
+ *  by a scope is handed out again by the next one, so the kernels using it
+ *  must run on the instance the scope was opened with (by default the
+ *  arena's), or be fenced before the scope is released.
+ */
+template <typename ExecSpace, typename MemorySpace>
+class WorkspaceArena {
+ public:
+  using execution_space = typename ExecSpace::execution_space;
+  using memory_space    = typename MemorySpace::memory_space;
+  template <typename T>
+  using view_t = Kokkos::View<T *, memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  // every allocation is aligned to a cache line
+  static constexpr size_t alignment = 64;
+
+  /**
+   * \brief RAII guard releasing everything allocated after its construction.
+   * A null arena makes the guard a no-op, so that callers do not need to
+   * check whether the arena is enabled. exec is the instance the kernels of
+   * the scope run on: it is the only one fenced before overflow blocks are
+   * freed.
+   */
+  class Scope {
+   public:
+    explicit Scope(WorkspaceArena *arena_) : Scope(arena_, arena_ ? arena_->space : execution_space()) {}
+    Scope(WorkspaceArena *arena_, const execution_space &exec_)
+        : arena(arena_), exec(exec_), mark(arena_ ? arena_->push() : 0) {}
+    ~Scope() {
+      if (arena) arena->pop(mark, exec);
+    }
+    Scope(const Scope &)            = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    WorkspaceArena *arena;
+    execution_space exec;
+    size_t mark;
+  };
+
+  explicit WorkspaceArena(size_t initial_bytes = 0, const execution_space &space_ = execution_space())
+      : space(space_),
+        buffer(),
+        overflows(),
+        top(0),
+        overflow_bytes(0),
+        depth(0),
+        high_water_mark(0),
+        num_allocations(0),
+        num_buffer_allocations(0) {
+    if (initial_bytes) this->reallocate(round_up(initial_bytes));
+  }
+
+  WorkspaceArena(const WorkspaceArena &)            = delete;
+  WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+
+  /**
+   * \brief Returns an uninitialized, unmanaged view of n elements, valid
+   * until the enclosing Scope is released.
+   */
+  template <typename T>
+  view_t<T> allocate(size_t n) {
+    if (depth == 0) {
+      throw_runtime_exception("KokkosKernels::WorkspaceArena: allocate called outside of a Scope");
+    }
+    const size_t bytes = round_up(n * sizeof(T));
+    ++num_allocations;
+    char *ptr = nullptr;
+    if (top + bytes <= buffer.extent(0)) {
+      ptr = buffer.data() + top;
+      top += bytes;
+    } else {
+      overflows.emplace_back(Kokkos::view_alloc(Kokkos::WithoutInitializing, "WorkspaceArena overflow"), bytes);
+      ptr = overflows.back().data();
+      overflow_bytes += bytes;
+      ++num_buffer_allocations;
+    }
+    high_water_mark = std::max(high_water_mark, top + overflow_bytes);
+    return view_t<T>(reinterpret_cast<T *>(ptr), n);
+  }
+
+  /**
+   * \brief Like allocate(), but returns a view of type ViewType, so that
+   * arena memory can be handed to code written for managed views: a view
+   * built from a pointer does not own it.
+   */
+  template <typename ViewType>
+  ViewType allocate_view(size_t n) {
+    static_assert(std::is_same_v<typename ViewType::memory_space, memory_space>,
+                  "WorkspaceArena::allocate_view: the view must be in the memory space of the arena");
+    return ViewType(this->template allocate<typename ViewType::non_const_value_type>(n).data(), n);
+  }
+
+  /// \brief Size of the persistent buffer, in bytes.
+  size_t capacity() const { return buffer.extent(0); }
+  /// \brief Bytes currently allocated, including overflow allocations.
+  size_t size() const { return top + overflow_bytes; }
+  /// \brief Largest size() reached since construction or reset_stats().
+  size_t get_high_water_mark() const { return high_water_mark; }
+  /// \brief Number of allocate() calls.
+  size_t get_num_allocations() const { return num_allocations; }
+  /// \brief Number of device allocations made (buffer growth and overflows).
+  /// This stops increasing once the arena has reached its steady state.
+  size_t get_num_buffer_allocations() const { return num_buffer_allocations; }
+
+  void reset_stats() {
+    high_water_mark        = size();
+    num_allocations        = 0;
+    num_buffer_allocations = 0;
+  }
+
+  void print_stats(std::ostream &os = std::cout) const {
+    os << "WorkspaceArena: capacity:" << capacity() << " high_water_mark:" << high_water_mark
+       << " allocations:" << num_allocations << " buffer_allocations:" << num_buffer_allocations << std::endl;
+  }
+
+ private:
+  static size_t round_up(size_t bytes) { return (bytes + alignment - 1) / alignment * alignment; }
+
+  size_t push() {
+    // the buffer only grows when nothing is allocated from it
+    if (depth == 0 && high_water_mark > buffer.extent(0)) this->reallocate(high_water_mark);
+    ++depth;
+    return top;
+  }
+
+  void pop(size_t mark, const execution_space &exec) {
+    top = mark;
+    if (--depth == 0 && !overflows.empty()) {
+      // kernels launched in the scope may still use the overflow blocks
+      exec.fence("KokkosKernels::WorkspaceArena: fence before releasing overflow blocks");
+      overflows.clear();
+      overflow_bytes = 0;
+    }
+  }
+
+  void reallocate(size_t bytes) {
+    // the old buffer is only released once the kernels of the last scope are done with it
+    space.fence("KokkosKernels::WorkspaceArena: fence before reallocating");
+    buffer = Kokkos::View<char *, memory_space>();
+    buffer = Kokkos::View<char *, memory_space>(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "WorkspaceArena"), bytes);
+    ++num_buffer_allocations;
+    Kokkos::parallel_for("KokkosKernels::WorkspaceArena::first_touch",
+                         Kokkos::RangePolicy<execution_space>(space, 0, bytes / alignment),
+                         WorkspaceFirstTouchFunctor{buffer.data(), alignment});
+    space.fence("KokkosKernels::WorkspaceArena: fence after first touch");
+  }
+
+  execution_space space;
+  Kokkos::View<char *, memory_space> buffer;
+  std::vector<Kokkos::View<char *, memory_space>> overflows;
+  size_t top;
+  size_t overflow_bytes;
+  int depth;
+  size_t high_water_mark;
+  size_t num_allocations;
+  size_t num_buffer_allocations;
+};
+
+/**
+ * \brief Uninitialized temporary of n elements, drawn from the arena when it
+ * is enabled and in the memory space of ViewType, allocated on exec otherwise.
+ */
+template <typename ViewType, typename ExecSpace, typename Arena>
+ViewType make_workspace_view(const ExecSpace &exec, Arena *arena, const std::string &label, size_t n) {
+  if constexpr (std::is_same_v<typename ViewType::memory_space, typename Arena::memory_space>) {
+    if (arena) return arena->template allocate_view<ViewType>(n);
+  }
+  return ViewType(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, label), n);
+}
+
+}  // namespace Impl
+}  // namespace KokkosKernels
+
+#endif  // KOKKOSKERNELS_WORKSPACEARENA_HPP
@@ -21,6 +21,9 @@
 // #include<Test_Common_float128.hpp>
 #include <Test_Common_set_bit_count.hpp>
 #include <Test_Common_Sorting.hpp>
+#include <Test_Common_HashmapAccumulator.hpp>
+#include <Test_Common_WorkspaceArena.hpp>
+#include <Test_Common_PrefixSum.hpp>
 #include <Test_Common_CudaIndependentThreads.hpp>
 #include <Test_Common_IOUtils.hpp>
 #include <Test_Common_Error.hpp>
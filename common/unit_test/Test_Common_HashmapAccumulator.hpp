@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Common_HashmapAccumulator.hpp
+/// \brief Tests for GrowableHashmapAccumulator and HashmapArena
+
+#ifndef TEST_COMMON_HASHMAPACCUMULATOR_HPP
+#define TEST_COMMON_HASHMAPACCUMULATOR_HPP
+
+#include <algorithm>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_HashmapAccumulator.hpp"
+
+// Every team inserts keys i % numDistinct for i in [0, numKeys) with value 1
+// into its own map, which starts with 4 slots and grows in the arena. Each
+// team reports its number of keys (-1 if the arena ran out) and the number of
+// keys whose merged value is wrong.
+template <typename Device>
+struct GrowableHashmapTestFunctor {
+  using exec_space = typename Device::execution_space;
+  using member_t   = typename Kokkos::TeamPolicy<exec_space>::member_type;
+  using arena_t    = KokkosKernels::Experimental::HashmapArena<typename Device::memory_space>;
+  using map_t      = KokkosKernels::Experimental::GrowableHashmapAccumulator<int, int, double>;
+
+  static constexpr int batchSize = 100;
+
+  GrowableHashmapTestFunctor(const arena_t& arena_, int numKeys_, int numDistinct_,
+                             const Kokkos::View<int*, Device>& sizes_, const Kokkos::View<int*, Device>& errors_)
+      : arena(arena_), numKeys(numKeys_), numDistinct(numDistinct_), sizes(sizes_), errors(errors_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_t& team) const {
+    const int t = team.league_rank();
+    map_t map   = map_t::team_create(team, 4, arena);
+    bool ok     = map.is_valid();
+    for (int batch = 0; ok && batch < numKeys; batch += batchSize) {
+      const int batchEnd = KOKKOSKERNELS_MACRO_MIN(batch + batchSize, numKeys);
+      ok                 = map.team_reserve(team, batchEnd - batch, arena);
+      if (ok) {
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team, batch, batchEnd), [&](const int i) {
+          map.vector_atomic_insert_mergeAtomicAdd(i % numDistinct, 1.0);
+        });
+      }
+    }
+    if (!ok) {
+      Kokkos::single(Kokkos::PerTeam(team), [&]() { sizes(t) = -1; });
+      return;
+    }
+    team.team_barrier();
+    int teamErrors = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(team, numDistinct),
+        [&](const int k, int& lerrors) {
+          const int slot     = map.find(k);
+          const int expected = numKeys / numDistinct + (k < numKeys % numDistinct ? 1 : 0);
+          if (expected == 0 ? slot != -1 : slot == -1 || map.values[slot] != expected) lerrors++;
+        },
+        teamErrors);
+    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+      sizes(t)  = *map.used_size;
+      errors(t) = teamErrors + (map.find(numDistinct) != -1);
+    });
+  }
+
+  arena_t arena;
+  int numKeys;
+  int numDistinct;
+  Kokkos::View<int*, Device> sizes;
+  Kokkos::View<int*, Device> errors;
+};
+
+template <typename Device>
+void testGrowableHashmap(int numTeams, int numKeys, int numDistinct, size_t arenaBytes) {
+  using functor_t  = GrowableHashmapTestFunctor<Device>;
+  using exec_space = typename Device::execution_space;
+  typename functor_t::arena_t arena(arenaBytes);
+  Kokkos::View<int*, Device> sizes("sizes", numTeams);
+  Kokkos::View<int*, Device> errors("errors", numTeams);
+  Kokkos::parallel_for(Kokkos::TeamPolicy<exec_space>(numTeams, Kokkos::AUTO),
+                       functor_t(arena, numKeys, numDistinct, sizes, errors));
+  auto sizesHost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sizes);
+  auto errorsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), errors);
+  // The map of a team needs at most 2 * 4/3 * numDistinct slots over all of
+  // its tables, so a large enough arena never runs out
+  const size_t perTeam = 2 * functor_t::map_t::table_bytes(4 * numDistinct) + 32 * functor_t::arena_t::alignment;
+  const bool fits      = arenaBytes >= numTeams * perTeam;
+  for (int t = 0; t < numTeams; t++) {
+    if (fits) {
+      ASSERT_EQ(sizesHost(t), std::min(numKeys, numDistinct)) << "team " << t;
+    } else if (sizesHost(t) == -1) {
+      continue;
+    }
+    EXPECT_EQ(errorsHost(t), 0) << "team " << t;
+  }
+  if (fits) EXPECT_LE(arena.requested(), arena.capacity());
+}
+
+TEST_F(TestCategory, common_growable_hashmap) {
+  testGrowableHashmap<TestDevice>(1, 0, 1, 1024);
+  testGrowableHashmap<TestDevice>(3, 50, 50, 1 << 20);
+  testGrowableHashmap<TestDevice>(16, 10000, 3000, 1 << 22);
+  testGrowableHashmap<TestDevice>(16, 10000, 10000, 1 << 24);
+  // arena too small for every team: the teams that run out report it, and
+  // the others must still be right
+  testGrowableHashmap<TestDevice>(16, 10000, 3000, 1 << 16);
+}
+
+#endif  // TEST_COMMON_HASHMAPACCUMULATOR_HPP
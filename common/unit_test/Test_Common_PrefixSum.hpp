@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Common_PrefixSum.hpp
+/// \brief Tests for kk_exclusive_parallel_prefix_sum and the single-pass scan
+
+#ifndef TEST_COMMON_PREFIXSUM_HPP
+#define TEST_COMMON_PREFIXSUM_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include "KokkosKernels_SimpleUtils.hpp"
+
+// In-place prefix sum of random values, over the whole array (the last entry
+// gets the total) and over a prefix of it (entries past the prefix are kept)
+template <typename Device, typename Value>
+void testExclusivePrefixSum(size_t n) {
+  using exec_space = typename Device::execution_space;
+  using view_t     = Kokkos::View<Value *, Device>;
+  view_t input("input", n + 1);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718 + n);
+  Kokkos::fill_random(input, rand_pool, Value(100));
+  auto inputHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), input);
+
+  // whole array, with the total
+  view_t arr("arr", n + 1);
+  Kokkos::deep_copy(arr, input);
+  Value total = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<exec_space>(exec_space(), Value(n + 1), arr, total);
+  auto arrHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), arr);
+  Value sum    = 0;
+  for (size_t i = 0; i <= n; i++) {
+    ASSERT_EQ(arrHost(i), sum) << "i = " << i;
+    if (i < n) sum += inputHost(i);
+  }
+  EXPECT_EQ(total, sum);
+
+  // first n entries only: the last one keeps its value
+  Kokkos::deep_copy(arr, input);
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<exec_space>(Value(n), arr);
+  Kokkos::deep_copy(arrHost, arr);
+  sum = 0;
+  for (size_t i = 0; i + 1 < n; i++) {
+    ASSERT_EQ(arrHost(i), sum) << "i = " << i;
+    sum += inputHost(i);
+  }
+  if (n) EXPECT_EQ(arrHost(n - 1), sum);
+  EXPECT_EQ(arrHost(n), inputHost(n));
+}
+
+// Fused count and scan: out(i) = sum of (j % 7) for j < i, out(n) = total
+template <typename Device>
+void testSinglePassScan(size_t n) {
+  using exec_space = typename Device::execution_space;
+  using view_t     = Kokkos::View<int64_t *, Device>;
+  view_t out("out", n + 1);
+  const int64_t total = KokkosKernels::Impl::kk_single_pass_exclusive_scan(
+      exec_space(), n, KOKKOS_LAMBDA(const size_t i) { return int64_t(i % 7); }, out);
+  auto outHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out);
+  int64_t sum  = 0;
+  for (size_t i = 0; i <= n; i++) {
+    ASSERT_EQ(outHost(i), sum) << "i = " << i;
+    sum += i % 7;
+  }
+  EXPECT_EQ(total, outHost(n));
+}
+
+// Fused count, scan and transform: out(i) = 2 * (sum of (j % 7) for j < i) + i,
+// and the untransformed total is returned
+template <typename Device>
+void testSinglePassScanTransform(size_t n) {
+  using exec_space = typename Device::execution_space;
+  using view_t     = Kokkos::View<int64_t *, Device>;
+  view_t out("out", n + 1);
+  const int64_t total = KokkosKernels::Impl::kk_single_pass_exclusive_scan(
+      exec_space(), n, KOKKOS_LAMBDA(const size_t i) { return int64_t(i % 7); },
+      KOKKOS_LAMBDA(const size_t i, const int64_t prefix) { return 2 * prefix + int64_t(i); }, out);
+  auto outHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out);
+  int64_t sum  = 0;
+  for (size_t i = 0; i <= n; i++) {
+    ASSERT_EQ(outHost(i), 2 * sum + int64_t(i)) << "i = " << i;
+    if (i < n) sum += i % 7;
+  }
+  EXPECT_EQ(total, sum);
+}
+
+TEST_F(TestCategory, common_prefix_sum) {
+  // below and above KokkosKernels::Impl::single_pass_scan_min_length
+  for (size_t n : {size_t(0), size_t(1), size_t(1000), size_t(1 << 18), size_t(3000017)}) {
+    testExclusivePrefixSum<TestDevice, int>(n);
+    testExclusivePrefixSum<TestDevice, size_t>(n);
+    testSinglePassScan<TestDevice>(n);
+    testSinglePassScanTransform<TestDevice>(n);
+  }
+}
+
+#endif  // TEST_COMMON_PREFIXSUM_HPP
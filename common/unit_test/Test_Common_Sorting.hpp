@@ -28,6 +28,7 @@
 #include <Kokkos_ArithTraits.hpp>
 #include <Kokkos_Complex.hpp>
 #include <cstdlib>
+#include <vector>
 
 // Generate n randomized counts with mean <avg>.
 // Then prefix-sum into randomOffsets.
@@ -248,6 +249,97 @@ void testSerialRadixSort2(size_t k, size_t subArraySize) {
   }
 }
 
+// Random keys spanning all the bits of Key, but with many repeats (about n/4
+// distinct values), so that the stability of radixSortByKey is tested
+template <typename KeyHost>
+void fillRandomWide(KeyHost keys) {
+  using Key = typename KeyHost::value_type;
+  srand(34567);
+  const size_t n = keys.extent(0);
+  std::vector<Key> pool(n / 4 + 1);
+  for (auto& p : pool) {
+    uint64_t r = 0;
+    for (int i = 0; i < 4; i++) r = (r << 16) ^ uint64_t(rand());
+    p = Key(r);
+  }
+  for (size_t i = 0; i < n; i++) keys(i) = pool[rand() % pool.size()];
+}
+
+template <typename Device, typename Key>
+void testDeviceRadixSort(size_t n) {
+  typedef typename Device::execution_space exec_space;
+  typedef typename Device::memory_space mem_space;
+  typedef Kokkos::View<Key*, mem_space> KeyView;
+  typedef Kokkos::View<uint32_t*, mem_space> ValView;
+  KeyView keys("Radix test keys", n);
+  ValView data("Radix test data", n);
+  auto keysHost = Kokkos::create_mirror_view(keys);
+  auto dataHost = Kokkos::create_mirror_view(data);
+  fillRandomWide(keysHost);
+  // The values are the original positions: a stable sort orders equal keys
+  // by value
+  for (size_t i = 0; i < n; i++) dataHost(i) = i;
+  std::vector<std::pair<Key, uint32_t>> gold(n);
+  for (size_t i = 0; i < n; i++) gold[i] = {keysHost(i), dataHost(i)};
+  std::sort(gold.begin(), gold.end());
+  Kokkos::deep_copy(keys, keysHost);
+  Kokkos::deep_copy(data, dataHost);
+  KokkosKernels::radixSortByKey(exec_space(), keys, data);
+  Kokkos::deep_copy(keysHost, keys);
+  Kokkos::deep_copy(dataHost, data);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(keysHost(i), gold[i].first);
+    ASSERT_EQ(dataHost(i), gold[i].second);
+  }
+  // Keys only
+  fillRandomWide(keysHost);
+  Kokkos::deep_copy(keys, keysHost);
+  KokkosKernels::radixSort(exec_space(), keys);
+  Kokkos::deep_copy(keysHost, keys);
+  for (size_t i = 0; i < n; i++) ASSERT_EQ(keysHost(i), gold[i].first);
+  // The team passes (the default on GPUs), forced on any backend
+  fillRandomWide(keysHost);
+  for (size_t i = 0; i < n; i++) dataHost(i) = i;
+  Kokkos::deep_copy(keys, keysHost);
+  Kokkos::deep_copy(data, dataHost);
+  Kokkos::View<uint32_t*, exec_space> noSegs;
+  KokkosKernels::Impl::radixSortPasses(exec_space(), keys, data, noSegs, 8 * sizeof(Key), 0, true, false, true);
+  Kokkos::deep_copy(keysHost, keys);
+  Kokkos::deep_copy(dataHost, data);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(keysHost(i), gold[i].first);
+    ASSERT_EQ(dataHost(i), gold[i].second);
+  }
+}
+
+template <typename Device, typename Key, typename Value>
+void testSegmentedRadixSort(size_t k, size_t subArraySize) {
+  typedef typename Device::execution_space exec_space;
+  typedef typename Device::memory_space mem_space;
+  typedef Kokkos::View<int*, mem_space> OrdView;
+  typedef Kokkos::View<Key*, mem_space> KeyView;
+  typedef Kokkos::View<Value*, mem_space> ValView;
+  OrdView counts("Subarray Sizes", k + 1);
+  OrdView offsets("Subarray Offsets", k + 1);
+  // k segments, then the total as the last offset
+  size_t n = generateRandomOffsets<OrdView, exec_space>(counts, offsets, k + 1, subArraySize);
+  auto offsetsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), offsets);
+  n                = offsetsHost(k);
+  KeyView keys("Radix test keys", n);
+  ValView data("Radix test data", n);
+  fillRandom(keys, data);
+  Kokkos::View<Key*, Kokkos::HostSpace> gold("Host sorted", n);
+  Kokkos::deep_copy(gold, keys);
+  KokkosKernels::segmentedRadixSortByKey(exec_space(), offsets, keys, data);
+  for (size_t i = 0; i < k; i++) std::sort(gold.data() + offsetsHost(i), gold.data() + offsetsHost(i + 1));
+  auto keysHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), keys);
+  auto dataHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(keysHost(i), gold(i));
+    ASSERT_EQ(dataHost(i), kvHash<Key, Value>()(keysHost(i)));
+  }
+}
+
 template <typename View>
 struct CheckSortedFunctor {
   CheckSortedFunctor(View& v_) : v(v_) {}
@@ -377,4 +469,17 @@ TEST_F(TestCategory, common_device_bitonic) {
   testBitonicSortLexicographic<TestDevice>();
 }
 
+TEST_F(TestCategory, common_device_radix) {
+  // Test device-wide radix sort, including the trivial sizes
+  for (size_t n : {0, 1, 2, 255, 4097, 100000}) {
+    testDeviceRadixSort<TestDevice, uint32_t>(n);
+    testDeviceRadixSort<TestDevice, uint64_t>(n);
+  }
+  // Segmented: 1st arg is #segments, 2nd arg is max segment size
+  testSegmentedRadixSort<TestDevice, unsigned, int>(1, 5000);
+  testSegmentedRadixSort<TestDevice, unsigned, double>(100, 0);
+  testSegmentedRadixSort<TestDevice, unsigned, double>(100, 300);
+  testSegmentedRadixSort<TestDevice, uint64_t, Kokkos::complex<double>>(700, 40);
+}
+
 #endif
@@ -0,0 +1,111 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Test_Common_WorkspaceArena.hpp
+/// \brief Tests for WorkspaceArena and the UniformMemoryPool drawn from it
+
+#ifndef TEST_COMMON_WORKSPACEARENA_HPP
+#define TEST_COMMON_WORKSPACEARENA_HPP
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_WorkspaceArena.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+
+// Nested scopes with allocations of various types; the views must be
+// usable by kernels until their scope is released
+template <typename Device, typename Arena>
+void workspaceArenaIteration(Arena &arena) {
+  using exec_space = typename Device::execution_space;
+  typename Arena::Scope scope(&arena);
+  auto a = arena.template allocate<double>(1000);
+  {
+    typename Arena::Scope inner(&arena);
+    auto b = arena.template allocate<char>(3);
+    EXPECT_EQ(size_t(b.data()) % Arena::alignment, size_t(0));
+    EXPECT_EQ(b.extent(0), size_t(3));
+  }
+  auto c = arena.template allocate<int>(5000);
+  EXPECT_EQ(size_t(c.data()) % Arena::alignment, size_t(0));
+  Kokkos::deep_copy(a, 1.0);
+  Kokkos::deep_copy(c, 2);
+  double sum = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<exec_space>(0, 5000),
+      KOKKOS_LAMBDA(const int i, double &lsum) { lsum += c(i) + (i < 1000 ? a(i) : 0.0); }, sum);
+  EXPECT_EQ(sum, 11000.0);
+}
+
+template <typename Device>
+void testWorkspaceArena() {
+  using exec_space = typename Device::execution_space;
+  using mem_space  = typename Device::memory_space;
+  using arena_t    = KokkosKernels::Impl::WorkspaceArena<exec_space, mem_space>;
+  using pool_t     = KokkosKernels::Impl::UniformMemoryPool<Device, int>;
+
+  arena_t arena;
+  EXPECT_EQ(arena.capacity(), size_t(0));
+  EXPECT_THROW(arena.template allocate<int>(10), std::runtime_error);
+
+  // The first iteration overflows. Releasing it does not allocate: the next
+  // outermost scope grows the arena to its high-water mark
+  workspaceArenaIteration<Device>(arena);
+  EXPECT_EQ(arena.size(), size_t(0));
+  EXPECT_EQ(arena.capacity(), size_t(0));
+  EXPECT_GE(arena.get_high_water_mark(), 1000 * sizeof(double) + 5000 * sizeof(int));
+  {
+    typename arena_t::Scope scope(&arena, exec_space());
+    EXPECT_EQ(arena.capacity(), arena.get_high_water_mark());
+  }
+
+  arena.reset_stats();
+  workspaceArenaIteration<Device>(arena);
+  workspaceArenaIteration<Device>(arena);
+  EXPECT_EQ(arena.get_num_allocations(), size_t(6));
+  EXPECT_EQ(arena.get_num_buffer_allocations(), size_t(0));
+
+  // Views of handle-owned types can be drawn from the arena, or allocated
+  // when it is not enabled
+  for (arena_t *parena : {&arena, static_cast<arena_t *>(nullptr)}) {
+    typename arena_t::Scope scope(parena);
+    auto v = KokkosKernels::Impl::make_workspace_view<Kokkos::View<int *, Device>>(exec_space(), parena, "v", 100);
+    EXPECT_EQ(v.extent(0), size_t(100));
+    EXPECT_EQ(v.use_count(), parena ? 0 : 1);
+  }
+  EXPECT_EQ(arena.get_num_buffer_allocations(), size_t(0));
+
+  // A pool drawn from the arena is initialized like an allocated one, and a
+  // null arena falls back to allocating
+  for (arena_t *parena : {&arena, static_cast<arena_t *>(nullptr)}) {
+    typename arena_t::Scope scope(parena);
+    pool_t pool(8, 100, -1, KokkosKernels::Impl::ManyThread2OneChunk, parena);
+    Kokkos::View<int *, Device> chunkSums("chunk sums", 8);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<exec_space>(0, 8), KOKKOS_LAMBDA(const int i) {
+          int *chunk = pool.allocate_chunk(i);
+          int s      = 0;
+          for (int j = 0; j < 100; j++) s += chunk[j];
+          chunkSums(i) = s;
+          pool.release_chunk(chunk);
+        });
+    auto chunkSumsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), chunkSums);
+    for (int i = 0; i < 8; i++) EXPECT_EQ(chunkSumsHost(i), -100);
+  }
+  EXPECT_EQ(arena.size(), size_t(0));
+}
+
+TEST_F(TestCategory, common_workspace_arena) { testWorkspaceArena<TestDevice>(); }
+
+#endif  // TEST_COMMON_WORKSPACEARENA_HPP
@@ -0,0 +1,479 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSGRAPH_COMPRESSEDGRAPH_IMPL_HPP
+#define KOKKOSGRAPH_COMPRESSEDGRAPH_IMPL_HPP
+
+#include <cstdint>
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+// Byte-aligned varints: 7 bits per byte, least significant group first. The
+// high bit of a byte is set when more bytes follow.
+KOKKOS_INLINE_FUNCTION int varint_size(uint64_t x) {
+  int n = 1;
+  while (x >= 0x80) {
+    x >>= 7;
+    n++;
+  }
+  return n;
+}
+
+KOKKOS_INLINE_FUNCTION uint8_t *varint_encode(uint64_t x, uint8_t *out) {
+  while (x >= 0x80) {
+    *out++ = uint8_t(x) | 0x80;
+    x >>= 7;
+  }
+  *out++ = uint8_t(x);
+  return out;
+}
+
+KOKKOS_INLINE_FUNCTION const uint8_t *varint_decode(const uint8_t *in, uint64_t &x) {
+  uint64_t b = *in++;
+  x          = b & 0x7f;
+  for (int shift = 7; b & 0x80; shift += 7) {
+    b = *in++;
+    x |= (b & 0x7f) << shift;
+  }
+  return in;
+}
+
+// Maps small signed values to small unsigned values: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+KOKKOS_INLINE_FUNCTION uint64_t zigzag_encode(int64_t x) { return (uint64_t(x) << 1) ^ uint64_t(x >> 63); }
+
+KOKKOS_INLINE_FUNCTION int64_t zigzag_decode(uint64_t x) { return int64_t(x >> 1) ^ -int64_t(x & 1); }
+
+/// \brief Forward iterator over one adjacency list of a CompressedCrsGraph.
+///
+/// A compressed row is the varint degree, followed by the first neighbor as
+/// a zigzag varint relative to the row index, followed by the gaps between
+/// consecutive (sorted) neighbors as varints.
+template <typename OrdinalType>
+class CompressedRowIterator {
+ public:
+  KOKKOS_INLINE_FUNCTION CompressedRowIterator(const uint8_t *row_bytes, OrdinalType row)
+      : ptr(row_bytes), remaining(0), current(row), first(true) {
+    uint64_t degree;
+    ptr       = varint_decode(ptr, degree);
+    remaining = OrdinalType(degree);
+  }
+
+  /// \brief Number of neighbors not yet returned by next().
+  KOKKOS_INLINE_FUNCTION OrdinalType size() const { return remaining; }
+  KOKKOS_INLINE_FUNCTION bool has_next() const { return remaining > 0; }
+
+  /// \brief Decodes and returns the next neighbor. Requires has_next().
+  KOKKOS_INLINE_FUNCTION OrdinalType next() {
+    uint64_t gap;
+    ptr = varint_decode(ptr, gap);
+    if (first) {
+      current = OrdinalType(int64_t(current) + zigzag_decode(gap));
+      first   = false;
+    } else {
+      current += OrdinalType(gap);
+    }
+    remaining--;
+    return current;
+  }
+
+ private:
+  const uint8_t *ptr;
+  OrdinalType remaining;
+  OrdinalType current;
+  bool first;
+};
+
+/// \brief Iterator with the interface of CompressedRowIterator over one row
+/// of a plain CRS graph, so that kernels written against the iterator run on
+/// both formats.
+template <typename entries_t>
+class CrsRowIterator {
+ public:
+  using ordinal_type = typename entries_t::non_const_value_type;
+
+  KOKKOS_INLINE_FUNCTION CrsRowIterator(const entries_t &entries_, size_t begin, size_t end)
+      : entries(entries_), pos(begin), last(end) {}
+
+  KOKKOS_INLINE_FUNCTION ordinal_type size() const { return ordinal_type(last - pos); }
+  KOKKOS_INLINE_FUNCTION bool has_next() const { return pos < last; }
+  KOKKOS_INLINE_FUNCTION ordinal_type next() { return entries(pos++); }
+
+ private:
+  entries_t entries;
+  size_t pos;
+  size_t last;
+};
+
+/// \brief Device view of a plain CRS graph with the row() interface of
+/// CompressedCrsGraph.
+template <typename rowmap_t, typename entries_t>
+struct CrsGraphAccessor {
+  using ordinal_type = typename entries_t::non_const_value_type;
+  using row_iterator = CrsRowIterator<entries_t>;
+
+  rowmap_t rowmap;
+  entries_t entries;
+
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return rowmap.extent(0) ? ordinal_type(rowmap.extent(0) - 1) : ordinal_type(0);
+  }
+  KOKKOS_INLINE_FUNCTION ordinal_type degree(ordinal_type i) const { return ordinal_type(rowmap(i + 1) - rowmap(i)); }
+  KOKKOS_INLINE_FUNCTION row_iterator row(ordinal_type i) const {
+    return row_iterator(entries, rowmap(i), rowmap(i + 1));
+  }
+};
+
+// Sizes (SizeTag) and writes (EncodeTag) the compressed rows of a CRS graph
+// whose rows are sorted.
+template <typename rowmap_t, typename entries_t, typename offsets_t, typename bytes_t>
+struct CompressGraphFunctor {
+  using ordinal_type = typename entries_t::non_const_value_type;
+  using size_type    = typename offsets_t::non_const_value_type;
+
+  struct SizeTag {};
+  struct EncodeTag {};
+
+  rowmap_t rowmap;
+  entries_t entries;
+  offsets_t offsets;
+  bytes_t bytes;
+  ordinal_type numRows;
+
+  // offsets(i) = compressed size of row i; offsets(numRows) = 0. Sums the degrees.
+  KOKKOS_INLINE_FUNCTION void operator()(SizeTag, const ordinal_type i, size_type &numEntries) const {
+    if (i == numRows) {
+      offsets(i) = 0;
+      return;
+    }
+    const size_type begin = rowmap(i);
+    const size_type end   = rowmap(i + 1);
+    size_type rowBytes    = varint_size(uint64_t(end - begin));
+    int64_t prev          = i;
+    for (size_type j = begin; j < end; j++) {
+      const int64_t col = entries(j);
+      rowBytes += varint_size(j == begin ? zigzag_encode(col - prev) : uint64_t(col - prev));
+      prev = col;
+    }
+    offsets(i) = rowBytes;
+    numEntries += end - begin;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(EncodeTag, const ordinal_type i) const {
+    const size_type begin = rowmap(i);
+    const size_type end   = rowmap(i + 1);
+    uint8_t *out          = bytes.data() + offsets(i);
+    out                   = varint_encode(uint64_t(end - begin), out);
+    int64_t prev          = i;
+    for (size_type j = begin; j < end; j++) {
+      const int64_t col = entries(j);
+      out               = varint_encode(j == begin ? zigzag_encode(col - prev) : uint64_t(col - prev), out);
+      prev              = col;
+    }
+  }
+};
+
+// Degrees (DegreeTag) and neighbors (DecodeTag) of a compressed graph, written
+// as a CRS graph.
+template <typename graph_t, typename rowmap_t, typename entries_t>
+struct DecompressGraphFunctor {
+  using ordinal_type = typename graph_t::ordinal_type;
+
+  struct DegreeTag {};
+  struct DecodeTag {};
+
+  graph_t graph;
+  rowmap_t rowmap;
+  entries_t entries;
+
+  KOKKOS_INLINE_FUNCTION void operator()(DegreeTag, const ordinal_type i) const {
+    rowmap(i) = i == graph.numRows() ? 0 : graph.degree(i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(DecodeTag, const ordinal_type i) const {
+    auto it = graph.row(i);
+    for (auto j = rowmap(i); it.has_next(); j++) entries(j) = it.next();
+  }
+};
+
+// One level of a top-down BFS: the unvisited neighbors of the frontier get
+// the next level and are appended to the next frontier
+template <typename graph_t, typename levels_t, typename frontier_t>
+struct BFSExpandFunctor {
+  using ordinal_type = typename graph_t::ordinal_type;
+
+  graph_t graph;
+  levels_t levels;
+  frontier_t frontier;
+  frontier_t nextFrontier;
+  Kokkos::View<ordinal_type, typename frontier_t::device_type> nextFrontierSize;
+  ordinal_type level;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
+    const ordinal_type numRows = graph.numRows();
+    for (auto it = graph.row(frontier(i)); it.has_next();) {
+      const ordinal_type nei = it.next();
+      if (nei < 0 || nei >= numRows || levels(nei) != -1) continue;
+      if (Kokkos::atomic_compare_exchange(&levels(nei), ordinal_type(-1), ordinal_type(level + 1)) == -1) {
+        nextFrontier(Kokkos::atomic_fetch_add(&nextFrontierSize(), ordinal_type(1))) = nei;
+      }
+    }
+  }
+};
+
+template <typename ExecSpace, typename graph_t, typename levels_t>
+void graph_bfs_impl(const ExecSpace &exec, const graph_t &graph, typename graph_t::ordinal_type source,
+                    const levels_t &levels) {
+  using ordinal_type = typename graph_t::ordinal_type;
+  using device_t     = typename levels_t::device_type;
+  using frontier_t   = Kokkos::View<ordinal_type *, device_t>;
+  const ordinal_type numRows = graph.numRows();
+  Kokkos::deep_copy(exec, levels, ordinal_type(-1));
+  if (source < 0 || source >= numRows) return;
+  Kokkos::deep_copy(exec, Kokkos::subview(levels, source), ordinal_type(0));
+  frontier_t frontier(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "BFS frontier"), numRows);
+  frontier_t nextFrontier(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "BFS next frontier"), numRows);
+  Kokkos::View<ordinal_type, device_t> nextFrontierSize("BFS next frontier size");
+  Kokkos::deep_copy(exec, Kokkos::subview(frontier, 0), source);
+  ordinal_type frontierSize = 1;
+  for (ordinal_type level = 0; frontierSize; level++) {
+    Kokkos::deep_copy(exec, nextFrontierSize, ordinal_type(0));
+    Kokkos::parallel_for("KokkosGraph::BFS::Expand", Kokkos::RangePolicy<ExecSpace>(exec, 0, frontierSize),
+                         BFSExpandFunctor<graph_t, levels_t, frontier_t>{graph, levels, frontier, nextFrontier,
+                                                                         nextFrontierSize, level});
+    Kokkos::deep_copy(exec, frontierSize, nextFrontierSize);
+    exec.fence();
+    std::swap(frontier, nextFrontier);
+  }
+}
+
+// Speculative vertex-based greedy coloring: every uncolored vertex takes the
+// smallest color not used by its neighbors (ColorTag), then of two adjacent
+// vertices with the same color, the larger one is uncolored (ConflictTag).
+// Vertices still uncolored when the iterations run out are colored one after
+// the other by a single thread (SerialTag), like the serial conflict
+// resolution of the VB/EB colorings. Colors start at 1; 0 means uncolored.
+template <typename graph_t, typename colors_t>
+struct CompressedGreedyColorFunctor {
+  using ordinal_type = typename graph_t::ordinal_type;
+  using color_t      = typename colors_t::non_const_value_type;
+  using ban_type     = uint64_t;
+
+  struct ColorTag {};
+  struct ConflictTag {};
+  struct SerialTag {};
+
+  static constexpr int ban_bits = 64;
+
+  graph_t graph;
+  colors_t colors;
+
+  KOKKOS_INLINE_FUNCTION void operator()(ColorTag, const ordinal_type v) const {
+    if (colors(v) > 0) return;
+    const ordinal_type numRows = graph.numRows();
+    // Each pass bans the colors [offset, offset + ban_bits) of the neighbors
+    for (color_t offset = 1;; offset += ban_bits) {
+      ban_type banned = 0;
+      for (auto it = graph.row(v); it.has_next();) {
+        const ordinal_type nei = it.next();
+        if (nei == v || nei < 0 || nei >= numRows) continue;
+        const color_t c = colors(nei);
+        if (c >= offset && c - offset < ban_bits) banned |= ban_type(1) << (c - offset);
+      }
+      if (banned != ~ban_type(0)) {
+        int bit = 0;
+        while (banned & (ban_type(1) << bit)) bit++;
+        colors(v) = offset + bit;
+        return;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(ConflictTag, const ordinal_type v, ordinal_type &numConflicts) const {
+    const color_t c = colors(v);
+    if (c == 0) return;
+    for (auto it = graph.row(v); it.has_next();) {
+      const ordinal_type nei = it.next();
+      if (nei >= 0 && nei < v && colors(nei) == c) {
+        colors(v) = 0;
+        numConflicts++;
+        return;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(SerialTag, const int) const {
+    const ordinal_type numRows = graph.numRows();
+    for (ordinal_type v = 0; v < numRows; v++) (*this)(ColorTag(), v);
+  }
+};
+
+template <typename ExecSpace, typename graph_t, typename colors_t>
+int graph_color_compressed_impl(const ExecSpace &exec, const graph_t &graph, const colors_t &colors,
+                                int maxIterations) {
+  using functor_t            = CompressedGreedyColorFunctor<graph_t, colors_t>;
+  using ordinal_type         = typename graph_t::ordinal_type;
+  const ordinal_type numRows = graph.numRows();
+  Kokkos::deep_copy(exec, colors, typename colors_t::non_const_value_type(0));
+  int iter                  = 0;
+  ordinal_type numConflicts = numRows;
+  for (; numConflicts && iter < maxIterations; iter++) {
+    Kokkos::parallel_for("KokkosGraph::CompressedColor::Color",
+                         Kokkos::RangePolicy<ExecSpace, typename functor_t::ColorTag>(exec, 0, numRows),
+                         functor_t{graph, colors});
+    numConflicts = 0;
+    Kokkos::parallel_reduce("KokkosGraph::CompressedColor::Conflicts",
+                            Kokkos::RangePolicy<ExecSpace, typename functor_t::ConflictTag>(exec, 0, numRows),
+                            functor_t{graph, colors}, numConflicts);
+  }
+  if (numConflicts) {
+    // out of iterations: color the uncolored vertices serially
+    Kokkos::parallel_for("KokkosGraph::CompressedColor::Serial",
+                         Kokkos::RangePolicy<ExecSpace, typename functor_t::SerialTag>(exec, 0, 1),
+                         functor_t{graph, colors});
+    iter++;
+  }
+  return iter;
+}
+
+// Distance-2 MIS by iterated random priorities. A vertex status is IN (0),
+// OUT (max) or, while undecided, a unique key in [1, 2^63). A vertex joins the
+// set when its key is the smallest within distance 2, and leaves when a vertex
+// within distance 2 has joined.
+template <typename graph_t, typename status_view_t>
+struct CompressedMIS2Functor {
+  using ordinal_type = typename graph_t::ordinal_type;
+  using status_t     = uint64_t;
+
+  struct PriorityTag {};
+  struct RowMinTag {};
+  struct DecideTag {};
+
+  static constexpr status_t IN_SET  = 0;
+  static constexpr status_t OUT_SET = ~status_t(0);
+
+  graph_t graph;
+  status_view_t status;
+  status_view_t rowMin;
+  int idBits;
+  bool degreePriority;
+  status_t seed;
+
+  KOKKOS_INLINE_FUNCTION static status_t hash(status_t x) {
+    // splitmix64 finalizer
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(PriorityTag, const ordinal_type v) const {
+    const status_t s = status(v);
+    if (s == IN_SET || s == OUT_SET) return;
+    status_t priority = hash(seed + status_t(v));
+    // low degree first, which gives larger sets
+    if (degreePriority) {
+      const status_t degree = graph.degree(v);
+      priority              = ((degree < 0x7fff ? degree : 0x7fff) << 48) | (priority >> 16);
+    }
+    status(v) = (((priority >> (idBits + 1)) << idBits) | status_t(v)) + 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(RowMinTag, const ordinal_type v) const {
+    const ordinal_type numRows = graph.numRows();
+    status_t m                 = status(v);
+    for (auto it = graph.row(v); it.has_next();) {
+      const ordinal_type nei = it.next();
+      if (nei >= 0 && nei < numRows && status(nei) < m) m = status(nei);
+    }
+    rowMin(v) = m;
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(DecideTag, const ordinal_type v, ordinal_type &numUndecided) const {
+    const status_t s = status(v);
+    if (s == IN_SET || s == OUT_SET) return;
+    const ordinal_type numRows = graph.numRows();
+    status_t m                 = rowMin(v);
+    for (auto it = graph.row(v); it.has_next();) {
+      const ordinal_type nei = it.next();
+      if (nei >= 0 && nei < numRows && rowMin(nei) < m) m = rowMin(nei);
+    }
+    if (m == IN_SET)
+      status(v) = OUT_SET;
+    else if (m == s)
+      status(v) = IN_SET;
+    else
+      numUndecided++;
+  }
+};
+
+template <typename status_view_t, typename lno_view_t>
+struct CompactMIS2Functor {
+  using ordinal_type = typename lno_view_t::non_const_value_type;
+
+  status_view_t status;
+  lno_view_t mis;
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type v, ordinal_type &offset, bool final) const {
+    if (status(v) == 0) {
+      if (final) mis(offset) = v;
+      offset++;
+    }
+  }
+};
+
+template <typename ExecSpace, typename graph_t, typename lno_view_t>
+lno_view_t graph_d2_mis_compressed_impl(const ExecSpace &exec, const graph_t &graph, bool degreePriority) {
+  using ordinal_type  = typename graph_t::ordinal_type;
+  using status_view_t = Kokkos::View<uint64_t *, typename lno_view_t::device_type>;
+  using functor_t     = CompressedMIS2Functor<graph_t, status_view_t>;
+  const ordinal_type numRows = graph.numRows();
+  int idBits                 = 1;
+  while (idBits < 62 && (int64_t(1) << idBits) < int64_t(numRows)) idBits++;
+  // every vertex starts undecided
+  status_view_t status(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "MIS2 status"), numRows);
+  status_view_t rowMin(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "MIS2 row min"), numRows);
+  Kokkos::deep_copy(exec, status, uint64_t(1));
+  functor_t functor{graph, status, rowMin, idBits, degreePriority, 0};
+  for (ordinal_type numUndecided = numRows, iter = 0; numUndecided; iter++) {
+    // with degree priorities the keys stay fixed, as in MIS2_QUALITY
+    if (!degreePriority || iter == 0) {
+      functor.seed = uint64_t(iter) * uint64_t(numRows);
+      Kokkos::parallel_for("KokkosGraph::CompressedMIS2::Priority",
+                           Kokkos::RangePolicy<ExecSpace, typename functor_t::PriorityTag>(exec, 0, numRows), functor);
+    }
+    Kokkos::parallel_for("KokkosGraph::CompressedMIS2::RowMin",
+                         Kokkos::RangePolicy<ExecSpace, typename functor_t::RowMinTag>(exec, 0, numRows), functor);
+    numUndecided = 0;
+    Kokkos::parallel_reduce("KokkosGraph::CompressedMIS2::Decide",
+                            Kokkos::RangePolicy<ExecSpace, typename functor_t::DecideTag>(exec, 0, numRows), functor,
+                            numUndecided);
+  }
+  ordinal_type misSize = 0;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::CompressedMIS2::Count", Kokkos::RangePolicy<ExecSpace>(exec, 0, numRows),
+      KOKKOS_LAMBDA(const ordinal_type v, ordinal_type &lsize) { lsize += status(v) == 0; }, misSize);
+  lno_view_t mis(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "D2MIS"), misSize);
+  Kokkos::parallel_scan("KokkosGraph::CompressedMIS2::Compact", Kokkos::RangePolicy<ExecSpace>(exec, 0, numRows),
+                        CompactMIS2Functor<status_view_t, lno_view_t>{status, mis});
+  return mis;
+}
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_COMPRESSEDGRAPH_IMPL_HPP
@@ -15,8 +15,11 @@
 //@HEADER
 
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include "KokkosGraph_Distance1ColorHandle.hpp"
+#include "KokkosSparse_Utils.hpp"
 
 #include <bitset>
 
@@ -30,6 +33,12 @@ namespace Impl {
 
 #define VB_COLORING_FORBIDDEN_SIZE 64
 #define VBBIT_COLORING_FORBIDDEN_SIZE 64
+// VBH: smallest degree for which a vertex is colored by a team
+#define VBH_COLORING_MIN_HUB_DEGREE 256
+// VBH: number of 32-bit words of the team bitset of forbidden colors
+#define VBH_COLORING_FORBIDDEN_WORDS 256
+// BALANCED: maximum number of rounds of the color balancing pass
+#define BALANCED_COLORING_MAX_ROUNDS 8
 /*! \brief Base class for graph coloring purposes.
  *  Each color represents the set of the vertices that are independent,
  *  e.g. no vertex having same color shares an edge.
@@ -228,6 +237,7 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
                                   // 2: for VBBIT
 
   int _max_num_iterations;
+  bool _hybrid;  // VBH: VBBIT, with a team per high-degree vertex
 
  public:
   /**
@@ -250,10 +260,13 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
         _edge_filtering(coloring_handle->get_vb_edge_filtering()),
         _chunkSize(coloring_handle->get_vb_chunk_size()),
         _use_color_set(),
-        _max_num_iterations(coloring_handle->get_max_number_of_iterations()) {
+        _max_num_iterations(coloring_handle->get_max_number_of_iterations()),
+        _hybrid(coloring_handle->get_coloring_algo_type() == COLORING_VBH) {
     switch (coloring_handle->get_coloring_algo_type()) {
       case COLORING_VB: this->_use_color_set = 0; break;
-      case COLORING_VBBIT: this->_use_color_set = 2; break;
+      case COLORING_VBBIT:
+      case COLORING_VBH:
+      case COLORING_BALANCED: this->_use_color_set = 2; break;
       case COLORING_VBCS: this->_use_color_set = 1; break;
       default:  // cannnot get in here.
         this->_use_color_set = 0;
@@ -323,6 +336,15 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
                            functorInitList<nnz_lno_temp_work_view_t>(current_vertexList));
     }
 
+    // VBH: the high-degree vertices are taken out of the worklist, and are
+    // colored by a team each. Their conflicts are checked on the whole list
+    // of high-degree vertices, so this needs a conflictlist for the others.
+    nnz_lno_temp_work_view_t hubList;
+    nnz_lno_t numHubs = 0;
+    if (this->_hybrid && this->_conflict_scheme != COLORING_NOCONFLICT) {
+      numHubs = this->splitHubs(current_vertexList, current_vertexListLength, hubList);
+    }
+
     // the next iteration's conflict list
     nnz_lno_temp_work_view_t next_iteration_recolorList;
     // the size of the current conflictlist
@@ -338,7 +360,8 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
       next_iteration_recolorListLength = single_dim_index_view_type("recolorListLength");
     }
 
-    nnz_lno_t numUncolored = this->nv;
+    nnz_lno_t numUncolored     = this->nv;
+    nnz_lno_t numHubsUncolored = numHubs;
 
     double total_time_greedy_phase               = 0.0;
     double total_time_find_conflicts             = 0.0;
@@ -347,7 +370,7 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
     timer.reset();
 
     int iter = 0;
-    for (; (iter < this->_max_num_iterations) && (numUncolored > 0); iter++) {
+    for (; (iter < this->_max_num_iterations) && (numUncolored > 0 || numHubsUncolored > 0); iter++) {
       if (this->_edge_filtering) {
         // First color greedy speculatively,
         // some conflicts expected
@@ -359,6 +382,9 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
         this->colorGreedy(this->xadj, this->adj, colors, vertex_color_set, current_vertexList,
                           current_vertexListLength);
       }
+      if (numHubs) {
+        this->colorGreedyHubs(colors, hubList, numHubs);
+      }
 
       MyExecSpace().fence();
 
@@ -379,6 +405,9 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
             this->findConflicts(swap_work_arrays, this->xadj, this->adj, colors, vertex_color_set, current_vertexList,
                                 current_vertexListLength, next_iteration_recolorList, next_iteration_recolorListLength);
       }
+      if (numHubs) {
+        numHubsUncolored = this->findHubConflicts(colors, hubList, numHubs);
+      }
 
       MyExecSpace().fence();
 
@@ -421,6 +450,10 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
         std::cout << "\tTime serial conflict resolution: " << t << std::endl;
       }
     }
+    if (numHubsUncolored > 0) {
+      this->resolveConflicts(this->nv, this->xadj, this->adj, colors, hubList, numHubs);
+      MyExecSpace().fence();
+    }
     num_loops = iter;
 
     this->cp->add_to_overall_coloring_time_phase1(total_time_greedy_phase);
@@ -429,6 +462,82 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
   }  // color_graph (end)
 
  private:
+  /** \brief VBH: degree above which a vertex is colored by a team. Unless
+   * set in the handle, it is chosen from the degree distribution: the
+   * geometric mean of the average and maximum degrees, so that graphs with
+   * a narrow distribution have no high-degree vertices, and at least
+   * 4 times the average degree.
+   */
+  nnz_lno_t hubDegreeThreshold() {
+    nnz_lno_t threshold = this->cp->get_vbh_degree_threshold();
+    if (threshold > 0) return threshold;
+    nnz_lno_t minDegree = 0, maxDegree = 0;
+    KokkosSparse::Impl::graph_min_max_degree<Kokkos::Device<MyExecSpace, MyTempMemorySpace>, nnz_lno_t>(
+        this->xadj, minDegree, maxDegree);
+    double avgDegree = this->nv ? double(this->ne) / this->nv : 0.0;
+    double t = std::max({double(VBH_COLORING_MIN_HUB_DEGREE), 4 * avgDegree, std::sqrt(avgDegree * maxDegree)});
+    threshold = t < double(maxDegree) ? nnz_lno_t(t) : maxDegree;
+    if (this->_ticToc) {
+      std::cout << "\tVBH degrees min:" << minDegree << " avg:" << avgDegree << " max:" << maxDegree
+                << " threshold:" << threshold << std::endl;
+    }
+    return threshold;
+  }
+
+  /** \brief VBH: moves the vertices with a degree above the threshold from
+   * the worklist to hubList.
+   *  \param vertexList_: [in/out] the worklist
+   *  \param vertexListLength_: [in/out] size of the worklist
+   *  \param hubList_: [out] the high-degree vertices
+   *  \return the number of high-degree vertices
+   */
+  nnz_lno_t splitHubs(nnz_lno_temp_work_view_t &vertexList_, nnz_lno_t &vertexListLength_,
+                      nnz_lno_temp_work_view_t &hubList_) {
+    functorSplitHubs split(this->xadj, vertexList_, nnz_lno_temp_work_view_t(), nnz_lno_temp_work_view_t(),
+                           this->hubDegreeThreshold());
+    nnz_lno_t numLight = 0;
+    Kokkos::parallel_reduce("KokkosGraph::GraphColoring::CountLight", my_exec_space(0, vertexListLength_), split,
+                            numLight);
+    nnz_lno_t numHubs = vertexListLength_ - numLight;
+    if (numHubs == 0) return 0;
+    split._lightList = nnz_lno_temp_work_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vertexList"),
+                                                this->nv);
+    split._hubList   = nnz_lno_temp_work_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "hubList"), numHubs);
+    Kokkos::parallel_scan("KokkosGraph::GraphColoring::SplitHubs", my_exec_space(0, vertexListLength_), split);
+    vertexList_       = split._lightList;
+    vertexListLength_ = numLight;
+    hubList_          = split._hubList;
+    if (this->_ticToc) {
+      std::cout << "\tVBH high-degree vertices:" << numHubs << std::endl;
+    }
+    return numHubs;
+  }
+
+  /** \brief VBH: speculative coloring of the uncolored high-degree vertices.
+   */
+  void colorGreedyHubs(color_view_type vertex_colors_, nnz_lno_temp_work_view_t hubList_, nnz_lno_t numHubs_) {
+    Kokkos::TeamPolicy<MyExecSpace> policy(numHubs_, Kokkos::AUTO);
+    policy.set_scratch_size(0, Kokkos::PerTeam(functorGreedyColorHubs::team_scratch_size()));
+    Kokkos::parallel_for("KokkosGraph::GraphColoring::GreedyColorHubs", policy,
+                         functorGreedyColorHubs(this->nv, this->xadj, this->adj, vertex_colors_, hubList_));
+  }
+
+  /** \brief VBH: uncolors the high-degree vertices in conflict.
+   *  \return the number of uncolored high-degree vertices
+   */
+  nnz_lno_t findHubConflicts(color_view_type vertex_colors_, nnz_lno_temp_work_view_t hubList_,
+                             nnz_lno_t numHubs_) {
+    nnz_lno_t numConflicts = 0;
+    Kokkos::parallel_reduce("KokkosGraph::GraphColoring::FindConflictsHubs",
+                            Kokkos::TeamPolicy<MyExecSpace>(numHubs_, Kokkos::AUTO),
+                            functorFindConflictsHubs(this->nv, this->xadj, this->adj, vertex_colors_, hubList_),
+                            numConflicts);
+    if (this->_ticToc) {
+      std::cout << "\tnumHubsUncolored:" << numConflicts << std::endl;
+    }
+    return numConflicts;
+  }
+
   /** \brief Performs speculative coloring based on the given colorings.
    *  \param xadj_: row map of the graph
    *  \param adj_: entries, columns of the graph
@@ -834,6 +943,155 @@ class GraphColor_VB : public GraphColor<HandleType, lno_row_view_t_, lno_nnz_vie
     }
   };
 
+  /**
+   * VBH: splits the worklist into vertices of degree up to the threshold
+   * and high-degree vertices. Counts the former when used in a reduction.
+   */
+  struct functorSplitHubs {
+    typedef nnz_lno_t value_type;
+
+    const_lno_row_view_t _idx;
+    nnz_lno_temp_work_view_t _vertexList;
+    nnz_lno_temp_work_view_t _lightList;
+    nnz_lno_temp_work_view_t _hubList;
+    nnz_lno_t _threshold;
+
+    functorSplitHubs(const_lno_row_view_t xadj_, nnz_lno_temp_work_view_t vertexList,
+                     nnz_lno_temp_work_view_t lightList, nnz_lno_temp_work_view_t hubList, nnz_lno_t threshold)
+        : _idx(xadj_), _vertexList(vertexList), _lightList(lightList), _hubList(hubList), _threshold(threshold) {}
+
+    KOKKOS_INLINE_FUNCTION
+    bool isLight(const nnz_lno_t i) const { return nnz_lno_t(_idx(i + 1) - _idx(i)) <= _threshold; }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t ii, nnz_lno_t &numLight) const {
+      if (isLight(_vertexList(ii))) numLight++;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t ii, nnz_lno_t &numLight, const bool final) const {
+      const nnz_lno_t i = _vertexList(ii);
+      if (isLight(i)) {
+        if (final) _lightList(numLight) = i;
+        numLight++;
+      } else if (final) {
+        _hubList(ii - numLight) = i;
+      }
+    }
+  };
+
+  /**
+   * VBH: speculative coloring of high-degree vertices, a team per vertex.
+   * The colors of the neighbors are set in a bitset in team scratch, one
+   * window of VBH_COLORING_FORBIDDEN_WORDS * 32 colors at a time, and the
+   * smallest free color is found with a team reduction.
+   */
+  struct functorGreedyColorHubs {
+    typedef typename Kokkos::TeamPolicy<MyExecSpace>::member_type team_member_t;
+    typedef unsigned int bitset_word_t;
+    static constexpr int word_bits = 32;
+
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _hubList;
+
+    functorGreedyColorHubs(nnz_lno_t nv_, const_lno_row_view_t xadj_, const_lno_nnz_view_t adj_,
+                           color_view_type colors, nnz_lno_temp_work_view_t hubList)
+        : nv(nv_), _idx(xadj_), _adj(adj_), _colors(colors), _hubList(hubList) {}
+
+    KOKKOS_INLINE_FUNCTION
+    static size_t team_scratch_size() { return VBH_COLORING_FORBIDDEN_WORDS * sizeof(bitset_word_t); }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const team_member_t &t) const {
+      const nnz_lno_t i = _hubList(t.league_rank());
+      if (_colors(i) > 0) return;  // Already colored this vertex
+
+      bitset_word_t *forbidden = (bitset_word_t *)t.team_scratch(0).get_shmem(team_scratch_size());
+      const size_type xadjbegin   = _idx(i);
+      const size_type my_xadj_end = _idx(i + 1);
+      const color_t window        = VBH_COLORING_FORBIDDEN_WORDS * word_bits;
+
+      // At most degree colors are forbidden, so this ends within degree / window + 1 passes
+      for (color_t offset = 0;; offset += window) {
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(t, VBH_COLORING_FORBIDDEN_WORDS),
+                             [&](const int w) { forbidden[w] = 0; });
+        t.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(t, xadjbegin, my_xadj_end), [&](const size_type j) {
+          nnz_lno_t n = _adj(j);
+          if (n == i || n >= nv) return;  // Skip self-loops
+          color_t c = _colors(n);
+          if (c > offset && c - offset <= window) {
+            color_t bit = c - offset - 1;
+            Kokkos::atomic_or(&forbidden[bit / word_bits], bitset_word_t(1) << (bit % word_bits));
+          }
+        });
+        t.team_barrier();
+        color_t first_free = window;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(t, VBH_COLORING_FORBIDDEN_WORDS),
+            [&](const int w, color_t &lmin) {
+              bitset_word_t available = ~forbidden[w];
+              if (available) {
+                color_t bit = 0;
+                while ((available & 1) == 0) {
+                  ++bit;
+                  available = available >> 1;
+                }
+                if (w * word_bits + bit < lmin) lmin = w * word_bits + bit;
+              }
+            },
+            Kokkos::Min<color_t>(first_free));
+        if (first_free < window) {
+          Kokkos::single(Kokkos::PerTeam(t), [&]() { _colors(i) = offset + first_free + 1; });
+          return;
+        }
+        t.team_barrier();
+      }
+    }
+  };
+
+  /**
+   * VBH: finds the conflicts of high-degree vertices, a team per vertex.
+   * As in the other conflict functors, of two neighbors with the same color,
+   * the one with the smaller index is uncolored.
+   */
+  struct functorFindConflictsHubs {
+    typedef typename Kokkos::TeamPolicy<MyExecSpace>::member_type team_member_t;
+
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _hubList;
+
+    functorFindConflictsHubs(nnz_lno_t nv_, const_lno_row_view_t xadj_, const_lno_nnz_view_t adj_,
+                             color_view_type colors, nnz_lno_temp_work_view_t hubList)
+        : nv(nv_), _idx(xadj_), _adj(adj_), _colors(colors), _hubList(hubList) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const team_member_t &t, nnz_lno_t &numConflicts) const {
+      const nnz_lno_t i      = _hubList(t.league_rank());
+      const color_t my_color = _colors(i);
+      nnz_lno_t conflicts    = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, _idx(i), _idx(i + 1)),
+          [&](const size_type j, nnz_lno_t &lconflicts) {
+            nnz_lno_t neighbor = _adj(j);
+            if (i < neighbor && neighbor < nv && _colors(neighbor) == my_color) lconflicts++;
+          },
+          conflicts);
+      Kokkos::single(Kokkos::PerTeam(t), [&]() {
+        if (my_color == 0 || conflicts) {
+          _colors(i) = 0;  // Uncolor vertex i
+          numConflicts += 1;
+        }
+      });
+    }
+  };
+
   /**
    * Functor for VBCS algorithms speculative coloring with edge filtering.
    */
@@ -2796,6 +3054,146 @@ class GraphColor_EB : public GraphColor<HandleType, in_row_index_view_type_, in_
   };
 };
 
+/*! \brief Color balancing pass of COLORING_BALANCED.
+ *
+ *  Greedy colorings give a few large color classes and a long tail of small
+ *  ones. This is the vertex-centric first fit "shuffling" of Lu et al.,
+ *  Balanced coloring for parallel computing applications (IPDPS 2015): in
+ *  parallel, vertices of the classes larger than the average size move to
+ *  the first class smaller than the average that none of their neighbors is
+ *  in. Moves are speculative; of two adjacent vertices that moved to the same
+ *  class, the one with the larger index goes back. Source classes are above
+ *  the average and destination classes below it, so going back is always
+ *  valid. The number of colors does not change.
+ */
+template <typename rowmap_t, typename entries_t, typename colors_t, typename sizes_t>
+struct BalanceColorsFunctor {
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename sizes_t::non_const_value_type;
+  using color_t   = typename colors_t::non_const_value_type;
+
+  struct CountTag {};
+  struct MoveTag {};
+  struct ResolveTag {};
+
+  rowmap_t rowmap;
+  entries_t entries;
+  colors_t colors;
+  colors_t newColors;
+  // class sizes at the start of the round, and vertices moved out of/into each class
+  sizes_t sizes;
+  sizes_t removed;
+  sizes_t added;
+  lno_t nv;
+  color_t numColors;
+  lno_t target;
+
+  KOKKOS_INLINE_FUNCTION void operator()(CountTag, const lno_t i) const {
+    Kokkos::atomic_inc(&sizes(colors(i)));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(MoveTag, const lno_t i) const {
+    const color_t c = colors(i);
+    newColors(i)    = c;
+    if (sizes(c) <= target) return;
+    // at most sizes(c) - target vertices leave the class
+    if (Kokkos::atomic_fetch_add(&removed(c), lno_t(1)) >= sizes(c) - target) {
+      Kokkos::atomic_dec(&removed(c));
+      return;
+    }
+    const size_type rowBegin = rowmap(i);
+    const size_type rowEnd   = rowmap(i + 1);
+    // destination classes are searched by windows of 64 colors
+    for (color_t base = 1; base <= numColors; base += 64) {
+      const color_t windowEnd = base + 63 < numColors ? base + 63 : numColors;
+      bool hasRoom            = false;
+      for (color_t d = base; d <= windowEnd && !hasRoom; d++) hasRoom = sizes(d) < target;
+      if (!hasRoom) continue;
+      uint64_t forbidden = 0;
+      for (size_type j = rowBegin; j < rowEnd; j++) {
+        const lno_t nei = entries(j);
+        if (nei == i || nei >= nv) continue;
+        const color_t neiColor = colors(nei);
+        if (neiColor >= base && neiColor <= windowEnd) forbidden |= uint64_t(1) << (neiColor - base);
+      }
+      for (color_t d = base; d <= windowEnd; d++) {
+        if (sizes(d) >= target || (forbidden & (uint64_t(1) << (d - base)))) continue;
+        if (Kokkos::atomic_fetch_add(&added(d), lno_t(1)) < target - sizes(d)) {
+          newColors(i) = d;
+          return;
+        }
+        Kokkos::atomic_dec(&added(d));
+      }
+    }
+    Kokkos::atomic_dec(&removed(c));
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(ResolveTag, const lno_t i, lno_t &numMoved) const {
+    const color_t d = newColors(i);
+    if (d == colors(i)) return;
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++) {
+      const lno_t nei = entries(j);
+      if (nei < i && newColors(nei) == d) return;
+    }
+    colors(i) = d;
+    numMoved++;
+  }
+};
+
+/*! \brief Balances the sizes of the color classes of a valid distance-1
+ *  coloring, see BalanceColorsFunctor.
+ *  \param colors [in/out] colors of the vertices, from 1 to the number of colors
+ *  \param maxRounds maximum number of balancing rounds
+ *  \return number of rounds done
+ */
+template <typename ExecSpace, typename rowmap_t, typename entries_t, typename colors_t>
+int balance_colors(const ExecSpace &exec, const rowmap_t &rowmap, const entries_t &entries, const colors_t &colors,
+                   int maxRounds) {
+  using color_t   = typename colors_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+  using sizes_t   = Kokkos::View<lno_t *, typename colors_t::memory_space>;
+  using functor_t = BalanceColorsFunctor<rowmap_t, entries_t, colors_t, sizes_t>;
+  const lno_t nv  = colors.extent(0);
+
+  color_t numColors = 0;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::BalanceColors::NumColors", Kokkos::RangePolicy<ExecSpace>(exec, 0, nv),
+      KOKKOS_LAMBDA(const lno_t i, color_t &lmax) {
+        if (colors(i) > lmax) lmax = colors(i);
+      },
+      Kokkos::Max<color_t>(numColors));
+  if (numColors <= 1) return 0;
+
+  const lno_t target = (nv + lno_t(numColors) - 1) / lno_t(numColors);
+  functor_t functor{rowmap,
+                    entries,
+                    colors,
+                    colors_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "new colors"), nv),
+                    sizes_t(Kokkos::view_alloc(exec, "color class sizes"), numColors + 1),
+                    sizes_t(Kokkos::view_alloc(exec, "removed from class"), numColors + 1),
+                    sizes_t(Kokkos::view_alloc(exec, "added to class"), numColors + 1),
+                    nv,
+                    numColors,
+                    target};
+  int round = 0;
+  while (round < maxRounds) {
+    round++;
+    Kokkos::deep_copy(exec, functor.sizes, lno_t(0));
+    Kokkos::deep_copy(exec, functor.removed, lno_t(0));
+    Kokkos::deep_copy(exec, functor.added, lno_t(0));
+    Kokkos::parallel_for("KokkosGraph::BalanceColors::Count",
+                         Kokkos::RangePolicy<ExecSpace, typename functor_t::CountTag>(exec, 0, nv), functor);
+    Kokkos::parallel_for("KokkosGraph::BalanceColors::Move",
+                         Kokkos::RangePolicy<ExecSpace, typename functor_t::MoveTag>(exec, 0, nv), functor);
+    lno_t numMoved = 0;
+    Kokkos::parallel_reduce("KokkosGraph::BalanceColors::Resolve",
+                            Kokkos::RangePolicy<ExecSpace, typename functor_t::ResolveTag>(exec, 0, nv), functor,
+                            numMoved);
+    if (numMoved == 0) break;
+  }
+  return round;
+}
+
 template <class KernelHandle, typename lno_row_view_t_, typename lno_nnz_view_t_>
 void graph_color_impl(KernelHandle *handle, typename KernelHandle::nnz_lno_t num_rows, lno_row_view_t_ row_map,
                       lno_nnz_view_t_ entries) {
@@ -2826,6 +3224,8 @@ void graph_color_impl(KernelHandle *handle, typename KernelHandle::nnz_lno_t num
     case COLORING_VB:
     case COLORING_VBBIT:
     case COLORING_VBCS:
+    case COLORING_VBH:
+    case COLORING_BALANCED:
       typedef
           typename Impl::GraphColor_VB<typename KernelHandle::GraphColoringHandleType, lno_row_view_t_, lno_nnz_view_t_>
               VBGraphColoring;
@@ -2854,6 +3254,10 @@ void graph_color_impl(KernelHandle *handle, typename KernelHandle::nnz_lno_t num
 
   int num_phases = 0;
   gc->color_graph(colors_out, num_phases);
+  if (algorithm == COLORING_BALANCED) {
+    balance_colors(typename KernelHandle::HandleExecSpace(), row_map, entries, colors_out,
+                   BALANCED_COLORING_MAX_ROUNDS);
+  }
 
   delete gc;
   double coloring_time = timer.seconds();
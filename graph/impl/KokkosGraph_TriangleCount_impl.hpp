@@ -0,0 +1,346 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSGRAPH_TRIANGLECOUNT_IMPL_HPP
+#define KOKKOSGRAPH_TRIANGLECOUNT_IMPL_HPP
+
+#include <algorithm>
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+
+namespace KokkosGraph {
+namespace Impl {
+
+/// \brief Triangle counting on an oriented graph.
+///
+/// Each edge {u, v} of the undirected graph is kept once, from the endpoint
+/// with the lower (degree, index) to the other one. Every vertex then has at
+/// most sqrt(2 * numEdges) out-neighbors, and every triangle is found exactly
+/// once, from its lowest ranked vertex u and its middle vertex v, as an
+/// element of N+(u) and N+(v).
+///
+/// Out-neighbor lists are sorted. Each oriented edge (u, v) intersects N+(u)
+/// and N+(v) by merging them, or by galloping search of the longer one when
+/// their lengths are far apart. Hub rows, with at least hubMinDegree
+/// out-neighbors, are handled by a team instead: N+(u) is marked in a bitmap
+/// of the team, and the lists N+(v) are tested against it.
+template <typename device_t, typename rowmap_t, typename entries_t, typename counts_t>
+struct TriangleCount {
+  using exec_space = typename device_t::execution_space;
+  using mem_space  = typename device_t::memory_space;
+  using size_type  = typename rowmap_t::non_const_value_type;
+  using lno_t      = typename entries_t::non_const_value_type;
+  using count_t    = typename counts_t::non_const_value_type;
+  using orowmap_t  = Kokkos::View<size_type*, mem_space>;
+  using oentries_t = Kokkos::View<lno_t*, mem_space>;
+  using bitmaps_t  = Kokkos::View<uint32_t**, Kokkos::LayoutRight, mem_space>;
+
+  // Out-degree from which a row is intersected through a bitmap
+  static constexpr lno_t hubMinDegree = 256;
+  // Length ratio from which intersections gallop instead of merging
+  static constexpr size_type gallopRatio = 16;
+  // Memory for the bitmaps of the hub teams running at the same time. When
+  // a single bitmap is larger, there are no hub rows.
+  static constexpr size_t maxBitmapBytes = size_t(64) << 20;
+
+  struct OrientFunctor {
+    struct DegreeTag {};
+    struct CountTag {};
+    struct FillTag {};
+
+    rowmap_t rowmap;
+    entries_t entries;
+    lno_t numVerts;
+    oentries_t degrees;
+    orowmap_t orowmap;
+    oentries_t oentries;
+    oentries_t sources;
+
+    KOKKOS_INLINE_FUNCTION bool keep(const lno_t u, const lno_t w) const {
+      if (w >= numVerts || w == u) return false;
+      return degrees(w) > degrees(u) || (degrees(w) == degrees(u) && w > u);
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(DegreeTag, const lno_t u) const {
+      lno_t d = 0;
+      for (size_type j = rowmap(u); j < rowmap(u + 1); j++) {
+        const lno_t w = entries(j);
+        if (w < numVerts && w != u) d++;
+      }
+      degrees(u) = d;
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(CountTag, const lno_t u) const {
+      size_type d = 0;
+      for (size_type j = rowmap(u); j < rowmap(u + 1); j++) {
+        if (keep(u, entries(j))) d++;
+      }
+      orowmap(u) = d;
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(FillTag, const lno_t u) const {
+      size_type pos = orowmap(u);
+      for (size_type j = rowmap(u); j < rowmap(u + 1); j++) {
+        const lno_t w = entries(j);
+        if (keep(u, w)) {
+          oentries(pos) = w;
+          sources(pos)  = u;
+          pos++;
+        }
+      }
+    }
+  };
+
+  struct IntersectFunctor {
+    struct EdgeTag {};
+    struct HubTag {};
+    using member_t = typename Kokkos::TeamPolicy<exec_space, HubTag>::member_type;
+
+    orowmap_t rowmap;
+    oentries_t entries;
+    oentries_t sources;
+    // per-vertex counts, not computed if empty
+    counts_t counts;
+    oentries_t hubs;
+    // out-degree of the hub rows
+    lno_t hubDegree;
+    bitmaps_t bitmaps;
+    lno_t hubBegin;
+
+    KOKKOS_INLINE_FUNCTION void found(const lno_t w) const {
+      if (counts.extent(0)) Kokkos::atomic_inc(&counts(w));
+    }
+
+    KOKKOS_INLINE_FUNCTION void found(const lno_t u, const lno_t v, const size_t n) const {
+      if (counts.extent(0) && n) {
+        Kokkos::atomic_add(&counts(u), count_t(n));
+        Kokkos::atomic_add(&counts(v), count_t(n));
+      }
+    }
+
+    // Intersection of two sorted lists, b the longer one
+    KOKKOS_INLINE_FUNCTION size_t intersect(const lno_t* a, const size_type na, const lno_t* b,
+                                            const size_type nb) const {
+      size_t n = 0;
+      if (nb < gallopRatio * na) {
+        size_type i = 0, j = 0;
+        while (i < na && j < nb) {
+          if (a[i] < b[j])
+            i++;
+          else if (a[i] > b[j])
+            j++;
+          else {
+            found(a[i]);
+            n++;
+            i++;
+            j++;
+          }
+        }
+        return n;
+      }
+      size_type pos = 0;
+      for (size_type i = 0; i < na && pos < nb; i++) {
+        const lno_t x = a[i];
+        // exponential search for the first entry >= x, then binary search
+        size_type lo = pos, hi = pos, step = 1;
+        while (hi < nb && b[hi] < x) {
+          lo = hi + 1;
+          hi += step;
+          step *= 2;
+        }
+        if (hi > nb) hi = nb;
+        while (lo < hi) {
+          const size_type mid = lo + (hi - lo) / 2;
+          if (b[mid] < x)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        pos = lo;
+        if (pos < nb && b[pos] == x) {
+          found(x);
+          n++;
+          pos++;
+        }
+      }
+      return n;
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(EdgeTag, const size_type e, size_t& total) const {
+      const lno_t u           = sources(e);
+      const size_type uBegin  = rowmap(u);
+      const size_type uDegree = rowmap(u + 1) - uBegin;
+      if (uDegree >= size_type(hubDegree)) return;
+      const lno_t v             = entries(e);
+      const size_type vBegin    = rowmap(v);
+      const size_type vDegree   = rowmap(v + 1) - vBegin;
+      const lno_t* uNeighbors   = entries.data() + uBegin;
+      const lno_t* vNeighbors   = entries.data() + vBegin;
+      const size_t n            = uDegree <= vDegree ? intersect(uNeighbors, uDegree, vNeighbors, vDegree)
+                                                     : intersect(vNeighbors, vDegree, uNeighbors, uDegree);
+      found(u, v, n);
+      total += n;
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(HubTag, const member_t& t, size_t& total) const {
+      const lno_t u          = hubs(hubBegin + t.league_rank());
+      const size_type uBegin = rowmap(u);
+      const size_type uEnd   = rowmap(u + 1);
+      uint32_t* bits         = &bitmaps(t.league_rank(), 0);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(t, uBegin, uEnd), [&](const size_type j) {
+        const lno_t w = entries(j);
+        Kokkos::atomic_or(&bits[w >> 5], uint32_t(1) << (w & 31));
+      });
+      t.team_barrier();
+      size_t teamTotal = 0;
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(t, uBegin, uEnd),
+          [&](const size_type j, size_t& lsum) {
+            const lno_t v = entries(j);
+            size_t n      = 0;
+            for (size_type k = rowmap(v); k < rowmap(v + 1); k++) {
+              const lno_t w = entries(k);
+              if (bits[w >> 5] & (uint32_t(1) << (w & 31))) {
+                found(w);
+                n++;
+              }
+            }
+            found(u, v, n);
+            lsum += n;
+          },
+          teamTotal);
+      t.team_barrier();
+      // leave the bitmap cleared for the next hub
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(t, uBegin, uEnd),
+                           [&](const size_type j) { bits[entries(j) >> 5] = 0; });
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { total += teamTotal; });
+    }
+  };
+
+  struct HubListFunctor {
+    orowmap_t rowmap;
+    lno_t hubDegree;
+    oentries_t hubs;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t u, lno_t& offset, const bool final) const {
+      if (rowmap(u + 1) - rowmap(u) < size_type(hubDegree)) return;
+      if (final) hubs(offset) = u;
+      offset++;
+    }
+  };
+
+  struct ClusteringFunctor {
+    oentries_t degrees;
+    counts_t counts;
+    Kokkos::View<double*, mem_space> coefficients;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const lno_t u) const {
+      const double d  = degrees(u);
+      coefficients(u) = d < 2 ? 0.0 : 2.0 * double(counts(u)) / (d * (d - 1));
+    }
+  };
+
+  TriangleCount(const rowmap_t& rowmap_, const entries_t& entries_)
+      : rowmap(rowmap_), entries(entries_), numVerts(rowmap_.extent(0) ? rowmap_.extent(0) - 1 : 0) {}
+
+  /// \brief Counts the triangles.
+  /// \param counts [out] if not empty, the number of triangles of each vertex
+  /// \return the number of triangles
+  size_t compute(const counts_t& counts) {
+    exec_space exec;
+    if (counts.extent(0)) Kokkos::deep_copy(exec, counts, count_t(0));
+    if (numVerts == 0) return 0;
+
+    // orient the graph
+    degrees = oentries_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "degrees"), numVerts);
+    orowmap_t orowmap(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "oriented rowmap"), numVerts + 1);
+    OrientFunctor orient{rowmap, entries, numVerts, degrees, orowmap, oentries_t(), oentries_t()};
+    Kokkos::parallel_for("KokkosGraph::TriangleCount::Degree",
+                         Kokkos::RangePolicy<exec_space, typename OrientFunctor::DegreeTag>(exec, 0, numVerts),
+                         orient);
+    Kokkos::parallel_for("KokkosGraph::TriangleCount::CountOriented",
+                         Kokkos::RangePolicy<exec_space, typename OrientFunctor::CountTag>(exec, 0, numVerts),
+                         orient);
+    size_type numEdges = 0;
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numVerts + 1, orowmap, numEdges);
+    orient.oentries = oentries_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "oriented entries"), numEdges);
+    orient.sources  = oentries_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "edge sources"), numEdges);
+    Kokkos::parallel_for("KokkosGraph::TriangleCount::Orient",
+                         Kokkos::RangePolicy<exec_space, typename OrientFunctor::FillTag>(exec, 0, numVerts),
+                         orient);
+    // sorting keeps every entry in its row, so the edge sources stay valid
+    KokkosSparse::sort_crs_graph(exec, orowmap, orient.oentries);
+
+    // hub rows, unless a single bitmap would not fit in maxBitmapBytes
+    const size_t bitmapWords = (size_t(numVerts) + 31) / 32;
+    const lno_t hubDegree =
+        4 * bitmapWords <= maxBitmapBytes ? hubMinDegree : Kokkos::Experimental::finite_max_v<lno_t>;
+    lno_t numHubs = 0;
+    Kokkos::parallel_scan("KokkosGraph::TriangleCount::CountHubs", Kokkos::RangePolicy<exec_space>(exec, 0, numVerts),
+                          HubListFunctor{orowmap, hubDegree, oentries_t()}, numHubs);
+    oentries_t hubs(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "hubs"), numHubs);
+    if (numHubs) {
+      Kokkos::parallel_scan("KokkosGraph::TriangleCount::ListHubs",
+                            Kokkos::RangePolicy<exec_space>(exec, 0, numVerts),
+                            HubListFunctor{orowmap, hubDegree, hubs});
+    }
+
+    // non-hub rows, by edge
+    IntersectFunctor intersect{orowmap, orient.oentries, orient.sources, counts, hubs, hubDegree, bitmaps_t(), 0};
+    size_t total = 0;
+    Kokkos::parallel_reduce("KokkosGraph::TriangleCount::Edges",
+                            Kokkos::RangePolicy<exec_space, typename IntersectFunctor::EdgeTag>(exec, 0, numEdges),
+                            intersect, total);
+
+    // hub rows, by team, as many at a time as there are bitmaps
+    if (numHubs) {
+      const lno_t numBitmaps =
+          std::min<size_t>(std::min<size_t>(numHubs, exec.concurrency()), maxBitmapBytes / (4 * bitmapWords));
+      intersect.bitmaps = bitmaps_t("triangle count bitmaps", numBitmaps, bitmapWords);
+      for (lno_t hubBegin = 0; hubBegin < numHubs; hubBegin += numBitmaps) {
+        intersect.hubBegin = hubBegin;
+        size_t hubTotal    = 0;
+        Kokkos::parallel_reduce(
+            "KokkosGraph::TriangleCount::Hubs",
+            Kokkos::TeamPolicy<exec_space, typename IntersectFunctor::HubTag>(
+                exec, std::min<lno_t>(numBitmaps, numHubs - hubBegin), Kokkos::AUTO),
+            intersect, hubTotal);
+        total += hubTotal;
+      }
+    }
+    return total;
+  }
+
+  /// \brief Local clustering coefficients, 2 t(u) / (d(u) (d(u) - 1)), from
+  /// the per-vertex counts t of compute(). d(u) is the number of neighbors of
+  /// u other than itself.
+  void clustering_coefficients(const counts_t& counts, const Kokkos::View<double*, mem_space>& coefficients) {
+    Kokkos::parallel_for("KokkosGraph::TriangleCount::Clustering", Kokkos::RangePolicy<exec_space>(0, numVerts),
+                         ClusteringFunctor{degrees, counts, coefficients});
+  }
+
+  rowmap_t rowmap;
+  entries_t entries;
+  lno_t numVerts;
+  oentries_t degrees;
+};
+
+}  // namespace Impl
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_TRIANGLECOUNT_IMPL_HPP
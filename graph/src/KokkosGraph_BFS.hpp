@@ -0,0 +1,55 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSGRAPH_BFS_HPP
+#define KOKKOSGRAPH_BFS_HPP
+
+#include "KokkosGraph_CompressedGraph.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+
+// Parallel breadth-first search from source. Returns the BFS level (hop
+// distance from source) of every vertex, or -1 for vertices not reachable
+// from source. Column indices >= num_verts are ignored.
+
+template <typename device_t, typename rowmap_t, typename colinds_t,
+          typename levels_t = typename colinds_t::non_const_type>
+levels_t graph_bfs(const rowmap_t& rowmap, const colinds_t& colinds,
+                   typename colinds_t::non_const_value_type source) {
+  using exec_space = typename device_t::execution_space;
+  using graph_t    = KokkosGraph::Impl::CrsGraphAccessor<rowmap_t, colinds_t>;
+  graph_t graph{rowmap, colinds};
+  levels_t levels(Kokkos::view_alloc(Kokkos::WithoutInitializing, "BFS levels"), graph.numRows());
+  KokkosGraph::Impl::graph_bfs_impl(exec_space(), graph, source, levels);
+  return levels;
+}
+
+// Same, on a compressed graph
+template <typename CompressedGraph,
+          typename levels_t = Kokkos::View<typename CompressedGraph::ordinal_type*,
+                                           typename CompressedGraph::device_type>>
+std::enable_if_t<is_compressed_crs_graph_v<CompressedGraph>, levels_t> graph_bfs(
+    const CompressedGraph& graph, typename CompressedGraph::ordinal_type source) {
+  levels_t levels(Kokkos::view_alloc(Kokkos::WithoutInitializing, "BFS levels"), graph.numRows());
+  KokkosGraph::Impl::graph_bfs_impl(typename CompressedGraph::execution_space(), graph, source, levels);
+  return levels;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_BFS_HPP
@@ -157,6 +157,8 @@ class coarse_builder {
   using spgemm_kernel_handle  = KokkosKernels::Experimental::KokkosKernelsHandle<edge_offset_t, ordinal_t, scalar_t,
                                                                                 exec_space, mem_space, mem_space>;
   using uniform_memory_pool_t = KokkosKernels::Impl::UniformMemoryPool<exec_space, ordinal_t>;
+  using hashmap_arena_t       = KokkosKernels::Experimental::HashmapArena<mem_space>;
+  using growable_hashmap_t    = KokkosKernels::Experimental::GrowableHashmapAccumulator<ordinal_t, ordinal_t, scalar_t>;
   using mapper_t              = coarsen_heuristics<crsMat>;
   static constexpr ordinal_t get_null_val() {
     // this value must line up with the null value used by the hashmap
@@ -581,11 +583,15 @@ class coarse_builder {
     const ordinal_t max_hash_entries;
     vtx_view_t remaining;
     bool use_out;
+    hashmap_arena_t arena;
+    // keys inserted into a growable hashmap between two reservations
+    static constexpr ordinal_t arena_batch_size = 256;
 
     functorHashmapAccumulator(edge_view_t _row_map, vtx_view_t _entries_in, vtx_view_t _entries_out,
                               wgt_view_t _wgts_in, wgt_view_t _wgts_out, vtx_view_t _dedupe_edge_count,
                               uniform_memory_pool_t _memory_pool, const ordinal_t _hash_size,
-                              const ordinal_t _max_hash_entries, vtx_view_t _remaining, bool _use_out)
+                              const ordinal_t _max_hash_entries, vtx_view_t _remaining, bool _use_out,
+                              hashmap_arena_t _arena)
         : row_map(_row_map),
           entries_in(_entries_in),
           entries_out(_entries_out),
@@ -596,7 +602,8 @@ class coarse_builder {
           hash_size(_hash_size),
           max_hash_entries(_max_hash_entries),
           remaining(_remaining),
-          use_out(_use_out) {}
+          use_out(_use_out),
+          arena(_arena) {}
 
     KOKKOS_INLINE_FUNCTION
     ordinal_t get_thread_id(const ordinal_t row_index) const {
@@ -703,10 +710,16 @@ class coarse_builder {
       typedef ordinal_t hash_key_type;
       typedef scalar_t hash_value_type;
 
-      // can't do this row at current hashmap size
+      // can't do this row at current hashmap size, unless it fits in the
+      // arena
       ordinal_t hash_entries = row_map(idx + 1) - row_map(idx);
       if (hash_entries >= max_hash_entries) {
-        Kokkos::single(Kokkos::PerTeam(thread), [&]() { thread_sum++; });
+        if (dedupe_in_arena(thread, idx)) {
+          // mark the row as done for the next phase
+          Kokkos::single(Kokkos::PerTeam(thread), [&]() { remaining(thread.league_rank()) = ORD_MAX; });
+        } else {
+          Kokkos::single(Kokkos::PerTeam(thread), [&]() { thread_sum++; });
+        }
         thread.team_barrier();
         return;
       }
@@ -880,8 +893,67 @@ class coarse_builder {
 
     }  // operator()
 
+    // Deduplicates a row that is too long for the pool chunks, with a hashmap
+    // that starts at twice the chunk size and grows in the arena as needed.
+    // Returns false, leaving the row untouched, if the arena runs out.
+    KOKKOS_INLINE_FUNCTION
+    bool dedupe_in_arena(const member& thread, const ordinal_t idx) const {
+      if (arena.capacity() == 0) return false;
+      growable_hashmap_t hash_map = growable_hashmap_t::team_create(thread, 2 * hash_size, arena);
+      if (!hash_map.is_valid()) return false;
+      const edge_offset_t row_begin = row_map(idx);
+      const edge_offset_t row_end   = row_map(idx + 1);
+      for (edge_offset_t batch = row_begin; batch < row_end; batch += arena_batch_size) {
+        const edge_offset_t batch_end = KOKKOSKERNELS_MACRO_MIN(batch + arena_batch_size, row_end);
+        if (!hash_map.team_reserve(thread, batch_end - batch, arena)) return false;
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(thread, batch, batch_end), [&](const edge_offset_t& i) {
+          hash_map.vector_atomic_insert_mergeAtomicAdd(entries_in(i), wgts_in(i));
+        });
+      }
+      thread.team_barrier();
+      // The inputs have all been read, so the row can be overwritten. The
+      // write positions are claimed by counting used_size back down to 0.
+      const ordinal_t deduped_count = *hash_map.used_size;
+      thread.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(thread, hash_map.capacity), [&](const ordinal_t& i) {
+        if (hash_map.keys[i] != growable_hashmap_t::empty_key) {
+          const edge_offset_t write_at = row_begin + Kokkos::atomic_fetch_add(hash_map.used_size, ordinal_t(-1)) - 1;
+          entries_out(write_at)        = hash_map.keys[i];
+          wgts_out(write_at)           = hash_map.values[i];
+        }
+      });
+      Kokkos::single(Kokkos::PerTeam(thread), [&]() { dedupe_edge_count(idx) = deduped_count; });
+      return true;
+    }
+
   };  // functorHashmapAccumulator
 
+  // Bytes of arena the team hashmap kernel may use for the rows that are too
+  // long for its pool chunks: enough for all of them in the worst case (no
+  // duplicates), within what is left of max_mem_allowed after the pool.
+  static size_t getHashmapArenaSize(coarsen_handle& handle, const ordinal_t remaining_count, vtx_view_t remaining,
+                                    vtx_view_t edges_per_source, const ordinal_t hash_size,
+                                    const ordinal_t max_entries, const size_t pool_bytes) {
+    if (is_host_space || max_entries < 128 || pool_bytes >= handle.max_mem_allowed) return 0;
+    size_t needed = 0;
+    Kokkos::parallel_reduce(
+        "calc hashmap arena size", policy_t(0, remaining_count),
+        KOKKOS_LAMBDA(const ordinal_t i, size_t& sum) {
+          ordinal_t degree = edges_per_source(remaining(i));
+          if (degree < max_entries) return;
+          // the map doubles from 2 * hash_size until it can hold degree keys;
+          // all of its tables stay allocated
+          ordinal_t capacity = 2 * hash_size;
+          sum += hashmap_arena_t::alignment + growable_hashmap_t::table_bytes(capacity);
+          while (growable_hashmap_t::max_load(capacity) < degree) {
+            capacity *= 2;
+            sum += hashmap_arena_t::alignment + growable_hashmap_t::table_bytes(capacity);
+          }
+        },
+        needed);
+    return KOKKOSKERNELS_MACRO_MIN(needed, handle.max_mem_allowed - pool_bytes);
+  }
+
   static void getHashmapSizeAndCount(coarsen_handle& handle, const ordinal_t n, const ordinal_t remaining_count,
                                      vtx_view_t remaining, vtx_view_t edges_per_source, ordinal_t& hash_size,
                                      ordinal_t& max_entries, ordinal_t& mem_chunk_size, ordinal_t& mem_chunk_count) {
@@ -981,10 +1053,14 @@ class coarse_builder {
         bool use_dyn = should_use_dyn(n, source_bucket_offset, mem_chunk_count);
 
         uniform_memory_pool_t memory_pool(mem_chunk_count, mem_chunk_size, ORD_MAX, pool_type);
+        // rows too long for the pool chunks grow their hashmaps in the arena
+        hashmap_arena_t arena(getHashmapArenaSize(handle, remaining_count, remaining, edges_per_source, hash_size,
+                                                  max_entries,
+                                                  size_t(mem_chunk_count) * mem_chunk_size * sizeof(ordinal_t)));
 
         functorHashmapAccumulator hashmapAccumulator(source_bucket_offset, dest_by_source, dest_by_source,
                                                      wgt_by_source, wgt_out, edges_per_source, memory_pool, hash_size,
-                                                     max_entries, remaining, !scal_eq_ord);
+                                                     max_entries, remaining, !scal_eq_ord, arena);
 
         ordinal_t old_remaining_count = remaining_count;
         if (!is_host_space && max_entries >= 128) {
@@ -1006,8 +1082,9 @@ class coarse_builder {
           Kokkos::parallel_scan(
               "move remaining vertices", policy_t(0, old_remaining_count),
               KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& update, const bool final) {
+                // rows marked ORD_MAX were deduplicated in the arena
                 ordinal_t u = remaining(i);
-                if (edges_per_source(u) >= max_entries) {
+                if (u != ORD_MAX && edges_per_source(u) >= max_entries) {
                   if (final) {
                     new_remaining(update) = u;
                   }
@@ -1091,10 +1168,14 @@ class coarse_builder {
         }
 
         uniform_memory_pool_t memory_pool(mem_chunk_count, mem_chunk_size, ORD_MAX, pool_type);
+        // rows too long for the pool chunks grow their hashmaps in the arena
+        hashmap_arena_t arena(getHashmapArenaSize(handle, remaining_count, remaining, edges_per_source, hash_size,
+                                                  max_entries,
+                                                  size_t(mem_chunk_count) * mem_chunk_size * sizeof(ordinal_t)));
 
         functorHashmapAccumulator hashmapAccumulator(source_bucket_offset, dest_by_source, dest_by_source,
                                                      wgt_by_source, wgt_out, edges_per_source, memory_pool, hash_size,
-                                                     max_entries, remaining, !scal_eq_ord);
+                                                     max_entries, remaining, !scal_eq_ord, arena);
 
         ordinal_t old_remaining_count = remaining_count;
         if (!is_host_space && max_entries >= 128) {
@@ -1111,8 +1192,9 @@ class coarse_builder {
           Kokkos::parallel_scan(
               "move remaining vertices", policy_t(0, old_remaining_count),
               KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& update, const bool final) {
+                // rows marked ORD_MAX were deduplicated in the arena
                 ordinal_t u = remaining(i);
-                if (edges_per_source(u) >= max_entries) {
+                if (u != ORD_MAX && edges_per_source(u) >= max_entries) {
                   if (final) {
                     new_remaining(update) = u;
                   }
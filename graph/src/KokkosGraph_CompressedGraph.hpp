@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosGraph_CompressedGraph.hpp
+/// \brief Read-only CRS graph with delta/varint-encoded adjacency lists
+
+#ifndef KOKKOSGRAPH_COMPRESSEDGRAPH_HPP
+#define KOKKOSGRAPH_COMPRESSEDGRAPH_HPP
+
+#include <type_traits>
+#include "KokkosGraph_CompressedGraph_impl.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+
+namespace KokkosGraph {
+
+/// \brief Read-only CRS graph whose adjacency lists are compressed.
+///
+/// Each row is stored as its degree, then its sorted neighbors as gaps:
+/// the first relative to the row index, the others relative to the previous
+/// neighbor. All values are byte-aligned varints, so that rows with local
+/// neighbors take one or two bytes per edge instead of sizeof(OrdinalType).
+/// Rows are byte-addressed through offsets, one per row as in a CRS rowmap.
+///
+/// The graph is traversed on the device with row(i), which returns a
+/// forward iterator:
+///
+///   for (auto it = graph.row(i); it.has_next();) { auto nei = it.next(); ... }
+///
+/// Build it with compress_graph(), and get back a plain CRS graph with
+/// decompress_graph().
+template <typename OrdinalType, typename Device, typename SizeType = size_t>
+class CompressedCrsGraph {
+ public:
+  using ordinal_type    = OrdinalType;
+  using size_type       = SizeType;
+  using device_type     = Device;
+  using execution_space = typename Device::execution_space;
+  using memory_space    = typename Device::memory_space;
+  using offsets_type    = Kokkos::View<size_type *, device_type>;
+  using bytes_type      = Kokkos::View<uint8_t *, device_type>;
+  using row_iterator    = Impl::CompressedRowIterator<ordinal_type>;
+
+  /// \brief Byte offset of each row in bytes; numRows() + 1 entries.
+  offsets_type offsets;
+  /// \brief The encoded rows.
+  bytes_type bytes;
+
+  CompressedCrsGraph() : offsets(), bytes(), num_entries(0) {}
+
+  CompressedCrsGraph(const offsets_type &offsets_, const bytes_type &bytes_, size_type num_entries_)
+      : offsets(offsets_), bytes(bytes_), num_entries(num_entries_) {}
+
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const {
+    return offsets.extent(0) ? ordinal_type(offsets.extent(0) - 1) : ordinal_type(0);
+  }
+
+  /// \brief Number of edges, as in the CRS graph the compressed graph was built from.
+  KOKKOS_INLINE_FUNCTION size_type numEntries() const { return num_entries; }
+
+  KOKKOS_INLINE_FUNCTION row_iterator row(const ordinal_type i) const {
+    return row_iterator(bytes.data() + offsets(i), i);
+  }
+
+  KOKKOS_INLINE_FUNCTION ordinal_type degree(const ordinal_type i) const {
+    uint64_t d;
+    Impl::varint_decode(bytes.data() + offsets(i), d);
+    return ordinal_type(d);
+  }
+
+  /// \brief Bytes used by the compressed graph.
+  size_t compressed_bytes() const { return offsets.span() * sizeof(size_type) + bytes.span(); }
+
+  /// \brief Bytes the same graph takes as a StaticCrsGraph.
+  size_t uncompressed_bytes() const { return offsets.span() * sizeof(size_type) + num_entries * sizeof(ordinal_type); }
+
+ private:
+  size_type num_entries;
+};
+
+template <typename T>
+struct is_compressed_crs_graph : public std::false_type {};
+template <typename OrdinalType, typename Device, typename SizeType>
+struct is_compressed_crs_graph<CompressedCrsGraph<OrdinalType, Device, SizeType>> : public std::true_type {};
+template <typename OrdinalType, typename Device, typename SizeType>
+struct is_compressed_crs_graph<const CompressedCrsGraph<OrdinalType, Device, SizeType>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_compressed_crs_graph_v = is_compressed_crs_graph<T>::value;
+
+namespace Impl {
+template <typename CompressedGraph, typename ExecSpace, typename rowmap_t, typename entries_t>
+CompressedGraph compress_sorted_graph(const ExecSpace &exec, const rowmap_t &rowmap, const entries_t &entries) {
+  using ordinal_type = typename CompressedGraph::ordinal_type;
+  using size_type    = typename CompressedGraph::size_type;
+  using offsets_t    = typename CompressedGraph::offsets_type;
+  using bytes_t      = typename CompressedGraph::bytes_type;
+  using functor_t    = CompressGraphFunctor<rowmap_t, entries_t, offsets_t, bytes_t>;
+  const ordinal_type numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+
+  offsets_t offsets(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "CompressedCrsGraph offsets"),
+                    numRows + 1);
+  functor_t functor{rowmap, entries, offsets, bytes_t(), numRows};
+  size_type numEntries = 0;
+  Kokkos::parallel_reduce("KokkosGraph::CompressGraph::Size",
+                          Kokkos::RangePolicy<ExecSpace, typename functor_t::SizeTag>(exec, 0, numRows + 1), functor,
+                          numEntries);
+  size_type numBytes = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numRows + 1, offsets, numBytes);
+  functor.bytes = bytes_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "CompressedCrsGraph bytes"), numBytes);
+  Kokkos::parallel_for("KokkosGraph::CompressGraph::Encode",
+                       Kokkos::RangePolicy<ExecSpace, typename functor_t::EncodeTag>(exec, 0, numRows), functor);
+  return CompressedGraph(offsets, functor.bytes, numEntries);
+}
+}  // namespace Impl
+
+/// \brief Compresses a CRS graph.
+///
+/// Rows need not be sorted: unsorted rows are sorted in a temporary copy of
+/// the entries. Repeated entries are kept.
+///
+/// \tparam CompressedGraph The CompressedCrsGraph type to return
+/// \param exec The execution space instance on which to run
+/// \param rowmap The row offsets of the graph, numRows + 1 entries
+/// \param entries The column indices of the graph
+template <typename CompressedGraph, typename ExecSpace, typename rowmap_t, typename entries_t>
+CompressedGraph compress_graph(const ExecSpace &exec, const rowmap_t &rowmap, const entries_t &entries) {
+  static_assert(is_compressed_crs_graph_v<CompressedGraph>,
+                "KokkosGraph::compress_graph: CompressedGraph must be a CompressedCrsGraph");
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, typename rowmap_t::memory_space>::accessible &&
+                    Kokkos::SpaceAccessibility<ExecSpace, typename entries_t::memory_space>::accessible,
+                "KokkosGraph::compress_graph: rowmap and entries must be accessible from ExecSpace");
+  if (KokkosSparse::Impl::isCrsGraphSorted(rowmap, entries)) {
+    return Impl::compress_sorted_graph<CompressedGraph>(exec, rowmap, entries);
+  }
+  Kokkos::View<typename entries_t::non_const_value_type *, typename entries_t::device_type> sortedEntries(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "sorted entries"), entries.extent(0));
+  Kokkos::deep_copy(exec, sortedEntries, entries);
+  KokkosSparse::sort_crs_graph(exec, rowmap, sortedEntries);
+  return Impl::compress_sorted_graph<CompressedGraph>(exec, rowmap, sortedEntries);
+}
+
+template <typename CompressedGraph, typename rowmap_t, typename entries_t>
+CompressedGraph compress_graph(const rowmap_t &rowmap, const entries_t &entries) {
+  return compress_graph<CompressedGraph>(typename CompressedGraph::execution_space(), rowmap, entries);
+}
+
+/// \brief Expands a compressed graph into a CRS graph with sorted rows.
+///
+/// \param graph The compressed graph
+/// \param rowmap [out] Allocated with graph.numRows() + 1 entries
+/// \param entries [out] Allocated with graph.numEntries() entries
+template <typename CompressedGraph, typename rowmap_t, typename entries_t>
+void decompress_graph(const CompressedGraph &graph, rowmap_t &rowmap, entries_t &entries) {
+  static_assert(is_compressed_crs_graph_v<CompressedGraph>,
+                "KokkosGraph::decompress_graph: CompressedGraph must be a CompressedCrsGraph");
+  using exec_space   = typename CompressedGraph::execution_space;
+  using ordinal_type = typename CompressedGraph::ordinal_type;
+  using functor_t    = Impl::DecompressGraphFunctor<CompressedGraph, rowmap_t, entries_t>;
+  exec_space exec;
+  const ordinal_type numRows = graph.numRows();
+  rowmap = rowmap_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "rowmap"), numRows + 1);
+  Kokkos::parallel_for("KokkosGraph::DecompressGraph::Degree",
+                       Kokkos::RangePolicy<exec_space, typename functor_t::DegreeTag>(exec, 0, numRows + 1),
+                       functor_t{graph, rowmap, entries});
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numRows + 1, rowmap);
+  entries = entries_t(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "entries"), graph.numEntries());
+  Kokkos::parallel_for("KokkosGraph::DecompressGraph::Decode",
+                       Kokkos::RangePolicy<exec_space, typename functor_t::DecodeTag>(exec, 0, numRows),
+                       functor_t{graph, rowmap, entries});
+  exec.fence();
+}
+
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_COMPRESSEDGRAPH_HPP
@@ -0,0 +1,48 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosGraph_CompressedGraph_IOUtils.hpp
+/// \brief File output of compressed graphs, kept out of
+///   KokkosGraph_CompressedGraph.hpp so that it does not pull in the I/O
+///   utilities
+
+#ifndef KOKKOSGRAPH_COMPRESSEDGRAPH_IOUTILS_HPP
+#define KOKKOSGRAPH_COMPRESSEDGRAPH_IOUTILS_HPP
+
+#include "KokkosGraph_CompressedGraph.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+
+namespace KokkosGraph {
+
+/// \brief Writes a compressed graph in the Ligra AdjacencyGraph format
+/// (uncompressed), with KokkosSparse::Impl::write_graph_ligra.
+template <typename CompressedGraph>
+void write_graph_ligra(const CompressedGraph &graph, const char *filename) {
+  using ordinal_type = typename CompressedGraph::ordinal_type;
+  using size_type    = typename CompressedGraph::size_type;
+  using device_t     = typename CompressedGraph::device_type;
+  Kokkos::View<size_type *, device_t> rowmap;
+  Kokkos::View<ordinal_type *, device_t> entries;
+  decompress_graph(graph, rowmap, entries);
+  auto rowmapHost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
+  auto entriesHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  KokkosSparse::Impl::write_graph_ligra<ordinal_type, size_type, double>(
+      graph.numRows(), graph.numEntries(), rowmapHost.data(), entriesHost.data(), nullptr, filename);
+}
+
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_COMPRESSEDGRAPH_IOUTILS_HPP
@@ -17,6 +17,7 @@
 #define KOKKOSGRAPH_DISTANCE1_COLOR_HPP
 
 #include "KokkosGraph_color_d1_spec.hpp"
+#include "KokkosGraph_CompressedGraph.hpp"
 #include "KokkosKernels_helpers.hpp"
 #include "KokkosKernels_Utils.hpp"
 
@@ -62,6 +63,33 @@ void graph_color(KernelHandle *handle, typename KernelHandle::nnz_lno_t num_rows
   graph_color_symbolic(handle, num_rows, num_cols, row_map, entries, is_symmetric);
 }
 
+// Distance-1 coloring of a compressed graph. The vertex based speculative
+// coloring runs directly on the compressed rows; the algorithm set in the
+// coloring handle is not used. If conflicts remain after the handle's maximum
+// number of iterations, they are resolved serially, so the coloring is always
+// valid.
+template <class KernelHandle, typename CompressedGraph>
+std::enable_if_t<is_compressed_crs_graph_v<CompressedGraph>> graph_color(KernelHandle *handle,
+                                                                         const CompressedGraph &graph) {
+  using ExecSpace    = typename KernelHandle::HandleExecSpace;
+  using color_view_t = typename KernelHandle::GraphColoringHandleType::color_view_t;
+  Kokkos::Timer timer;
+  auto *gch = handle->get_graph_coloring_handle();
+  color_view_t colors;
+  if (gch->get_vertex_colors().use_count() > 0 && gch->get_vertex_colors().extent(0) == size_t(graph.numRows())) {
+    colors = gch->get_vertex_colors();
+  } else {
+    colors = color_view_t("Graph Colors", graph.numRows());
+  }
+  int num_phases = KokkosGraph::Impl::graph_color_compressed_impl(ExecSpace(), graph, colors,
+                                                                  gch->get_max_number_of_iterations());
+  double coloring_time = timer.seconds();
+  gch->add_to_overall_coloring_time(coloring_time);
+  gch->set_coloring_time(coloring_time);
+  gch->set_num_phases(num_phases);
+  gch->set_vertex_colors(colors);
+}
+
 }  // end namespace Experimental
 }  // end namespace KokkosGraph
 
@@ -27,15 +27,19 @@ namespace KokkosGraph {
 
 enum ColoringAlgorithm {
   COLORING_DEFAULT,
-  COLORING_SERIAL,   // Serial Greedy Coloring
-  COLORING_VB,       // Vertex Based Coloring
-  COLORING_VBBIT,    // Vertex Based Coloring with bit array
-  COLORING_VBCS,     // Vertex Based Color Set
-  COLORING_VBD,      // Vertex Based Deterministic Coloring
-  COLORING_VBDBIT,   // Vertex Based Deterministic Coloring with bit array
-  COLORING_EB,       // Edge Based Coloring
-  COLORING_SERIAL2,  // Serial Distance-2 Graph Coloring (kept here for
-                     // backwards compatibility for SPGEMM and other use cases)
+  COLORING_SERIAL,    // Serial Greedy Coloring
+  COLORING_VB,        // Vertex Based Coloring
+  COLORING_VBBIT,     // Vertex Based Coloring with bit array
+  COLORING_VBCS,      // Vertex Based Color Set
+  COLORING_VBD,       // Vertex Based Deterministic Coloring
+  COLORING_VBDBIT,    // Vertex Based Deterministic Coloring with bit array
+  COLORING_EB,        // Edge Based Coloring
+  COLORING_SERIAL2,   // Serial Distance-2 Graph Coloring (kept here for
+                      // backwards compatibility for SPGEMM and other use cases)
+  COLORING_VBH,       // Vertex Based Hybrid Coloring: VBBIT for low degree
+                      // vertices, a team per vertex for high degree vertices
+  COLORING_BALANCED,  // VBBIT, then moves vertices from the largest color
+                      // classes to the smallest ones to balance their sizes
 };
 
 enum ConflictList { COLORING_NOCONFLICT, COLORING_ATOMIC, COLORING_PPS };
@@ -116,6 +120,10 @@ class GraphColoringHandle {
   int eb_num_initial_colors;  // the number of colors to assign at the beginning
                               // of the edge-based algorithm
 
+  nnz_lno_t vbh_degree_threshold;  // VBH: vertices with a larger degree are
+                                   // colored by a team. 0: chosen from the
+                                   // degree distribution of the graph.
+
   // STATISTICS
   double overall_coloring_time;         // the overall time that it took to color the
                                         // graph. In the case of the iterative calls.
@@ -157,6 +165,7 @@ class GraphColoringHandle {
         vb_chunk_size(8),
         max_number_of_iterations(200),
         eb_num_initial_colors(1),
+        vbh_degree_threshold(0),
         overall_coloring_time(0),
         overall_coloring_time_phase1(0),
         overall_coloring_time_phase2(0),
@@ -511,6 +520,8 @@ class GraphColoringHandle {
       case COLORING_VBCS:
       case COLORING_VBD:
       case COLORING_VBDBIT:
+      case COLORING_VBH:
+      case COLORING_BALANCED:
       case COLORING_SERIAL:
         this->conflict_list_type             = COLORING_ATOMIC;
         this->min_reduction_for_conflictlist = 0.35;
@@ -552,6 +563,7 @@ class GraphColoringHandle {
   int get_vb_chunk_size() const { return this->vb_chunk_size; }
   int get_max_number_of_iterations() const { return this->max_number_of_iterations; }
   int get_eb_num_initial_colors() const { return this->eb_num_initial_colors; }
+  nnz_lno_t get_vbh_degree_threshold() const { return this->vbh_degree_threshold; }
 
   double get_overall_coloring_time() const { return this->overall_coloring_time; }
   double get_overall_coloring_time_phase1() const { return this->overall_coloring_time_phase1; }
@@ -588,6 +600,7 @@ class GraphColoringHandle {
   void set_vb_chunk_size(const int &chunksize) { this->vb_chunk_size = chunksize; }
   void set_max_number_of_iterations(const int &max_phases) { this->max_number_of_iterations = max_phases; }
   void set_eb_num_initial_colors(const int &num_initial_colors) { this->eb_num_initial_colors = num_initial_colors; }
+  void set_vbh_degree_threshold(const nnz_lno_t &degree_threshold) { this->vbh_degree_threshold = degree_threshold; }
   void add_to_overall_coloring_time(const double &coloring_time_) { this->overall_coloring_time += coloring_time_; }
   void add_to_overall_coloring_time_phase1(const double &coloring_time_) {
     this->overall_coloring_time_phase1 += coloring_time_;
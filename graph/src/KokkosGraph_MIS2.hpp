@@ -18,6 +18,7 @@
 #define KOKKOSGRAPH_DISTANCE2_MIS_HPP
 
 #include "KokkosGraph_Distance2MIS_impl.hpp"
+#include "KokkosGraph_CompressedGraph.hpp"
 
 namespace KokkosGraph {
 
@@ -48,6 +49,19 @@ lno_view_t graph_d2_mis(const rowmap_t& rowmap, const colinds_t& colinds, MIS2_A
   throw std::invalid_argument("graph_d2_mis: invalid algorithm");
 }
 
+// Same, on a compressed graph, which must be symmetric. MIS2_QUALITY gives
+// priority to low-degree vertices, MIS2_FAST uses new random priorities at
+// every iteration.
+template <typename CompressedGraph,
+          typename lno_view_t = Kokkos::View<typename CompressedGraph::ordinal_type*,
+                                             typename CompressedGraph::device_type>>
+std::enable_if_t<is_compressed_crs_graph_v<CompressedGraph>, lno_view_t> graph_d2_mis(
+    const CompressedGraph& graph, MIS2_Algorithm algo = MIS2_FAST) {
+  if (graph.numRows() == 0) return lno_view_t();
+  return Impl::graph_d2_mis_compressed_impl<typename CompressedGraph::execution_space, CompressedGraph, lno_view_t>(
+      typename CompressedGraph::execution_space(), graph, algo == MIS2_QUALITY);
+}
+
 template <typename device_t, typename rowmap_t, typename colinds_t,
           typename labels_t = typename colinds_t::non_const_type>
 labels_t graph_mis2_coarsen(const rowmap_t& rowmap, const colinds_t& colinds,
@@ -0,0 +1,65 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSGRAPH_TRIANGLECOUNT_HPP
+#define KOKKOSGRAPH_TRIANGLECOUNT_HPP
+
+#include "KokkosGraph_TriangleCount_impl.hpp"
+
+namespace KokkosGraph {
+namespace Experimental {
+
+// Triangle counting on an undirected graph, given as a symmetric CRS graph
+// without repeated entries. Self-loops and column indices >= num_verts are
+// ignored. Unlike triangle_generic, this does not go through SpGEMM: edges
+// are oriented by degree, and the neighbor lists of each edge's endpoints are
+// intersected directly (see KokkosGraph::Impl::TriangleCount).
+
+// Returns the number of triangles in the graph.
+template <typename device_t, typename rowmap_t, typename entries_t>
+size_t graph_triangle_count(const rowmap_t& rowmap, const entries_t& entries) {
+  using counts_t = Kokkos::View<size_t*, device_t>;
+  KokkosGraph::Impl::TriangleCount<device_t, rowmap_t, entries_t, counts_t> tc(rowmap, entries);
+  return tc.compute(counts_t());
+}
+
+// Same, and counts(i) is set to the number of triangles containing vertex i.
+// counts must have num_verts entries.
+template <typename device_t, typename rowmap_t, typename entries_t, typename counts_t>
+size_t graph_triangle_count(const rowmap_t& rowmap, const entries_t& entries, const counts_t& counts) {
+  KokkosGraph::Impl::TriangleCount<device_t, rowmap_t, entries_t, counts_t> tc(rowmap, entries);
+  return tc.compute(counts);
+}
+
+// Local clustering coefficient of every vertex: the fraction of the pairs of
+// its neighbors that are adjacent, or 0 for vertices with fewer than 2
+// neighbors. coefficients must have num_verts entries. Returns the number of
+// triangles in the graph.
+template <typename device_t, typename rowmap_t, typename entries_t>
+size_t graph_clustering_coefficients(const rowmap_t& rowmap, const entries_t& entries,
+                                     const Kokkos::View<double*, device_t>& coefficients) {
+  using counts_t = Kokkos::View<size_t*, device_t>;
+  KokkosGraph::Impl::TriangleCount<device_t, rowmap_t, entries_t, counts_t> tc(rowmap, entries);
+  counts_t counts(Kokkos::view_alloc(Kokkos::WithoutInitializing, "triangle counts"), coefficients.extent(0));
+  size_t numTriangles = tc.compute(counts);
+  tc.clustering_coefficients(counts, coefficients);
+  return numTriangles;
+}
+
+}  // namespace Experimental
+}  // namespace KokkosGraph
+
+#endif  // KOKKOSGRAPH_TRIANGLECOUNT_HPP
@@ -20,6 +20,8 @@
 #include "Test_Graph_graph_color_distance2.hpp"
 #include "Test_Graph_graph_color.hpp"
 #include "Test_Graph_mis2.hpp"
+#include "Test_Graph_compressed.hpp"
+#include "Test_Graph_triangle_count.hpp"
 #if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
 #include "Test_Graph_coarsen.hpp"
 #endif
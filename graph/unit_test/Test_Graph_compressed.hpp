@@ -0,0 +1,182 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <queue>
+#include <set>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_CompressedGraph.hpp"
+#include "KokkosGraph_BFS.hpp"
+#include "KokkosGraph_Distance1Color.hpp"
+#include "KokkosGraph_MIS2.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "Test_Graph_mis2_verify.hpp"
+
+namespace Test {
+
+// Generates a random symmetric graph; row_map and entries are returned on the device.
+template <typename lno_t, typename size_type, typename device, typename rowmap_t, typename entries_t>
+void make_compressed_test_graph(lno_t numVerts, size_type nnz, lno_t bandwidth, lno_t row_size_variance,
+                                rowmap_t& symRowmap, entries_t& symEntries) {
+  using crsMat      = KokkosSparse::CrsMatrix<double, lno_t, device, void, size_type>;
+  using graph_type  = typename crsMat::StaticCrsGraphType;
+  using c_rowmap_t  = typename graph_type::row_map_type;
+  using c_entries_t = typename graph_type::entries_type;
+  crsMat A =
+      KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat>(numVerts, numVerts, nnz, row_size_variance, bandwidth);
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<c_rowmap_t, c_entries_t, rowmap_t, entries_t,
+                                                         typename device::execution_space>(
+      numVerts, A.graph.row_map, A.graph.entries, symRowmap, symEntries);
+}
+
+// Host reference BFS levels
+template <typename lno_t, typename rowmap_t, typename entries_t>
+std::vector<lno_t> host_bfs(lno_t numVerts, const rowmap_t& rowmap, const entries_t& entries, lno_t source) {
+  std::vector<lno_t> levels(numVerts, -1);
+  std::queue<lno_t> q;
+  levels[source] = 0;
+  q.push(source);
+  while (!q.empty()) {
+    lno_t v = q.front();
+    q.pop();
+    for (auto j = rowmap(v); j < rowmap(v + 1); j++) {
+      lno_t nei = entries(j);
+      if (nei < numVerts && levels[nei] == -1) {
+        levels[nei] = levels[v] + 1;
+        q.push(nei);
+      }
+    }
+  }
+  return levels;
+}
+
+}  // namespace Test
+
+template <typename scalar_unused, typename lno_t, typename size_type, typename device>
+void test_compressed_graph(lno_t numVerts, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using rowmap_t     = Kokkos::View<size_type*, device>;
+  using entries_t    = Kokkos::View<lno_t*, device>;
+  using compressed_t = KokkosGraph::CompressedCrsGraph<lno_t, device, size_type>;
+  rowmap_t rowmap;
+  entries_t entries;
+  Test::make_compressed_test_graph<lno_t, size_type, device>(numVerts, nnz, bandwidth, row_size_variance, rowmap,
+                                                             entries);
+  auto rowmapHost  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
+  auto entriesHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+
+  compressed_t graph = KokkosGraph::compress_graph<compressed_t>(rowmap, entries);
+  EXPECT_EQ(graph.numRows(), numVerts);
+  EXPECT_EQ(graph.numEntries(), size_type(entries.extent(0)));
+  // gaps within the band take fewer bytes than full ordinals
+  EXPECT_LT(graph.compressed_bytes(), graph.uncompressed_bytes());
+
+  // Round trip: same graph, with sorted rows
+  {
+    rowmap_t rowmap2;
+    entries_t entries2;
+    KokkosGraph::decompress_graph(graph, rowmap2, entries2);
+    auto rowmap2Host  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap2);
+    auto entries2Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries2);
+    ASSERT_EQ(rowmap2Host.extent(0), rowmapHost.extent(0));
+    for (lno_t i = 0; i < numVerts; i++) {
+      ASSERT_EQ(rowmap2Host(i + 1), rowmapHost(i + 1)) << "row " << i;
+      std::vector<lno_t> row(entriesHost.data() + rowmapHost(i), entriesHost.data() + rowmapHost(i + 1));
+      std::sort(row.begin(), row.end());
+      for (size_t k = 0; k < row.size(); k++) EXPECT_EQ(entries2Host(rowmap2Host(i) + k), row[k]) << "row " << i;
+    }
+  }
+
+  // Distance-1 coloring, with the default iteration limit, then with a single
+  // iteration so that the remaining conflicts are resolved serially
+  for (int maxIterations : {0, 1}) {
+    using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+        size_type, lno_t, double, typename device::execution_space, typename device::memory_space,
+        typename device::memory_space>;
+    KernelHandle kh;
+    kh.create_graph_coloring_handle();
+    if (maxIterations) kh.get_graph_coloring_handle()->set_max_number_of_iterations(maxIterations);
+    KokkosGraph::Experimental::graph_color(&kh, graph);
+    auto colors =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), kh.get_graph_coloring_handle()->get_vertex_colors());
+    for (lno_t i = 0; i < numVerts; i++) {
+      ASSERT_GT(colors(i), 0) << "vertex " << i << " is uncolored";
+      for (size_type j = rowmapHost(i); j < rowmapHost(i + 1); j++) {
+        lno_t nei = entriesHost(j);
+        if (nei != i && nei < numVerts) EXPECT_NE(colors(i), colors(nei)) << "edge " << i << " - " << nei;
+      }
+    }
+    kh.destroy_graph_coloring_handle();
+  }
+
+  // Distance-2 MIS
+  for (auto algo : {KokkosGraph::MIS2_FAST, KokkosGraph::MIS2_QUALITY}) {
+    auto mis     = KokkosGraph::graph_d2_mis(graph, algo);
+    auto misHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), mis);
+    bool success = Test::verifyD2MIS<lno_t, size_type, decltype(rowmapHost), decltype(entriesHost), decltype(misHost)>(
+        numVerts, rowmapHost, entriesHost, misHost);
+    EXPECT_TRUE(success) << "Dist-2 MIS (algo " << (int)algo << ") on the compressed graph produced invalid set.";
+  }
+
+  // BFS, on the compressed and on the plain graph
+  for (lno_t source : {lno_t(0), lno_t(numVerts / 2)}) {
+    auto ref    = Test::host_bfs(numVerts, rowmapHost, entriesHost, source);
+    auto levels = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      KokkosGraph::Experimental::graph_bfs(graph, source));
+    auto crsLevels = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), KokkosGraph::Experimental::graph_bfs<device>(rowmap, entries, source));
+    for (lno_t i = 0; i < numVerts; i++) {
+      EXPECT_EQ(levels(i), ref[i]) << "vertex " << i;
+      EXPECT_EQ(crsLevels(i), ref[i]) << "vertex " << i;
+    }
+  }
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                                     \
+  TEST_F(TestCategory, graph##_##compressed_graph##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {         \
+    test_compressed_graph<SCALAR, ORDINAL, OFFSET, DEVICE>(5000, 5000 * 20, 100, 10);                     \
+    test_compressed_graph<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50 * 10, 40, 10);                          \
+    test_compressed_graph<SCALAR, ORDINAL, OFFSET, DEVICE>(5, 5 * 3, 5, 0);                               \
+  }
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, int, TestDevice)
+#endif
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(double, int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
+#include <algorithm>
 
 #include "KokkosGraph_Distance1Color.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
@@ -94,8 +95,9 @@ void test_coloring(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size
   graph_t static_graph(sym_adj, sym_xadj);
   input_mat = crsMat_t("CrsMatrix", numCols, newValues, static_graph);
 
-  std::vector<ColoringAlgorithm> coloring_algorithms = {COLORING_DEFAULT, COLORING_SERIAL, COLORING_VB, COLORING_VBBIT,
-                                                        COLORING_VBCS};
+  std::vector<ColoringAlgorithm> coloring_algorithms = {COLORING_DEFAULT, COLORING_SERIAL, COLORING_VB,
+                                                        COLORING_VBBIT,   COLORING_VBCS,   COLORING_VBH,
+                                                        COLORING_BALANCED};
 
   // FIXME: VBD sometimes fails on CUDA and HIP
 #if defined(KOKKOS_ENABLE_CUDA)
@@ -169,10 +171,128 @@ void test_coloring(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size
   // device::execution_space::finalize();
 }
 
-#define EXECUTE_TEST(ORDINAL, OFFSET, DEVICE)                                                          \
-  TEST_F(TestCategory, graph##_##graph_color##_default_scalar_##ORDINAL##_##OFFSET##_##DEVICE) {       \
-    test_coloring<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 30, 200, 10); \
-    test_coloring<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 30, 100, 10); \
+// A ring with a few vertices adjacent to all others, so that VBH colors
+// these with teams
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_coloring_hubs(lno_t numRows, lno_t numHubs) {
+  using namespace Test;
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type lno_view_t;
+  typedef typename graph_t::entries_type::non_const_type lno_nnz_view_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+
+  std::vector<std::vector<lno_t>> adj(numRows);
+  for (lno_t i = 0; i < numRows; i++) {
+    adj[i].push_back((i + 1) % numRows);
+    adj[(i + 1) % numRows].push_back(i);
+  }
+  for (lno_t h = 0; h < numHubs; h++) {
+    for (lno_t i = 0; i < numRows; i++) {
+      if (i == h) continue;
+      adj[h].push_back(i);
+      adj[i].push_back(h);
+    }
+  }
+  lno_view_t rowmap("rowmap", numRows + 1);
+  auto hrowmap = Kokkos::create_mirror_view(rowmap);
+  for (lno_t i = 0; i < numRows; i++) hrowmap(i + 1) = hrowmap(i) + adj[i].size();
+  lno_nnz_view_t entries("entries", hrowmap(numRows));
+  auto hentries = Kokkos::create_mirror_view(entries);
+  for (lno_t i = 0; i < numRows; i++) std::copy(adj[i].begin(), adj[i].end(), hentries.data() + hrowmap(i));
+  Kokkos::deep_copy(rowmap, hrowmap);
+  Kokkos::deep_copy(entries, hentries);
+  crsMat_t input_mat("CrsMatrix", numRows, scalar_view_t("vals", entries.extent(0)), graph_t(entries, rowmap));
+
+  for (ColoringAlgorithm coloring_algorithm : {COLORING_VBBIT, COLORING_VBH}) {
+    lno_nnz_view_t vector_colors;
+    size_t num_colors;
+    int res = run_graphcolor<crsMat_t, device>(input_mat, coloring_algorithm, num_colors, vector_colors);
+    EXPECT_TRUE((res == 0));
+    lno_t num_conflict =
+        KokkosSparse::Impl::kk_is_d1_coloring_valid<lno_view_t, lno_nnz_view_t, lno_nnz_view_t,
+                                                    typename device::execution_space>(
+            numRows, numRows, rowmap, entries, vector_colors);
+    EXPECT_TRUE((num_conflict == 0)) << "Coloring algo " << (int)coloring_algorithm
+                                     << ": D1 coloring produced invalid coloring (" << num_conflict << " conflicts)";
+    // the hubs form a clique adjacent to the ring
+    EXPECT_GE(num_colors, size_t(numHubs + 2));
+  }
+}
+
+// Color class sizes of a coloring, and the sum of their distances to the
+// average size
+template <typename color_view_t>
+std::vector<size_t> color_class_sizes(const color_view_t &colors, size_t numColors, size_t &imbalance) {
+  auto hcolors = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), colors);
+  std::vector<size_t> sizes(numColors, 0);
+  for (size_t i = 0; i < hcolors.extent(0); i++) sizes[hcolors(i) - 1]++;
+  const size_t target = (hcolors.extent(0) + numColors - 1) / numColors;
+  imbalance           = 0;
+  for (size_t size : sizes) imbalance += size > target ? size - target : target - size;
+  return sizes;
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_coloring_balance(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  using namespace Test;
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type lno_view_t;
+  typedef typename graph_t::entries_type lno_nnz_view_t;
+  typedef typename graph_t::entries_type::non_const_type color_view_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+  typedef typename device::execution_space execution_space;
+
+  crsMat_t input_mat =
+      KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows, numRows, nnz, row_size_variance, bandwidth);
+  typename lno_view_t::non_const_type sym_xadj;
+  typename lno_nnz_view_t::non_const_type sym_adj;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<lno_view_t, lno_nnz_view_t,
+                                                         typename lno_view_t::non_const_type,
+                                                         typename lno_nnz_view_t::non_const_type, execution_space>(
+      numRows, input_mat.graph.row_map, input_mat.graph.entries, sym_xadj, sym_adj);
+  input_mat = crsMat_t("CrsMatrix", numRows, scalar_view_t("vals", sym_adj.extent(0)), graph_t(sym_adj, sym_xadj));
+
+  // greedy coloring, then the balancing pass of COLORING_BALANCED on a copy
+  color_view_t colors;
+  size_t num_colors;
+  run_graphcolor<crsMat_t, device>(input_mat, COLORING_VBBIT, num_colors, colors);
+  color_view_t balanced_colors("balanced colors", numRows);
+  Kokkos::deep_copy(balanced_colors, colors);
+  int rounds = KokkosGraph::Impl::balance_colors(execution_space(), input_mat.graph.row_map, input_mat.graph.entries,
+                                                 balanced_colors, BALANCED_COLORING_MAX_ROUNDS);
+  EXPECT_GT(rounds, 0);
+
+  lno_t num_conflict = KokkosSparse::Impl::kk_is_d1_coloring_valid<lno_view_t, lno_nnz_view_t, color_view_t,
+                                                                   execution_space>(
+      numRows, numRows, input_mat.graph.row_map, input_mat.graph.entries, balanced_colors);
+  EXPECT_EQ(num_conflict, lno_t(0)) << "Balancing produced an invalid coloring";
+
+  size_t imbalance, balanced_imbalance;
+  std::vector<size_t> sizes          = color_class_sizes(colors, num_colors, imbalance);
+  std::vector<size_t> balanced_sizes = color_class_sizes(balanced_colors, num_colors, balanced_imbalance);
+  // vertices only move from classes above the average to classes below it
+  EXPECT_LE(*std::max_element(balanced_sizes.begin(), balanced_sizes.end()),
+            *std::max_element(sizes.begin(), sizes.end()));
+  EXPECT_GE(*std::min_element(balanced_sizes.begin(), balanced_sizes.end()),
+            *std::min_element(sizes.begin(), sizes.end()));
+  EXPECT_LT(balanced_imbalance, imbalance);
+
+  // the whole algorithm, through the coloring handle
+  run_graphcolor<crsMat_t, device>(input_mat, COLORING_BALANCED, num_colors, colors);
+  num_conflict = KokkosSparse::Impl::kk_is_d1_coloring_valid<lno_view_t, lno_nnz_view_t, color_view_t,
+                                                             execution_space>(
+      numRows, numRows, input_mat.graph.row_map, input_mat.graph.entries, colors);
+  EXPECT_EQ(num_conflict, lno_t(0)) << "COLORING_BALANCED produced an invalid coloring";
+}
+
+#define EXECUTE_TEST(ORDINAL, OFFSET, DEVICE)                                                                  \
+  TEST_F(TestCategory, graph##_##graph_color##_default_scalar_##ORDINAL##_##OFFSET##_##DEVICE) {               \
+    test_coloring<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 30, 200, 10);         \
+    test_coloring<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 30, 100, 10);         \
+    test_coloring_hubs<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(20000, 3);                      \
+    test_coloring_balance<KokkosKernels::default_scalar, ORDINAL, OFFSET, DEVICE>(50000, 50000 * 30, 200, 10); \
   }
 
 #if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
@@ -26,60 +26,13 @@
 #include "KokkosSparse_Utils.hpp"
 #include "KokkosKernels_Handle.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "Test_Graph_mis2_verify.hpp"
 
 using namespace KokkosKernels;
 using namespace KokkosKernels::Experimental;
 
 enum CoarseningType { PHASE2, NO_PHASE2 };
 
-namespace Test {
-
-template <typename lno_t, typename size_type, typename rowmap_t, typename entries_t, typename mis_t>
-bool verifyD2MIS(lno_t numVerts, const rowmap_t& rowmap, const entries_t& entries, const mis_t& misArray) {
-  // set a std::set of the mis, for fast membership test
-  std::set<lno_t> mis;
-  for (size_t i = 0; i < misArray.extent(0); i++) mis.insert(misArray(i));
-  for (lno_t i = 0; i < numVerts; i++) {
-    // determine whether another vertex in the set is
-    // within 2 hops of i.
-    bool misIn2Hops = false;
-    for (size_type j = rowmap(i); j < rowmap(i + 1); j++) {
-      lno_t nei1 = entries(j);
-      if (nei1 == i || nei1 >= numVerts) continue;
-      if (mis.find(nei1) != mis.end()) {
-        misIn2Hops = true;
-        break;
-      }
-      for (size_type k = rowmap(nei1); k < rowmap(nei1 + 1); k++) {
-        lno_t nei2 = entries(k);
-        if (nei2 == i || nei2 >= numVerts) continue;
-        if (mis.find(nei2) != mis.end()) {
-          misIn2Hops = true;
-          break;
-        }
-      }
-    }
-    if (mis.find(i) == mis.end()) {
-      // i is not in the set
-      if (!misIn2Hops) {
-        std::cout << "INVALID D2 MIS: vertex " << i << " is not in the set,\n";
-        std::cout << "but there are no vertices in the set within 2 hops.\n";
-        return false;
-      }
-    } else {
-      // i is in the set
-      if (misIn2Hops) {
-        std::cout << "INVALID D2 MIS: vertex " << i << " is in the set,\n";
-        std::cout << "but there is another vertex within 2 hops which is also "
-                     "in the set.\n";
-        return false;
-      }
-    }
-  }
-  return true;
-}
-}  // namespace Test
-
 template <typename scalar_unused, typename lno_t, typename size_type, typename device>
 void test_mis2(lno_t numVerts, size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
   using execution_space = typename device::execution_space;
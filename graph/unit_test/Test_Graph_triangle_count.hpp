@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+#include <Kokkos_Core.hpp>
+
+#include "KokkosGraph_TriangleCount.hpp"
+
+// Random undirected graph with numEdges edges, a clique on the first
+// cliqueSize vertices (so that some rows are hubs after orientation), and a
+// few self-loops, which must be ignored. Rows are shuffled.
+template <typename lno_t, typename size_type, typename device>
+void test_triangle_count(lno_t numVerts, size_type numEdges, lno_t cliqueSize) {
+  using rowmap_t  = Kokkos::View<size_type*, device>;
+  using entries_t = Kokkos::View<lno_t*, device>;
+  std::mt19937 rng(numVerts + cliqueSize);
+  std::uniform_int_distribution<lno_t> vertex(0, numVerts - 1);
+  std::vector<std::set<lno_t>> adj(numVerts);
+  for (size_type e = 0; e < numEdges; e++) {
+    lno_t u = vertex(rng);
+    lno_t v = vertex(rng);
+    if (u == v) continue;
+    adj[u].insert(v);
+    adj[v].insert(u);
+  }
+  for (lno_t u = 0; u < cliqueSize; u++) {
+    for (lno_t v = 0; v < cliqueSize; v++) {
+      if (u != v) adj[u].insert(v);
+    }
+  }
+  // host reference
+  size_t refTotal = 0;
+  std::vector<size_t> refCounts(numVerts, 0);
+  for (lno_t u = 0; u < numVerts; u++) {
+    for (lno_t v : adj[u]) {
+      if (v <= u) continue;
+      for (lno_t w : adj[v]) {
+        if (w <= v || !adj[u].count(w)) continue;
+        refTotal++;
+        refCounts[u]++;
+        refCounts[v]++;
+        refCounts[w]++;
+      }
+    }
+  }
+  for (lno_t u = 0; u < numVerts; u += 7) adj[u].insert(u);
+
+  rowmap_t rowmap("rowmap", numVerts + 1);
+  auto rowmapHost = Kokkos::create_mirror_view(rowmap);
+  for (lno_t u = 0; u < numVerts; u++) rowmapHost(u + 1) = rowmapHost(u) + adj[u].size();
+  entries_t entries("entries", rowmapHost(numVerts));
+  auto entriesHost = Kokkos::create_mirror_view(entries);
+  for (lno_t u = 0; u < numVerts; u++) {
+    lno_t* row = entriesHost.data() + rowmapHost(u);
+    std::copy(adj[u].begin(), adj[u].end(), row);
+    std::shuffle(row, row + adj[u].size(), rng);
+  }
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+
+  EXPECT_EQ(KokkosGraph::Experimental::graph_triangle_count<device>(rowmap, entries), refTotal);
+
+  Kokkos::View<size_t*, device> counts("counts", numVerts);
+  EXPECT_EQ(KokkosGraph::Experimental::graph_triangle_count<device>(rowmap, entries, counts), refTotal);
+  auto countsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  for (lno_t u = 0; u < numVerts; u++) ASSERT_EQ(countsHost(u), refCounts[u]) << "vertex " << u;
+
+  Kokkos::View<double*, device> coefficients("clustering coefficients", numVerts);
+  EXPECT_EQ(KokkosGraph::Experimental::graph_clustering_coefficients<device>(rowmap, entries, coefficients),
+            refTotal);
+  auto coefficientsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coefficients);
+  for (lno_t u = 0; u < numVerts; u++) {
+    const double d = adj[u].size() - adj[u].count(u);
+    EXPECT_NEAR(coefficientsHost(u), d < 2 ? 0.0 : 2.0 * refCounts[u] / (d * (d - 1)), 1e-12) << "vertex " << u;
+  }
+}
+
+template <typename lno_t, typename size_type, typename device>
+void test_triangle_count_empty() {
+  Kokkos::View<size_type*, device> rowmap;
+  Kokkos::View<lno_t*, device> entries;
+  EXPECT_EQ(KokkosGraph::Experimental::graph_triangle_count<device>(rowmap, entries), size_t(0));
+}
+
+#define EXECUTE_TEST(ORDINAL, OFFSET, DEVICE)                                        \
+  TEST_F(TestCategory, graph##_##triangle_count##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    test_triangle_count<ORDINAL, OFFSET, DEVICE>(5000, 50000, 0);                    \
+    test_triangle_count<ORDINAL, OFFSET, DEVICE>(5000, 20000, 400);                  \
+    test_triangle_count<ORDINAL, OFFSET, DEVICE>(10, 30, 4);                         \
+    test_triangle_count_empty<ORDINAL, OFFSET, DEVICE>();                            \
+  }
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(int, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_INT)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(int64_t, int, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(int, size_t, TestDevice)
+#endif
+
+#if (defined(KOKKOSKERNELS_INST_ORDINAL_INT64_T) && defined(KOKKOSKERNELS_INST_OFFSET_SIZE_T)) || \
+    (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+EXECUTE_TEST(int64_t, size_t, TestDevice)
+#endif
+
+#undef EXECUTE_TEST
@@ -108,32 +108,29 @@ struct BDF_system_wrapper {
   }
 };
 
-template <class system_type, class subview_type, class d_vec_type>
+template <class system_type, class subview_type, class predict_vec_type>
 struct BDF_system_wrapper2 {
   const system_type mySys;
   const int neqs;
   const subview_type psi;
-  const d_vec_type d;
+  const predict_vec_type y_predict;
 
   bool compute_jac = true;
   double t, dt, c = 0;
 
   KOKKOS_FUNCTION
-  BDF_system_wrapper2(const system_type& mySys_, const subview_type& psi_, const d_vec_type& d_, const double t_,
-                      const double dt_)
-      : mySys(mySys_), neqs(mySys_.neqs), psi(psi_), d(d_), t(t_), dt(dt_) {}
+  BDF_system_wrapper2(const system_type& mySys_, const subview_type& psi_, const predict_vec_type& y_predict_,
+                      const double t_, const double dt_)
+      : mySys(mySys_), neqs(mySys_.neqs), psi(psi_), y_predict(y_predict_), t(t_), dt(dt_) {}
 
   template <class YVectorType, class FVectorType>
   KOKKOS_FUNCTION void residual(const YVectorType& y, const FVectorType& f) const {
     // f = f(t+dt, y)
     mySys.evaluate_function(t, dt, y, f);
 
-    // std::cout << "f = psi + d - c * f = " << psi(0) << " + " << d(0) << " - "
-    // << c << " * " << f(0) << std::endl;
-
-    // rhs = higher order terms + y_{n+1}^i - y_n - dt*f
+    // rhs = higher order terms + y_{n+1}^i - y_predict - c*f
     for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
-      f(eqIdx) = psi(eqIdx) + d(eqIdx) - c * f(eqIdx);
+      f(eqIdx) = psi(eqIdx) + y(eqIdx) - y_predict(eqIdx) - c * f(eqIdx);
     }
   }
 
@@ -260,12 +257,27 @@ KOKKOS_FUNCTION void initial_step_size(const ode_type ode, const int order, cons
   }
 }  // initial_step_size
 
+// Jacobian bookkeeping carried by the adaptive
+// BDF integrator from one step to the next.
+struct BDF_jacobian_state {
+  // Number of accepted steps since the last evaluation
+  int age = 0;
+  // Value of c used to form the factored iteration matrix
+  double c = 0;
+  // Whether the stored Jacobian and factorization can be reused
+  bool jacobian_current = false;
+  bool matrix_current   = false;
+
+  int num_jacobian_evals = 0, num_factorizations = 0;
+};
+
 template <class ode_type, class vec_type, class res_type, class mat_type, class scalar_type>
 KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, scalar_type t_end, int& order,
                              int& num_equal_steps, const int max_newton_iters, const scalar_type atol,
                              const scalar_type rtol, const scalar_type min_factor, const vec_type& y_old,
                              const vec_type& y_new, const res_type& rhs, const res_type& update, const mat_type& temp,
-                             const mat_type& temp2) {
+                             const mat_type& temp2, const KokkosODE::Experimental::Jacobian_reuse_params& reuse_params,
+                             BDF_jacobian_state& jac_state) {
   using newton_params = KokkosODE::Experimental::Newton_params;
 
   constexpr int max_order = 5;
@@ -290,20 +302,22 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
   offset += 8;
   auto tempD = Kokkos::subview(temp, Kokkos::ALL(), Kokkos::pair<int, int>(offset, offset + 8));
   offset += 8;
-  auto scale = Kokkos::subview(temp, Kokkos::ALL(), offset + 1);
+  auto scale = Kokkos::subview(temp, Kokkos::ALL(), offset);
   ++offset;  // Scaling coefficients for error calculation
-  auto y_predict = Kokkos::subview(temp, Kokkos::ALL(), offset + 1);
+  auto y_predict = Kokkos::subview(temp, Kokkos::ALL(), offset);
   ++offset;  // Initial guess for y_{n+1}
-  auto psi = Kokkos::subview(temp, Kokkos::ALL(), offset + 1);
+  auto psi = Kokkos::subview(temp, Kokkos::ALL(), offset);
   ++offset;  // Higher order terms contribution to rhs
-  auto error = Kokkos::subview(temp, Kokkos::ALL(), offset + 1);
+  auto error = Kokkos::subview(temp, Kokkos::ALL(), offset);
   ++offset;  // Error estimate
-  auto jac =
-      Kokkos::subview(temp, Kokkos::ALL(), Kokkos::pair<int, int>(offset, offset + ode.neqs));  // Jacobian matrix
+  auto jac = Kokkos::subview(temp, Kokkos::ALL(),
+                             Kokkos::pair<int, int>(offset, offset + ode.neqs));  // Factored iteration matrix
   offset += ode.neqs;
-  auto tmp_gesv = Kokkos::subview(
-      temp, Kokkos::ALL(), Kokkos::pair<int, int>(offset, offset + ode.neqs + 4));  // Buffer space for gesv calculation
-  offset += ode.neqs + 4;
+  auto jac_f = Kokkos::subview(temp, Kokkos::ALL(),
+                               Kokkos::pair<int, int>(offset, offset + ode.neqs));  // Jacobian of the ode
+  offset += ode.neqs;
+  auto piv = Kokkos::subview(temp, Kokkos::ALL(), offset);
+  ++offset;  // Pivots of the factorization, kept with jac across steps
 
   auto coeffs = Kokkos::subview(temp2, Kokkos::ALL(), Kokkos::pair<int, int>(0, 6));
   auto gamma  = Kokkos::subview(temp2, Kokkos::ALL(), 6);
@@ -314,8 +328,8 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
   gamma(4)    = 2.08333333;
   gamma(5)    = 2.28333333;
 
-  BDF_system_wrapper2 sys(ode, psi, update, t, dt);
-  const newton_params param(
+  BDF_system_wrapper2 sys(ode, psi, y_predict, t, dt);
+  newton_params param(
       max_newton_iters, atol,
       Kokkos::max(10 * Kokkos::ArithTraits<scalar_type>::eps() / rtol, Kokkos::min(0.03, Kokkos::sqrt(rtol))));
 
@@ -337,6 +351,11 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
     y_new(eqIdx) = y_old(eqIdx);
   }
 
+  // The Jacobian is too old to be reused
+  if (jac_state.age >= reuse_params.max_age) {
+    jac_state.jacobian_current = false;
+  }
+
   double t_new       = 0;
   bool step_accepted = false;
   while (!step_accepted) {
@@ -366,25 +385,69 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
     auto subGamma = Kokkos::subview(gamma, Kokkos::pair<int, int>(1, order + 1));
     KokkosBlas::Experimental::serial_gemv('N', 1.0 / alpha[order], subD, subGamma, 0.0, psi);
 
-    sys.compute_jac = true;
-    sys.c           = dt / alpha[order];
-    sys.jacobian(y_new, jac);
-    sys.compute_jac = true;
-    Kokkos::Experimental::local_deep_copy(y_new, y_predict);
-    Kokkos::Experimental::local_deep_copy(update, 0);
+    sys.c = dt / alpha[order];
     KokkosODE::Experimental::newton_solver_status newton_status =
-        KokkosODE::Experimental::Newton::Solve(sys, param, jac, tmp_gesv, y_new, rhs, update, scale);
+        KokkosODE::Experimental::newton_solver_status::LIN_SOLVE_FAIL;
+    bool jacobian_fresh = false;
+    double rate         = 0;
+    while (true) {
+      if (!jac_state.jacobian_current) {
+        ode.evaluate_jacobian(t_new, dt, y_predict, jac_f);
+        ++jac_state.num_jacobian_evals;
+        jac_state.age              = 0;
+        jac_state.jacobian_current = true;
+        jac_state.matrix_current   = false;
+        jacobian_fresh             = true;
+      }
+
+      // Only refactor I - c*J when c changed significantly,
+      // smaller changes are corrected by scaling the updates
+      if (!jac_state.matrix_current || (Kokkos::abs(sys.c / jac_state.c - 1) > reuse_params.max_c_change)) {
+        for (int rowIdx = 0; rowIdx < sys.neqs; ++rowIdx) {
+          for (int colIdx = 0; colIdx < sys.neqs; ++colIdx) {
+            jac(rowIdx, colIdx) = -sys.c * jac_f(rowIdx, colIdx);
+          }
+          jac(rowIdx, rowIdx) += 1.0;
+        }
+        ++jac_state.num_factorizations;
+        jac_state.c              = sys.c;
+        jac_state.matrix_current = (KokkosODE::Impl::NewtonFactor(jac, piv) == 0);
+      }
+
+      if (jac_state.matrix_current) {
+        Kokkos::Experimental::local_deep_copy(y_new, y_predict);
+        // The Newton updates computed with I - c_old*J are scaled
+        // by 2 / (1 + c/c_old) as in CVODE, which approximates the
+        // updates of I - c*J for the stiff components.
+        const double update_scale = 2.0 / (1.0 + sys.c / jac_state.c);
+        newton_status =
+            KokkosODE::Impl::ModifiedNewtonSolve(sys, param, jac, piv, y_new, rhs, update, scale, rate, update_scale);
+      }
+
+      // An old Jacobian might be the reason why
+      // Newton failed, try again with a new one
+      // before reducing the time step.
+      if ((newton_status == KokkosODE::Experimental::newton_solver_status::NLS_SUCCESS) || jacobian_fresh) {
+        break;
+      }
+      jac_state.jacobian_current = false;
+    }
 
     for (int eqIdx = 0; eqIdx < sys.neqs; ++eqIdx) {
       update(eqIdx) = y_new(eqIdx) - y_predict(eqIdx);
     }
 
-    if (newton_status == KokkosODE::Experimental::newton_solver_status::MAX_ITER) {
+    if (newton_status != KokkosODE::Experimental::newton_solver_status::NLS_SUCCESS) {
       dt = 0.5 * dt;
       update_D(order, 0.5, coeffs, tempD, D);
       num_equal_steps = 0;
 
     } else {
+      // Slow convergence, get a new Jacobian for the next step
+      if (!jacobian_fresh && (rate > reuse_params.max_rate)) {
+        jac_state.jacobian_current = false;
+      }
+
       // Estimate the solution error
       safety     = 0.9 * (2 * max_newton_iters + 1) / (2 * max_newton_iters + param.iters);
       error_norm = 0;
@@ -413,6 +476,7 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
   // or the time step before going to
   // the next step.
   ++num_equal_steps;
+  ++jac_state.age;
   t = t_new;
   for (int eqIdx = 0; eqIdx < sys.neqs; ++eqIdx) {
     D(eqIdx, order + 2) = update(eqIdx) - D(eqIdx, order + 1);
@@ -473,6 +537,19 @@ KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, sca
 
 }  // BDFStep
 
+// Without any state carried from one step to the next,
+// the Jacobian is evaluated and factored at every call.
+template <class ode_type, class vec_type, class res_type, class mat_type, class scalar_type>
+KOKKOS_FUNCTION void BDFStep(ode_type& ode, scalar_type& t, scalar_type& dt, scalar_type t_end, int& order,
+                             int& num_equal_steps, const int max_newton_iters, const scalar_type atol,
+                             const scalar_type rtol, const scalar_type min_factor, const vec_type& y_old,
+                             const vec_type& y_new, const res_type& rhs, const res_type& update, const mat_type& temp,
+                             const mat_type& temp2) {
+  BDF_jacobian_state jac_state{};
+  BDFStep(ode, t, dt, t_end, order, num_equal_steps, max_newton_iters, atol, rtol, min_factor, y_old, y_new, rhs,
+          update, temp, temp2, KokkosODE::Experimental::Jacobian_reuse_params(), jac_state);
+}
+
 }  // namespace Impl
 }  // namespace KokkosODE
 
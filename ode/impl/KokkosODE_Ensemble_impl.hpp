@@ -0,0 +1,212 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ENSEMBLE_IMPL_HPP
+#define KOKKOSODE_ENSEMBLE_IMPL_HPP
+
+#include <sstream>
+#include <utility>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_RungeKutta_impl.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Sets the initial time, time step and active list of every
+// system in the ensemble.
+template <class ensemble_type, class table_type, class params_type, class time_view, class vec_type, class mv_type,
+          class mv3_type, class index_view, class status_view, class count_view>
+struct RKEnsembleInit {
+  ensemble_type ensemble;
+  table_type table;
+  params_type params;
+  time_view t_start, t_end;
+  vec_type t_now, dt;
+  mv_type y, y_new, temp;
+  mv3_type k_vecs;
+  index_view active;
+  status_view status;
+  count_view count;
+
+  KOKKOS_FUNCTION
+  void operator()(const int sysIdx) const {
+    const auto ode = ensemble.system(sysIdx);
+    auto y0        = Kokkos::subview(y, sysIdx, Kokkos::ALL());
+    auto y1        = Kokkos::subview(y_new, sysIdx, Kokkos::ALL());
+    auto tmp       = Kokkos::subview(temp, sysIdx, Kokkos::ALL());
+    auto k         = Kokkos::subview(k_vecs, sysIdx, Kokkos::ALL(), Kokkos::ALL());
+
+    t_now(sysIdx)  = t_start(sysIdx);
+    dt(sysIdx)     = RKInitialStep(ode, table, params, t_start(sysIdx), t_end(sysIdx), y0, y1, tmp, k);
+    active(sysIdx) = sysIdx;
+    status(sysIdx) = Experimental::ode_solver_status::MAX_STEP;
+    count(sysIdx)  = 0;
+  }
+};
+
+// Advances each active system by at most steps_per_pass steps.
+// The systems are indexed through the active list so that retired
+// systems do not occupy any thread once the list is compacted.
+template <class ensemble_type, class table_type, class params_type, class time_view, class vec_type, class mv_type,
+          class mv3_type, class index_view, class status_view, class count_view>
+struct RKEnsemblePass {
+  ensemble_type ensemble;
+  table_type table;
+  params_type params;
+  int steps_per_pass;
+  time_view t_end;
+  vec_type t_now, dt;
+  mv_type y, y_new, temp;
+  mv3_type k_vecs;
+  index_view active;
+  status_view status;
+  count_view count;
+
+  KOKKOS_FUNCTION
+  void operator()(const int idx) const {
+    const int sysIdx = active(idx);
+    const auto ode   = ensemble.system(sysIdx);
+    auto y0          = Kokkos::subview(y, sysIdx, Kokkos::ALL());
+    auto y1          = Kokkos::subview(y_new, sysIdx, Kokkos::ALL());
+    auto tmp         = Kokkos::subview(temp, sysIdx, Kokkos::ALL());
+    auto k           = Kokkos::subview(k_vecs, sysIdx, Kokkos::ALL(), Kokkos::ALL());
+
+    params_type pass_params(params);
+    pass_params.max_steps = Kokkos::min(steps_per_pass, params.max_steps - count(sysIdx));
+
+    auto t = t_now(sysIdx), h = dt(sysIdx);
+    int steps      = 0;
+    status(sysIdx) = RKIntegrate(ode, table, pass_params, t, h, t_end(sysIdx), y0, y1, tmp, k, &steps);
+    t_now(sysIdx)  = t;
+    dt(sysIdx)     = h;
+    count(sysIdx) += steps;
+  }
+};
+
+// Copies the systems that still have steps to take from active
+// to next and returns their number.
+template <class index_view, class status_view, class count_view>
+struct RKEnsembleCompact {
+  int max_steps;
+  index_view active, next;
+  status_view status;
+  count_view count;
+
+  KOKKOS_FUNCTION
+  void operator()(const int idx, int& offset, const bool final) const {
+    const int sysIdx = active(idx);
+    if ((status(sysIdx) == Experimental::ode_solver_status::MAX_STEP) && (count(sysIdx) < max_steps)) {
+      if (final) next(offset) = sysIdx;
+      ++offset;
+    }
+  }
+};
+
+template <class execution_space, class ensemble_type, class table_type, class time_view, class mv_type,
+          class status_view, class count_view>
+void RKEnsembleSolve(const execution_space& space, const ensemble_type& ensemble, const table_type& table,
+                     const KokkosODE::Experimental::ODE_params& params, const time_view& t_start,
+                     const time_view& t_end, const mv_type& y, const status_view& status, const count_view& count,
+                     const int steps_per_pass) {
+  using scalar_type  = typename mv_type::non_const_value_type;
+  using memory_space = typename mv_type::memory_space;
+  using layout_type  = typename mv_type::array_layout;
+  using params_type  = KokkosODE::Experimental::ODE_params;
+
+  using vec_internal    = Kokkos::View<scalar_type*, memory_space>;
+  using mv_internal     = Kokkos::View<scalar_type**, layout_type, memory_space>;
+  using mv3_internal    = Kokkos::View<scalar_type***, layout_type, memory_space>;
+  using index_internal  = Kokkos::View<int*, memory_space>;
+  using time_internal   = Kokkos::View<const scalar_type*, typename time_view::array_layout, memory_space>;
+  using status_internal = Kokkos::View<typename status_view::non_const_data_type, typename status_view::array_layout,
+                                       typename status_view::memory_space>;
+  using count_internal  = Kokkos::View<typename count_view::non_const_data_type, typename count_view::array_layout,
+                                      typename count_view::memory_space>;
+
+  const int num_systems = y.extent_int(0);
+  const int neqs        = y.extent_int(1);
+  if (num_systems == 0) return;
+
+  if ((t_start.extent_int(0) != num_systems) || (t_end.extent_int(0) != num_systems) ||
+      (status.extent_int(0) != num_systems) || (count.extent_int(0) != num_systems)) {
+    std::ostringstream os;
+    os << "KokkosODE::Experimental::RungeKuttaEnsemble::Solve: t_start, t_end, status and count must have one "
+       << "entry per system, y has " << num_systems << " systems but t_start has " << t_start.extent(0)
+       << ", t_end has " << t_end.extent(0) << ", status has " << status.extent(0) << " and count has "
+       << count.extent(0) << " entries.";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (steps_per_pass < 1) {
+    std::ostringstream os;
+    os << "KokkosODE::Experimental::RungeKuttaEnsemble::Solve: steps_per_pass must be positive, got "
+       << steps_per_pass << ".";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // Scratch storage is allocated with the layout of y so that
+  // the same equation of consecutive systems is contiguous when
+  // y is LayoutLeft, i.e. the systems are interleaved.
+  const mv_internal y_internal           = y;
+  const time_internal t_start_internal   = t_start;
+  const time_internal t_end_internal     = t_end;
+  const status_internal status_internal_ = status;
+  const count_internal count_internal_   = count;
+  vec_internal t_now(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "ensemble t"), num_systems);
+  vec_internal dt(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "ensemble dt"), num_systems);
+  mv_internal y_new(Kokkos::view_alloc(space, "ensemble y_new"), num_systems, neqs);
+  mv_internal temp(Kokkos::view_alloc(space, "ensemble temp"), num_systems, neqs);
+  mv3_internal k_vecs(Kokkos::view_alloc(space, "ensemble k_vecs"), num_systems, table_type::nstages, neqs);
+  index_internal active(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "ensemble active"), num_systems);
+  index_internal next(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "ensemble next"), num_systems);
+
+  RKEnsembleInit<ensemble_type, table_type, params_type, time_internal, vec_internal, mv_internal, mv3_internal,
+                 index_internal, status_internal, count_internal>
+      init{ensemble, table, params, t_start_internal, t_end_internal, t_now, dt, y_internal, y_new, temp, k_vecs,
+           active, status_internal_, count_internal_};
+  Kokkos::parallel_for("KokkosODE::RKEnsemble::init", Kokkos::RangePolicy<execution_space>(space, 0, num_systems),
+                       init);
+
+  // Each pass integrates the active systems for a bounded number of
+  // steps, then retires the systems that reached t_end or failed.
+  // Relaunching on the compacted list keeps the remaining work dense
+  // so that threads are not left idle by systems that finished early.
+  int num_active = num_systems;
+  while (num_active > 0) {
+    RKEnsemblePass<ensemble_type, table_type, params_type, time_internal, vec_internal, mv_internal, mv3_internal,
+                   index_internal, status_internal, count_internal>
+        pass{ensemble, table, params, steps_per_pass, t_end_internal, t_now, dt, y_internal, y_new, temp, k_vecs,
+             active, status_internal_, count_internal_};
+    Kokkos::parallel_for("KokkosODE::RKEnsemble::pass",
+                         Kokkos::RangePolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>(space, 0, num_active),
+                         pass);
+
+    RKEnsembleCompact<index_internal, status_internal, count_internal> compact{params.max_steps, active, next,
+                                                                               status_internal_, count_internal_};
+    int num_next = 0;
+    Kokkos::parallel_scan("KokkosODE::RKEnsemble::compact", Kokkos::RangePolicy<execution_space>(space, 0, num_active),
+                          compact, num_next);
+    num_active = num_next;
+    std::swap(active, next);
+  }
+}  // RKEnsembleSolve
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_ENSEMBLE_IMPL_HPP
@@ -105,6 +105,136 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
   return newton_solver_status::MAX_ITER;
 }
 
+// LU factorization with partial pivoting, computed in place.
+// The pivots are stored in a view of scalars so that the
+// factorization can live in the scalar scratch space of the
+// BDF integrator and be reused across time steps.
+template <class mat_type, class piv_type>
+KOKKOS_FUNCTION int NewtonFactor(const mat_type& A, const piv_type& piv) {
+  using value_type = typename mat_type::non_const_value_type;
+  using KAT        = Kokkos::ArithTraits<value_type>;
+
+  const int n = A.extent_int(0);
+  for (int colIdx = 0; colIdx < n; ++colIdx) {
+    int pivIdx = colIdx;
+    for (int rowIdx = colIdx + 1; rowIdx < n; ++rowIdx) {
+      if (KAT::abs(A(rowIdx, colIdx)) > KAT::abs(A(pivIdx, colIdx))) {
+        pivIdx = rowIdx;
+      }
+    }
+    piv(colIdx) = pivIdx;
+    if (A(pivIdx, colIdx) == KAT::zero()) {
+      return 1;
+    }
+
+    if (pivIdx != colIdx) {
+      for (int idx = 0; idx < n; ++idx) {
+        const value_type tmp = A(colIdx, idx);
+        A(colIdx, idx)       = A(pivIdx, idx);
+        A(pivIdx, idx)       = tmp;
+      }
+    }
+
+    const value_type inv_diag = KAT::one() / A(colIdx, colIdx);
+    for (int rowIdx = colIdx + 1; rowIdx < n; ++rowIdx) {
+      A(rowIdx, colIdx) *= inv_diag;
+      for (int idx = colIdx + 1; idx < n; ++idx) {
+        A(rowIdx, idx) -= A(rowIdx, colIdx) * A(colIdx, idx);
+      }
+    }
+  }
+  return 0;
+}
+
+// Solve LU*x = P*b in place using the output of NewtonFactor
+template <class mat_type, class piv_type, class vec_type>
+KOKKOS_FUNCTION void NewtonFactoredSolve(const mat_type& LU, const piv_type& piv, const vec_type& x) {
+  using value_type = typename vec_type::non_const_value_type;
+
+  const int n = LU.extent_int(0);
+  for (int rowIdx = 0; rowIdx < n; ++rowIdx) {
+    const int pivIdx = static_cast<int>(piv(rowIdx));
+    if (pivIdx != rowIdx) {
+      const value_type tmp = x(rowIdx);
+      x(rowIdx)            = x(pivIdx);
+      x(pivIdx)            = tmp;
+    }
+  }
+
+  for (int rowIdx = 1; rowIdx < n; ++rowIdx) {
+    for (int colIdx = 0; colIdx < rowIdx; ++colIdx) {
+      x(rowIdx) -= LU(rowIdx, colIdx) * x(colIdx);
+    }
+  }
+
+  for (int rowIdx = n - 1; 0 <= rowIdx; --rowIdx) {
+    for (int colIdx = rowIdx + 1; colIdx < n; ++colIdx) {
+      x(rowIdx) -= LU(rowIdx, colIdx) * x(colIdx);
+    }
+    x(rowIdx) /= LU(rowIdx, rowIdx);
+  }
+}
+
+// Modified Newton iteration: the iteration matrix is
+// factored once by the caller with NewtonFactor and
+// reused for all the iterations. The last estimate of
+// the convergence rate is returned in rate so that the
+// caller can decide when the factorization is too old.
+// Each update is multiplied by update_scale, which lets
+// the caller correct for a factorization formed with an
+// older step size.
+template <class system_type, class mat_type, class piv_type, class vec_type, class rhs_vec_type, class update_type,
+          class scale_type>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status ModifiedNewtonSolve(
+    system_type& sys, KokkosODE::Experimental::Newton_params& params, const mat_type& LU, const piv_type& piv,
+    const vec_type& y0, const rhs_vec_type& rhs, const update_type& update, const scale_type& scale, double& rate,
+    const double update_scale = 1.0) {
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using norm_type =
+      typename Kokkos::Details::InnerProductSpaceTraits<typename vec_type::non_const_value_type>::mag_type;
+
+  const norm_type tol = Kokkos::max(10 * Kokkos::ArithTraits<norm_type>::eps() / params.rel_tol,
+                                    Kokkos::min(0.03, Kokkos::sqrt(params.rel_tol)));
+  norm_type norm_old  = Kokkos::ArithTraits<norm_type>::zero();
+  norm_type norm_new  = Kokkos::ArithTraits<norm_type>::zero();
+
+  rate         = 0;
+  params.iters = 0;
+  for (int it = 0; it < params.max_iters; ++it) {
+    sys.residual(y0, rhs);
+
+    // update = -update_scale*LU^{-1}*rhs
+    for (int eqIdx = 0; eqIdx < sys.neqs; ++eqIdx) {
+      update(eqIdx) = -update_scale * rhs(eqIdx);
+    }
+    NewtonFactoredSolve(LU, piv, update);
+    ++params.iters;
+
+    // Compute rms norm of the scaled update
+    norm_new = Kokkos::ArithTraits<norm_type>::zero();
+    for (int eqIdx = 0; eqIdx < sys.neqs; ++eqIdx) {
+      norm_new += (update(eqIdx) * update(eqIdx)) / (scale(eqIdx) * scale(eqIdx));
+    }
+    norm_new = Kokkos::sqrt(norm_new / sys.neqs);
+
+    if (norm_old > Kokkos::ArithTraits<norm_type>::zero()) {
+      rate = norm_new / norm_old;
+      if ((rate >= 1) || Kokkos::pow(rate, params.max_iters - it) / (1 - rate) * norm_new > tol) {
+        return newton_solver_status::NLS_DIVERGENCE;
+      }
+    }
+
+    KokkosBlas::serial_axpy(Kokkos::ArithTraits<norm_type>::one(), update, y0);
+
+    if ((norm_new == 0) || ((norm_old > 0) && (rate / (1 - rate)) * norm_new < tol)) {
+      return newton_solver_status::NLS_SUCCESS;
+    }
+
+    norm_old = norm_new;
+  }
+  return newton_solver_status::MAX_ITER;
+}
+
 }  // namespace Impl
 }  // namespace KokkosODE
 
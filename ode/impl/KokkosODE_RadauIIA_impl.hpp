@@ -0,0 +1,310 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_RADAUIIA_IMPL_HPP
+#define KOKKOSODE_RADAUIIA_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include <Kokkos_Array.hpp>
+
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_Newton_impl.hpp"
+#include "KokkosODE_BDF_impl.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Three stages, order 5 Radau IIA method, see
+// E. Hairer, G. Wanner, "Solving Ordinary Differential
+// Equations II: Stiff and Differential-Algebraic Problems",
+// Sec. IV.5 and IV.8. The a coefficients are ordered by rows,
+// e holds the coefficients used for the error estimate and
+// u1 is the real eigenvalue of the inverse of the a matrix.
+struct RadauIIATableau {
+  static constexpr int order   = 5;
+  static constexpr int nstages = 3;
+
+  Kokkos::Array<double, nstages * nstages> a{{0.19681547722366044, -0.06553542585019838, 0.02377097434822015,
+                                              0.3944243147390873, 0.29207341166522843, -0.04154875212599792,
+                                              0.37640306270046725, 0.5124858261884216, 1.0 / 9.0}};
+  Kokkos::Array<double, nstages> c{{0.15505102572168222, 0.6449489742783178, 1.0}};
+  Kokkos::Array<double, nstages> e{{-10.048809399827414, 1.382142733160748, -1.0 / 3.0}};
+  double u1 = 3.6378342527444962;
+};
+
+// Layout of the temp storage used by the Radau IIA solver,
+// temp must be at least (3*neqs) x (5*neqs + 9):
+//   - columns [0, 3*neqs): factored iteration matrix I - dt*(A x J)
+//   - column 3*neqs: pivots of the factorization
+//   - column 3*neqs + 1: stage increments Z
+//   - column 3*neqs + 2: stage function evaluations
+//   - column 3*neqs + 3: Newton update
+// and using the first neqs rows only:
+//   - columns [3*neqs + 4, 4*neqs + 4): Jacobian
+//   - columns [4*neqs + 4, 5*neqs + 4): factored error matrix u1/dt*I - J
+//   - column 5*neqs + 4: pivots of the error matrix
+//   - column 5*neqs + 5: function evaluation at the start of the step
+//   - column 5*neqs + 6: error estimate
+//   - column 5*neqs + 7: scaling of the Newton update
+//   - column 5*neqs + 8: stage solution
+KOKKOS_FUNCTION constexpr int RadauIIATempRows(const int neqs) { return 3 * neqs; }
+
+KOKKOS_FUNCTION constexpr int RadauIIATempCols(const int neqs) { return 5 * neqs + 9; }
+
+enum RadauIIA_step_status : int { STEP_SUCCESS = 0, SINGULAR_MATRIX = 1, NEWTON_FAIL = 2 };
+
+// Takes a single step of size dt from y_old to y_new.
+// The stage equations are solved with a simplified Newton
+// method: the Jacobian is evaluated and the 3*neqs x 3*neqs
+// iteration matrix is factored once per step. When adaptivity
+// is requested the scaled rms norm of the error estimate of
+// Hairer and Wanner is returned in err.
+template <class ode_type, class table_type, class vec_type, class mat_type, class scalar_type>
+KOKKOS_FUNCTION RadauIIA_step_status RadauIIAStep(const ode_type& ode, const table_type& table,
+                                                  const KokkosODE::Experimental::ODE_params& params,
+                                                  const scalar_type t, const scalar_type dt, const vec_type& y_old,
+                                                  const vec_type& y_new, const mat_type& temp, scalar_type& err) {
+  using KAT                 = Kokkos::ArithTraits<scalar_type>;
+  constexpr int nstages     = table_type::nstages;
+  constexpr int max_iters   = 7;
+  const int neqs            = ode.neqs;
+  const int nvars           = nstages * neqs;
+  const scalar_type nls_tol = Kokkos::max(10 * KAT::epsilon() / params.rel_tol,
+                                          Kokkos::min(0.03, Kokkos::sqrt(params.rel_tol)));
+
+  auto M       = Kokkos::subview(temp, Kokkos::make_pair(0, nvars), Kokkos::make_pair(0, nvars));
+  auto piv     = Kokkos::subview(temp, Kokkos::make_pair(0, nvars), nvars);
+  auto Z       = Kokkos::subview(temp, Kokkos::make_pair(0, nvars), nvars + 1);
+  auto F       = Kokkos::subview(temp, Kokkos::make_pair(0, nvars), nvars + 2);
+  auto dZ      = Kokkos::subview(temp, Kokkos::make_pair(0, nvars), nvars + 3);
+  auto jac     = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), Kokkos::make_pair(nvars + 4, nvars + neqs + 4));
+  auto E       = Kokkos::subview(temp, Kokkos::make_pair(0, neqs),
+                                 Kokkos::make_pair(nvars + neqs + 4, nvars + 2 * neqs + 4));
+  auto piv_E   = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), nvars + 2 * neqs + 4);
+  auto f0      = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), nvars + 2 * neqs + 5);
+  auto error   = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), nvars + 2 * neqs + 6);
+  auto scale   = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), nvars + 2 * neqs + 7);
+  auto y_stage = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), nvars + 2 * neqs + 8);
+
+  // Form and factor the iteration matrix I - dt*(A x J)
+  ode.evaluate_jacobian(t, dt, y_old, jac);
+  for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+    for (int stageJdx = 0; stageJdx < nstages; ++stageJdx) {
+      const scalar_type coeff = dt * table.a[stageIdx * nstages + stageJdx];
+      for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+        for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+          M(stageIdx * neqs + rowIdx, stageJdx * neqs + colIdx) = -coeff * jac(rowIdx, colIdx);
+        }
+      }
+    }
+  }
+  for (int varIdx = 0; varIdx < nvars; ++varIdx) {
+    M(varIdx, varIdx) += KAT::one();
+  }
+  if (NewtonFactor(M, piv) != 0) {
+    return RadauIIA_step_status::SINGULAR_MATRIX;
+  }
+
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    scale(eqIdx) = params.abs_tol + params.rel_tol * Kokkos::abs(y_old(eqIdx));
+  }
+  for (int varIdx = 0; varIdx < nvars; ++varIdx) {
+    Z(varIdx) = KAT::zero();
+  }
+
+  // Simplified Newton iterations on the stage increments Z_i = Y_i - y_old
+  // solving Z - dt*(A x I)*F(Z) = 0, convergence is tested on the
+  // estimated distance to the solution theta / (1 - theta)*|dZ|.
+  bool converged       = false;
+  scalar_type norm_old = KAT::zero();
+  for (int iter = 0; iter < max_iters; ++iter) {
+    for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+      auto F_stage = Kokkos::subview(F, Kokkos::make_pair(stageIdx * neqs, (stageIdx + 1) * neqs));
+      for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+        y_stage(eqIdx) = y_old(eqIdx) + Z(stageIdx * neqs + eqIdx);
+      }
+      ode.evaluate_function(t + table.c[stageIdx] * dt, dt, y_stage, F_stage);
+    }
+
+    for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+      for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+        dZ(stageIdx * neqs + eqIdx) = -Z(stageIdx * neqs + eqIdx);
+        for (int stageJdx = 0; stageJdx < nstages; ++stageJdx) {
+          dZ(stageIdx * neqs + eqIdx) += dt * table.a[stageIdx * nstages + stageJdx] * F(stageJdx * neqs + eqIdx);
+        }
+      }
+    }
+    NewtonFactoredSolve(M, piv, dZ);
+
+    scalar_type norm = KAT::zero();
+    for (int varIdx = 0; varIdx < nvars; ++varIdx) {
+      Z(varIdx) += dZ(varIdx);
+      norm += (dZ(varIdx) * dZ(varIdx)) / (scale(varIdx % neqs) * scale(varIdx % neqs));
+    }
+    norm = Kokkos::sqrt(norm / nvars);
+
+    if (iter == 0) {
+      converged = (norm <= 1e-2 * nls_tol);
+    } else {
+      const scalar_type theta = norm / norm_old;
+      if (theta >= 0.99) {
+        return RadauIIA_step_status::NEWTON_FAIL;
+      }
+      converged = (theta / (1 - theta) * norm <= nls_tol);
+    }
+    if (converged) break;
+    norm_old = norm;
+  }
+  if (!converged) {
+    return RadauIIA_step_status::NEWTON_FAIL;
+  }
+
+  // The method is stiffly accurate, the solution is the last stage
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    y_new(eqIdx) = y_old(eqIdx) + Z((nstages - 1) * neqs + eqIdx);
+  }
+
+  err = KAT::zero();
+  if (!params.adaptivity) {
+    return RadauIIA_step_status::STEP_SUCCESS;
+  }
+
+  // Error estimate: (u1/dt*I - J)^{-1} (f(t, y_old) + sum_i e_i*Z_i / dt)
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      E(rowIdx, colIdx) = -jac(rowIdx, colIdx);
+    }
+    E(rowIdx, rowIdx) += table.u1 / dt;
+  }
+  if (NewtonFactor(E, piv_E) != 0) {
+    return RadauIIA_step_status::SINGULAR_MATRIX;
+  }
+
+  ode.evaluate_function(t, dt, y_old, f0);
+  for (int pass = 0; pass < 2; ++pass) {
+    // If the first estimate is too large, it is refined with one
+    // more evaluation of f to filter out the stiff components.
+    if (pass == 1) {
+      if (err < KAT::one()) break;
+      for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+        y_stage(eqIdx) = y_old(eqIdx) + error(eqIdx);
+      }
+      ode.evaluate_function(t, dt, y_stage, f0);
+    }
+
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      error(eqIdx) = f0(eqIdx);
+      for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+        error(eqIdx) += table.e[stageIdx] * Z(stageIdx * neqs + eqIdx) / dt;
+      }
+    }
+    NewtonFactoredSolve(E, piv_E, error);
+
+    err = KAT::zero();
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      const scalar_type tol =
+          params.abs_tol + params.rel_tol * Kokkos::max(Kokkos::abs(y_new(eqIdx)), Kokkos::abs(y_old(eqIdx)));
+      err += (error(eqIdx) * error(eqIdx)) / (tol * tol);
+    }
+    err = Kokkos::sqrt(err / neqs);
+  }
+
+  return RadauIIA_step_status::STEP_SUCCESS;
+}  // RadauIIAStep
+
+// The step size controller mirrors RosenbrockSolve, failures of
+// the Newton iterations or singular iteration matrices lead to
+// a rejected step with dt halved.
+template <class ode_type, class table_type, class vec_type, class mat_type, class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RadauIIASolve(const ode_type& ode, const table_type& table,
+                                                              const KokkosODE::Experimental::ODE_params& params,
+                                                              const scalar_type t_start, const scalar_type t_end,
+                                                              const vec_type& y0, const vec_type& y,
+                                                              const mat_type& temp, int* const step_count) {
+  using KAT        = Kokkos::ArithTraits<scalar_type>;
+  const int neqs   = ode.neqs;
+  const bool adapt = params.adaptivity;
+
+  // Set current time and initial time step
+  scalar_type t_now = t_start, dt = KAT::zero();
+  if (adapt) {
+    auto f0 = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), 5 * neqs + 5);
+    ode.evaluate_function(t_start, dt, y0, f0);
+    initial_step_size(ode, table_type::order, t_start, params.abs_tol, params.rel_tol, y0, f0, temp, dt);
+    if (dt < params.min_step_size) {
+      dt = params.min_step_size;
+    }
+  } else {
+    dt = (t_end - t_start) / params.num_steps;
+  }
+
+  *step_count = 0;
+  for (int stepIdx = 0; stepIdx < params.max_steps; ++stepIdx) {
+    // Do not step past t_end, round-off in t_now
+    // should not trigger an extra step of size ~0.
+    bool last_step = false;
+    if (t_end - t_now <= (1 + 100 * KAT::epsilon()) * dt) {
+      dt        = t_end - t_now;
+      last_step = true;
+    }
+
+    scalar_type err     = KAT::zero();
+    bool dt_was_reduced = false;
+    while (true) {
+      if (RadauIIAStep(ode, table, params, t_now, dt, y0, y, temp, err) != RadauIIA_step_status::STEP_SUCCESS) {
+        if (!adapt) return Experimental::ode_solver_status::NLS_FAIL;
+        dt             = dt / 2;
+        last_step      = false;
+        dt_was_reduced = true;
+        if (dt < params.min_step_size) return Experimental::ode_solver_status::MIN_SIZE;
+        continue;
+      }
+
+      if (err <= KAT::one()) break;
+
+      dt             = dt * Kokkos::max(0.2, 0.9 * Kokkos::pow(err, -0.25));
+      last_step      = false;
+      dt_was_reduced = true;
+      if (dt < params.min_step_size) return Experimental::ode_solver_status::MIN_SIZE;
+    }
+
+    // Update time and initial condition for next time step
+    t_now = last_step ? t_end : t_now + dt;
+    *step_count += 1;
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      y0(eqIdx) = y(eqIdx);
+    }
+    if (last_step) return Experimental::ode_solver_status::SUCCESS;
+
+    if (adapt) {
+      scalar_type factor = 6.0;
+      if (err > KAT::zero()) {
+        factor = Kokkos::min(6.0, Kokkos::max(0.2, 0.9 * Kokkos::pow(err, -0.25)));
+      }
+      if (dt_was_reduced) {
+        factor = Kokkos::min(KAT::one(), factor);
+      }
+      dt = dt * factor;
+    }
+  }
+
+  return Experimental::ode_solver_status::MAX_STEP;
+}  // RadauIIASolve
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_RADAUIIA_IMPL_HPP
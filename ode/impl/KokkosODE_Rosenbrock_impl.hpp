@@ -0,0 +1,278 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ROSENBROCK_IMPL_HPP
+#define KOKKOSODE_ROSENBROCK_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include <Kokkos_Array.hpp>
+
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_Newton_impl.hpp"
+#include "KokkosODE_BDF_impl.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+//=====================================================================
+// Linearly implicit Rosenbrock solvers with embedded error estimation
+//=====================================================================
+
+// Methods supported:
+// ROS3P  (Lang & Verwer)
+// RODAS3 (Sandu et al.)
+//
+// The coefficients are stored in the transformed form of
+// E. Hairer, G. Wanner, "Solving Ordinary Differential
+// Equations II: Stiff and Differential-Algebraic Problems",
+// Sec. IV.7, which avoids any matrix-vector product with J:
+//
+// (I / (gamma*dt) - J) k_i = f(t + alpha_i*dt, y + sum_j a_ij*k_j)
+//                            + sum_j c_ij / dt * k_j + gammas_i*dt*df/dt
+// y_new = y + sum_i m_i*k_i
+// error = sum_i e_i*k_i
+//
+// with j in [0, i-1]. The arrays of aij and cij coefficients
+// are ordered by rows as: a = {a10,a20,a21,a30,a31,a32,...}.
+// new_f is false when the stage uses the same function
+// evaluation as the previous stage.
+
+template <int order, int nstages>
+struct RosenbrockTableau {};
+
+// J. Lang, J. Verwer, "ROS3P - An accurate third-order
+// Rosenbrock solver designed for parabolic problems",
+// BIT 41, pp. 731-738 (2001)
+template <>
+struct RosenbrockTableau<3, 3> {
+  static constexpr int order   = 3;
+  static constexpr int nstages = 3;
+
+  double gamma = 7.886751345948129e-01;
+  Kokkos::Array<double, (nstages * (nstages - 1)) / 2> a{{1.267949192431123, 1.267949192431123, 0.0}};
+  Kokkos::Array<double, (nstages * (nstages - 1)) / 2> c{{-1.607695154586736, -3.464101615137755, -1.732050807568877}};
+  Kokkos::Array<double, nstages> alpha{{0.0, 1.0, 1.0}};
+  Kokkos::Array<double, nstages> gammas{{7.886751345948129e-01, -2.113248654051871e-01, -1.077350269189626}};
+  Kokkos::Array<double, nstages> m{{2.0, 5.773502691896258e-01, 4.226497308103742e-01}};
+  Kokkos::Array<double, nstages> e{{-1.132486540518712e-01, -4.226497308103742e-01, 0.0}};
+  Kokkos::Array<bool, nstages> new_f{{true, true, false}};
+};
+
+// A. Sandu, J. G. Verwer, J. G. Blom, E. J. Spee,
+// G. R. Carmichael, F. A. Potra, "Benchmarking stiff ODE
+// solvers for atmospheric chemistry problems II:
+// Rosenbrock solvers", Atmos. Env. 31, pp. 3459-3472 (1997)
+template <>
+struct RosenbrockTableau<3, 4> {
+  static constexpr int order   = 3;
+  static constexpr int nstages = 4;
+
+  double gamma = 0.5;
+  Kokkos::Array<double, (nstages * (nstages - 1)) / 2> a{{0.0, 2.0, 0.0, 2.0, 0.0, 1.0}};
+  Kokkos::Array<double, (nstages * (nstages - 1)) / 2> c{{4.0, 1.0, -1.0, 1.0, -1.0, -8.0 / 3.0}};
+  Kokkos::Array<double, nstages> alpha{{0.0, 0.0, 1.0, 1.0}};
+  Kokkos::Array<double, nstages> gammas{{0.5, 1.5, 0.0, 0.0}};
+  Kokkos::Array<double, nstages> m{{2.0, 0.0, 1.0, 1.0}};
+  Kokkos::Array<double, nstages> e{{0.0, 0.0, 0.0, 1.0}};
+  Kokkos::Array<bool, nstages> new_f{{true, false, true, true}};
+};
+
+// Layout of the temp storage used by the Rosenbrock solvers,
+// temp must be at least neqs x (neqs + nstages + 5):
+//   - columns [0, neqs): Jacobian then factored iteration matrix
+//   - column neqs: pivots of the factorization
+//   - column neqs + 1: stage solution
+//   - column neqs + 2: time derivative of f
+//   - column neqs + 3: error estimate
+//   - column neqs + 4: stage function evaluation
+//   - columns [neqs + 5, neqs + 5 + nstages): stage vectors k_i
+template <class table_type>
+KOKKOS_FUNCTION constexpr int RosenbrockTempCols(const int neqs) {
+  return neqs + table_type::nstages + 5;
+}
+
+// Takes a single step of size dt from y_old to y_new and stores
+// the embedded error estimate in column neqs + 3 of temp.
+// A single Jacobian evaluation and a single factorization are
+// performed per step, the stages only require triangular solves.
+// The time derivative of f is approximated by finite difference.
+// Returns a non-zero value if the iteration matrix is singular.
+template <class ode_type, class table_type, class vec_type, class mat_type, class scalar_type>
+KOKKOS_FUNCTION int RosenbrockStep(const ode_type& ode, const table_type& table, const scalar_type t,
+                                   const scalar_type dt, const vec_type& y_old, const vec_type& y_new,
+                                   const mat_type& temp) {
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+  const int neqs        = ode.neqs;
+  constexpr int nstages = table_type::nstages;
+
+  auto LU      = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), Kokkos::make_pair(0, neqs));
+  auto piv     = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs);
+  auto y_stage = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 1);
+  auto dfdt    = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 2);
+  auto error   = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 3);
+  auto f_stage = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 4);
+
+  // Form and factor the iteration matrix I / (gamma*dt) - J
+  ode.evaluate_jacobian(t, dt, y_old, LU);
+  for (int rowIdx = 0; rowIdx < neqs; ++rowIdx) {
+    for (int colIdx = 0; colIdx < neqs; ++colIdx) {
+      LU(rowIdx, colIdx) = -LU(rowIdx, colIdx);
+    }
+    LU(rowIdx, rowIdx) += KAT::one() / (table.gamma * dt);
+  }
+  if (NewtonFactor(LU, piv) != 0) {
+    return 1;
+  }
+
+  // The first stage is always evaluated at (t, y_old)
+  // and that evaluation is reused for df/dt.
+  const scalar_type delta = Kokkos::sqrt(KAT::epsilon()) * Kokkos::max(1e-5, Kokkos::abs(t));
+  ode.evaluate_function(t, dt, y_old, f_stage);
+  ode.evaluate_function(t + delta, dt, y_old, dfdt);
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    dfdt(eqIdx) = (dfdt(eqIdx) - f_stage(eqIdx)) / delta;
+  }
+
+  for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+    const int offset = (stageIdx * (stageIdx - 1)) / 2;
+    auto k           = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 5 + stageIdx);
+
+    if ((stageIdx > 0) && table.new_f[stageIdx]) {
+      for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+        y_stage(eqIdx) = y_old(eqIdx);
+        for (int idx = 0; idx < stageIdx; ++idx) {
+          y_stage(eqIdx) += table.a[offset + idx] * temp(eqIdx, neqs + 5 + idx);
+        }
+      }
+      ode.evaluate_function(t + table.alpha[stageIdx] * dt, dt, y_stage, f_stage);
+    }
+
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      k(eqIdx) = f_stage(eqIdx) + table.gammas[stageIdx] * dt * dfdt(eqIdx);
+      for (int idx = 0; idx < stageIdx; ++idx) {
+        k(eqIdx) += table.c[offset + idx] / dt * temp(eqIdx, neqs + 5 + idx);
+      }
+    }
+    NewtonFactoredSolve(LU, piv, k);
+  }
+
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    y_new(eqIdx) = y_old(eqIdx);
+    error(eqIdx) = KAT::zero();
+    for (int stageIdx = 0; stageIdx < nstages; ++stageIdx) {
+      y_new(eqIdx) += table.m[stageIdx] * temp(eqIdx, neqs + 5 + stageIdx);
+      error(eqIdx) += table.e[stageIdx] * temp(eqIdx, neqs + 5 + stageIdx);
+    }
+  }
+
+  return 0;
+}  // RosenbrockStep
+
+// The step size controller follows RKIntegrate: the error
+// is measured in the rms norm weighted by abs_tol + rel_tol*|y|,
+// rejected steps shrink dt by at most a factor 5 and accepted
+// steps grow dt by at most a factor 6. A singular iteration
+// matrix is handled like a rejected step with dt halved.
+template <class ode_type, class table_type, class vec_type, class mat_type, class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RosenbrockSolve(const ode_type& ode, const table_type& table,
+                                                                const KokkosODE::Experimental::ODE_params& params,
+                                                                const scalar_type t_start, const scalar_type t_end,
+                                                                const vec_type& y0, const vec_type& y,
+                                                                const mat_type& temp, int* const step_count) {
+  using KAT        = Kokkos::ArithTraits<scalar_type>;
+  const int neqs   = ode.neqs;
+  const bool adapt = params.adaptivity;
+
+  auto error = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 3);
+
+  // Set current time and initial time step
+  scalar_type t_now = t_start, dt = KAT::zero();
+  if (adapt) {
+    auto f0 = Kokkos::subview(temp, Kokkos::make_pair(0, neqs), neqs + 5);
+    ode.evaluate_function(t_start, dt, y0, f0);
+    initial_step_size(ode, table_type::order, t_start, params.abs_tol, params.rel_tol, y0, f0, temp, dt);
+    if (dt < params.min_step_size) {
+      dt = params.min_step_size;
+    }
+  } else {
+    dt = (t_end - t_start) / params.num_steps;
+  }
+
+  *step_count = 0;
+  for (int stepIdx = 0; stepIdx < params.max_steps; ++stepIdx) {
+    // Do not step past t_end, round-off in t_now
+    // should not trigger an extra step of size ~0.
+    bool last_step = false;
+    if (t_end - t_now <= (1 + 100 * KAT::epsilon()) * dt) {
+      dt        = t_end - t_now;
+      last_step = true;
+    }
+
+    scalar_type err     = KAT::zero();
+    bool dt_was_reduced = false;
+    while (true) {
+      if (RosenbrockStep(ode, table, t_now, dt, y0, y, temp) != 0) {
+        if (!adapt) return Experimental::ode_solver_status::NLS_FAIL;
+        dt             = dt / 2;
+        last_step      = false;
+        dt_was_reduced = true;
+        if (dt < params.min_step_size) return Experimental::ode_solver_status::MIN_SIZE;
+        continue;
+      }
+
+      if (!adapt) break;
+
+      err = KAT::zero();
+      for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+        const scalar_type tol =
+            params.abs_tol + params.rel_tol * Kokkos::max(Kokkos::abs(y(eqIdx)), Kokkos::abs(y0(eqIdx)));
+        err += (error(eqIdx) * error(eqIdx)) / (tol * tol);
+      }
+      err = Kokkos::sqrt(err / neqs);
+      if (err <= KAT::one()) break;
+
+      dt             = dt * Kokkos::max(0.2, 0.9 * Kokkos::pow(err, -KAT::one() / table_type::order));
+      last_step      = false;
+      dt_was_reduced = true;
+      if (dt < params.min_step_size) return Experimental::ode_solver_status::MIN_SIZE;
+    }
+
+    // Update time and initial condition for next time step
+    t_now = last_step ? t_end : t_now + dt;
+    *step_count += 1;
+    for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+      y0(eqIdx) = y(eqIdx);
+    }
+    if (last_step) return Experimental::ode_solver_status::SUCCESS;
+
+    if (adapt) {
+      scalar_type factor = 6.0;
+      if (err > KAT::zero()) {
+        factor = Kokkos::min(6.0, Kokkos::max(0.2, 0.9 * Kokkos::pow(err, -KAT::one() / table_type::order)));
+      }
+      if (dt_was_reduced) {
+        factor = Kokkos::min(KAT::one(), factor);
+      }
+      dt = dt * factor;
+    }
+  }
+
+  return Experimental::ode_solver_status::MAX_STEP;
+}  // RosenbrockSolve
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_ROSENBROCK_IMPL_HPP
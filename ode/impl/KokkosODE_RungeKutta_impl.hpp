@@ -139,29 +139,20 @@ KOKKOS_FUNCTION void RKStep(ode_type& ode, const table_type& table, scalar_type
   }
 }  // RKStep
 
-// Note that the control values for
-// time step increase/decrease are
-// heuristically chosen based on
-// L. F. Shampine and M. W. Reichelt
-// "The Matlab ODE suite" SIAM J. Sci.
-// Comput. Vol. 18, No. 1, pp. 1-22
-// Jan. 1997
+// Computes the time step used at the start of an integration,
+// either from first_step_size for adaptive methods or from the
+// number of steps requested in params.
 template <class ode_type, class table_type, class vec_type, class mv_type, class scalar_type>
-KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(const ode_type& ode, const table_type& table,
-                                                        const KokkosODE::Experimental::ODE_params& params,
-                                                        const scalar_type t_start, const scalar_type t_end,
-                                                        const vec_type& y0, const vec_type& y, const vec_type& temp,
-                                                        const mv_type& k_vecs, int* const step_count) {
-  constexpr scalar_type error_threshold = 1;
-  scalar_type error_n;
+KOKKOS_FUNCTION scalar_type RKInitialStep(const ode_type& ode, const table_type& /*table*/,
+                                          const KokkosODE::Experimental::ODE_params& params, const scalar_type t_start,
+                                          const scalar_type t_end, const vec_type& y0, const vec_type& y,
+                                          const vec_type& temp, const mv_type& k_vecs) {
   bool adapt = params.adaptivity;
-  bool dt_was_reduced;
   if constexpr (std::is_same_v<table_type, ButcherTableau<0, 0>>) {
     adapt = false;
   }
 
-  // Set current time and initial time step
-  scalar_type t_now = t_start, dt = 0.0;
+  scalar_type dt = 0.0;
   if (adapt == true) {
     ode.evaluate_function(t_start, 0, y0, temp);
     first_step_size(ode, table_type::order, t_start, params.abs_tol, params.rel_tol, y0, temp, y, k_vecs, dt);
@@ -172,7 +163,36 @@ KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(const ode_type& ode, con
     dt = (t_end - t_start) / params.num_steps;
   }
 
-  *step_count = 0;
+  return dt;
+}  // RKInitialStep
+
+// Note that the control values for
+// time step increase/decrease are
+// heuristically chosen based on
+// L. F. Shampine and M. W. Reichelt
+// "The Matlab ODE suite" SIAM J. Sci.
+// Comput. Vol. 18, No. 1, pp. 1-22
+// Jan. 1997
+//
+// RKIntegrate advances y0 from t_now to t_end taking at most
+// params.max_steps steps. t_now and dt are updated in place so
+// that an integration stopped with MAX_STEP can be resumed by
+// calling RKIntegrate again, step_count is incremented by the
+// number of accepted steps.
+template <class ode_type, class table_type, class vec_type, class mv_type, class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKIntegrate(const ode_type& ode, const table_type& table,
+                                                            const KokkosODE::Experimental::ODE_params& params,
+                                                            scalar_type& t_now, scalar_type& dt,
+                                                            const scalar_type t_end, const vec_type& y0,
+                                                            const vec_type& y, const vec_type& temp,
+                                                            const mv_type& k_vecs, int* const step_count) {
+  constexpr scalar_type error_threshold = 1;
+  scalar_type error_n;
+  bool adapt = params.adaptivity;
+  bool dt_was_reduced;
+  if constexpr (std::is_same_v<table_type, ButcherTableau<0, 0>>) {
+    adapt = false;
+  }
 
   // Loop over time steps to integrate ODE
   for (int stepIdx = 0; (stepIdx < params.max_steps) && (t_now <= t_end); ++stepIdx) {
@@ -246,6 +266,21 @@ KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(const ode_type& ode, con
   if (t_now < t_end) return Experimental::ode_solver_status::MAX_STEP;
 
   return Experimental::ode_solver_status::SUCCESS;
+}  // RKIntegrate
+
+template <class ode_type, class table_type, class vec_type, class mv_type, class scalar_type>
+KOKKOS_FUNCTION Experimental::ode_solver_status RKSolve(const ode_type& ode, const table_type& table,
+                                                        const KokkosODE::Experimental::ODE_params& params,
+                                                        const scalar_type t_start, const scalar_type t_end,
+                                                        const vec_type& y0, const vec_type& y, const vec_type& temp,
+                                                        const mv_type& k_vecs, int* const step_count) {
+  // Set current time and initial time step
+  scalar_type t_now = t_start;
+  scalar_type dt    = RKInitialStep(ode, table, params, t_start, t_end, y0, y, temp, k_vecs);
+
+  *step_count = 0;
+
+  return RKIntegrate(ode, table, params, t_now, dt, t_end, y0, y, temp, k_vecs, step_count);
 }  // RKSolve
 
 }  // namespace Impl
@@ -0,0 +1,238 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSEBDF_IMPL_HPP
+#define KOKKOSODE_SPARSEBDF_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_BDF_impl.hpp"
+#include "KokkosODE_SparseNewton.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+template <int order>
+void copy_BDF_coefficients(Kokkos::Array<double, 7>& coefficients) {
+  const BDF_table<order> table{};
+  for (int coeffIdx = 0; coeffIdx < order + 1; ++coeffIdx) {
+    coefficients[coeffIdx] = table.coefficients[coeffIdx];
+  }
+}
+
+// Runtime access to the BDF tables, used when the
+// order changes during the start-up of the method.
+inline Kokkos::Array<double, 7> BDF_coefficients(const int order) {
+  Kokkos::Array<double, 7> coefficients{};
+  switch (order) {
+    case 1: copy_BDF_coefficients<1>(coefficients); break;
+    case 2: copy_BDF_coefficients<2>(coefficients); break;
+    case 3: copy_BDF_coefficients<3>(coefficients); break;
+    case 4: copy_BDF_coefficients<4>(coefficients); break;
+    case 5: copy_BDF_coefficients<5>(coefficients); break;
+    case 6: copy_BDF_coefficients<6>(coefficients); break;
+    default: KokkosKernels::Impl::throw_runtime_exception("KokkosODE::BDF_coefficients: order must be in [1, 6]");
+  }
+  return coefficients;
+}
+
+// The iteration matrix I - gamma*J is formed in place
+// in the pattern of J, check that all diagonal entries
+// are part of that pattern.
+template <class crs_matrix_type>
+void check_diagonal_pattern(const crs_matrix_type& J) {
+  using execution_space = typename crs_matrix_type::execution_space;
+  using ordinal_type    = typename crs_matrix_type::non_const_ordinal_type;
+  using size_type       = typename crs_matrix_type::non_const_size_type;
+
+  auto row_map = J.graph.row_map;
+  auto entries = J.graph.entries;
+  int missing  = 0;
+  Kokkos::parallel_reduce(
+      "KokkosODE::SparseBDF::check_diagonal", Kokkos::RangePolicy<execution_space>(0, J.numRows()),
+      KOKKOS_LAMBDA(const ordinal_type rowIdx, int& update) {
+        bool found = false;
+        for (size_type entryIdx = row_map(rowIdx); entryIdx < row_map(rowIdx + 1); ++entryIdx) {
+          if (entries(entryIdx) == rowIdx) {
+            found = true;
+          }
+        }
+        if (!found) {
+          ++update;
+        }
+      },
+      missing);
+
+  if (missing > 0) {
+    std::ostringstream os;
+    os << "KokkosODE::SparseBDF: " << missing << " diagonal entries are missing from the Jacobian sparsity pattern";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+/// \brief Nonlinear system solved at each BDF step:
+///   F(y) = y - gamma*f(t, y) + sum_k coeffs[order - 1 - k]*yn(:, k)
+///   dF/dy = I - gamma*df/dy
+/// with gamma = coeffs[order]*dt, yn stores the history oldest first.
+template <class ode_type, class mv_type>
+struct SparseBDF_system_wrapper {
+  using execution_space = typename mv_type::execution_space;
+
+  const ode_type mySys;
+  const int neqs;
+  const mv_type yn;
+  const int order;
+  const Kokkos::Array<double, 7> coefficients;
+
+  double t, dt, gamma;
+
+  SparseBDF_system_wrapper(const ode_type& mySys_, const mv_type& yn_, const int order_,
+                           const Kokkos::Array<double, 7>& coefficients_, const double t_, const double dt_)
+      : mySys(mySys_),
+        neqs(mySys_.neqs),
+        yn(yn_),
+        order(order_),
+        coefficients(coefficients_),
+        t(t_),
+        dt(dt_),
+        gamma(coefficients_[order_] * dt_) {}
+
+  template <class vec_type, class rhs_type>
+  void residual(const vec_type& y, const rhs_type& f) const {
+    // f = f(t+dt, y)
+    mySys.evaluate_function(t, dt, y, f);
+
+    const auto history       = yn;
+    const auto coeffs        = coefficients;
+    const int history_order  = order;
+    const double local_gamma = gamma;
+    Kokkos::parallel_for(
+        "KokkosODE::SparseBDF::residual", Kokkos::RangePolicy<execution_space>(0, neqs),
+        KOKKOS_LAMBDA(const int eqIdx) {
+          f(eqIdx) = y(eqIdx) - local_gamma * f(eqIdx);
+          for (int orderIdx = 0; orderIdx < history_order; ++orderIdx) {
+            f(eqIdx) += coeffs[history_order - 1 - orderIdx] * history(eqIdx, orderIdx);
+          }
+        });
+  }
+
+  template <class vec_type, class crs_matrix_type>
+  void jacobian(const vec_type& y, const crs_matrix_type& jac) const {
+    using ordinal_type = typename crs_matrix_type::non_const_ordinal_type;
+    using size_type    = typename crs_matrix_type::non_const_size_type;
+
+    mySys.evaluate_jacobian(t, dt, y, jac);
+
+    // J = I - gamma*(df/dy)
+    auto row_map             = jac.graph.row_map;
+    auto entries             = jac.graph.entries;
+    auto values              = jac.values;
+    const double local_gamma = gamma;
+    Kokkos::parallel_for(
+        "KokkosODE::SparseBDF::jacobian", Kokkos::RangePolicy<execution_space>(0, neqs),
+        KOKKOS_LAMBDA(const ordinal_type rowIdx) {
+          for (size_type entryIdx = row_map(rowIdx); entryIdx < row_map(rowIdx + 1); ++entryIdx) {
+            values(entryIdx) = -local_gamma * values(entryIdx);
+            if (entries(entryIdx) == rowIdx) {
+              values(entryIdx) += 1.0;
+            }
+          }
+        });
+  }
+};
+
+/// \brief Fixed step BDF integration of a large system with a sparse Jacobian.
+///
+/// The history needed by the method is built by ramping up the order
+/// from BDF1, each step solves its nonlinear system with the modified
+/// Newton method of SparseNewtonSolve so the Jacobian and preconditioner
+/// stored in the handle are reused across iterations and time steps.
+/// The Jacobian is only invalidated when gamma changes, i.e. when the
+/// order increases during the start-up phase.
+template <class table_type, class ode_type, class handle_type, class vec_type, class scalar_type>
+KokkosODE::Experimental::ode_solver_status SparseBDFSolve(const ode_type& ode, handle_type& handle,
+                                                          KokkosODE::Experimental::Newton_params& params,
+                                                          const scalar_type t_start, const scalar_type t_end,
+                                                          const int num_steps, const vec_type& y0, const vec_type& y,
+                                                          const vec_type& scale) {
+  using value_type      = typename vec_type::non_const_value_type;
+  using execution_space = typename vec_type::execution_space;
+  using mv_type         = Kokkos::View<value_type**, Kokkos::LayoutLeft, typename vec_type::device_type>;
+  using newton_status   = KokkosODE::Experimental::newton_solver_status;
+
+  const table_type table{};
+  const int neqs = ode.neqs;
+
+  if ((y0.extent(0) != static_cast<size_t>(neqs)) || (y.extent(0) != y0.extent(0)) ||
+      (scale.extent(0) != y0.extent(0)) || (handle.get_jacobian().numRows() != neqs)) {
+    std::ostringstream os;
+    os << "KokkosODE::SparseBDF: Dimensions do not match: neqs: " << neqs << ", y0: " << y0.extent(0)
+       << ", y: " << y.extent(0) << ", scale: " << scale.extent(0)
+       << ", jacobian: " << handle.get_jacobian().numRows();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  check_diagonal_pattern(handle.get_jacobian());
+
+  vec_type rhs("SparseBDF::rhs", neqs), update("SparseBDF::update", neqs);
+  mv_type y_vecs("SparseBDF::y_vecs", neqs, table.order);
+  Kokkos::deep_copy(Kokkos::subview(y_vecs, Kokkos::ALL(), table.order - 1), y0);
+
+  const double dt = (t_end - t_start) / num_steps;
+  double t        = t_start;
+  int order       = 0;
+
+  for (int stepIdx = 0; stepIdx < num_steps; ++stepIdx) {
+    // gamma changes with the order, the
+    // Jacobian needs to be recomputed.
+    if (order < table.order) {
+      ++order;
+      handle.invalidate_jacobian();
+    }
+
+    auto history = Kokkos::subview(y_vecs, Kokkos::ALL(), Kokkos::pair<int, int>(table.order - order, table.order));
+    SparseBDF_system_wrapper sys(ode, history, order, BDF_coefficients(order), t, dt);
+
+    // Use the last solution as initial guess
+    Kokkos::deep_copy(y, y0);
+    const newton_status status =
+        KokkosODE::Experimental::SparseNewton::Solve(handle, sys, params, y, rhs, update, scale);
+    if (status != newton_status::NLS_SUCCESS) {
+      return KokkosODE::Experimental::ode_solver_status::NLS_FAIL;
+    }
+
+    // Update history
+    const int max_order = table.order;
+    Kokkos::parallel_for(
+        "KokkosODE::SparseBDF::update_history", Kokkos::RangePolicy<execution_space>(0, neqs),
+        KOKKOS_LAMBDA(const int eqIdx) {
+          for (int orderIdx = 0; orderIdx < max_order - 1; ++orderIdx) {
+            y_vecs(eqIdx, orderIdx) = y_vecs(eqIdx, orderIdx + 1);
+          }
+          y_vecs(eqIdx, max_order - 1) = y(eqIdx);
+        });
+    Kokkos::deep_copy(y0, y);
+    t += dt;
+  }
+
+  return KokkosODE::Experimental::ode_solver_status::SUCCESS;
+}
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_SPARSEBDF_IMPL_HPP
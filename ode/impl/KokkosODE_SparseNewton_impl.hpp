@@ -0,0 +1,209 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSENEWTON_IMPL_HPP
+#define KOKKOSODE_SPARSENEWTON_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBlas1_nrm2.hpp"
+#include "KokkosBlas1_nrm2w.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosSparse_Preconditioner.hpp"
+
+#include "KokkosODE_Types.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+/// \brief Point Jacobi preconditioner, used by default by the sparse
+/// Newton solver. compute() extracts the inverse of the diagonal of A,
+/// rows without a (non-zero) diagonal entry are left unscaled.
+template <class crs_matrix_type>
+class JacobiPrec : public KokkosSparse::Experimental::Preconditioner<crs_matrix_type> {
+ public:
+  using scalar_type     = typename crs_matrix_type::non_const_value_type;
+  using ordinal_type    = typename crs_matrix_type::non_const_ordinal_type;
+  using size_type       = typename crs_matrix_type::non_const_size_type;
+  using execution_space = typename crs_matrix_type::execution_space;
+  using memory_space    = typename crs_matrix_type::memory_space;
+  using device_type     = Kokkos::Device<execution_space, memory_space>;
+  using vec_type        = Kokkos::View<scalar_type*, device_type>;
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+
+ private:
+  crs_matrix_type A;
+  vec_type inv_diag;
+  bool is_computed = false;
+
+ public:
+  JacobiPrec(const crs_matrix_type& A_) : A(A_), inv_diag("JacobiPrec::inv_diag", A_.numRows()) {}
+
+  virtual ~JacobiPrec() {}
+
+  /// \brief Y = beta*Y + alpha*D^{-1}*X, D^{-1} being diagonal
+  /// transM is irrelevant.
+  virtual void apply(const Kokkos::View<const scalar_type*, device_type>& X,
+                     const Kokkos::View<scalar_type*, device_type>& Y, const char transM[] = "N",
+                     scalar_type alpha = KAT::one(), scalar_type beta = KAT::zero()) const {
+    (void)transM;
+    auto d = inv_diag;
+    if (beta == KAT::zero()) {
+      Kokkos::parallel_for(
+          "KokkosODE::JacobiPrec::apply", Kokkos::RangePolicy<execution_space>(0, X.extent(0)),
+          KOKKOS_LAMBDA(const ordinal_type rowIdx) { Y(rowIdx) = alpha * d(rowIdx) * X(rowIdx); });
+    } else {
+      Kokkos::parallel_for(
+          "KokkosODE::JacobiPrec::apply", Kokkos::RangePolicy<execution_space>(0, X.extent(0)),
+          KOKKOS_LAMBDA(const ordinal_type rowIdx) { Y(rowIdx) = beta * Y(rowIdx) + alpha * d(rowIdx) * X(rowIdx); });
+    }
+  }
+
+  void setParameters() {}
+
+  void initialize() {}
+
+  bool isInitialized() const { return true; }
+
+  /// \brief Extract the inverse diagonal of A, must be called
+  /// each time the values of A are modified.
+  void compute() {
+    auto row_map = A.graph.row_map;
+    auto entries = A.graph.entries;
+    auto values  = A.values;
+    auto d       = inv_diag;
+    Kokkos::parallel_for(
+        "KokkosODE::JacobiPrec::compute", Kokkos::RangePolicy<execution_space>(0, A.numRows()),
+        KOKKOS_LAMBDA(const ordinal_type rowIdx) {
+          scalar_type diag = KAT::zero();
+          for (size_type entryIdx = row_map(rowIdx); entryIdx < row_map(rowIdx + 1); ++entryIdx) {
+            if (entries(entryIdx) == rowIdx) {
+              diag += values(entryIdx);
+            }
+          }
+          d(rowIdx) = (diag == KAT::zero()) ? KAT::one() : KAT::one() / diag;
+        });
+    is_computed = true;
+  }
+
+  bool isComputed() const { return is_computed; }
+
+  bool hasTransposeApply() const { return true; }
+};
+
+/// \brief Modified Newton solve with a sparse Jacobian.
+///
+/// The Jacobian stored in the handle is only re-evaluated when the handle
+/// reports it as stale, i.e. it is older than the allowed number of Newton
+/// solves or it was invalidated because the previous iterate converged too
+/// slowly. Each linear problem J*update=rhs is solved with preconditioned
+/// GMRES. When a stale Jacobian leads to a failed linear solve or to a
+/// diverging iteration, the diverging update is undone, the Jacobian is
+/// re-evaluated and the iteration goes on; failures with a freshly evaluated
+/// Jacobian are reported to the caller.
+/// This function is host callable only, it launches kernels on the execution
+/// space of the Jacobian.
+template <class handle_type, class system_type, class vec_type>
+KokkosODE::Experimental::newton_solver_status SparseNewtonSolve(handle_type& handle, const system_type& sys,
+                                                                KokkosODE::Experimental::Newton_params& params,
+                                                                const vec_type& y0, const vec_type& rhs,
+                                                                const vec_type& update, const vec_type& scale) {
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using value_type           = typename vec_type::non_const_value_type;
+  using norm_type            = typename Kokkos::Details::InnerProductSpaceTraits<value_type>::mag_type;
+
+  if ((y0.extent(0) != static_cast<size_t>(sys.neqs)) || (rhs.extent(0) != y0.extent(0)) ||
+      (update.extent(0) != y0.extent(0)) || (scale.extent(0) != y0.extent(0))) {
+    std::ostringstream os;
+    os << "KokkosODE::SparseNewton: Dimensions do not match: neqs: " << sys.neqs << ", y0: " << y0.extent(0)
+       << ", rhs: " << rhs.extent(0) << ", update: " << update.extent(0) << ", scale: " << scale.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  handle.start_solve();
+  params.iters = 0;
+
+  sys.residual(y0, rhs);
+  const norm_type norm0 = KokkosBlas::nrm2(rhs);
+  norm_type norm        = Kokkos::ArithTraits<norm_type>::zero();
+  norm_type norm_old    = Kokkos::ArithTraits<norm_type>::zero();
+  norm_type norm_new    = Kokkos::ArithTraits<norm_type>::zero();
+  norm_type rate        = Kokkos::ArithTraits<norm_type>::zero();
+
+  const norm_type tol = Kokkos::max(10 * Kokkos::ArithTraits<norm_type>::eps() / params.rel_tol,
+                                    Kokkos::min(0.03, Kokkos::sqrt(params.rel_tol)));
+
+  for (int it = 0; it < params.max_iters; ++it) {
+    if (it > 0) {
+      sys.residual(y0, rhs);
+    }
+
+    if (!handle.jacobian_is_current()) {
+      handle.evaluate_jacobian(sys, y0);
+    }
+
+    // Solve J*update = rhs, using a zero initial guess
+    Kokkos::deep_copy(update, Kokkos::ArithTraits<value_type>::zero());
+    if (!handle.linear_solve(rhs, update)) {
+      if (handle.jacobian_is_fresh()) {
+        return newton_solver_status::LIN_SOLVE_FAIL;
+      }
+      handle.invalidate_jacobian();
+      continue;
+    }
+
+    // y0 = y0 - update
+    KokkosBlas::axpy(-Kokkos::ArithTraits<value_type>::one(), update, y0);
+    handle.add_newton_iteration();
+    ++params.iters;
+    norm = KokkosBlas::nrm2(rhs);
+
+    // rms norm of the scaled update
+    norm_new = KokkosBlas::nrm2w(update, scale) / Kokkos::sqrt(static_cast<norm_type>(sys.neqs));
+    if (norm_old > Kokkos::ArithTraits<norm_type>::zero()) {
+      rate = norm_new / norm_old;
+      if ((rate >= 1) || Kokkos::pow(rate, params.max_iters - it) / (1 - rate) * norm_new > tol) {
+        if (handle.jacobian_is_fresh()) {
+          return newton_solver_status::NLS_DIVERGENCE;
+        }
+        // The Jacobian is too far from the current
+        // iterate: undo the update, re-evaluate the
+        // Jacobian at the previous iterate and start
+        // the rate estimate over.
+        KokkosBlas::axpy(Kokkos::ArithTraits<value_type>::one(), update, y0);
+        handle.invalidate_jacobian();
+        norm_old = Kokkos::ArithTraits<norm_type>::zero();
+        continue;
+      } else if ((norm_new == 0) || ((rate / (1 - rate)) * norm_new < tol)) {
+        return newton_solver_status::NLS_SUCCESS;
+      } else if (rate > handle.get_reuse_rate() && !handle.jacobian_is_fresh()) {
+        handle.invalidate_jacobian();
+      }
+    }
+
+    if ((norm < (params.rel_tol * norm0)) || (it > 0 ? KokkosBlas::nrm2(update) < params.abs_tol : false)) {
+      return newton_solver_status::NLS_SUCCESS;
+    }
+
+    norm_old = norm_new;
+  }
+  return newton_solver_status::MAX_ITER;
+}
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_SPARSENEWTON_IMPL_HPP
@@ -155,10 +155,15 @@ struct BDF {
 /// \param y_new [out]: vector of solution at t_end
 /// \param temp [in]: vectors for temporary storage
 /// \param temp2 [in]: vectors for temporary storage
+/// \param reuse_params [in]: policy used to reuse the Jacobian and its factorization across steps
+/// \param num_jacobian_evals [out]: if not null, number of Jacobian evaluations
+/// \param num_factorizations [out]: if not null, number of factorizations of the iteration matrix
 template <class ode_type, class mat_type, class vec_type, class scalar_type>
 KOKKOS_FUNCTION void BDFSolve(const ode_type& ode, const scalar_type t_start, const scalar_type t_end,
                               const scalar_type initial_step, const scalar_type max_step, const vec_type& y0,
-                              const vec_type& y_new, mat_type& temp, mat_type& temp2) {
+                              const vec_type& y_new, mat_type& temp, mat_type& temp2,
+                              const Jacobian_reuse_params& reuse_params = Jacobian_reuse_params(),
+                              int* const num_jacobian_evals = nullptr, int* const num_factorizations = nullptr) {
   using KAT = Kokkos::ArithTraits<scalar_type>;
 
   // This needs to go away and be pulled out of temp instead...
@@ -194,15 +199,23 @@ KOKKOS_FUNCTION void BDFSolve(const ode_type& ode, const scalar_type t_start, co
 
   // Now we loop over the time interval [t_start, t_end]
   // and solve our ODE.
+  KokkosODE::Impl::BDF_jacobian_state jac_state{};
   while (t < t_end) {
     KokkosODE::Impl::BDFStep(ode, t, dt, t_end, order, num_equal_steps, max_newton_iters, atol, rtol, min_factor, y0,
-                             y_new, rhs, update, temp, temp2);
+                             y_new, rhs, update, temp, temp2, reuse_params, jac_state);
 
     for (int eqIdx = 0; eqIdx < ode.neqs; ++eqIdx) {
       y0(eqIdx) = y_new(eqIdx);
     }
     // printf("t=%f, dt=%f, y={%f, %f, %f}\n", t, dt, y0(0), y0(1), y0(2));
   }
+
+  if (num_jacobian_evals != nullptr) {
+    *num_jacobian_evals = jac_state.num_jacobian_evals;
+  }
+  if (num_factorizations != nullptr) {
+    *num_factorizations = jac_state.num_factorizations;
+  }
 }  // BDFSolve
 
 }  // namespace Experimental
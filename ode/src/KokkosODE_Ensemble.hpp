@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ENSEMBLE_HPP
+#define KOKKOSODE_ENSEMBLE_HPP
+
+/// \file KokkosODE_Ensemble.hpp
+
+#include "Kokkos_Core.hpp"
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_RungeKutta.hpp"
+
+#include "KokkosODE_Ensemble_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief Integrates many independent ODE systems with a Runge-Kutta method
+///
+/// \tparam RK_type an RK_type enum value used to specify
+///         which Runge Kutta method is to be used.
+template <RK_type T>
+struct RungeKuttaEnsemble {
+  using table_type = typename RK_Tableau_helper<T>::table_type;
+
+  /// \brief Solve integrates every system of an ensemble in parallel
+  ///
+  /// The ensemble object must provide the number of equations per system
+  /// as neqs, and a KOKKOS_FUNCTION member system(const int sysIdx) that
+  /// returns the ode of system sysIdx. That ode has the interface expected
+  /// by RungeKutta<T>::Solve, so per-system parameters (rate constants,
+  /// temperatures, ...) can be captured by the returned object.
+  ///
+  /// The temporary storage used by RungeKutta<T>::Solve is allocated
+  /// internally with the layout of y. With a LayoutLeft y, the values of
+  /// one equation for consecutive systems are contiguous, which gives
+  /// coalesced accesses on GPUs and unit stride across systems on CPUs.
+  ///
+  /// Integration proceeds in passes of at most steps_per_pass time steps
+  /// per system. After each pass, the systems that reached t_end or failed
+  /// are retired, and the next pass is launched on the remaining systems
+  /// only. Systems needing many more steps than the rest are therefore
+  /// spread over all threads instead of idling most of them.
+  ///
+  /// \tparam execution_space the execution space where the systems are integrated
+  /// \tparam ensemble_type the type of the ensemble object
+  /// \tparam time_view a rank-1 view
+  /// \tparam mv_type a rank-2 view
+  /// \tparam status_view a rank-1 view of ode_solver_status or int
+  /// \tparam count_view a rank-1 view of int
+  ///
+  /// \param space [in]: execution space instance used for all kernels
+  /// \param ensemble [in]: the ensemble of odes to integrate
+  /// \param params [in]: standard input parameters of ODE integrators, max_steps
+  /// applies to each system over the whole integration
+  /// \param t_start [in]: time at which the integration of each system starts
+  /// \param t_end [in]: time at which the integration of each system stops
+  /// \param y [in/out]: initial conditions of dimensions num_systems x neqs, set
+  /// to the solutions at t_end
+  /// \param status [out]: final ode_solver_status of each system
+  /// \param count [out]: number of time steps taken by each system
+  /// \param steps_per_pass [in]: maximum number of steps taken by a system
+  /// between two retirements of finished systems
+  template <class execution_space, class ensemble_type, class time_view, class mv_type, class status_view,
+            class count_view>
+  static void Solve(const execution_space& space, const ensemble_type& ensemble, const ODE_params& params,
+                    const time_view& t_start, const time_view& t_end, const mv_type& y, const status_view& status,
+                    const count_view& count, const int steps_per_pass = 64) {
+    static_assert(Kokkos::is_execution_space_v<execution_space>,
+                  "KokkosODE::RungeKuttaEnsemble::Solve: execution_space is not a Kokkos execution space");
+    static_assert(Kokkos::is_view_v<mv_type> && (mv_type::rank == 2),
+                  "KokkosODE::RungeKuttaEnsemble::Solve: y must be a rank-2 Kokkos::View");
+    static_assert(Kokkos::is_view_v<time_view> && (time_view::rank == 1),
+                  "KokkosODE::RungeKuttaEnsemble::Solve: t_start and t_end must be rank-1 Kokkos::View");
+    static_assert(Kokkos::SpaceAccessibility<execution_space, typename mv_type::memory_space>::accessible,
+                  "KokkosODE::RungeKuttaEnsemble::Solve: y must be accessible from execution_space");
+
+    table_type table;
+    KokkosODE::Impl::RKEnsembleSolve(space, ensemble, table, params, t_start, t_end, y, status, count,
+                                     steps_per_pass);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+#endif  // KOKKOSODE_ENSEMBLE_HPP
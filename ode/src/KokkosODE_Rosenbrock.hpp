@@ -0,0 +1,120 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_ROSENBROCK_HPP
+#define KOKKOSODE_ROSENBROCK_HPP
+
+/// \file KokkosODE_Rosenbrock.hpp
+
+#include "Kokkos_Core.hpp"
+#include "KokkosODE_Types.hpp"
+
+#include "KokkosODE_Rosenbrock_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief ROS_type is an enum type that conveniently
+/// describes the Rosenbrock methods implemented.
+/// ROS3P is A-stable but not L-stable and its error estimator
+/// does not control very stiff transients, RODAS3 is L-stable
+/// and should be preferred for such problems.
+enum ROS_type : int {
+  ROS3P  = 0,  ///< Lang-Verwer order 3 method, 3 stages
+  RODAS3 = 1   ///< Sandu et al. stiffly accurate order 3 method, 4 stages
+};
+
+template <ROS_type T>
+struct ROS_Tableau_helper {};
+
+template <>
+struct ROS_Tableau_helper<ROS_type::ROS3P> {
+  using table_type = KokkosODE::Impl::RosenbrockTableau<3, 3>;
+};
+
+template <>
+struct ROS_Tableau_helper<ROS_type::RODAS3> {
+  using table_type = KokkosODE::Impl::RosenbrockTableau<3, 4>;
+};
+
+/// \brief Rosenbrock solvers for stiff ODEs
+///
+/// Rosenbrock methods are linearly implicit: each time step
+/// evaluates the Jacobian once, factors I / (gamma*dt) - J once
+/// and each stage only requires a pair of triangular solves.
+/// Unlike BDF or fully implicit Runge-Kutta methods no Newton
+/// iteration is needed and no history is carried from one step
+/// to the next, making restarts cheap.
+///
+/// \tparam ROS_type a ROS_type enum value used to specify
+///         which Rosenbrock method is to be used.
+template <ROS_type T>
+struct Rosenbrock {
+  using table_type = typename ROS_Tableau_helper<T>::table_type;
+
+  /// \brief order returns the convergence order of the method
+  KOKKOS_FUNCTION
+  static int order() { return table_type::order; }
+
+  /// \brief num_stages returns the number of stages used by the method
+  KOKKOS_FUNCTION
+  static int num_stages() { return table_type::nstages; }
+
+  /// \brief temp_rows and temp_cols return the extents of
+  /// the temp storage passed to Solve for a system of size neqs.
+  KOKKOS_FUNCTION
+  static constexpr int temp_rows(const int neqs) { return neqs; }
+
+  KOKKOS_FUNCTION
+  static constexpr int temp_cols(const int neqs) { return KokkosODE::Impl::RosenbrockTempCols<table_type>(neqs); }
+
+  /// \brief Solve integrates an ordinary differential equation
+  ///
+  /// The integration is carried with the method specified as template
+  /// parameter to the Rosenbrock struct. This method is static and
+  /// marked as KOKKOS_FUNCTION so it can be used on host and device.
+  ///
+  /// \tparam ode_type the type of the ode object to integrated
+  /// \tparam vec_type a rank-1 view
+  /// \tparam mat_type a rank-2 view
+  /// \tparam scalar_type a floating point type
+  ///
+  /// \param ode [in]: the ode to integrate, it provides evaluate_function
+  /// and evaluate_jacobian
+  /// \param params [in]: standard input parameters of ODE integrators
+  /// \param t_start [in]: time at which the integration starts
+  /// \param t_end [in]: time at which the integration stops
+  /// \param y0 [in/out]: vector of initial conditions, set to the solution
+  /// at the end of the integration
+  /// \param y [out]: vector of solution at t_end
+  /// \param temp [in]: matrix for temporary storage of size
+  /// temp_rows(neqs) x temp_cols(neqs)
+  /// \param count [out]: number of accepted time steps
+  ///
+  /// \return ode_solver_status an enum that describes success of failure
+  /// of the integration method once it at terminated.
+  template <class ode_type, class vec_type, class mat_type, class scalar_type>
+  KOKKOS_FUNCTION static ode_solver_status Solve(const ode_type& ode, const KokkosODE::Experimental::ODE_params& params,
+                                                 const scalar_type t_start, const scalar_type t_end, const vec_type& y0,
+                                                 const vec_type& y, const mat_type& temp, int* const count) {
+    table_type table;
+    return KokkosODE::Impl::RosenbrockSolve(ode, table, params, t_start, t_end, y0, y, temp, count);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+#endif  // KOKKOSODE_ROSENBROCK_HPP
@@ -0,0 +1,69 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSEBDF_HPP
+#define KOKKOSODE_SPARSEBDF_HPP
+
+/// \file KokkosODE_SparseBDF.hpp
+
+#include "Kokkos_Core.hpp"
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_BDF.hpp"
+#include "KokkosODE_SparseNewton.hpp"
+
+#include "KokkosODE_SparseBDF_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief Fixed step BDF integrator for large stiff systems whose
+/// Jacobian is stored in a KokkosSparse::CrsMatrix.
+///
+/// Where BDF::Solve integrates one small system per thread with a
+/// dense Jacobian, SparseBDF::Solve is called from host and parallelizes
+/// over the equations of a single large system. The ode must provide:
+///   - neqs: the number of equations,
+///   - evaluate_function(t, dt, y, f): f = f(t, y),
+///   - evaluate_jacobian(t, dt, y, jac): values of df/dy in the pattern
+///     of the matrix stored in the handle, that pattern must include
+///     the diagonal.
+/// All functions are host callable and take device views.
+///
+/// \param ode [in]: the ode to integrate
+/// \param handle [in/out]: sparse Newton handle holding the Jacobian, GMRES solver and preconditioner
+/// \param params [in/out]: Newton solver parameters, iters is set by the last solve
+/// \param t_start [in]: time at which the integration starts
+/// \param t_end [in]: time at which the integration stops
+/// \param num_steps [in]: number of time steps
+/// \param y0 [in/out]: vector of initial conditions, set to the solution at t_end
+/// \param y [out]: vector of solution at t_end
+/// \param scale [in]: scaling of the Newton update norm
+template <BDF_type T>
+struct SparseBDF {
+  using table_type = typename BDF_coeff_helper<T>::table_type;
+
+  template <class ode_type, class handle_type, class vec_type, class scalar_type>
+  static ode_solver_status Solve(const ode_type& ode, handle_type& handle, Newton_params& params,
+                                 const scalar_type t_start, const scalar_type t_end, const int num_steps,
+                                 const vec_type& y0, const vec_type& y, const vec_type& scale) {
+    return KokkosODE::Impl::SparseBDFSolve<table_type>(ode, handle, params, t_start, t_end, num_steps, y0, y, scale);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_SPARSEBDF_HPP
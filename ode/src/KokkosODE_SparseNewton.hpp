@@ -0,0 +1,184 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_SPARSENEWTON_HPP
+#define KOKKOSODE_SPARSENEWTON_HPP
+
+/// \file KokkosODE_SparseNewton.hpp
+
+#include <memory>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_gmres.hpp"
+
+#include "KokkosODE_Types.hpp"
+#include "KokkosODE_SparseNewton_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief State shared by successive sparse Newton solves.
+///
+/// The handle owns the sparse Jacobian, the GMRES solver and its
+/// preconditioner. The Jacobian (and the preconditioner computed
+/// from it) is reused across Newton iterations and across Newton
+/// solves until one of the following happens:
+///   - it has been used for more than max_jacobian_age solves,
+///   - the Newton convergence rate rises above reuse_rate,
+///   - invalidate_jacobian() is called, for instance when the
+///     system being solved changes (new time step size, ...).
+///
+/// \tparam crs_matrix_type the KokkosSparse::CrsMatrix storing the Jacobian
+template <class crs_matrix_type>
+class SparseNewtonHandle {
+ public:
+  using scalar_type     = typename crs_matrix_type::non_const_value_type;
+  using ordinal_type    = typename crs_matrix_type::non_const_ordinal_type;
+  using size_type       = typename crs_matrix_type::non_const_size_type;
+  using execution_space = typename crs_matrix_type::execution_space;
+  using memory_space    = typename crs_matrix_type::memory_space;
+  using device_type     = typename crs_matrix_type::device_type;
+  using vec_type        = Kokkos::View<scalar_type*, device_type>;
+  using precond_type    = KokkosSparse::Experimental::Preconditioner<crs_matrix_type>;
+
+  using kernel_handle_type =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, ordinal_type, scalar_type, execution_space,
+                                                       memory_space, memory_space>;
+  using gmres_handle_type  = typename kernel_handle_type::GMRESHandleType;
+
+ private:
+  crs_matrix_type J;
+  kernel_handle_type kh;
+  std::unique_ptr<precond_type> default_precond;
+  precond_type* precond;
+
+  int max_jacobian_age;
+  double reuse_rate;
+
+  bool jacobian_current = false;
+  bool jacobian_fresh   = false;
+  int jacobian_age      = 0;
+
+  int num_jacobian_evals = 0, num_newton_iters = 0, num_linear_iters = 0;
+
+ public:
+  /// \param J_ [in]: matrix with the sparsity pattern of the Jacobian, its values are overwritten
+  /// \param max_jacobian_age_ [in]: number of Newton solves a Jacobian can be reused for
+  /// \param reuse_rate_ [in]: Newton convergence rate above which the Jacobian is re-evaluated
+  /// \param krylov_dim [in]: GMRES restart length
+  /// \param krylov_tol [in]: GMRES relative residual tolerance
+  /// \param max_restart [in]: maximum number of GMRES restarts
+  SparseNewtonHandle(const crs_matrix_type& J_, const int max_jacobian_age_ = 20, const double reuse_rate_ = 0.3,
+                     const size_type krylov_dim = 50, const typename gmres_handle_type::float_t krylov_tol = 1e-8,
+                     const size_type max_restart = 20)
+      : J(J_),
+        default_precond(new KokkosODE::Impl::JacobiPrec<crs_matrix_type>(J_)),
+        precond(default_precond.get()),
+        max_jacobian_age(max_jacobian_age_),
+        reuse_rate(reuse_rate_) {
+    kh.create_gmres_handle(krylov_dim, krylov_tol, max_restart);
+  }
+
+  SparseNewtonHandle(const SparseNewtonHandle&)            = delete;
+  SparseNewtonHandle& operator=(const SparseNewtonHandle&) = delete;
+
+  crs_matrix_type& get_jacobian() { return J; }
+  gmres_handle_type* get_gmres_handle() { return kh.get_gmres_handle(); }
+
+  /// \brief Replace the default Jacobi preconditioner, for instance with a
+  /// KokkosSparse::Experimental::LUPrec built on J. The preconditioner is not
+  /// owned by the handle and its compute() is called after each evaluation of
+  /// the Jacobian. Passing nullptr restores the default preconditioner.
+  void set_preconditioner(precond_type* precond_) {
+    precond = (precond_ == nullptr) ? default_precond.get() : precond_;
+    invalidate_jacobian();
+  }
+
+  int get_max_jacobian_age() const { return max_jacobian_age; }
+  void set_max_jacobian_age(const int max_jacobian_age_) { max_jacobian_age = max_jacobian_age_; }
+  double get_reuse_rate() const { return reuse_rate; }
+  void set_reuse_rate(const double reuse_rate_) { reuse_rate = reuse_rate_; }
+
+  int get_num_jacobian_evals() const { return num_jacobian_evals; }
+  int get_num_newton_iters() const { return num_newton_iters; }
+  int get_num_linear_iters() const { return num_linear_iters; }
+  void reset_stats() { num_jacobian_evals = num_newton_iters = num_linear_iters = 0; }
+
+  /// \brief True if the Jacobian can be used for the current iteration
+  bool jacobian_is_current() const { return jacobian_current; }
+  /// \brief True if the Jacobian was evaluated during the current solve
+  bool jacobian_is_fresh() const { return jacobian_fresh; }
+  /// \brief Force the evaluation of the Jacobian at the next Newton iteration
+  void invalidate_jacobian() { jacobian_current = false; }
+
+  /// \brief Called at the beginning of each Newton solve to age the Jacobian
+  void start_solve() {
+    jacobian_fresh = false;
+    if (jacobian_age >= max_jacobian_age) {
+      jacobian_current = false;
+    }
+    ++jacobian_age;
+  }
+
+  /// \brief Evaluate the Jacobian of sys at y and recompute the preconditioner
+  template <class system_type, class y_vec_type>
+  void evaluate_jacobian(const system_type& sys, const y_vec_type& y) {
+    sys.jacobian(y, J);
+    precond->compute();
+    ++num_jacobian_evals;
+    jacobian_age     = 0;
+    jacobian_current = true;
+    jacobian_fresh   = true;
+  }
+
+  void add_newton_iteration() { ++num_newton_iters; }
+
+  /// \brief Solve J*x = b with preconditioned GMRES, x holds the initial guess
+  /// \return true if GMRES converged, a loss of accuracy is accepted since
+  /// the Newton iteration monitors its own convergence.
+  bool linear_solve(const vec_type& b, const vec_type& x) {
+    KokkosSparse::Experimental::gmres(&kh, J, b, x, precond);
+    num_linear_iters += kh.get_gmres_handle()->get_num_iters();
+    const auto flag = kh.get_gmres_handle()->get_conv_flag_val();
+    return (flag == gmres_handle_type::Flag::Conv) || (flag == gmres_handle_type::Flag::LOA);
+  }
+};
+
+/// \brief Modified Newton solver for large non-linear systems with
+/// a sparse Jacobian, see KokkosODE::Impl::SparseNewtonSolve.
+///
+/// Unlike Newton::Solve this is called from host and parallelizes over
+/// the equations of a single system. The system must provide:
+///   - neqs: the number of equations,
+///   - residual(y, rhs): rhs = F(y),
+///   - jacobian(y, J): values of J = dF/dy at y, J having the pattern
+///     of the matrix stored in the handle.
+/// All functions are host callable and take device views.
+struct SparseNewton {
+  template <class handle_type, class system_type, class vec_type>
+  static newton_solver_status Solve(handle_type& handle, const system_type& sys, Newton_params& params,
+                                    const vec_type& y0, const vec_type& rhs, const vec_type& update,
+                                    const vec_type& scale) {
+    return KokkosODE::Impl::SparseNewtonSolve(handle, sys, params, y0, rhs, update, scale);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_SPARSENEWTON_HPP
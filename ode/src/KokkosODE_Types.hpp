@@ -20,7 +20,7 @@
 namespace KokkosODE {
 namespace Experimental {
 
-enum ode_solver_status { SUCCESS = 0, MAX_STEP = 1, MIN_SIZE = 2 };
+enum ode_solver_status { SUCCESS = 0, MAX_STEP = 1, MIN_SIZE = 2, NLS_FAIL = 3 };
 
 struct ODE_params {
   bool adaptivity;
@@ -76,6 +76,29 @@ struct Newton_params {
       : max_iters(max_iters_), abs_tol(abs_tol_), rel_tol(rel_tol_) {}
 };
 
+// Jacobian reuse policy of the adaptive BDF solver.
+// The Jacobian and the factorization of the iteration
+// matrix I - c*J are kept from one step to the next and
+// only recomputed when:
+//   - the Jacobian is older than max_age steps,
+//   - c changed by more than max_c_change (relative)
+//     since the last factorization, smaller changes are
+//     corrected by scaling the Newton updates,
+//   - the Newton convergence rate exceeded max_rate,
+//   - Newton failed to converge with an old Jacobian.
+// Setting max_age to 0 evaluates the Jacobian at every step.
+struct Jacobian_reuse_params {
+  int max_age;
+  double max_c_change, max_rate;
+
+  KOKKOS_FUNCTION
+  Jacobian_reuse_params() : max_age(20), max_c_change(0.3), max_rate(0.3) {}
+
+  KOKKOS_FUNCTION
+  Jacobian_reuse_params(const int max_age_, const double max_c_change_, const double max_rate_)
+      : max_age(max_age_), max_c_change(max_c_change_), max_rate(max_rate_) {}
+};
+
 }  // namespace Experimental
 }  // namespace KokkosODE
 #endif  // KOKKOSODE_TYPES_HPP
@@ -16,13 +16,20 @@
 #ifndef TEST_ODE_HPP
 #define TEST_ODE_HPP
 
+#include "KokkosKernels_config.h"
+
 // Explicit integrators
 #include "Test_ODE_RK.hpp"
 #include "Test_ODE_RK_chem.hpp"
 #include "Test_ODE_RK_counts.hpp"
+#include "Test_ODE_RK_ensemble.hpp"
 
 // Implicit integrators
 #include "Test_ODE_Newton.hpp"
 #include "Test_ODE_BDF.hpp"
+#include "Test_ODE_ImplicitRK.hpp"
+#ifdef KOKKOSKERNELS_ENABLE_COMPONENT_SPARSE
+#include "Test_ODE_SparseBDF.hpp"
+#endif
 
 #endif  // TEST_ODE_HPP
@@ -187,6 +187,34 @@ struct BDF_Solve_wrapper {
   }
 };
 
+template <class ode_type, class mat_type, class vec_type, class count_type, class scalar_type>
+struct BDF_reuse_wrapper {
+  const ode_type my_ode;
+  const scalar_type t_start, t_end;
+  const vec_type y0, y_new;
+  const mat_type temp, temp2;
+  const KokkosODE::Experimental::Jacobian_reuse_params reuse_params;
+  const count_type counts;
+
+  BDF_reuse_wrapper(const ode_type& my_ode_, const scalar_type& t_start_, const scalar_type& t_end_,
+                    const vec_type& y0_, const vec_type& y_new_, const mat_type& temp_, const mat_type& temp2_,
+                    const KokkosODE::Experimental::Jacobian_reuse_params& reuse_params_, const count_type& counts_)
+      : my_ode(my_ode_),
+        t_start(t_start_),
+        t_end(t_end_),
+        y0(y0_),
+        y_new(y_new_),
+        temp(temp_),
+        temp2(temp2_),
+        reuse_params(reuse_params_),
+        counts(counts_) {}
+
+  KOKKOS_FUNCTION void operator()(const int) const {
+    KokkosODE::Experimental::BDFSolve(my_ode, t_start, t_end, 0.0, (t_end - t_start) / 10, y0, y_new, temp, temp2,
+                                      reuse_params, &counts(0), &counts(1));
+  }
+};
+
 template <class device_type, class scalar_type>
 void test_BDF_Logistic() {
   using execution_space = typename device_type::execution_space;
@@ -728,6 +756,69 @@ void test_BDF_adaptive_stiff() {
             << std::endl;
 }
 
+// Compare the adaptive BDF solver with and without
+// reuse of the Jacobian across time steps.
+template <class Device, class scalar_type>
+void test_BDF_jacobian_reuse() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, execution_space>;
+  using mat_type        = Kokkos::View<scalar_type**, execution_space>;
+  using count_type      = Kokkos::View<int*, execution_space>;
+  using KAT             = Kokkos::ArithTraits<scalar_type>;
+  using wrapper_type    = BDF_reuse_wrapper<StiffChemistry, mat_type, vec_type, count_type, scalar_type>;
+
+  StiffChemistry mySys{};
+
+  const scalar_type t_start = KAT::zero(), t_end = 350 * KAT::one();
+  vec_type y0("initial conditions", mySys.neqs), y_new("solution", mySys.neqs);
+  vec_type y0_ref("initial conditions", mySys.neqs), y_new_ref("solution", mySys.neqs);
+  mat_type temp("buffer1", mySys.neqs, 23 + 2 * mySys.neqs + 4), temp2("buffer2", 6, 7);
+  count_type counts("counts", 2), counts_ref("counts reference", 2);
+
+  auto y0_h = Kokkos::create_mirror_view(y0);
+  y0_h(0)   = KAT::one();
+  y0_h(1)   = KAT::zero();
+  y0_h(2)   = KAT::zero();
+  Kokkos::deep_copy(y0, y0_h);
+  Kokkos::deep_copy(y0_ref, y0_h);
+
+  Kokkos::RangePolicy<execution_space> policy(0, 1);
+
+  // Jacobian evaluated at every step
+  const KokkosODE::Experimental::Jacobian_reuse_params no_reuse(0, 0.0, 0.0);
+  Kokkos::parallel_for(policy,
+                       wrapper_type(mySys, t_start, t_end, y0_ref, y_new_ref, temp, temp2, no_reuse, counts_ref));
+
+  Kokkos::deep_copy(temp, KAT::zero());
+  Kokkos::deep_copy(temp2, KAT::zero());
+  const KokkosODE::Experimental::Jacobian_reuse_params reuse{};
+  Kokkos::parallel_for(policy, wrapper_type(mySys, t_start, t_end, y0, y_new, temp, temp2, reuse, counts));
+
+  auto y_new_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_new);
+  auto y_new_ref_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_new_ref);
+  auto counts_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  auto counts_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts_ref);
+
+  // y1 is below the absolute tolerance of the
+  // solver and is therefore not checked.
+  EXPECT_NEAR_KK_REL(y_new_h(0), 0.462966, 2e-2);
+  EXPECT_NEAR_KK_REL(y_new_h(2), 0.537030, 2e-2);
+  EXPECT_NEAR_KK_REL(y_new_ref_h(0), 0.462966, 2e-2);
+  EXPECT_NEAR_KK_REL(y_new_ref_h(2), 0.537030, 2e-2);
+
+  // Reusing the Jacobian must not cost accuracy: both solutions
+  // agree within the tolerances of the solver (rtol=1e-3, atol=1e-6)
+  EXPECT_NEAR_KK(y_new_h(0), y_new_ref_h(0), 1e-6 + 1e-3 * Kokkos::abs(y_new_ref_h(0)));
+  EXPECT_NEAR_KK(y_new_h(2), y_new_ref_h(2), 1e-6 + 1e-3 * Kokkos::abs(y_new_ref_h(2)));
+
+  // Jacobian evaluations and factorizations
+  EXPECT_GT(counts_h(0), 0);
+  EXPECT_GE(counts_h(1), counts_h(0));
+  EXPECT_EQ(counts_ref_h(0), counts_ref_h(1));
+  EXPECT_LT(5 * counts_h(0), counts_ref_h(0));
+  EXPECT_LT(2 * counts_h(1), counts_ref_h(1));
+}  // test_BDF_jacobian_reuse
+
 }  // namespace Test
 
 TEST_F(TestCategory, BDF_Logistic_serial) { ::Test::test_BDF_Logistic<TestDevice, double>(); }
@@ -742,3 +833,4 @@ TEST_F(TestCategory, BDF_Nordsieck) { ::Test::test_Nordsieck<TestDevice, double>
 //   ::Test::test_adaptive_BDF_v2<TestDevice, double>();
 // }
 TEST_F(TestCategory, BDF_StiffChemistry_adaptive) { ::Test::test_BDF_adaptive_stiff<TestDevice, double>(); }
+TEST_F(TestCategory, BDF_jacobian_reuse) { ::Test::test_BDF_jacobian_reuse<TestDevice, double>(); }
@@ -0,0 +1,182 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "KokkosODE_Rosenbrock.hpp"
+#include "KokkosODE_RadauIIA.hpp"
+#include "Test_ODE_TestProblems.hpp"
+
+namespace Test {
+
+template <class solver_type, class ode_type, class vec_type, class mat_type, class count_type>
+struct ImplicitRKSolve_wrapper {
+  using ode_params = KokkosODE::Experimental::ODE_params;
+
+  ode_type my_ode;
+  ode_params params;
+  double tstart, tend;
+  vec_type y_old, y_new;
+  mat_type temp;
+  count_type count;
+
+  ImplicitRKSolve_wrapper(const ode_type& my_ode_, const ode_params& params_, const double tstart_,
+                          const double tend_, const vec_type& y_old_, const vec_type& y_new_, const mat_type& temp_,
+                          const count_type& count_)
+      : my_ode(my_ode_),
+        params(params_),
+        tstart(tstart_),
+        tend(tend_),
+        y_old(y_old_),
+        y_new(y_new_),
+        temp(temp_),
+        count(count_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int /*idx*/) const {
+    // count(0) stores the number of steps and count(1) the solver status
+    count(1) = solver_type::Solve(my_ode, params, tstart, tend, y_old, y_new, temp, &count(0));
+  }
+};
+
+// Integrates myODE on [tstart, tend] starting from its expected
+// value at tstart and returns the solution at tend on host.
+template <class solver_type, class Device, class OdeType>
+Kokkos::View<double*, Kokkos::HostSpace> ImplicitRK_Solve(const OdeType& myODE,
+                                                          const KokkosODE::Experimental::ODE_params& params,
+                                                          int& num_steps, int& status) {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mat_type        = Kokkos::View<double**, Device>;
+  using count_type      = Kokkos::View<int*, execution_space>;
+  using wrapper_type    = ImplicitRKSolve_wrapper<solver_type, OdeType, vec_type, mat_type, count_type>;
+
+  constexpr int neqs = OdeType::neqs;
+
+  vec_type y_old("y old", neqs), y_new("y new", neqs);
+  mat_type temp("temp storage", solver_type::temp_rows(neqs), solver_type::temp_cols(neqs));
+  count_type count("time step count and status", 2);
+
+  auto y_old_h = Kokkos::create_mirror_view(y_old);
+  for (int dofIdx = 0; dofIdx < neqs; ++dofIdx) {
+    y_old_h(dofIdx) = myODE.expected_val(myODE.tstart(), dofIdx);
+  }
+  Kokkos::deep_copy(y_old, y_old_h);
+
+  Kokkos::RangePolicy<execution_space> my_policy(0, 1);
+  Kokkos::parallel_for(my_policy, wrapper_type(myODE, params, myODE.tstart(), myODE.tend(), y_old, y_new, temp, count));
+
+  auto count_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), count);
+  num_steps    = count_h(0);
+  status       = count_h(1);
+
+  return Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_new);
+}  // ImplicitRK_Solve
+
+// Checks the convergence order with fixed time steps on a
+// non-autonomous problem, which also exercises the df/dt
+// term of the Rosenbrock methods.
+template <class solver_type, class Device>
+void ImplicitRK_Order(const std::string& label, const int num_steps_coarse) {
+  TestProblem::CosExp myODE(-1., 0., 2.);
+
+  double errors[3] = {0};
+  for (int refIdx = 0; refIdx < 3; ++refIdx) {
+    const int num_steps = num_steps_coarse * (1 << refIdx);
+    KokkosODE::Experimental::ODE_params params(num_steps);
+
+    int count = 0, status = -1;
+    auto y_h  = ImplicitRK_Solve<solver_type, Device>(myODE, params, count, status);
+
+    EXPECT_EQ(status, KokkosODE::Experimental::ode_solver_status::SUCCESS) << label;
+    EXPECT_EQ(count, num_steps) << label;
+    errors[refIdx] = Kokkos::abs(y_h(0) - myODE.expected_val(myODE.tend(), 0));
+  }
+
+  const double measured_order = Kokkos::log2(errors[0] / errors[2]) / 2;
+#if defined(HAVE_KOKKOSKERNELS_DEBUG)
+  std::cout << label << ": expected order " << solver_type::order() << ", measured order " << measured_order
+            << std::endl;
+#endif
+  EXPECT_NEAR_KK_REL(measured_order, static_cast<double>(solver_type::order()), 0.1) << label;
+}  // ImplicitRK_Order
+
+// Checks that the adaptive integration of a stiff
+// problem meets the requested tolerances.
+template <class solver_type, class Device, class OdeType>
+void ImplicitRK_Stiff(const std::string& label, const OdeType& myODE, const double relTol, const double absTol) {
+  constexpr int neqs     = OdeType::neqs;
+  constexpr int maxSteps = 100000;
+  KokkosODE::Experimental::ODE_params params(myODE.numsteps(), maxSteps, absTol, relTol,
+                                             1e-12 * (myODE.tend() - myODE.tstart()));
+
+  int count = 0, status = -1;
+  auto y_h  = ImplicitRK_Solve<solver_type, Device>(myODE, params, count, status);
+
+  double error = 0.0;
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    const double scale = absTol + relTol * Kokkos::abs(y_h(eqIdx));
+    error += Kokkos::pow((myODE.expected_val(myODE.tend(), eqIdx) - y_h(eqIdx)) / scale, 2.0);
+  }
+  error = Kokkos::sqrt(error / neqs);
+
+  std::string msg = label + ", " + std::string(OdeType::name);
+  EXPECT_EQ(status, KokkosODE::Experimental::ode_solver_status::SUCCESS) << msg;
+  EXPECT_GT(count, 0) << msg;
+  EXPECT_LE(error, 1.0) << msg;
+}  // ImplicitRK_Stiff
+
+template <class Device>
+void test_Rosenbrock() {
+  using KokkosODE::Experimental::ROS_type;
+  using ros3p_type  = KokkosODE::Experimental::Rosenbrock<ROS_type::ROS3P>;
+  using rodas3_type = KokkosODE::Experimental::Rosenbrock<ROS_type::RODAS3>;
+
+  EXPECT_EQ(ros3p_type::order(), 3);
+  EXPECT_EQ(ros3p_type::num_stages(), 3);
+  EXPECT_EQ(rodas3_type::order(), 3);
+  EXPECT_EQ(rodas3_type::num_stages(), 4);
+
+  ImplicitRK_Order<ros3p_type, Device>("ROS3P", 20);
+  ImplicitRK_Order<rodas3_type, Device>("RODAS3", 20);
+
+  // ROS3P is not L-stable and is therefore not
+  // used on the fast decay of the first species.
+  ImplicitRK_Stiff<ros3p_type, Device>("ROS3P", TestProblem::KKStiffChemistry(), 1e-4, 1e-8);
+  ImplicitRK_Stiff<rodas3_type, Device>("RODAS3", TestProblem::StiffChemicalDecayProcess(1e4, 1.), 1e-5, 1e-10);
+  ImplicitRK_Stiff<rodas3_type, Device>("RODAS3", TestProblem::KKStiffChemistry(), 1e-4, 1e-8);
+}  // test_Rosenbrock
+
+template <class Device>
+void test_RadauIIA() {
+  using radau_type = KokkosODE::Experimental::RadauIIA;
+
+  EXPECT_EQ(radau_type::order(), 5);
+  EXPECT_EQ(radau_type::num_stages(), 3);
+
+  ImplicitRK_Order<radau_type, Device>("RadauIIA", 10);
+
+  ImplicitRK_Stiff<radau_type, Device>("RadauIIA", TestProblem::StiffChemicalDecayProcess(1e4, 1.), 1e-5, 1e-10);
+  ImplicitRK_Stiff<radau_type, Device>("RadauIIA", TestProblem::KKStiffChemistry(), 1e-4, 1e-8);
+}  // test_RadauIIA
+
+}  // namespace Test
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, ODE_Rosenbrock) { ::Test::test_Rosenbrock<TestDevice>(); }
+TEST_F(TestCategory, ODE_RadauIIA) { ::Test::test_RadauIIA<TestDevice>(); }
+#endif
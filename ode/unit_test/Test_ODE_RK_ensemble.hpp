@@ -0,0 +1,133 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "KokkosODE_Ensemble.hpp"
+
+namespace Test {
+
+// y0' = -lambda * y0, y1' = -2 * lambda * y1
+// solution: y0 = exp(-lambda * t), y1 = exp(-2 * lambda * t)
+struct decay_system {
+  constexpr static int neqs = 2;
+  double lambda;
+
+  template <class vec_type1, class vec_type2>
+  KOKKOS_FUNCTION void evaluate_function(const double /*t*/, const double /*dt*/, const vec_type1& y,
+                                         const vec_type2& f) const {
+    f(0) = -lambda * y(0);
+    f(1) = -2 * lambda * y(1);
+  }
+};
+
+// Ensemble of decay systems, each with its own rate
+template <class rate_view>
+struct decay_ensemble {
+  constexpr static int neqs = 2;
+  rate_view rates;
+
+  KOKKOS_FUNCTION decay_system system(const int sysIdx) const { return decay_system{rates(sysIdx)}; }
+};
+
+template <class Device>
+void test_RK_ensemble() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using mv_type         = Kokkos::View<double**, Kokkos::LayoutLeft, Device>;
+  using status_type     = Kokkos::View<KokkosODE::Experimental::ode_solver_status*, Device>;
+  using count_type      = Kokkos::View<int*, Device>;
+  using solver_type     = KokkosODE::Experimental::RungeKuttaEnsemble<KokkosODE::Experimental::RK_type::RKCK>;
+
+  constexpr int num_systems = 37;
+  constexpr int neqs        = decay_ensemble<vec_type>::neqs;
+  const execution_space space{};
+
+  // Rates and final times differ between systems so that
+  // the number of steps taken by each system also differs.
+  vec_type rates("rates", num_systems), t_start("t start", num_systems), t_end("t end", num_systems);
+  auto rates_h = Kokkos::create_mirror_view(rates);
+  auto t_end_h = Kokkos::create_mirror_view(t_end);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    rates_h(sysIdx) = 0.5 + 0.75 * (sysIdx % 7);
+    t_end_h(sysIdx) = 1.0 + (sysIdx % 3);
+  }
+  Kokkos::deep_copy(rates, rates_h);
+  Kokkos::deep_copy(t_end, t_end_h);
+  decay_ensemble<vec_type> ensemble{rates};
+
+  KokkosODE::Experimental::ODE_params params(100, 10000, 1.0e-10, 1.0e-8, 1.0e-10);
+
+  mv_type y("y", num_systems, neqs), y_ref("y reference", num_systems, neqs);
+  status_type status("status", num_systems), status_ref("status reference", num_systems);
+  count_type count("count", num_systems), count_ref("count reference", num_systems);
+
+  // Reference run with a single pass, then a run that
+  // retires systems every few steps. Both must take the
+  // same steps and produce the same solutions.
+  Kokkos::deep_copy(y_ref, 1.0);
+  solver_type::Solve(space, ensemble, params, t_start, t_end, y_ref, status_ref, count_ref, params.max_steps);
+  Kokkos::deep_copy(y, 1.0);
+  solver_type::Solve(space, ensemble, params, t_start, t_end, y, status, count, 3);
+
+  auto y_h          = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  auto y_ref_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+  auto status_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), status);
+  auto status_ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), status_ref);
+  auto count_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), count);
+  auto count_ref_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), count_ref);
+
+  int min_count = count_h(0), max_count = count_h(0);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    EXPECT_EQ(status_h(sysIdx), KokkosODE::Experimental::ode_solver_status::SUCCESS);
+    EXPECT_EQ(status_ref_h(sysIdx), KokkosODE::Experimental::ode_solver_status::SUCCESS);
+    EXPECT_EQ(count_h(sysIdx), count_ref_h(sysIdx));
+    min_count = Kokkos::min(min_count, count_h(sysIdx));
+    max_count = Kokkos::max(max_count, count_h(sysIdx));
+
+    const double decay = Kokkos::exp(-rates_h(sysIdx) * t_end_h(sysIdx));
+    EXPECT_NEAR_KK_REL(y_h(sysIdx, 0), decay, 1.0e-6);
+    EXPECT_NEAR_KK_REL(y_h(sysIdx, 1), decay * decay, 1.0e-6);
+    EXPECT_NEAR_KK_REL(y_h(sysIdx, 0), y_ref_h(sysIdx, 0), 1.0e-12);
+    EXPECT_NEAR_KK_REL(y_h(sysIdx, 1), y_ref_h(sysIdx, 1), 1.0e-12);
+  }
+  EXPECT_LT(min_count, max_count);
+
+  // With a step budget smaller than what the slowest systems
+  // need, those systems are retired with MAX_STEP.
+  const int max_steps = (min_count + max_count) / 2;
+  KokkosODE::Experimental::ODE_params short_params(100, max_steps, 1.0e-10, 1.0e-8, 1.0e-10);
+  Kokkos::deep_copy(y, 1.0);
+  solver_type::Solve(space, ensemble, short_params, t_start, t_end, y, status, count, 4);
+  Kokkos::deep_copy(status_h, status);
+  Kokkos::deep_copy(count_h, count);
+  for (int sysIdx = 0; sysIdx < num_systems; ++sysIdx) {
+    if (count_ref_h(sysIdx) <= max_steps) {
+      EXPECT_EQ(status_h(sysIdx), KokkosODE::Experimental::ode_solver_status::SUCCESS);
+      EXPECT_EQ(count_h(sysIdx), count_ref_h(sysIdx));
+    } else {
+      EXPECT_EQ(status_h(sysIdx), KokkosODE::Experimental::ode_solver_status::MAX_STEP);
+      EXPECT_EQ(count_h(sysIdx), max_steps);
+    }
+  }
+}  // test_RK_ensemble
+
+}  // namespace Test
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, RK_ensemble) { ::Test::test_RK_ensemble<TestDevice>(); }
+#endif
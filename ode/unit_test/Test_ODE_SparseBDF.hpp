@@ -0,0 +1,184 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosODE_SparseBDF.hpp"
+
+namespace Test {
+
+// Reaction-diffusion on (0, 1) with homogeneous Dirichlet
+// boundary conditions, discretized with central differences:
+//   y_i' = D/h^2 * (y_{i-1} - 2*y_i + y_{i+1}) - k*y_i
+// The spectrum of the Jacobian spans [-4D/h^2 - k, -k]
+// making the system stiff. With y_i(0) = sin(pi*x_i) the
+// semi-discrete solution is y_i(t) = exp(lambda*t)*sin(pi*x_i)
+// with lambda = -4D/h^2*sin^2(pi*h/2) - k.
+template <class execution_space>
+struct ReactionDiffusion {
+  const int neqs;
+  const double diffusion, reaction;
+
+  ReactionDiffusion(const int neqs_, const double diffusion_, const double reaction_)
+      : neqs(neqs_), diffusion(diffusion_ * (neqs_ + 1) * (neqs_ + 1)), reaction(reaction_) {}
+
+  template <class vec_type1, class vec_type2>
+  void evaluate_function(const double /*t*/, const double /*dt*/, const vec_type1& y, const vec_type2& f) const {
+    const int n    = neqs;
+    const double d = diffusion, k = reaction;
+    Kokkos::parallel_for(
+        "ReactionDiffusion::evaluate_function", Kokkos::RangePolicy<execution_space>(0, n),
+        KOKKOS_LAMBDA(const int eqIdx) {
+          const double left  = (eqIdx > 0) ? y(eqIdx - 1) : 0.0;
+          const double right = (eqIdx < n - 1) ? y(eqIdx + 1) : 0.0;
+          f(eqIdx)           = d * (left - 2 * y(eqIdx) + right) - k * y(eqIdx);
+        });
+  }
+
+  template <class vec_type, class mat_type>
+  void evaluate_jacobian(const double /*t*/, const double /*dt*/, const vec_type& /*y*/, const mat_type& jac) const {
+    using size_type = typename mat_type::non_const_size_type;
+
+    const double d = diffusion, k = reaction;
+    auto row_map   = jac.graph.row_map;
+    auto entries   = jac.graph.entries;
+    auto values    = jac.values;
+    Kokkos::parallel_for(
+        "ReactionDiffusion::evaluate_jacobian", Kokkos::RangePolicy<execution_space>(0, neqs),
+        KOKKOS_LAMBDA(const int rowIdx) {
+          for (size_type entryIdx = row_map(rowIdx); entryIdx < row_map(rowIdx + 1); ++entryIdx) {
+            values(entryIdx) = (entries(entryIdx) == rowIdx) ? -2 * d - k : d;
+          }
+        });
+  }
+};
+
+template <class crs_matrix_type>
+crs_matrix_type tridiagonal_pattern(const int n) {
+  using size_type    = typename crs_matrix_type::non_const_size_type;
+  using ordinal_type = typename crs_matrix_type::non_const_ordinal_type;
+
+  const size_type nnz = 3 * n - 2;
+  typename crs_matrix_type::row_map_type::non_const_type row_map("row map", n + 1);
+  typename crs_matrix_type::index_type::non_const_type entries("entries", nnz);
+  typename crs_matrix_type::values_type::non_const_type values("values", nnz);
+  auto row_map_h = Kokkos::create_mirror_view(row_map);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+
+  size_type entryIdx = 0;
+  for (ordinal_type rowIdx = 0; rowIdx < n; ++rowIdx) {
+    row_map_h(rowIdx)               = entryIdx;
+    const ordinal_type first_column = Kokkos::max(rowIdx - 1, ordinal_type(0));
+    const ordinal_type last_column  = Kokkos::min(rowIdx + 2, ordinal_type(n));
+    for (ordinal_type colIdx = first_column; colIdx < last_column; ++colIdx) {
+      entries_h(entryIdx) = colIdx;
+      ++entryIdx;
+    }
+  }
+  row_map_h(n) = entryIdx;
+  Kokkos::deep_copy(row_map, row_map_h);
+  Kokkos::deep_copy(entries, entries_h);
+
+  return crs_matrix_type("jacobian", n, n, nnz, values, row_map, entries);
+}
+
+template <class Device, KokkosODE::Experimental::BDF_type bdf_type>
+void test_SparseBDF(const int num_steps, const double tol) {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<double*, Device>;
+  using crs_matrix_type = KokkosSparse::CrsMatrix<double, default_lno_t, Device, void, default_size_type>;
+  using handle_type     = KokkosODE::Experimental::SparseNewtonHandle<crs_matrix_type>;
+  using solver_type     = KokkosODE::Experimental::SparseBDF<bdf_type>;
+
+  constexpr int neqs         = 127;
+  constexpr double t_start   = 0.0, t_end = 0.5;
+  constexpr double diffusion = 1.0, reaction = 1.0;
+  const ReactionDiffusion<execution_space> ode(neqs, diffusion, reaction);
+
+  const double pi     = Kokkos::numbers::pi;
+  const double h      = 1.0 / (neqs + 1);
+  const double lambda = -4 * ode.diffusion * Kokkos::pow(Kokkos::sin(pi * h / 2), 2) - reaction;
+
+  vec_type y0("y0", neqs), y("y", neqs), scale("scale", neqs);
+  auto y0_h = Kokkos::create_mirror_view(y0);
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    y0_h(eqIdx) = Kokkos::sin(pi * (eqIdx + 1) * h);
+  }
+  Kokkos::deep_copy(y0, y0_h);
+  Kokkos::deep_copy(scale, 1.0e-6);
+
+  handle_type handle(tridiagonal_pattern<crs_matrix_type>(neqs));
+  KokkosODE::Experimental::Newton_params params(10, 1.0e-14, 1.0e-10);
+
+  const KokkosODE::Experimental::ode_solver_status status =
+      solver_type::Solve(ode, handle, params, t_start, t_end, num_steps, y0, y, scale);
+  EXPECT_EQ(status, KokkosODE::Experimental::ode_solver_status::SUCCESS);
+
+  auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  for (int eqIdx = 0; eqIdx < neqs; ++eqIdx) {
+    const double sol = Kokkos::exp(lambda * t_end) * Kokkos::sin(pi * (eqIdx + 1) * h);
+    EXPECT_NEAR_KK_REL(y_h(eqIdx), sol, tol);
+  }
+
+  // The system is linear, the Jacobian is only evaluated when
+  // gamma changes during start-up and when it gets too old.
+  const int max_evals = solver_type::table_type::order + num_steps / handle.get_max_jacobian_age() + 1;
+  EXPECT_LE(handle.get_num_jacobian_evals(), max_evals);
+  EXPECT_GE(handle.get_num_newton_iters(), num_steps);
+  EXPECT_GT(handle.get_num_linear_iters(), 0);
+
+  // Jacobian evaluated at every Newton solve
+  handle.reset_stats();
+  handle.set_max_jacobian_age(0);
+  Kokkos::deep_copy(y0, y0_h);
+  solver_type::Solve(ode, handle, params, t_start, t_end, num_steps, y0, y, scale);
+  EXPECT_EQ(handle.get_num_jacobian_evals(), num_steps);
+}  // test_SparseBDF
+
+template <class Device>
+void test_SparseBDF_pattern() {
+  using crs_matrix_type = KokkosSparse::CrsMatrix<double, default_lno_t, Device, void, default_size_type>;
+  using vec_type        = Kokkos::View<double*, Device>;
+
+  constexpr int neqs = 4;
+  const ReactionDiffusion<typename Device::execution_space> ode(neqs, 1.0, 1.0);
+
+  // Jacobian pattern without diagonal
+  typename crs_matrix_type::row_map_type::non_const_type row_map("row map", neqs + 1);
+  typename crs_matrix_type::index_type::non_const_type entries("entries", 0);
+  typename crs_matrix_type::values_type::non_const_type values("values", 0);
+  KokkosODE::Experimental::SparseNewtonHandle<crs_matrix_type> handle(
+      crs_matrix_type("jacobian", neqs, neqs, 0, values, row_map, entries));
+
+  KokkosODE::Experimental::Newton_params params(10, 1.0e-14, 1.0e-10);
+  vec_type y0("y0", neqs), y("y", neqs), scale("scale", neqs);
+  EXPECT_THROW(KokkosODE::Experimental::SparseBDF<KokkosODE::Experimental::BDF_type::BDF1>::Solve(
+                   ode, handle, params, 0.0, 1.0, 10, y0, y, scale),
+               std::runtime_error);
+}  // test_SparseBDF_pattern
+
+}  // namespace Test
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, SparseBDF) {
+  ::Test::test_SparseBDF<TestDevice, KokkosODE::Experimental::BDF_type::BDF1>(2000, 1.0e-2);
+  ::Test::test_SparseBDF<TestDevice, KokkosODE::Experimental::BDF_type::BDF2>(500, 1.0e-3);
+  ::Test::test_SparseBDF<TestDevice, KokkosODE::Experimental::BDF_type::BDF3>(500, 2.0e-4);
+  ::Test::test_SparseBDF_pattern<TestDevice>();
+}
+#endif
@@ -81,6 +81,14 @@ void print_options(std::ostream &os, const char *app_name, unsigned int indent =
      << "                 COLORING_VBDBIT   - Use the vertex-based "
         "deterministic with bit vectors method."
      << std::endl
+     << spaces
+     << "                 COLORING_VBH      - Use the vertex-based "
+        "with bit vectors method, with a team per high-degree vertex."
+     << std::endl
+     << spaces
+     << "                 COLORING_BALANCED - Use the vertex-based "
+        "with bit vectors method, then balance the color set sizes."
+     << std::endl
      << std::endl
      << spaces << "  Optional Parameters:" << std::endl
      << spaces << "      --chunksize <N>     Set the chunk size." << std::endl
@@ -158,6 +166,10 @@ int parse_inputs(KokkosKernels::Experiment::Parameters &params, int argc, char *
         params.algorithm = 7;
       } else if (0 == Test::string_compare_no_case(argv[i], "COLORING_VBDBIT")) {
         params.algorithm = 8;
+      } else if (0 == Test::string_compare_no_case(argv[i], "COLORING_VBH")) {
+        params.algorithm = 9;
+      } else if (0 == Test::string_compare_no_case(argv[i], "COLORING_BALANCED")) {
+        params.algorithm = 10;
       } else if (0 == Test::string_compare_no_case(argv[i], "--help") ||
                  0 == Test::string_compare_no_case(argv[i], "-h")) {
         print_options(std::cout, argv[0]);
@@ -312,6 +324,10 @@ void run_experiment(crsGraph_t crsGraph, int num_cols, Parameters params) {
 
       case 8: kh.create_graph_coloring_handle(COLORING_VBDBIT); break;
 
+      case 9: kh.create_graph_coloring_handle(COLORING_VBH); break;
+
+      case 10: kh.create_graph_coloring_handle(COLORING_BALANCED); break;
+
       default: kh.create_graph_coloring_handle(COLORING_DEFAULT);
     }
 
@@ -16,6 +16,7 @@
 #include <iostream>
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosGraph_Triangle.hpp"
+#include "KokkosGraph_TriangleCount.hpp"
 #include "KokkosSparse_StaticCrsGraph.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_IOUtils.hpp"  //for read_kokkos_crst_graph
@@ -79,6 +80,7 @@ void print_options() {
   //    << std::endl;
   std::cerr << "\tTRIANGLELL: Lower x Lower -- usually fastest " << std::endl;
   std::cerr << "\tTRIANGLELU: Lower x Upper -- usually 2nd fastest " << std::endl;
+  std::cerr << "\tTRIANGLEORIENTED: degree-oriented intersection, without SpGEMM" << std::endl;
   std::cerr << "--FLOP                               : Calculate and print the "
                "number of operations. This will be calculated on the first run."
             << std::endl;
@@ -212,6 +214,8 @@ int parse_inputs(KokkosKernels::Experiment::Parameters &params, int argc, char *
         params.algorithm = 19;
       } else if (0 == Test::string_compare_no_case(argv[i], "TRIANGLELU")) {
         params.algorithm = 20;
+      } else if (0 == Test::string_compare_no_case(argv[i], "TRIANGLEORIENTED")) {
+        params.algorithm = 21;
       } else {
         std::cerr << "2-Unrecognized command line argument #" << i << ": " << argv[i] << std::endl;
         print_options();
@@ -286,6 +290,18 @@ void run_experiment(int argc, char **argv, perf_test::CommonInputParams) {
   }
   const lno_t m = crsGraph.numRows();
 
+  if (algorithm == 21) {
+    for (int i = 0; i < repeat; ++i) {
+      Kokkos::Timer timer1;
+      size_t num_triangles =
+          KokkosGraph::Experimental::graph_triangle_count<device_t>(crsGraph.row_map, crsGraph.entries);
+      double count_time = timer1.seconds();
+      std::cout << "num_triangles:" << num_triangles << std::endl;
+      std::cout << "mm_time:" << count_time << std::endl;
+    }
+    return;
+  }
+
   for (int i = 0; i < repeat; ++i) {
     size_type rowmap_size = crsGraph.entries.extent(0);
     switch (algorithm) {
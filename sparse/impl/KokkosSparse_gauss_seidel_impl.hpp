@@ -786,11 +786,14 @@ class PointGaussSeidel {
 #endif
     if (longRowThreshold > 0) {
       // Count long rows per color set, and sort color sets so that long rows
-      // come after regular rows
-      nnz_lno_persistent_work_view_t long_rows_per_color(
-          Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing, "long_rows_per_color"), numColors);
-      nnz_lno_persistent_work_view_t max_row_length_per_color(
-          Kokkos::view_alloc(my_exec_space, Kokkos::WithoutInitializing, "max_row_length_per_color"), numColors);
+      // come after regular rows. The counts are copied to the host, so they
+      // come from the handle's workspace arena when it is enabled.
+      auto *workspace = gsHandle->get_workspace_arena();
+      typename HandleType::GaussSeidelHandleType::workspace_arena_t::Scope workspace_scope(workspace, my_exec_space);
+      auto long_rows_per_color = KokkosKernels::Impl::make_workspace_view<nnz_lno_persistent_work_view_t>(
+          my_exec_space, workspace, "long_rows_per_color", numColors);
+      auto max_row_length_per_color = KokkosKernels::Impl::make_workspace_view<nnz_lno_persistent_work_view_t>(
+          my_exec_space, workspace, "max_row_length_per_color", numColors);
       nnz_lno_t mostLongRowsInColor = 0;
       SortIntoLongRowsFunctor sortIntoLongRowsFunctor(xadj, longRowThreshold, color_xadj, color_adj,
                                                       long_rows_per_color, max_row_length_per_color);
@@ -751,12 +751,20 @@ struct IlutWrap {
     kh.create_spadd_handle(true /*we expect inputs to be sorted*/);
 
     //
-    // temporary workspaces and scalars
+    // temporary workspaces and scalars. The row maps have a fixed size, so
+    // they come from the handle's workspace arena when it is enabled.
     //
-    HandleDeviceRowMapType LU_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "LU_row_map"), nrows + 1),
-        L_new_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "L_new_row_map"), nrows + 1),
-        U_new_row_map(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U_new_row_map"), nrows + 1),
-        Ut_new_row_map("Ut_new_row_map", nrows + 1);
+    auto* workspace = thandle.get_workspace_arena();
+    typename IlutHandle::workspace_arena_t::Scope workspace_scope(workspace);
+    auto make_row_map = [&](const char* label) {
+      return KokkosKernels::Impl::make_workspace_view<HandleDeviceRowMapType>(execution_space(), workspace, label,
+                                                                              nrows + 1);
+    };
+    HandleDeviceRowMapType LU_row_map     = make_row_map("LU_row_map");
+    HandleDeviceRowMapType L_new_row_map  = make_row_map("L_new_row_map");
+    HandleDeviceRowMapType U_new_row_map  = make_row_map("U_new_row_map");
+    HandleDeviceRowMapType Ut_new_row_map = make_row_map("Ut_new_row_map");
+    Kokkos::deep_copy(Ut_new_row_map, size_type(0));
 
     HandleDeviceRowMapType R_row_map;
     HandleDeviceEntriesType LU_entries, L_new_entries, U_new_entries, Ut_new_entries, R_entries;
@@ -319,9 +319,9 @@ Kokkos::View<typename Rowmap::non_const_value_type*, ExecSpace> computeEntryPerm
   return permutation;
 }
 
-// Heuristic for choosing bulk sorting algorithm
-template <typename ExecSpace, typename Ordinal>
-bool useBulkSortHeuristic(Ordinal avgDeg, Ordinal maxDeg) {
+// Whether Kokkos::Experimental::sort_by_key is worth using on ExecSpace.
+template <typename ExecSpace>
+constexpr bool hasFastSortByKey() {
   // Issue 2352: the KokkosSparse::sort_crs_matrix uses Kokkos::Experimental::sort_by_key when this returns true.
   // sort_by_key executes on the host when a thrust-like library is not available, which really kills the performance in
   // a scenario where the bulk sort algorithm would otherwise be appropriate. Additionally, On MI300A, sorting via
@@ -337,17 +337,22 @@ bool useBulkSortHeuristic(Ordinal avgDeg, Ordinal maxDeg) {
     (defined(KOKKOS_ENABLE_HIP) && defined(KOKKOS_ARCH_AMD_GFX942))
     return false;
 #else
-    // Use bulk sort if matrix is highly imbalanced,
-    // OR the longest rows have many entries.
-    return (maxDeg / 10 > avgDeg) || (maxDeg > 1024);
+    return true;
 #endif
   } else {
-    // Use bulk sort if matrix is highly imbalanced,
-    // OR the longest rows have many entries.
-    return (maxDeg / 10 > avgDeg) || (maxDeg > 1024);
+    return true;
   }
 }
 
+// Heuristic for choosing bulk sorting algorithm
+template <typename ExecSpace, typename Ordinal>
+bool useBulkSortHeuristic(Ordinal avgDeg, Ordinal maxDeg) {
+  if (!hasFastSortByKey<ExecSpace>()) return false;
+  // Use bulk sort if matrix is highly imbalanced,
+  // OR the longest rows have many entries.
+  return (maxDeg / 10 > avgDeg) || (maxDeg > 1024);
+}
+
 template <typename ExecSpace, typename Permutation, typename InView, typename OutView>
 void applyPermutation(const ExecSpace& exec, const Permutation& permutation, const InView& in, const OutView& out) {
   Kokkos::parallel_for(
@@ -371,6 +376,260 @@ void applyPermutationBlockValues(const ExecSpace& exec, const Permutation& permu
       });
 }
 
+// Row length bins of the binned matrix sort (SortAlgorithm::BINNED): rows of
+// at most networkRowLength entries are sorted by one thread with a sorting
+// network, rows of at most longRowLength entries by one team, and the
+// remaining (long) rows together by one device-wide segmented radix sort.
+struct BinnedSortThresholds {
+  static constexpr int networkRowLength = 16;
+  static constexpr int longRowLength    = 4096;
+};
+
+// Sort the rows of at most N = networkRowLength entries with a bitonic
+// network, one thread per row. The row is staged in the thread's slice of
+// team scratch, padded to N slots with the largest Ordinal (columns are
+// smaller), and each of the network's stages is N/2 independent, branch-free
+// compare-exchanges over the vector lanes of the thread.
+template <typename ExecSpace, typename rowmap_t, typename entries_t, typename values_t>
+struct MatrixNetworkSortFunctor {
+  static constexpr int N = BinnedSortThresholds::networkRowLength;
+
+  using Offset        = typename rowmap_t::non_const_value_type;
+  using Ordinal       = typename entries_t::non_const_value_type;
+  using Scalar        = typename values_t::non_const_value_type;
+  using Policy        = Kokkos::TeamPolicy<ExecSpace>;
+  using member_type   = typename Policy::member_type;
+  using scratch_space = typename ExecSpace::scratch_memory_space;
+  using ScratchKeys   = Kokkos::View<Ordinal**, Kokkos::LayoutRight, scratch_space, Kokkos::MemoryUnmanaged>;
+  using ScratchValues = Kokkos::View<Scalar**, Kokkos::LayoutRight, scratch_space, Kokkos::MemoryUnmanaged>;
+
+  // One lane per compare-exchange of a stage on GPUs
+  static constexpr int vectorLength = KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace> ? N / 2 : 1;
+  static constexpr int teamSize     = KokkosKernels::Impl::is_gpu_exec_space_v<ExecSpace> ? 32 : 1;
+
+  MatrixNetworkSortFunctor(Ordinal numRows_, const rowmap_t& rowmap_, const entries_t& entries_,
+                           const values_t& values_)
+      : numRows(numRows_), rowmap(rowmap_), entries(entries_), values(values_) {}
+
+  static size_t scratchSize(int teamSize_) {
+    return ScratchKeys::shmem_size(teamSize_, N) + ScratchValues::shmem_size(teamSize_, N);
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& t) const {
+    ScratchKeys k(t.team_scratch(0), t.team_size(), N);
+    ScratchValues v(t.team_scratch(0), t.team_size(), N);
+    const int r     = t.team_rank();
+    const Ordinal i = t.league_rank() * t.team_size() + r;
+    if (i >= numRows) return;
+    const Offset rowStart = rowmap(i);
+    const int rowNum      = rowmap(i + 1) - rowStart;
+    if (rowNum < 2 || rowNum > N) return;
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, N), [&](int j) {
+      k(r, j) = j < rowNum ? entries(rowStart + j) : Kokkos::Experimental::finite_max_v<Ordinal>;
+      v(r, j) = j < rowNum ? values(rowStart + j) : Scalar();
+    });
+    for (int size = 2; size <= N; size *= 2) {
+      for (int stride = size / 2; stride > 0; stride /= 2) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, N / 2), [&](int j) {
+          // the j-th pair (l, l + stride) of the stage; slot a must not come
+          // after slot b
+          const int l      = (j / stride) * 2 * stride + j % stride;
+          const int a      = (l & size) ? l + stride : l;
+          const int b      = (l & size) ? l : l + stride;
+          const Ordinal ka = k(r, a), kb = k(r, b);
+          const Scalar va  = v(r, a), vb = v(r, b);
+          const bool swap  = kb < ka;
+          k(r, a)          = swap ? kb : ka;
+          k(r, b)          = swap ? ka : kb;
+          v(r, a)          = swap ? vb : va;
+          v(r, b)          = swap ? va : vb;
+        });
+      }
+    }
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, rowNum), [&](int j) {
+      entries(rowStart + j) = k(r, j);
+      values(rowStart + j)  = v(r, j);
+    });
+  }
+
+  Ordinal numRows;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+};
+
+// Number of rows in the team-sorted and the long bins
+template <typename Ordinal>
+struct SortBinCounts {
+  Ordinal team     = 0;
+  Ordinal longRows = 0;
+
+  KOKKOS_INLINE_FUNCTION SortBinCounts& operator+=(const SortBinCounts& other) {
+    team += other.team;
+    longRows += other.longRows;
+    return *this;
+  }
+};
+
+// Compact the rows of the team and long bins, in row order
+template <typename rowmap_t, typename rows_t>
+struct SortBinRowsFunctor {
+  using Ordinal    = typename rows_t::non_const_value_type;
+  using value_type = SortBinCounts<Ordinal>;
+
+  SortBinRowsFunctor(const rowmap_t& rowmap_, const rows_t& teamRows_, const rows_t& longRows_)
+      : rowmap(rowmap_), teamRows(teamRows_), longRows(longRows_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(Ordinal i, value_type& update, const bool final) const {
+    const auto rowNum = rowmap(i + 1) - rowmap(i);
+    if (rowNum > BinnedSortThresholds::longRowLength) {
+      if (final) longRows(update.longRows) = i;
+      update.longRows++;
+    } else if (rowNum > BinnedSortThresholds::networkRowLength) {
+      if (final) teamRows(update.team) = i;
+      update.team++;
+    }
+  }
+
+  rowmap_t rowmap;
+  rows_t teamRows;
+  rows_t longRows;
+};
+
+template <typename Policy, typename rows_t, typename rowmap_t, typename entries_t, typename values_t>
+struct MatrixTeamSortFunctor {
+  using Offset = typename rowmap_t::non_const_value_type;
+
+  MatrixTeamSortFunctor(const rows_t& rows_, const rowmap_t& rowmap_, const entries_t& entries_,
+                        const values_t& values_)
+      : rows(rows_), rowmap(rowmap_), entries(entries_), values(values_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const typename Policy::member_type& t) const {
+    const auto i          = rows(t.league_rank());
+    const Offset rowStart = rowmap(i);
+    const Offset rowEnd   = rowmap(i + 1);
+    Kokkos::Experimental::sort_by_key_team(t, Kokkos::subview(entries, Kokkos::make_pair(rowStart, rowEnd)),
+                                           Kokkos::subview(values, Kokkos::make_pair(rowStart, rowEnd)));
+  }
+
+  rows_t rows;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+};
+
+// Copy the long rows to (or back from) contiguous storage, where they are
+// sorted all at once by a segmented radix sort. Columns are nonnegative, so
+// their unsigned keys sort in the same order.
+template <typename Policy, typename rows_t, typename rowmap_t, typename entries_t, typename values_t,
+          typename long_rowmap_t>
+struct LongRowsCopyFunctor {
+  using Offset  = typename rowmap_t::non_const_value_type;
+  using Ordinal = typename entries_t::non_const_value_type;
+  using Keys    = Kokkos::View<std::make_unsigned_t<Ordinal>*, typename long_rowmap_t::device_type>;
+  using Values  = Kokkos::View<typename values_t::non_const_value_type*, typename long_rowmap_t::device_type>;
+
+  struct GatherTag {};
+  struct ScatterTag {};
+
+  LongRowsCopyFunctor(const rows_t& rows_, const rowmap_t& rowmap_, const entries_t& entries_,
+                      const values_t& values_, const long_rowmap_t& longRowmap_, const Keys& longKeys_,
+                      const Values& longValues_)
+      : rows(rows_),
+        rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        longRowmap(longRowmap_),
+        longKeys(longKeys_),
+        longValues(longValues_) {}
+
+  KOKKOS_INLINE_FUNCTION void operator()(const GatherTag&, const typename Policy::member_type& t) const {
+    const Ordinal r       = t.league_rank();
+    const Offset rowStart = rowmap(rows(r));
+    const Offset longBase = longRowmap(r);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, longRowmap(r + 1) - longBase), [&](Offset k) {
+      longKeys(longBase + k)   = entries(rowStart + k);
+      longValues(longBase + k) = values(rowStart + k);
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const ScatterTag&, const typename Policy::member_type& t) const {
+    const Ordinal r       = t.league_rank();
+    const Offset rowStart = rowmap(rows(r));
+    const Offset longBase = longRowmap(r);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, longRowmap(r + 1) - longBase), [&](Offset k) {
+      entries(rowStart + k) = longKeys(longBase + k);
+      values(rowStart + k)  = longValues(longBase + k);
+    });
+  }
+
+  rows_t rows;
+  rowmap_t rowmap;
+  entries_t entries;
+  values_t values;
+  long_rowmap_t longRowmap;
+  Keys longKeys;
+  Values longValues;
+};
+
+// Sort the rows of a CRS matrix binned by length, so that a few very long
+// rows do not serialize the sort (see BinnedSortThresholds).
+template <typename ExecSpace, typename rowmap_t, typename entries_t, typename values_t>
+void sortCrsMatrixBinned(const ExecSpace& exec, const rowmap_t& rowmap, const entries_t& entries,
+                         const values_t& values) {
+  using Offset    = typename rowmap_t::non_const_value_type;
+  using Ordinal   = typename entries_t::non_const_value_type;
+  using TeamPol   = Kokkos::TeamPolicy<ExecSpace>;
+  using rows_t    = Kokkos::View<Ordinal*, ExecSpace>;
+  using BinCounts = SortBinCounts<Ordinal>;
+  Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+  if (numRows == 0) return;
+
+  // Short rows: sorting networks, one thread per row
+  using NetworkSort = MatrixNetworkSortFunctor<ExecSpace, rowmap_t, entries_t, values_t>;
+  Kokkos::parallel_for("sort_crs_matrix[binned,network]",
+                       TeamPol(exec, (numRows + NetworkSort::teamSize - 1) / NetworkSort::teamSize,
+                               NetworkSort::teamSize, NetworkSort::vectorLength)
+                           .set_scratch_size(0, Kokkos::PerTeam(NetworkSort::scratchSize(NetworkSort::teamSize))),
+                       NetworkSort(numRows, rowmap, entries, values));
+
+  rows_t teamRows(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "team sorted rows"), numRows);
+  rows_t longRows(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "long rows"), numRows);
+  BinCounts counts;
+  Kokkos::parallel_scan("sort_crs_matrix[binned,bins]", Kokkos::RangePolicy<ExecSpace>(exec, 0, numRows),
+                        SortBinRowsFunctor<rowmap_t, rows_t>(rowmap, teamRows, longRows), counts);
+
+  // Medium rows: one team per row
+  if (counts.team) {
+    Kokkos::parallel_for("sort_crs_matrix[binned,team]", TeamPol(exec, counts.team, Kokkos::AUTO),
+                         MatrixTeamSortFunctor<TeamPol, rows_t, rowmap_t, entries_t, values_t>(teamRows, rowmap,
+                                                                                               entries, values));
+  }
+  if (counts.longRows == 0) return;
+
+  // Long rows: one device-wide segmented radix sort of all their entries
+  using long_rowmap_t = Kokkos::View<Offset*, ExecSpace>;
+  using Copy          = LongRowsCopyFunctor<TeamPol, rows_t, rowmap_t, entries_t, values_t, long_rowmap_t>;
+  using Gather        = Kokkos::TeamPolicy<ExecSpace, typename Copy::GatherTag>;
+  using Scatter       = Kokkos::TeamPolicy<ExecSpace, typename Copy::ScatterTag>;
+
+  const Ordinal numLong = counts.longRows;
+  long_rowmap_t longRowmap("long rows rowmap", numLong + 1);
+  Kokkos::parallel_for(
+      "sort_crs_matrix[binned,long lengths]", Kokkos::RangePolicy<ExecSpace>(exec, 0, numLong),
+      KOKKOS_LAMBDA(Ordinal r) { longRowmap(r) = rowmap(longRows(r) + 1) - rowmap(longRows(r)); });
+  Offset longNNZ = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, numLong + 1, longRowmap, longNNZ);
+
+  typename Copy::Keys longKeys(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "long rows entries"), longNNZ);
+  typename Copy::Values longValues(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "long rows values"),
+                                   longNNZ);
+  Copy copy(longRows, rowmap, entries, values, longRowmap, longKeys, longValues);
+  Kokkos::parallel_for("sort_crs_matrix[binned,long gather]", Gather(exec, numLong, Kokkos::AUTO), copy);
+  KokkosKernels::segmentedRadixSortByKey(exec, longRowmap, longKeys, longValues);
+  Kokkos::parallel_for("sort_crs_matrix[binned,long scatter]", Scatter(exec, numLong, Kokkos::AUTO), copy);
+}
+
 }  // namespace Impl
 }  // namespace KokkosSparse
 
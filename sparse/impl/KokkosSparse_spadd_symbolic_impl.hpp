@@ -200,24 +200,18 @@ struct SortedCountEntriesTeam {
 };
 
 // get upper bound for C entries per row (assumes worst case, that entries in A
-// and B on each row are disjoint)
-template <typename size_type, typename ordinal_type, typename ARowPtrsT, typename BRowPtrsT, typename CRowPtrsT>
+// and B on each row are disjoint). Counted and scanned into the C rowmap upper
+// bound by a single kernel (kk_single_pass_exclusive_scan).
+template <typename size_type, typename ARowPtrsT, typename BRowPtrsT>
 struct UnsortedEntriesUpperBound {
-  UnsortedEntriesUpperBound(ordinal_type nrows_, const typename ARowPtrsT::const_type& Arowptrs_,
-                            const typename BRowPtrsT::const_type& Browptrs_, const CRowPtrsT& Crowcounts_)
-      : nrows(nrows_), Arowptrs(Arowptrs_), Browptrs(Browptrs_), Crowcounts(Crowcounts_) {}
-  KOKKOS_INLINE_FUNCTION void operator()(const ordinal_type i) const {
-    Crowcounts(i) = (Arowptrs(i + 1) - Arowptrs(i)) + (Browptrs(i + 1) - Browptrs(i));
-    if (i == nrows - 1) {
-      // last workitem also zeros the one-past-end entry of row counts, so
-      // that prefix sum is correct
-      Crowcounts(nrows) = 0;
-    }
+  UnsortedEntriesUpperBound(const typename ARowPtrsT::const_type& Arowptrs_,
+                            const typename BRowPtrsT::const_type& Browptrs_)
+      : Arowptrs(Arowptrs_), Browptrs(Browptrs_) {}
+  KOKKOS_INLINE_FUNCTION size_type operator()(const size_t i) const {
+    return (Arowptrs(i + 1) - Arowptrs(i)) + (Browptrs(i + 1) - Browptrs(i));
   }
-  ordinal_type nrows;
   const typename ARowPtrsT::const_type Arowptrs;
   const typename BRowPtrsT::const_type Browptrs;
-  CRowPtrsT Crowcounts;
 };
 
 // Unsorted symbolic: new functors:
@@ -454,23 +448,21 @@ void spadd_symbolic_impl(const execution_space& exec, KernelHandle* handle, cons
     KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(exec, nrows + 1, c_rowmap);
   } else {
     // note: scoping individual parts of the process to free views sooner,
-    // minimizing peak memory usage run the unsorted c_rowmap upper bound
-    // functor (just adds together A and B entry counts row by row)
-    offset_view_t c_rowmap_upperbound(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "C row counts upper bound"),
-                                      nrows + 1);
-    size_type c_nnz_upperbound = 0;
-    {
-      UnsortedEntriesUpperBound<size_type, ordinal_type, alno_row_view_t_, blno_row_view_t_, offset_view_t>
-          countEntries(nrows, a_rowmap, b_rowmap, c_rowmap_upperbound);
-      Kokkos::parallel_for("KokkosSparse::SpAdd:Symbolic::InputNotSorted::CountEntries", range_type(exec, 0, nrows),
-                           countEntries);
-      KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<execution_space>(exec, nrows + 1, c_rowmap_upperbound,
-                                                                             c_nnz_upperbound);
-    }
-    ordinal_view_t c_entries_uncompressed(
-        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "C entries uncompressed"), c_nnz_upperbound);
-    ordinal_view_t ab_perm(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "A and B permuted entry indices"),
-                           c_nnz_upperbound);
+    // minimizing peak memory usage. Count (just adds together A and B entry
+    // counts row by row) and scan the unsorted c_rowmap upper bound.
+    // The temporaries come from the handle's workspace arena when it is enabled.
+    auto* workspace = addHandle->get_workspace_arena();
+    typename KernelHandle::SPADDHandleType::workspace_arena_t::Scope workspace_scope(workspace, exec);
+    auto c_rowmap_upperbound = KokkosKernels::Impl::make_workspace_view<offset_view_t>(
+        exec, workspace, "C row counts upper bound", nrows + 1);
+    const size_type c_nnz_upperbound = KokkosKernels::Impl::kk_single_pass_exclusive_scan(
+        exec, nrows, UnsortedEntriesUpperBound<size_type, alno_row_view_t_, blno_row_view_t_>(a_rowmap, b_rowmap),
+        c_rowmap_upperbound);
+    auto c_entries_uncompressed = KokkosKernels::Impl::make_workspace_view<ordinal_view_t>(
+        exec, workspace, "C entries uncompressed", c_nnz_upperbound);
+    auto ab_perm = KokkosKernels::Impl::make_workspace_view<ordinal_view_t>(exec, workspace,
+                                                                            "A and B permuted entry indices",
+                                                                            c_nnz_upperbound);
     // compute the unmerged sum
     UnmergedSumFunctor<size_type, ordinal_type, alno_row_view_t_, blno_row_view_t_, offset_view_t, alno_nnz_view_t_,
                        blno_nnz_view_t_, ordinal_view_t>
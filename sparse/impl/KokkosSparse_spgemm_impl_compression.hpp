@@ -650,6 +650,9 @@ bool KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
   // get the execution space type.
   KokkosKernels::Impl::ExecSpaceType lcl_my_exec_space = this->handle->get_handle_exec_space();
   constexpr bool exec_gpu                              = KokkosKernels::Impl::is_gpu_exec_space_v<MyExecSpace>;
+  // the accumulator pools come from the handle's workspace arena when it is enabled
+  auto *workspace = this->handle->get_workspace_arena();
+  typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
   // get the suggested vectorlane size based on the execution space, and average
   // number of nnzs per row.
   int suggested_vector_size = this->handle->get_suggested_vector_size(n, nnz);
@@ -747,7 +750,7 @@ bool KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
       std::cout << "\t\tPool Alloc MB:" << (sizeof(nnz_lno_t) * num_chunks * chunksize) / 1024. / 1024. << std::endl;
     }
     nnz_lno_t pool_init_val = -1;
-    pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
+    pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type, workspace);
     MyExecSpace().fence();
     sszm_compressMatrix.memory_space = m_space;
 #endif
@@ -784,7 +787,7 @@ bool KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
                     << std::endl;
         }
         nnz_lno_t pool_init_val = -1;
-        pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
+        pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type, workspace);
         MyExecSpace().fence();
         sszm_compressMatrix.memory_space = m_space;
       }
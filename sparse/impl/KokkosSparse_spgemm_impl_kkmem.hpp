@@ -72,6 +72,12 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
   nnz_lno_t max_first_level_hash_size;
   row_lno_persistent_work_view_t flops_per_row;
 
+  // When set (SPGEMM_KK_MEMORY_BIGSPREADTEAM only), the rows that overflow
+  // shmem take second level hashmaps sized for their own c_row_size from this
+  // arena, instead of worst-case chunks from memory_space.
+  using spill_arena_t = KokkosKernels::Experimental::HashmapArena<MyTempMemorySpace>;
+  spill_arena_t spill_arena;
+
   PortableNumericCHASH(nnz_lno_t m_, a_row_view_t row_mapA_, a_nnz_view_t entriesA_, a_scalar_view_t valuesA_,
 
                        b_row_view_t row_mapB_, b_nnz_view_t entriesB_, b_scalar_view_t valuesB_,
@@ -182,6 +188,39 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
     }
   }
 
+  // pow2 hash size of a second level hashmap holding c_row_size keys at
+  // most half full
+  KOKKOS_INLINE_FUNCTION
+  static nnz_lno_t spill_hash_size(const nnz_lno_t c_row_size, const int vector_size_) {
+    nnz_lno_t hash_size = vector_size_;
+    while (hash_size < 2 * c_row_size) hash_size *= 2;
+    return hash_size;
+  }
+
+  // keys, padding and values of a second level hashmap
+  KOKKOS_INLINE_FUNCTION
+  static size_t spill_table_bytes(const nnz_lno_t hash_size) {
+    return hash_size * sizeof(nnz_lno_t) + alignof(scalar_t) + hash_size * sizeof(scalar_t);
+  }
+
+  // Bytes of spill_arena needed by all the rows that overflow shmem
+  size_t spill_arena_bytes() const {
+    const c_row_view_t rowmap = rowmapC;
+    const nnz_lno_t cut_off   = max_first_level_hash_size;
+    const int vec_size        = vector_size;
+    size_t bytes              = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spgemm_numeric::spill_arena_bytes", Kokkos::RangePolicy<MyExecSpace>(0, numrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i, size_t &sum) {
+          const nnz_lno_t c_row_size = rowmap(i + 1) - rowmap(i);
+          if (c_row_size > cut_off) {
+            sum += spill_arena_t::alignment + spill_table_bytes(spill_hash_size(c_row_size, vec_size));
+          }
+        },
+        bytes);
+    return bytes;
+  }
+
   KOKKOS_INLINE_FUNCTION
   size_t get_thread_id(const size_t row_index) const {
     switch (my_exec_space) {
@@ -591,9 +630,24 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
       nnz_lno_t *global_acc_row_keys = c_row;
       scalar_t *global_acc_row_vals  = c_row_vals;
       volatile nnz_lno_t *tmp        = NULL;
+      const bool use_spill_arena     = spill_arena.capacity() > 0;
+      // size of the second level hashmap of this row
+      const nnz_lno_t row_hash_size = use_spill_arena ? spill_hash_size(c_row_size, vector_size) : pow2_hash_size;
+      const nnz_lno_t row_hash_func = row_hash_size - 1;
 
       if (c_row_size > max_first_level_hash_size) {
-        {
+        if (use_spill_arena) {
+          // the arena is sized for exactly the rows that overflow shmem
+          Kokkos::single(
+              Kokkos::PerTeam(teamMember),
+              [&](volatile nnz_lno_t *&memptr) {
+                memptr = (volatile nnz_lno_t *)(spill_arena.allocate(spill_table_bytes(row_hash_size)));
+              },
+              tmp);
+          // if it is exhausted anyway, skip the row: the arena records the
+          // bytes requested, and the host reruns with a large enough arena
+          if (tmp == NULL) continue;
+        } else {
           while (tmp == NULL) {
             Kokkos::single(
                 Kokkos::PerTeam(teamMember),
@@ -602,17 +656,20 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
                 },
                 tmp);
           }
-          global_acc_row_keys = (nnz_lno_t *)(tmp);
-          global_acc_row_vals = KokkosKernels::Impl::alignPtrTo<scalar_t>(tmp + pow2_hash_size);
         }
-        // initialize begins.
+        global_acc_row_keys = (nnz_lno_t *)(tmp);
+        global_acc_row_vals = KokkosKernels::Impl::alignPtrTo<scalar_t>(tmp + row_hash_size);
+        // initialize begins. Pool chunks come with their keys reset to
+        // init_value, arena memory does not.
         {
-          nnz_lno_t num_threads = pow2_hash_size / vector_size;
+          nnz_lno_t num_threads = row_hash_size / vector_size;
           // not needed as team_cuckoo_key_size is always pow2. +
           // (team_cuckoo_key_size & (vector_size - 1)) * 1;
           Kokkos::parallel_for(Kokkos::TeamThreadRange(teamMember, num_threads), [&](nnz_lno_t teamind) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, vector_size),
-                                 [&](nnz_lno_t i) { global_acc_row_vals[teamind * vector_size + i] = 0; });
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, vector_size), [&](nnz_lno_t i) {
+              global_acc_row_vals[teamind * vector_size + i] = 0;
+              if (use_spill_arena) global_acc_row_keys[teamind * vector_size + i] = init_value;
+            });
           });
         }
       }
@@ -727,9 +784,9 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
             }
 
             if (fail) {
-              nnz_lno_t new_hash = (my_b_col * HASHSCALAR) & pow2_hash_func;
+              nnz_lno_t new_hash = (my_b_col * HASHSCALAR) & row_hash_func;
 
-              for (nnz_lno_t trial = new_hash; trial < pow2_hash_size;) {
+              for (nnz_lno_t trial = new_hash; trial < row_hash_size;) {
                 if (global_acc_row_keys[trial] == my_b_col) {
                   Kokkos::atomic_add(global_acc_row_vals + trial, my_b_val);
 
@@ -777,7 +834,7 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
       teamMember.team_barrier();
 
       if (tmp != NULL) {
-        for (nnz_lno_t my_index = vector_shift; my_index < pow2_hash_size; my_index += bs) {
+        for (nnz_lno_t my_index = vector_shift; my_index < row_hash_size; my_index += bs) {
           nnz_lno_t my_b_col = global_acc_row_keys[my_index];
           if (my_b_col != init_value) {
             scalar_t my_b_val = global_acc_row_vals[my_index];
@@ -820,7 +877,9 @@ struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_v
         }
 
         teamMember.team_barrier();
-        Kokkos::single(Kokkos::PerTeam(teamMember), [&]() { memory_space.release_chunk(global_acc_row_keys); });
+        if (!use_spill_arena) {
+          Kokkos::single(Kokkos::PerTeam(teamMember), [&]() { memory_space.release_chunk(global_acc_row_keys); });
+        }
       }
 
       for (nnz_lno_t my_index = vector_shift; my_index < team_cuckoo_key_size; my_index += bs) {
@@ -1364,15 +1423,13 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
     my_pool_type = KokkosKernels::Impl::ManyThread2OneChunk;
   }
 
-  Kokkos::Timer timer1;
-  pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
-  MyExecSpace().fence();
+  // temporaries come from the handle's workspace arena when it is enabled
+  auto *workspace = this->handle->get_workspace_arena();
+  typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
 
-  if (KOKKOSKERNELS_VERBOSE) {
-    m_space.print_memory_pool();
-    std::cout << "\t\tPool Alloc Time:" << timer1.seconds() << std::endl;
-    std::cout << "\t\tPool Size(MB):" << sizeof(nnz_lno_t) * (num_chunks * chunksize) / 1024. / 1024. << std::endl;
-  }
+  Kokkos::Timer timer1;
+  // the pool is allocated below, once it is known to be needed
+  pool_memory_space m_space;
 
   PortableNumericCHASH<const_a_lno_row_view_t, const_a_lno_nnz_view_t, const_a_scalar_nnz_view_t,
                        const_b_lno_row_view_t, const_b_lno_nnz_view_t, const_b_scalar_nnz_view_t, c_row_view_t,
@@ -1386,6 +1443,35 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
 
          lcl_my_exec_space, team_row_chunk_size, first_level_cut_off, flops_per_row, KOKKOSKERNELS_VERBOSE);
 
+  // With SPGEMM_KK_MEMORY_BIGSPREADTEAM, the number of keys of every row is
+  // known, so the rows that overflow shmem can get second level hashmaps of
+  // their own size from an arena. Use it whenever it is smaller than the pool
+  // of worst-case chunks (e.g. for a few long rows among many short ones).
+  bool use_spill_arena = false;
+  if (KokkosKernels::Impl::is_gpu_exec_space_v<MyExecSpace> && algorithm_to_run == SPGEMM_KK_MEMORY_BIGSPREADTEAM) {
+    const size_t arena_bytes = sc.spill_arena_bytes();
+    if (arena_bytes < sizeof(nnz_lno_t) * num_chunks * chunksize) {
+      sc.spill_arena   = typename decltype(sc)::spill_arena_t(KOKKOSKERNELS_MACRO_MAX(arena_bytes, size_t(1)));
+      use_spill_arena = true;
+      if (KOKKOSKERNELS_VERBOSE) {
+        std::cout << "\t\tSpill Arena Size(MB):" << arena_bytes / 1024. / 1024. << std::endl;
+      }
+    }
+  }
+  if (!use_spill_arena) {
+    sc.memory_space = pool_memory_space(num_chunks, chunksize, -1, my_pool_type, workspace);
+  }
+  MyExecSpace().fence();
+
+  if (KOKKOSKERNELS_VERBOSE) {
+    sc.memory_space.print_memory_pool();
+    std::cout << "\t\tPool Alloc Time:" << timer1.seconds() << std::endl;
+    if (!use_spill_arena) {
+      std::cout << "\t\tPool Size(MB):" << sizeof(nnz_lno_t) * (num_chunks * chunksize) / 1024. / 1024.
+                << std::endl;
+    }
+  }
+
   if (KOKKOSKERNELS_VERBOSE) {
     std::cout << "\t\tvector_size:" << suggested_vector_size << " chunk_size:" << team_row_chunk_size
               << " suggested_team_size:" << suggested_team_size << std::endl;
@@ -1423,6 +1509,23 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
       Kokkos::parallel_for(
           "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_BIGSPREADTEAM",
           gpu_team_policy6_t(a_row_cnt / team_row_chunk_size + 1, suggested_team_size, suggested_vector_size), sc);
+      // Rows whose hashmap did not fit in the spill arena were skipped.
+      // requested() is what all the rows needed, so one rerun with an arena
+      // of that size computes every row.
+      if (use_spill_arena) {
+        const size_t requested = sc.spill_arena.requested();
+        if (requested > sc.spill_arena.capacity()) {
+          if (KOKKOSKERNELS_VERBOSE) {
+            std::cout << "\t\tSpill Arena exhausted, rerunning with Size(MB):" << requested / 1024. / 1024.
+                      << std::endl;
+          }
+          sc.spill_arena = typename decltype(sc)::spill_arena_t(requested);
+          Kokkos::parallel_for(
+              "KOKKOSPARSE::SPGEMM::SPGEMM_KK_MEMORY_BIGSPREADTEAM",
+              gpu_team_policy6_t(a_row_cnt / team_row_chunk_size + 1, suggested_team_size, suggested_vector_size),
+              sc);
+        }
+      }
     } else {
       if (team_shmem_key_size <= 0) {
         std::cout << "KokkosSPGEMM_numeric_hash SPGEMM_KK_MEMORY: Insufficient shmem "
@@ -1522,8 +1625,11 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
     my_pool_type = KokkosKernels::Impl::ManyThread2OneChunk;
   }
 
+  auto *workspace = this->handle->get_workspace_arena();
+  typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
+
   Kokkos::Timer timer1;
-  pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
+  pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type, workspace);
   MyExecSpace().fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -473,8 +473,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
     KokkosKernels::Impl::PoolType my_pool_type = KokkosKernels::Impl::OneThread2OneChunk;
     int num_chunks                             = concurrency;
 
+    auto *workspace = this->handle->get_workspace_arena();
+    typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
+
     Kokkos::Timer timer1;
-    pool_memory_space m_space(num_chunks, this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1, 0, my_pool_type);
+    pool_memory_space m_space(num_chunks, this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1, 0, my_pool_type,
+                              workspace);
     MyExecSpace().fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
@@ -1432,8 +1432,11 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
     std::cout << "\tPool Size (MB):" << (num_chunks * chunksize * sizeof(nnz_lno_t)) / 1024. / 1024.
               << " num_chunks:" << num_chunks << " chunksize:" << chunksize << std::endl;
   }
+  auto *workspace = this->handle->get_workspace_arena();
+  typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
+
   Kokkos::Timer timer1;
-  pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
+  pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type, workspace);
   MyExecSpace().fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -1708,8 +1711,11 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_, a_scalar_nnz_vie
     std::cout << "\tPool Size (MB):" << (num_chunks * chunksize * sizeof(nnz_lno_t)) / 1024. / 1024.
               << " num_chunks:" << num_chunks << " chunksize:" << chunksize << std::endl;
   }
+  auto *workspace = this->handle->get_workspace_arena();
+  typename HandleType::workspace_arena_t::Scope workspace_scope(workspace);
+
   Kokkos::Timer timer1;
-  pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type);
+  pool_memory_space m_space(num_chunks, chunksize, pool_init_val, my_pool_type, workspace);
   MyExecSpace().fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
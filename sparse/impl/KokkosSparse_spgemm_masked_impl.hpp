@@ -0,0 +1,344 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
+
+/// \file KokkosSparse_spgemm_masked_impl.hpp
+/// \brief Implementation of the masked, diagonally scaled SpGEMM
+///   C<M> = alpha * A * diag(d) * B.
+///
+/// Every output row is handled by one team. The columns of the mask row are
+/// inserted into a team-scratch HashmapAccumulator, keyed by column and
+/// indexed by their position within the row; the products a_ik * d_k * b_kj
+/// are then only accumulated when column j is found in the map, so work and
+/// memory outside the mask are never spent.
+
+#include <sstream>
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_HashmapAccumulator.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_Utils.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+template <class AMatrix, class BMatrix>
+void check_spgemm_masked_dims(const AMatrix& A, const BMatrix& B, const size_t cRows, const size_t cCols,
+                              const char* where) {
+  if (size_t(A.numCols()) != size_t(B.numRows()) || size_t(A.numRows()) != cRows ||
+      size_t(B.numCols()) != cCols) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << where << ": Dimensions do not match: A: " << A.numRows() << " x " << A.numCols()
+       << ", B: " << B.numRows() << " x " << B.numCols() << ", C/M: " << cRows << " x " << cCols;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+template <class ExecSpace, class ARowMap, class AEntries, class BRowMap, class BEntries, class MRowMap,
+          class MEntries, class AccumType>
+struct SpgemmMaskedBase {
+  using execution_space = ExecSpace;
+  using team_policy_t   = Kokkos::TeamPolicy<execution_space>;
+  using member_t        = typename team_policy_t::member_type;
+  using scratch_space   = typename execution_space::scratch_memory_space;
+  using lno_t           = typename AEntries::non_const_value_type;
+  using size_type       = typename ARowMap::non_const_value_type;
+  using accum_t         = AccumType;
+
+  using lno_scratch_t   = Kokkos::View<lno_t *, scratch_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using accum_scratch_t = Kokkos::View<accum_t *, scratch_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using hashmap_t =
+      KokkosKernels::Experimental::HashmapAccumulator<lno_t, lno_t, accum_t,
+                                                      KokkosKernels::Experimental::HashOpType::pow2Modulo>;
+
+  ARowMap a_rowmap;
+  AEntries a_entries;
+  BRowMap b_rowmap;
+  BEntries b_entries;
+  MRowMap m_rowmap;
+  MEntries m_entries;
+  lno_t max_mask_row;  // longest mask row
+  lno_t hash_size;     // power of 2 >= max_mask_row
+  int scratch_level;
+
+  SpgemmMaskedBase(const ARowMap &a_rowmap_, const AEntries &a_entries_, const BRowMap &b_rowmap_,
+                   const BEntries &b_entries_, const MRowMap &m_rowmap_, const MEntries &m_entries_,
+                   const lno_t max_mask_row_)
+      : a_rowmap(a_rowmap_),
+        a_entries(a_entries_),
+        b_rowmap(b_rowmap_),
+        b_entries(b_entries_),
+        m_rowmap(m_rowmap_),
+        m_entries(m_entries_),
+        max_mask_row(max_mask_row_),
+        hash_size(1),
+        scratch_level(0) {
+    while (hash_size < max_mask_row) hash_size *= 2;
+    scratch_level = (scratch_size() <= size_t(team_policy_t::scratch_size_max(0))) ? 0 : 1;
+  }
+
+  // hash_begins, hash_nexts, keys and values of the row accumulator
+  size_t scratch_size() const {
+    return 2 * lno_scratch_t::shmem_size(max_mask_row) + lno_scratch_t::shmem_size(hash_size) +
+           accum_scratch_t::shmem_size(max_mask_row);
+  }
+
+  team_policy_t policy(const execution_space &space, const lno_t num_rows, const size_type nnz) const {
+    const int vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        num_rows, nnz, KokkosKernels::Impl::kk_get_exec_space_type<execution_space>());
+    return team_policy_t(space, num_rows, Kokkos::AUTO, vector_size)
+        .set_scratch_size(scratch_level, Kokkos::PerTeam(scratch_size()));
+  }
+
+  // Insert the columns of mask row [m_begin, m_begin + m_len) into a zeroed
+  // accumulator; the key at position p of the row is stored at index p.
+  KOKKOS_INLINE_FUNCTION
+  hashmap_t make_row_accumulator(const member_t &t, const size_type m_begin, const lno_t m_len) const {
+    lno_scratch_t begins(t.team_scratch(scratch_level), hash_size);
+    lno_scratch_t nexts(t.team_scratch(scratch_level), max_mask_row);
+    lno_scratch_t keys(t.team_scratch(scratch_level), max_mask_row);
+    accum_scratch_t values(t.team_scratch(scratch_level), max_mask_row);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, hash_size), [&](const lno_t h) { begins(h) = -1; });
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, m_len), [&](const lno_t p) { values(p) = accum_t(); });
+    t.team_barrier();
+
+    hashmap_t hm(max_mask_row, hash_size, begins.data(), nexts.data(), keys.data(), values.data());
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, m_len),
+                         [&](const lno_t p) { hm.vector_atomic_insert_into_hash_at(m_entries(m_begin + p), p); });
+    t.team_barrier();
+    return hm;
+  }
+
+  // Call f(a_offset, b_offset, p) for every product a_ik * b_kj of row i
+  // whose column j is at position p of the mask row.
+  template <class F>
+  KOKKOS_INLINE_FUNCTION void for_each_masked_product(const member_t &t, const lno_t row, hashmap_t &hm,
+                                                      const F &f) const {
+    const size_type a_begin = a_rowmap(row);
+    const lno_t a_len       = a_rowmap(row + 1) - a_begin;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, a_len), [&](const lno_t ia) {
+      const size_type a_offset = a_begin + ia;
+      const lno_t k            = a_entries(a_offset);
+      const size_type b_begin  = b_rowmap(k);
+      const lno_t b_len        = b_rowmap(k + 1) - b_begin;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, b_len), [&](const lno_t ib) {
+        const lno_t p = hm.find(b_entries(b_begin + ib));
+        if (p != -1) f(a_offset, b_begin + ib, p);
+      });
+    });
+  }
+};
+
+/// \brief Symbolic: for every mask entry, record whether the structure of
+///   A*B hits it, and count the hits of every row.
+template <class ExecSpace, class ARowMap, class AEntries, class BRowMap, class BEntries, class MRowMap,
+          class MEntries, class HitView, class CRowMap>
+struct SpgemmMaskedSymbolicFunctor
+    : public SpgemmMaskedBase<ExecSpace, ARowMap, AEntries, BRowMap, BEntries, MRowMap, MEntries,
+                              typename HitView::non_const_value_type> {
+  using Base = SpgemmMaskedBase<ExecSpace, ARowMap, AEntries, BRowMap, BEntries, MRowMap, MEntries,
+                                typename HitView::non_const_value_type>;
+  using typename Base::lno_t;
+  using typename Base::member_t;
+  using typename Base::size_type;
+
+  HitView hits;
+  CRowMap c_rowmap;
+
+  SpgemmMaskedSymbolicFunctor(const ARowMap &a_rowmap_, const AEntries &a_entries_, const BRowMap &b_rowmap_,
+                              const BEntries &b_entries_, const MRowMap &m_rowmap_, const MEntries &m_entries_,
+                              const lno_t max_mask_row_, const HitView &hits_, const CRowMap &c_rowmap_)
+      : Base(a_rowmap_, a_entries_, b_rowmap_, b_entries_, m_rowmap_, m_entries_, max_mask_row_),
+        hits(hits_),
+        c_rowmap(c_rowmap_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &t) const {
+    const lno_t row         = t.league_rank();
+    const size_type m_begin = this->m_rowmap(row);
+    const lno_t m_len       = this->m_rowmap(row + 1) - m_begin;
+    if (m_len == 0) {
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { c_rowmap(row) = 0; });
+      return;
+    }
+
+    auto hm = this->make_row_accumulator(t, m_begin, m_len);
+    // every hit writes the same flag, so plain stores are enough
+    this->for_each_masked_product(t, row, hm, [&](size_type, size_type, const lno_t p) { hm.values[p] = 1; });
+    t.team_barrier();
+
+    size_type count = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(t, m_len),
+        [&](const lno_t p, size_type &lcount) {
+          hits(m_begin + p) = hm.values[p];
+          lcount += hm.values[p];
+        },
+        count);
+    Kokkos::single(Kokkos::PerTeam(t), [&]() { c_rowmap(row) = count; });
+  }
+};
+
+/// \brief Symbolic: compact the hit mask entries into the entries of C.
+template <class MRowMap, class MEntries, class HitView, class CRowMap, class CEntries>
+struct SpgemmMaskedCompactFunctor {
+  using lno_t     = typename CEntries::non_const_value_type;
+  using size_type = typename CRowMap::non_const_value_type;
+
+  MRowMap m_rowmap;
+  MEntries m_entries;
+  HitView hits;
+  CRowMap c_rowmap;
+  CEntries c_entries;
+
+  SpgemmMaskedCompactFunctor(const MRowMap &m_rowmap_, const MEntries &m_entries_, const HitView &hits_,
+                             const CRowMap &c_rowmap_, const CEntries &c_entries_)
+      : m_rowmap(m_rowmap_), m_entries(m_entries_), hits(hits_), c_rowmap(c_rowmap_), c_entries(c_entries_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t row) const {
+    size_type c = c_rowmap(row);
+    for (size_type k = m_rowmap(row); k < m_rowmap(row + 1); ++k) {
+      if (hits(k)) c_entries(c++) = m_entries(k);
+    }
+  }
+};
+
+/// \brief Numeric: C's own pattern is the mask. Accumulate
+///   a_ik * d_k * b_kj into the positions of row i of C.
+template <class ExecSpace, class ARowMap, class AEntries, class AValues, class DVector, class BRowMap,
+          class BEntries, class BValues, class CRowMap, class CEntries, class CValues>
+struct SpgemmMaskedNumericFunctor
+    : public SpgemmMaskedBase<ExecSpace, ARowMap, AEntries, BRowMap, BEntries, CRowMap, CEntries,
+                              typename CValues::non_const_value_type> {
+  using Base = SpgemmMaskedBase<ExecSpace, ARowMap, AEntries, BRowMap, BEntries, CRowMap, CEntries,
+                                typename CValues::non_const_value_type>;
+  using typename Base::lno_t;
+  using typename Base::member_t;
+  using typename Base::size_type;
+  using scalar_t = typename CValues::non_const_value_type;
+
+  scalar_t alpha;
+  AValues a_values;
+  DVector d;
+  BValues b_values;
+  CValues c_values;
+  bool scale_by_d;
+
+  SpgemmMaskedNumericFunctor(const scalar_t alpha_, const ARowMap &a_rowmap_, const AEntries &a_entries_,
+                             const AValues &a_values_, const DVector &d_, const BRowMap &b_rowmap_,
+                             const BEntries &b_entries_, const BValues &b_values_, const CRowMap &c_rowmap_,
+                             const CEntries &c_entries_, const CValues &c_values_, const lno_t max_c_row_)
+      : Base(a_rowmap_, a_entries_, b_rowmap_, b_entries_, c_rowmap_, c_entries_, max_c_row_),
+        alpha(alpha_),
+        a_values(a_values_),
+        d(d_),
+        b_values(b_values_),
+        c_values(c_values_),
+        scale_by_d(d_.extent(0) > 0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &t) const {
+    const lno_t row         = t.league_rank();
+    const size_type c_begin = this->m_rowmap(row);
+    const lno_t c_len       = this->m_rowmap(row + 1) - c_begin;
+    if (c_len == 0) return;
+
+    auto hm = this->make_row_accumulator(t, c_begin, c_len);
+    this->for_each_masked_product(t, row, hm, [&](const size_type a_offset, const size_type b_offset, const lno_t p) {
+      scalar_t v = a_values(a_offset) * b_values(b_offset);
+      if (scale_by_d) v *= d(this->a_entries(a_offset));
+      Kokkos::atomic_add(&hm.values[p], v);
+    });
+    t.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, c_len),
+                         [&](const lno_t p) { c_values(c_begin + p) = alpha * hm.values[p]; });
+  }
+};
+
+template <class ExecSpace, class AMatrix, class BMatrix, class MaskGraph, class CMatrix>
+void spgemm_masked_symbolic(const ExecSpace &space, const AMatrix &A, const BMatrix &B, const MaskGraph &M,
+                            CMatrix &C) {
+  using lno_t         = typename CMatrix::non_const_ordinal_type;
+  using size_type     = typename CMatrix::non_const_size_type;
+  using c_rowmap_t    = typename CMatrix::row_map_type::non_const_type;
+  using c_entries_t   = typename CMatrix::index_type::non_const_type;
+  using c_values_t    = typename CMatrix::values_type::non_const_type;
+  using hit_t         = Kokkos::View<lno_t *, typename CMatrix::device_type>;
+  using m_rowmap_t    = typename MaskGraph::row_map_type;
+  using m_entries_t   = typename MaskGraph::entries_type;
+  using SymbolicFunc  = SpgemmMaskedSymbolicFunctor<ExecSpace, typename AMatrix::row_map_type,
+                                                   typename AMatrix::index_type, typename BMatrix::row_map_type,
+                                                   typename BMatrix::index_type, m_rowmap_t, m_entries_t, hit_t,
+                                                   c_rowmap_t>;
+  using CompactFunc   = SpgemmMaskedCompactFunctor<m_rowmap_t, m_entries_t, hit_t, c_rowmap_t, c_entries_t>;
+
+  const lno_t num_rows = A.numRows();
+  // zero-initialized: the last entry takes part in the prefix sum
+  c_rowmap_t c_rowmap(Kokkos::view_alloc(space, "C<M> row map"), num_rows + 1);
+  c_entries_t c_entries;
+  c_values_t c_values;
+
+  if (num_rows) {
+    hit_t hits(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "C<M> mask hits"), M.entries.extent(0));
+    const lno_t max_mask_row = KokkosSparse::Impl::graph_max_degree(space, M.row_map);
+
+    SymbolicFunc symbolic(A.graph.row_map, A.graph.entries, B.graph.row_map, B.graph.entries, M.row_map, M.entries,
+                          max_mask_row, hits, c_rowmap);
+    Kokkos::parallel_for("KokkosSparse::spgemm_masked_symbolic", symbolic.policy(space, num_rows, A.nnz()),
+                         symbolic);
+
+    size_type c_nnz = 0;
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, num_rows + 1, c_rowmap, c_nnz);
+
+    c_entries = c_entries_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "C<M> entries"), c_nnz);
+    c_values  = c_values_t(Kokkos::view_alloc(space, "C<M> values"), c_nnz);
+    Kokkos::parallel_for("KokkosSparse::spgemm_masked_symbolic::compact",
+                         Kokkos::RangePolicy<ExecSpace>(space, 0, num_rows),
+                         CompactFunc(M.row_map, M.entries, hits, c_rowmap, c_entries));
+  }
+
+  C = CMatrix("C<M>=A*diag(d)*B", num_rows, B.numCols(), c_entries.extent(0), c_values, c_rowmap, c_entries);
+}
+
+template <class ExecSpace, class AMatrix, class DVector, class BMatrix, class CMatrix>
+void spgemm_masked_numeric(const ExecSpace &space, const typename CMatrix::const_value_type alpha, const AMatrix &A,
+                           const DVector &d, const BMatrix &B, const CMatrix &C) {
+  using lno_t       = typename CMatrix::non_const_ordinal_type;
+  using NumericFunc = SpgemmMaskedNumericFunctor<
+      ExecSpace, typename AMatrix::row_map_type, typename AMatrix::index_type, typename AMatrix::values_type,
+      DVector, typename BMatrix::row_map_type, typename BMatrix::index_type, typename BMatrix::values_type,
+      typename CMatrix::row_map_type, typename CMatrix::index_type, typename CMatrix::values_type>;
+
+  const lno_t num_rows = C.numRows();
+  if (num_rows == 0 || C.nnz() == 0) return;
+
+  const lno_t max_c_row = KokkosSparse::Impl::graph_max_degree(space, C.graph.row_map);
+  NumericFunc numeric(alpha, A.graph.row_map, A.graph.entries, A.values, d, B.graph.row_map, B.graph.entries,
+                      B.values, C.graph.row_map, C.graph.entries, C.values, max_c_row);
+  Kokkos::parallel_for("KokkosSparse::spgemm_masked_numeric", numeric.policy(space, num_rows, A.nnz()), numeric);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_MASKED_IMPL_HPP_
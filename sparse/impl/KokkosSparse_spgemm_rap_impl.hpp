@@ -0,0 +1,442 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
+#define KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
+
+/// \file KokkosSparse_spgemm_rap_impl.hpp
+/// \brief Implementation of the triple product C = P^T * A * P.
+///
+/// Coarse row I of C is
+///   C(I,:) = sum_{i : P(i,I) != 0} P(i,I) * sum_{k : A(i,k) != 0} A(i,k) * P(k,:).
+/// One team owns each coarse row and expands the products directly from A and
+/// P into a team-scratch accumulator, so A*P is never formed. Rows whose
+/// accumulator does not fit in team scratch use one from a pool in global
+/// memory instead. The fine rows i of coarse row I come from the index
+/// structure of P^T kept in the RAPHandle (P^T's values are not formed):
+/// without it, every team would have to scatter into the rows of C with
+/// atomics instead of owning one.
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_HashmapAccumulator.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+#include "KokkosKernels_Uniform_Initialized_MemoryPool.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_Utils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm_masked_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Upper bound on the length of every row of C: the number of
+///   products P(i,I) * A(i,k) * P(k,J) it sums, capped by the number of
+///   columns.
+template <class PtRowMap, class PtEntries, class ARowMap, class AEntries, class PRowMap>
+struct RapRowBoundFunctor {
+  using lno_t     = typename PtEntries::non_const_value_type;
+  using size_type = typename PtRowMap::non_const_value_type;
+
+  PtRowMap pt_rowmap;
+  PtEntries pt_entries;
+  ARowMap a_rowmap;
+  AEntries a_entries;
+  PRowMap p_rowmap;
+  lno_t num_cols;
+
+  RapRowBoundFunctor(const PtRowMap &pt_rowmap_, const PtEntries &pt_entries_, const ARowMap &a_rowmap_,
+                     const AEntries &a_entries_, const PRowMap &p_rowmap_, const lno_t num_cols_)
+      : pt_rowmap(pt_rowmap_),
+        pt_entries(pt_entries_),
+        a_rowmap(a_rowmap_),
+        a_entries(a_entries_),
+        p_rowmap(p_rowmap_),
+        num_cols(num_cols_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t row, lno_t &lmax) const {
+    size_type bound = 0;
+    for (size_type q = pt_rowmap(row); q < pt_rowmap(row + 1) && bound < size_type(num_cols); ++q) {
+      const lno_t i = pt_entries(q);
+      for (size_type ka = a_rowmap(i); ka < size_type(a_rowmap(i + 1)); ++ka) {
+        const lno_t k = a_entries(ka);
+        bound += p_rowmap(k + 1) - p_rowmap(k);
+      }
+    }
+    const lno_t len = bound < size_type(num_cols) ? lno_t(bound) : num_cols;
+    if (len > lmax) lmax = len;
+  }
+};
+
+/// \brief Symbolic: collect the distinct columns of the products of every
+///   coarse row. The count pass writes row lengths into c_rowmap; the fill
+///   pass (after the prefix sum) writes the columns into c_entries.
+///
+/// The columns go into an open addressing table claimed with a CAS on the
+/// key, so any number of threads may insert the same column concurrently.
+/// The table has at least twice as many slots as the row bound and can not
+/// fill up. It lives in team scratch if it fits there, and otherwise in a
+/// chunk of the pool (set by the caller when use_pool is true).
+template <class ExecSpace, class PtRowMap, class PtEntries, class ARowMap, class AEntries, class PRowMap,
+          class PEntries, class CRowMap, class CEntries>
+struct RapSymbolicFunctor {
+  using execution_space = ExecSpace;
+  using team_policy_t   = Kokkos::TeamPolicy<execution_space>;
+  using member_t        = typename team_policy_t::member_type;
+  using scratch_space   = typename execution_space::scratch_memory_space;
+  using lno_t           = typename PtEntries::non_const_value_type;
+  using size_type       = typename PtRowMap::non_const_value_type;
+  using lno_scratch_t   = Kokkos::View<lno_t *, scratch_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using hashmap_t       = KokkosKernels::Experimental::GrowableHashmapAccumulator<lno_t, lno_t, lno_t>;
+  using pool_t          = KokkosKernels::Impl::UniformMemoryPool<typename CRowMap::device_type, lno_t>;
+
+  PtRowMap pt_rowmap;
+  PtEntries pt_entries;
+  ARowMap a_rowmap;
+  AEntries a_entries;
+  PRowMap p_rowmap;
+  PEntries p_entries;
+  CRowMap c_rowmap;
+  CEntries c_entries;
+  pool_t pool;     // chunks of capacity + 1 for the keys and used_size
+  lno_t max_row;   // bound on the length of a row of C
+  lno_t capacity;  // power of 2 >= 2 * max_row
+  int scratch_level;
+  bool use_pool;
+  bool fill;
+
+  RapSymbolicFunctor(const PtRowMap &pt_rowmap_, const PtEntries &pt_entries_, const ARowMap &a_rowmap_,
+                     const AEntries &a_entries_, const PRowMap &p_rowmap_, const PEntries &p_entries_,
+                     const CRowMap &c_rowmap_, const CEntries &c_entries_, const lno_t max_row_, const bool fill_)
+      : pt_rowmap(pt_rowmap_),
+        pt_entries(pt_entries_),
+        a_rowmap(a_rowmap_),
+        a_entries(a_entries_),
+        p_rowmap(p_rowmap_),
+        p_entries(p_entries_),
+        c_rowmap(c_rowmap_),
+        c_entries(c_entries_),
+        pool(),
+        max_row(max_row_),
+        capacity(2),
+        scratch_level(0),
+        use_pool(false),
+        fill(fill_) {
+    while (capacity < 2 * max_row) capacity *= 2;
+    scratch_level = (scratch_size() <= size_t(team_policy_t::scratch_size_max(0))) ? 0 : 1;
+    use_pool      = scratch_size() > size_t(team_policy_t::scratch_size_max(1));
+  }
+
+  // keys and the used_size counter
+  size_t scratch_size() const { return lno_scratch_t::shmem_size(capacity) + lno_scratch_t::shmem_size(1); }
+
+  static int vector_size(const lno_t num_rows, const size_type nnz) {
+    return KokkosKernels::Impl::kk_get_suggested_vector_size(
+        num_rows, nnz, KokkosKernels::Impl::kk_get_exec_space_type<execution_space>());
+  }
+
+  /// \brief A pool of accumulators in global memory, one per team that can
+  ///   run concurrently, as far as half of the free memory allows.
+  pool_t make_pool(const execution_space &space, const lno_t num_rows, const size_type nnz) const {
+    const size_t chunk_size = size_t(capacity) + 1;
+    size_t num_chunks       = space.concurrency() / vector_size(num_rows, nnz);
+    num_chunks              = KOKKOSKERNELS_MACRO_MAX(size_t(1), num_chunks);
+    if constexpr (KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
+      size_t free_byte = 0, total_byte = 0;
+      KokkosKernels::Impl::kk_get_free_total_memory<typename execution_space::memory_space>(free_byte, total_byte);
+      if (free_byte > 0)
+        num_chunks = KOKKOSKERNELS_MACRO_MIN(
+            num_chunks, KOKKOSKERNELS_MACRO_MAX(size_t(1), free_byte / 2 / (chunk_size * sizeof(lno_t))));
+    }
+    num_chunks = KOKKOSKERNELS_MACRO_MIN(num_chunks, size_t(num_rows));
+    // the teams clear their chunk before using it
+    return pool_t(num_chunks, chunk_size, lno_t(0), KokkosKernels::Impl::ManyThread2OneChunk, false);
+  }
+
+  team_policy_t policy(const execution_space &space, const lno_t num_rows, const size_type nnz) const {
+    if (use_pool) return team_policy_t(space, num_rows, Kokkos::AUTO, vector_size(num_rows, nnz));
+    return team_policy_t(space, num_rows, Kokkos::AUTO, vector_size(num_rows, nnz))
+        .set_scratch_size(scratch_level, Kokkos::PerTeam(scratch_size()));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &t) const {
+    const lno_t row = t.league_rank();
+
+    lno_t *keys = nullptr, *used_size = nullptr;
+    if (use_pool) {
+      while (keys == nullptr) {
+        Kokkos::single(
+            Kokkos::PerTeam(t), [&](lno_t *&chunk) { chunk = pool.allocate_chunk(row); }, keys);
+      }
+      used_size = keys + capacity;
+    } else {
+      keys      = lno_scratch_t(t.team_scratch(scratch_level), capacity).data();
+      used_size = lno_scratch_t(t.team_scratch(scratch_level), 1).data();
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, capacity), [&](const lno_t s) { keys[s] = hashmap_t::empty_key; });
+    Kokkos::single(Kokkos::PerTeam(t), [&]() { *used_size = 0; });
+    t.team_barrier();
+
+    hashmap_t hm(capacity, keys, nullptr, used_size);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, pt_rowmap(row), pt_rowmap(row + 1)), [&](const size_type q) {
+      const lno_t i = pt_entries(q);
+      for (size_type ka = a_rowmap(i); ka < size_type(a_rowmap(i + 1)); ++ka) {
+        const lno_t k           = a_entries(ka);
+        const size_type p_begin = p_rowmap(k);
+        const lno_t p_len       = p_rowmap(k + 1) - p_begin;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, p_len),
+                             [&](const lno_t kp) { hm.vector_atomic_insert(p_entries(p_begin + kp)); });
+      }
+    });
+    t.team_barrier();
+
+    if (fill) {
+      // compact the used slots, in any order: the rows are sorted afterwards
+      const size_type c_begin = c_rowmap(row);
+      Kokkos::parallel_scan(Kokkos::TeamThreadRange(t, capacity), [&](const lno_t s, lno_t &pos, const bool final) {
+        if (keys[s] == hashmap_t::empty_key) return;
+        if (final) c_entries(c_begin + pos) = keys[s];
+        ++pos;
+      });
+    } else {
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { c_rowmap(row) = *used_size; });
+    }
+
+    if (use_pool) {
+      t.team_barrier();
+      Kokkos::single(Kokkos::PerTeam(t), [&]() { pool.release_chunk(keys); });
+    }
+  }
+};
+
+/// \brief Numeric: C's pattern is known, so accumulate
+///   P(i,I) * A(i,k) * P(k,J) into the positions of row I of C.
+///
+/// The products are summed with atomics in whatever order the threads run,
+/// so the values of C are not bitwise reproducible from run to run. If the
+/// accumulator of the longest row does not fit in team scratch, GlobalTag
+/// finds the positions in the sorted rows of C by bisection and adds into
+/// C's values directly.
+template <class ExecSpace, class PtRowMap, class PtEntries, class PtOffsets, class ARowMap, class AEntries,
+          class AValues, class PRowMap, class PEntries, class PValues, class CRowMap, class CEntries, class CValues>
+struct RapNumericFunctor : public SpgemmMaskedBase<ExecSpace, PtRowMap, PtEntries, ARowMap, AEntries, CRowMap,
+                                                   CEntries, typename CValues::non_const_value_type> {
+  using Base = SpgemmMaskedBase<ExecSpace, PtRowMap, PtEntries, ARowMap, AEntries, CRowMap, CEntries,
+                                typename CValues::non_const_value_type>;
+  using typename Base::accum_t;
+  using typename Base::lno_t;
+  using typename Base::member_t;
+  using typename Base::size_type;
+
+  struct GlobalTag {};
+
+  PtOffsets pt_offsets;
+  AValues a_values;
+  PRowMap p_rowmap;
+  PEntries p_entries;
+  PValues p_values;
+  CValues c_values;
+
+  RapNumericFunctor(const PtRowMap &pt_rowmap_, const PtEntries &pt_entries_, const PtOffsets &pt_offsets_,
+                    const ARowMap &a_rowmap_, const AEntries &a_entries_, const AValues &a_values_,
+                    const PRowMap &p_rowmap_, const PEntries &p_entries_, const PValues &p_values_,
+                    const CRowMap &c_rowmap_, const CEntries &c_entries_, const CValues &c_values_,
+                    const lno_t max_c_row_)
+      : Base(pt_rowmap_, pt_entries_, a_rowmap_, a_entries_, c_rowmap_, c_entries_, max_c_row_),
+        pt_offsets(pt_offsets_),
+        a_values(a_values_),
+        p_rowmap(p_rowmap_),
+        p_entries(p_entries_),
+        p_values(p_values_),
+        c_values(c_values_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &t) const {
+    const lno_t row         = t.league_rank();
+    const size_type c_begin = this->m_rowmap(row);
+    const lno_t c_len       = this->m_rowmap(row + 1) - c_begin;
+    if (c_len == 0) return;
+
+    auto hm = this->make_row_accumulator(t, c_begin, c_len);
+    // Pt and A play the roles of A and B of the masked product
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, this->a_rowmap(row), this->a_rowmap(row + 1)), [&](const size_type q) {
+          const lno_t i         = this->a_entries(q);
+          const accum_t p_scale = p_values(pt_offsets(q));
+          for (size_type ka = this->b_rowmap(i); ka < size_type(this->b_rowmap(i + 1)); ++ka) {
+            const lno_t k           = this->b_entries(ka);
+            const accum_t scale     = p_scale * a_values(ka);
+            const size_type p_begin = p_rowmap(k);
+            const lno_t p_len       = p_rowmap(k + 1) - p_begin;
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, p_len), [&](const lno_t kp) {
+              const lno_t p = hm.find(p_entries(p_begin + kp));
+              if (p != -1) Kokkos::atomic_add(&hm.values[p], scale * p_values(p_begin + kp));
+            });
+          }
+        });
+    t.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, c_len),
+                         [&](const lno_t p) { c_values(c_begin + p) = hm.values[p]; });
+  }
+
+  bool fits_scratch() const { return this->scratch_size() <= size_t(Base::team_policy_t::scratch_size_max(1)); }
+
+  Kokkos::TeamPolicy<ExecSpace, GlobalTag> global_policy(const ExecSpace &space, const lno_t num_rows,
+                                                         const size_type nnz) const {
+    const int vector_size = KokkosKernels::Impl::kk_get_suggested_vector_size(
+        num_rows, nnz, KokkosKernels::Impl::kk_get_exec_space_type<ExecSpace>());
+    return Kokkos::TeamPolicy<ExecSpace, GlobalTag>(space, num_rows, Kokkos::AUTO, vector_size);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const GlobalTag &, const member_t &t) const {
+    const lno_t row         = t.league_rank();
+    const size_type c_begin = this->m_rowmap(row);
+    const lno_t c_len       = this->m_rowmap(row + 1) - c_begin;
+    if (c_len == 0) return;
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(t, c_len), [&](const lno_t p) { c_values(c_begin + p) = accum_t(); });
+    t.team_barrier();
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(t, this->a_rowmap(row), this->a_rowmap(row + 1)), [&](const size_type q) {
+          const lno_t i         = this->a_entries(q);
+          const accum_t p_scale = p_values(pt_offsets(q));
+          for (size_type ka = this->b_rowmap(i); ka < size_type(this->b_rowmap(i + 1)); ++ka) {
+            const lno_t k           = this->b_entries(ka);
+            const accum_t scale     = p_scale * a_values(ka);
+            const size_type p_begin = p_rowmap(k);
+            const lno_t p_len       = p_rowmap(k + 1) - p_begin;
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(t, p_len), [&](const lno_t kp) {
+              const lno_t col = p_entries(p_begin + kp);
+              lno_t lo = 0, hi = c_len;
+              while (lo < hi) {
+                const lno_t mid = (lo + hi) / 2;
+                if (this->m_entries(c_begin + mid) < col)
+                  lo = mid + 1;
+                else
+                  hi = mid;
+              }
+              if (lo < c_len && this->m_entries(c_begin + lo) == col)
+                Kokkos::atomic_add(&c_values(c_begin + lo), scale * p_values(p_begin + kp));
+            });
+          }
+        });
+  }
+};
+
+template <class OffsetsType>
+struct RapIotaFunctor {
+  OffsetsType offsets;
+  RapIotaFunctor(const OffsetsType &offsets_) : offsets(offsets_) {}
+  KOKKOS_INLINE_FUNCTION void operator()(const typename OffsetsType::non_const_value_type k) const { offsets(k) = k; }
+};
+
+template <class ExecSpace, class RAPHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_symbolic(const ExecSpace &space, RAPHandle &handle, const AMatrix &A, const PMatrix &P, CMatrix &C) {
+  using lno_t        = typename RAPHandle::ordinal_type;
+  using size_type    = typename RAPHandle::size_type;
+  using row_map_type = typename RAPHandle::row_map_type;
+  using entries_type = typename RAPHandle::entries_type;
+  using offsets_type = typename RAPHandle::offsets_type;
+  using c_rowmap_t   = typename CMatrix::row_map_type::non_const_type;
+  using c_entries_t  = typename CMatrix::index_type::non_const_type;
+  using c_values_t   = typename CMatrix::values_type::non_const_type;
+  using a_rowmap_t   = typename AMatrix::row_map_type;
+  using a_entries_t  = typename AMatrix::index_type;
+  using p_rowmap_t   = typename PMatrix::row_map_type;
+  using p_entries_t  = typename PMatrix::index_type;
+  using BoundFunc    = RapRowBoundFunctor<row_map_type, entries_type, a_rowmap_t, a_entries_t, p_rowmap_t>;
+  using SymbolicFunc = RapSymbolicFunctor<ExecSpace, row_map_type, entries_type, a_rowmap_t, a_entries_t, p_rowmap_t,
+                                          p_entries_t, c_rowmap_t, c_entries_t>;
+
+  const lno_t num_fine   = P.numRows();
+  const lno_t num_coarse = P.numCols();
+
+  // Index structure of P^T: transpose the offsets of P's entries instead of
+  // its values, so the rows of C can be traversed without forming P^T's values
+  offsets_type p_offsets(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "P offsets"), P.nnz());
+  Kokkos::parallel_for("KokkosSparse::spgemm_rap_symbolic::iota", Kokkos::RangePolicy<ExecSpace>(space, 0, P.nnz()),
+                       RapIotaFunctor<offsets_type>(p_offsets));
+  handle.Pt_row_map = row_map_type(Kokkos::view_alloc(space, "P^T row map"), num_coarse + 1);
+  handle.Pt_entries = entries_type(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "P^T entries"), P.nnz());
+  handle.Pt_offsets = offsets_type(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "P^T offsets"), P.nnz());
+  KokkosSparse::Impl::transpose_matrix<p_rowmap_t, p_entries_t, offsets_type, row_map_type, entries_type,
+                                       offsets_type, row_map_type, ExecSpace>(
+      space, num_fine, num_coarse, P.graph.row_map, P.graph.entries, p_offsets, handle.Pt_row_map, handle.Pt_entries,
+      handle.Pt_offsets);
+
+  // Structure of C = P^T * A * P
+  c_rowmap_t c_rowmap(Kokkos::view_alloc(space, "C=PtAP row map"), num_coarse + 1);
+  c_entries_t c_entries;
+  size_type c_nnz = 0;
+  if (num_coarse) {
+    lno_t max_row = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spgemm_rap_symbolic::row_bound", Kokkos::RangePolicy<ExecSpace>(space, 0, num_coarse),
+        BoundFunc(handle.Pt_row_map, handle.Pt_entries, A.graph.row_map, A.graph.entries, P.graph.row_map, num_coarse),
+        Kokkos::Max<lno_t>(max_row));
+
+    SymbolicFunc count(handle.Pt_row_map, handle.Pt_entries, A.graph.row_map, A.graph.entries, P.graph.row_map,
+                       P.graph.entries, c_rowmap, c_entries, max_row, false);
+    // rows too long for team scratch take their accumulator from a pool
+    if (count.use_pool) count.pool = count.make_pool(space, num_coarse, A.nnz());
+    Kokkos::parallel_for("KokkosSparse::spgemm_rap_symbolic::count", count.policy(space, num_coarse, A.nnz()), count);
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(space, num_coarse + 1, c_rowmap, c_nnz);
+
+    c_entries = c_entries_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "C=PtAP entries"), c_nnz);
+    SymbolicFunc fill(handle.Pt_row_map, handle.Pt_entries, A.graph.row_map, A.graph.entries, P.graph.row_map,
+                      P.graph.entries, c_rowmap, c_entries, max_row, true);
+    fill.pool = count.pool;
+    Kokkos::parallel_for("KokkosSparse::spgemm_rap_symbolic::fill", fill.policy(space, num_coarse, A.nnz()), fill);
+
+    KokkosSparse::sort_crs_graph(space, c_rowmap, c_entries);
+    handle.max_c_row = KokkosSparse::Impl::graph_max_degree(space, c_rowmap);
+  }
+
+  c_values_t c_values(Kokkos::view_alloc(space, "C=PtAP values"), c_nnz);
+  C = CMatrix("C=PtAP", num_coarse, num_coarse, c_nnz, c_values, c_rowmap, c_entries);
+  handle.set_symbolic_complete();
+}
+
+template <class ExecSpace, class RAPHandle, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_numeric(const ExecSpace &space, RAPHandle &handle, const AMatrix &A, const PMatrix &P,
+                        const CMatrix &C) {
+  using NumericFunc =
+      RapNumericFunctor<ExecSpace, typename RAPHandle::row_map_type, typename RAPHandle::entries_type,
+                        typename RAPHandle::offsets_type, typename AMatrix::row_map_type, typename AMatrix::index_type,
+                        typename AMatrix::values_type, typename PMatrix::row_map_type, typename PMatrix::index_type,
+                        typename PMatrix::values_type, typename CMatrix::row_map_type, typename CMatrix::index_type,
+                        typename CMatrix::values_type>;
+
+  if (C.numRows() == 0 || C.nnz() == 0) return;
+  NumericFunc numeric(handle.Pt_row_map, handle.Pt_entries, handle.Pt_offsets, A.graph.row_map, A.graph.entries,
+                      A.values, P.graph.row_map, P.graph.entries, P.values, C.graph.row_map, C.graph.entries,
+                      C.values, handle.max_c_row);
+  if (numeric.fits_scratch())
+    Kokkos::parallel_for("KokkosSparse::spgemm_rap_numeric", numeric.policy(space, C.numRows(), A.nnz()), numeric);
+  else
+    Kokkos::parallel_for("KokkosSparse::spgemm_rap_numeric::global", numeric.global_policy(space, C.numRows(), A.nnz()),
+                         numeric);
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_RAP_IMPL_HPP_
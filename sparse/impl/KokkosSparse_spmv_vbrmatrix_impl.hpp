@@ -0,0 +1,293 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_IMPL_SPMV_VBRMATRIX_IMPL_HPP_
+#define KOKKOSSPARSE_IMPL_SPMV_VBRMATRIX_IMPL_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Vbr {
+
+//! Largest block dimension with a dedicated fixed-size micro-kernel
+constexpr int max_fixed_block_dim = 5;
+
+/// \brief y += alpha * op(A) * x for one dense R x C block stored row major.
+///
+/// R and C are compile-time constants so that the loops are fully unrolled
+/// and the partial sums stay in registers.
+template <int R, int C>
+struct FixedBlockGemv {
+  template <class ValueType, class XType, class YType>
+  KOKKOS_FORCEINLINE_FUNCTION static void invoke(const ValueType alpha, const ValueType *KOKKOS_RESTRICT A,
+                                                 const XType *KOKKOS_RESTRICT x, const int xs0,
+                                                 YType *KOKKOS_RESTRICT y, const int ys0, const bool conjugate) {
+    using ATV = Kokkos::ArithTraits<ValueType>;
+    ValueType t[R];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+    for (int i = 0; i < R; ++i) t[i] = ATV::zero();
+    if (conjugate) {
+      for (int j = 0; j < C; ++j) {
+        const ValueType xj = x[j * xs0];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int i = 0; i < R; ++i) t[i] += ATV::conj(A[i * C + j]) * xj;
+      }
+    } else {
+      for (int j = 0; j < C; ++j) {
+        const ValueType xj = x[j * xs0];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int i = 0; i < R; ++i) t[i] += A[i * C + j] * xj;
+      }
+    }
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+    for (int i = 0; i < R; ++i) y[i * ys0] += alpha * t[i];
+  }
+};
+
+/// \brief Fallback for blocks larger than max_fixed_block_dim
+struct GenericBlockGemv {
+  template <class ValueType, class XType, class YType>
+  KOKKOS_INLINE_FUNCTION static void invoke(const int r, const int c, const ValueType alpha,
+                                            const ValueType *KOKKOS_RESTRICT A, const XType *KOKKOS_RESTRICT x,
+                                            const int xs0, YType *KOKKOS_RESTRICT y, const int ys0,
+                                            const bool conjugate) {
+    using ATV = Kokkos::ArithTraits<ValueType>;
+    for (int i = 0; i < r; ++i) {
+      ValueType t = ATV::zero();
+      if (conjugate) {
+        for (int j = 0; j < c; ++j) t += ATV::conj(A[i * c + j]) * x[j * xs0];
+      } else {
+        for (int j = 0; j < c; ++j) t += A[i * c + j] * x[j * xs0];
+      }
+      y[i * ys0] += alpha * t;
+    }
+  }
+};
+
+template <int R, class ValueType, class XType, class YType>
+KOKKOS_INLINE_FUNCTION void block_gemv_dispatch_cols(const int c, const ValueType alpha, const ValueType *A,
+                                                     const XType *x, const int xs0, YType *y, const int ys0,
+                                                     const bool conjugate) {
+  switch (c) {
+    case 1: FixedBlockGemv<R, 1>::invoke(alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 2: FixedBlockGemv<R, 2>::invoke(alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 3: FixedBlockGemv<R, 3>::invoke(alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 4: FixedBlockGemv<R, 4>::invoke(alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 5: FixedBlockGemv<R, 5>::invoke(alpha, A, x, xs0, y, ys0, conjugate); break;
+    default: GenericBlockGemv::invoke(R, c, alpha, A, x, xs0, y, ys0, conjugate); break;
+  }
+}
+
+/// \brief y += alpha * op(A) * x for one dense r x c block stored row major,
+///   dispatching to an unrolled micro-kernel when r, c <= max_fixed_block_dim.
+template <class ValueType, class XType, class YType>
+KOKKOS_INLINE_FUNCTION void block_gemv(const int r, const int c, const ValueType alpha, const ValueType *A,
+                                       const XType *x, const int xs0, YType *y, const int ys0, const bool conjugate) {
+  switch (r) {
+    case 1: block_gemv_dispatch_cols<1>(c, alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 2: block_gemv_dispatch_cols<2>(c, alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 3: block_gemv_dispatch_cols<3>(c, alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 4: block_gemv_dispatch_cols<4>(c, alpha, A, x, xs0, y, ys0, conjugate); break;
+    case 5: block_gemv_dispatch_cols<5>(c, alpha, A, x, xs0, y, ys0, conjugate); break;
+    default: GenericBlockGemv::invoke(r, c, alpha, A, x, xs0, y, ys0, conjugate); break;
+  }
+}
+
+/* ******************* */
+
+template <class AMatrix, class XVector, class YVector>
+struct VBR_GEMV_Functor {
+  typedef typename AMatrix::execution_space execution_space;
+  typedef typename AMatrix::non_const_value_type value_type;
+  typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
+  typedef typename team_policy::member_type team_member;
+  typedef Kokkos::ArithTraits<value_type> ATV;
+
+  //! Nonconst version of the type of column indices in the sparse matrix.
+  typedef typename AMatrix::non_const_ordinal_type ordinal_type;
+  //! Nonconst version of the type of row offsets in the sparse matrix.
+  typedef typename AMatrix::non_const_size_type size_type;
+
+  const value_type alpha;
+
+  AMatrix m_A;
+  XVector m_x;
+  YVector m_y;
+
+  const bool conjugate;
+
+  VBR_GEMV_Functor(const value_type alpha_, const AMatrix &m_A_, const XVector &m_x_, const YVector &m_y_,
+                   const bool conj_)
+      : alpha(alpha_), m_A(m_A_), m_x(m_x_), m_y(m_y_), conjugate(conj_) {
+    static_assert(static_cast<int>(XVector::rank) == 1, "XVector must be a rank 1 View.");
+    static_assert(static_cast<int>(YVector::rank) == 1, "YVector must be a rank 1 View.");
+  }
+
+  //! One block row per thread; each block goes through a small GEMV micro-kernel
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iBlock) const {
+    const ordinal_type ystart = m_A.block_row_ptr(iBlock);
+    const int r               = static_cast<int>(m_A.block_row_ptr(iBlock + 1) - ystart);
+    const size_type start     = m_A.graph.row_map(iBlock);
+    const size_type end       = m_A.graph.row_map(iBlock + 1);
+    for (size_type k = start; k < end; ++k) {
+      const ordinal_type jBlock = m_A.graph.entries(k);
+      const ordinal_type xstart = m_A.block_col_ptr(jBlock);
+      const int c               = static_cast<int>(m_A.block_col_ptr(jBlock + 1) - xstart);
+      block_gemv(r, c, alpha, &m_A.values(m_A.block_val_ptr(k)), &m_x(xstart), static_cast<int>(m_x.stride(0)),
+                 &m_y(ystart), static_cast<int>(m_y.stride(0)), conjugate);
+    }
+  }
+
+  //! One block row per team; one point row per thread, vector lanes over the row's entries
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member &dev) const {
+    const ordinal_type iBlock = static_cast<ordinal_type>(dev.league_rank());
+    const ordinal_type ystart = m_A.block_row_ptr(iBlock);
+    const ordinal_type r      = m_A.block_row_ptr(iBlock + 1) - ystart;
+    const size_type start     = m_A.graph.row_map(iBlock);
+    const size_type end       = m_A.graph.row_map(iBlock + 1);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, 0, r), [&](const ordinal_type ii) {
+      value_type sum = ATV::zero();
+      for (size_type k = start; k < end; ++k) {
+        const ordinal_type jBlock = m_A.graph.entries(k);
+        const ordinal_type xstart = m_A.block_col_ptr(jBlock);
+        const ordinal_type c      = m_A.block_col_ptr(jBlock + 1) - xstart;
+        const value_type *Arow    = &m_A.values(m_A.block_val_ptr(k) + ii * c);
+        value_type partial        = ATV::zero();
+        Kokkos::parallel_reduce(
+            Kokkos::ThreadVectorRange(dev, c),
+            [&](const ordinal_type jj, value_type &lsum) {
+              const value_type aval = conjugate ? ATV::conj(Arow[jj]) : Arow[jj];
+              lsum += aval * m_x(xstart + jj);
+            },
+            partial);
+        sum += partial;
+      }
+      Kokkos::single(Kokkos::PerThread(dev), [&]() { m_y(ystart + ii) += alpha * sum; });
+    });
+  }
+};
+
+/* ******************* */
+
+template <class AMatrix, class XVector, class YVector>
+struct VBR_GEMV_Transpose_Functor {
+  typedef typename AMatrix::execution_space execution_space;
+  typedef typename AMatrix::non_const_value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ATV;
+
+  //! Nonconst version of the type of column indices in the sparse matrix.
+  typedef typename AMatrix::non_const_ordinal_type ordinal_type;
+  //! Nonconst version of the type of row offsets in the sparse matrix.
+  typedef typename AMatrix::non_const_size_type size_type;
+
+  const value_type alpha;
+
+  AMatrix m_A;
+  XVector m_x;
+  YVector m_y;
+
+  const bool conjugate;
+
+  VBR_GEMV_Transpose_Functor(const value_type alpha_, const AMatrix &m_A_, const XVector &m_x_, const YVector &m_y_,
+                             const bool conj_)
+      : alpha(alpha_), m_A(m_A_), m_x(m_x_), m_y(m_y_), conjugate(conj_) {
+    static_assert(static_cast<int>(XVector::rank) == 1, "XVector must be a rank 1 View.");
+    static_assert(static_cast<int>(YVector::rank) == 1, "YVector must be a rank 1 View.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type iBlock) const {
+    const ordinal_type xstart = m_A.block_row_ptr(iBlock);
+    const ordinal_type r      = m_A.block_row_ptr(iBlock + 1) - xstart;
+    const size_type start     = m_A.graph.row_map(iBlock);
+    const size_type end       = m_A.graph.row_map(iBlock + 1);
+    for (size_type k = start; k < end; ++k) {
+      const ordinal_type jBlock = m_A.graph.entries(k);
+      const ordinal_type ystart = m_A.block_col_ptr(jBlock);
+      const ordinal_type c      = m_A.block_col_ptr(jBlock + 1) - ystart;
+      const value_type *A       = &m_A.values(m_A.block_val_ptr(k));
+      for (ordinal_type jj = 0; jj < c; ++jj) {
+        value_type t = ATV::zero();
+        for (ordinal_type ii = 0; ii < r; ++ii) {
+          const value_type aval = conjugate ? ATV::conj(A[ii * c + jj]) : A[ii * c + jj];
+          t += aval * m_x(xstart + ii);
+        }
+        Kokkos::atomic_add(&m_y(ystart + jj), alpha * t);
+      }
+    }
+  }
+};
+
+/* ******************* */
+
+/// \brief y = beta * y + alpha * op(A) * x for a VbrMatrix and rank-1 x, y
+template <class ExecutionSpace, class AMatrix, class AlphaType, class XVector, class BetaType, class YVector>
+void spmv_vbr(const ExecutionSpace &exec, const char mode[], const AlphaType &alpha, const AMatrix &A,
+              const XVector &x, const BetaType &beta, const YVector &y) {
+  using value_type = typename AMatrix::non_const_value_type;
+
+  const bool transpose = (mode[0] == 'T' || mode[0] == 'H');
+  const bool conjugate = (mode[0] == 'C' || mode[0] == 'H');
+
+  // This is required to maintain semantics of KokkosKernels native SpMV:
+  // if y contains NaN but beta = 0, the result y should be filled with 0.
+  if (beta == Kokkos::ArithTraits<BetaType>::zero())
+    Kokkos::deep_copy(exec, y, Kokkos::ArithTraits<BetaType>::zero());
+  else if (beta != Kokkos::ArithTraits<BetaType>::one())
+    KokkosBlas::scal(exec, y, beta, y);
+
+  if (alpha == Kokkos::ArithTraits<AlphaType>::zero() || A.numRows() == 0) return;
+
+  if (transpose) {
+    VBR_GEMV_Transpose_Functor<AMatrix, XVector, YVector> func(static_cast<value_type>(alpha), A, x, y, conjugate);
+    Kokkos::parallel_for("KokkosSparse::vbrspmv<Transpose>", Kokkos::RangePolicy<ExecutionSpace>(exec, 0, A.numRows()),
+                         func);
+    return;
+  }
+
+  VBR_GEMV_Functor<AMatrix, XVector, YVector> func(static_cast<value_type>(alpha), A, x, y, conjugate);
+  if constexpr (KokkosKernels::Impl::is_gpu_exec_space_v<ExecutionSpace>) {
+    Kokkos::TeamPolicy<ExecutionSpace> policy(exec, A.numRows(), Kokkos::AUTO, Kokkos::AUTO);
+    Kokkos::parallel_for("KokkosSparse::vbrspmv<NoTranspose,Team>", policy, func);
+  } else {
+    // Row lengths vary with the block sizes, so let the runtime balance them
+    Kokkos::parallel_for(
+        "KokkosSparse::vbrspmv<NoTranspose,Dynamic>",
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>(exec, 0, A.numRows()), func);
+  }
+}
+
+}  // namespace Vbr
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_SPMV_VBRMATRIX_IMPL_HPP_
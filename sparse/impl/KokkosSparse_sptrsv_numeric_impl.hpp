@@ -0,0 +1,116 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_SPTRSV_NUMERIC_IMPL_HPP_
+#define KOKKOSSPARSE_SPTRSV_NUMERIC_IMPL_HPP_
+
+/// \file KokkosSparse_sptrsv_numeric_impl.hpp
+/// \brief Implementation of the numeric phase of block sparse triangular
+///   solve: the diagonal blocks are inverted once with the batched dense
+///   kernels so that every solve only applies small GEMVs.
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_InverseLU_Decl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+namespace Experimental {
+
+template <class TriSolveHandle, class RowMapType, class EntriesType, class ValuesType, class DiagInvType>
+struct SptrsvBlockDiagInverseFunctor {
+  using lno_t     = typename TriSolveHandle::nnz_lno_t;
+  using size_type = typename TriSolveHandle::size_type;
+  using scalar_t  = typename TriSolveHandle::scalar_t;
+
+  // BSR data is in LayoutRight!
+  using Block = Kokkos::View<scalar_t **, Kokkos::LayoutRight, typename DiagInvType::device_type,
+                             Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+  using Work  = Kokkos::View<scalar_t *, Kokkos::LayoutRight, typename DiagInvType::device_type,
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>>;
+
+  // Same bound as the on-the-fly factorization in the block solve
+  static constexpr size_type BUFF_SIZE = 256;
+
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  DiagInvType diag_inv;
+  size_type block_size;
+  size_type block_items;
+
+  SptrsvBlockDiagInverseFunctor(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_,
+                                const DiagInvType &diag_inv_, const size_type block_size_)
+      : row_map(row_map_),
+        entries(entries_),
+        values(values_),
+        diag_inv(diag_inv_),
+        block_size(block_size_),
+        block_items(block_size_ * block_size_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t row) const {
+    Block Dinv(diag_inv.data() + row * block_items, block_size, block_size);
+
+    size_type diag = row_map(row + 1);
+    for (size_type k = row_map(row); k < row_map(row + 1); ++k) {
+      if (entries(k) == row) {
+        diag = k;
+        break;
+      }
+    }
+    KK_KERNEL_ASSERT_MSG(diag != row_map(row + 1), "sptrsv_numeric: missing diagonal block");
+
+    const scalar_t *D = values.data() + diag * block_items;
+    for (size_type i = 0; i < block_items; ++i) Dinv.data()[i] = D[i];
+
+    scalar_t buff[BUFF_SIZE];
+    Work w(&buff[0], block_items);
+    KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(Dinv);
+    KokkosBatched::SerialInverseLU<KokkosBatched::Algo::InverseLU::Unblocked>::invoke(Dinv, w);
+  }
+};
+
+/// \brief Invert the diagonal blocks of a block triangular matrix and store
+///   them, by block row, in the sptrsv handle.
+template <class ExecutionSpace, class TriSolveHandle, class RowMapType, class EntriesType, class ValuesType>
+void sptrsv_block_diag_inverse(const ExecutionSpace &space, TriSolveHandle &thandle, const RowMapType &row_map,
+                               const EntriesType &entries, const ValuesType &values) {
+  using lno_t       = typename TriSolveHandle::nnz_lno_t;
+  using size_type   = typename TriSolveHandle::size_type;
+  using DiagInvType = typename TriSolveHandle::nnz_scalar_view_t;
+  using Functor     = SptrsvBlockDiagInverseFunctor<TriSolveHandle, RowMapType, EntriesType, ValuesType, DiagInvType>;
+
+  const size_type block_size = thandle.get_block_size();
+  KK_REQUIRE_MSG(block_size > 0, "sptrsv_numeric: only block (BSR) triangular solves use inverted diagonal blocks");
+  KK_REQUIRE_MSG(block_size * block_size <= Functor::BUFF_SIZE,
+                 "sptrsv_numeric: max supported block size is 16, got " << block_size);
+
+  const lno_t nrows = thandle.get_nrows();
+  DiagInvType diag_inv(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "sptrsv block diagonal inverse"),
+                       nrows * block_size * block_size);
+  Kokkos::parallel_for("KokkosSparse::sptrsv_numeric::block_diag_inverse",
+                       Kokkos::RangePolicy<ExecutionSpace>(space, 0, nrows),
+                       Functor(row_map, entries, values, diag_inv, block_size));
+  thandle.set_block_diag_inverse(diag_inv, values.data());
+}
+
+}  // namespace Experimental
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPTRSV_NUMERIC_IMPL_HPP_
@@ -177,6 +177,20 @@ struct SptrsvWrap {
     static void add_and_divide(scalar_t &lhs_val, const scalar_t &rhs_val, const scalar_t &diag_val) {
       lhs_val = (lhs_val + rhs_val) / diag_val;
     }
+
+    // lhs = (lhs + rhs) / diag, where diag is values(diag_offset) (team)
+    KOKKOS_INLINE_FUNCTION
+    void add_and_solve_diag(const member_type &team, scalar_t &lhs_val, const scalar_t &rhs_val, const lno_t,
+                            const size_type diag_offset) const {
+      add_and_divide(team, lhs_val, rhs_val, vget(diag_offset));
+    }
+
+    // lhs = (lhs + rhs) / diag, where diag is values(diag_offset) (serial)
+    KOKKOS_INLINE_FUNCTION
+    void add_and_solve_diag(scalar_t &lhs_val, const scalar_t &rhs_val, const lno_t,
+                            const size_type diag_offset) const {
+      add_and_divide(lhs_val, rhs_val, vget(diag_offset));
+    }
   };
 
   // Partial specialization for block support
@@ -280,6 +294,9 @@ struct SptrsvWrap {
     entries_t nodes_grouped_by_level;
     size_type block_size;
     size_type block_items;
+    // Pre-inverted diagonal blocks (see sptrsv_numeric), indexed by rowid.
+    // When empty, the diagonal blocks are LU-factored during the solve.
+    ValuesType diag_inv;
 
     Common(const RowMapType &row_map_, const EntriesType &entries_, const ValuesType &values_, LHSType &lhs_,
            const RHSType &rhs_, const entries_t &nodes_grouped_by_level_, const size_type block_size_)
@@ -298,6 +315,8 @@ struct SptrsvWrap {
     KOKKOS_INLINE_FUNCTION
     size_type get_block_size() const { return block_size; }
 
+    void set_diag_inverse(const ValuesType &diag_inv_) { diag_inv = diag_inv_; }
+
     // assign
     template <typename View1, typename View2>
     KOKKOS_INLINE_FUNCTION static void assign(const View1 &lhs_, const View2 &rhs_) {
@@ -370,6 +389,29 @@ struct SptrsvWrap {
                                 KokkosBatched::Diag::NonUnit, KokkosBatched::Algo::Trsv::Blocked>::invoke(1.0, LU, b);
     }
 
+    // multiply_inverse. b = Ainv * b
+    KOKKOS_INLINE_FUNCTION
+    static void multiply_inverse(const member_type &team, const Vector &b, const CBlock &Ainv) {
+      // Team-shared buffer, gemv cannot work in place
+      const auto block_size_ = b.size();
+      SBlock shared_buff(team.team_shmem(), block_size_, block_size_);
+      Vector tmp(shared_buff.data(), block_size_);
+      KokkosBlas::TeamGemv<member_type, KokkosBlas::Trans::NoTranspose, KokkosBlas::Algo::Gemv::Unblocked>::invoke(
+          team, 1.0, Ainv, b, 0.0, tmp);
+      team.team_barrier();
+      assign(team, b, tmp);
+    }
+
+    // serial multiply_inverse. b = Ainv * b
+    KOKKOS_INLINE_FUNCTION
+    static void multiply_inverse(const Vector &b, const CBlock &Ainv) {
+      scalar_t buff[MAX_VEC_SIZE];
+      Vector tmp(&buff[0], b.size());
+      KokkosBlas::SerialGemv<KokkosBlas::Trans::NoTranspose, KokkosBlas::Algo::Gemv::Blocked>::invoke(1.0, Ainv, b, 0.0,
+                                                                                                      tmp);
+      assign(b, tmp);
+    }
+
     // multiply_subtract. C -= A * B
     KOKKOS_INLINE_FUNCTION
     static void multiply_subtract(const CBlock &A, const CVector &b, ArrayType &ca) {
@@ -410,6 +452,12 @@ struct SptrsvWrap {
       return CBlock(values.data() + (block * block_items), block_size, block_size);
     }
 
+    // dinvget
+    KOKKOS_INLINE_FUNCTION
+    CBlock dinvget(const lno_t row) const {
+      return CBlock(diag_inv.data() + (row * block_items), block_size, block_size);
+    }
+
     // lhs = (lhs + rhs) / diag
     KOKKOS_INLINE_FUNCTION
     static void add_and_divide(const member_type &team, const Vector &lhs_val, const CVector &rhs_val,
@@ -424,6 +472,30 @@ struct SptrsvWrap {
       add(rhs_val, lhs_val);
       divide(lhs_val, diag_val);
     }
+
+    // lhs = diag^-1 (lhs + rhs), using the pre-inverted diagonal when available
+    KOKKOS_INLINE_FUNCTION
+    void add_and_solve_diag(const member_type &team, const Vector &lhs_val, const CVector &rhs_val, const lno_t rowid,
+                            const size_type diag_offset) const {
+      if (diag_inv.extent(0) > 0) {
+        add(team, rhs_val, lhs_val);
+        team.team_barrier();
+        multiply_inverse(team, lhs_val, dinvget(rowid));
+      } else {
+        add_and_divide(team, lhs_val, rhs_val, vget(diag_offset));
+      }
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void add_and_solve_diag(const Vector &lhs_val, const CVector &rhs_val, const lno_t rowid,
+                            const size_type diag_offset) const {
+      if (diag_inv.extent(0) > 0) {
+        add(rhs_val, lhs_val);
+        multiply_inverse(lhs_val, dinvget(rowid));
+      } else {
+        add_and_divide(lhs_val, rhs_val, vget(diag_offset));
+      }
+    }
   };
 
   /**
@@ -539,7 +611,7 @@ struct SptrsvWrap {
         // Serial case is easy, there's only 1 thread so just do the
         // add_and_divide
         KK_KERNEL_ASSERT_MSG(rf.diag != -1, "Serial should always know diag");
-        Base::add_and_divide(lhs_val, rhs_val, Base::vget(rf.diag));
+        Base::add_and_solve_diag(lhs_val, rhs_val, rowid, rf.diag);
       } else {
         if constexpr (IsSorted) {
           // Parallel sorted case is complex. All threads know what the diag is.
@@ -548,15 +620,15 @@ struct SptrsvWrap {
           // we can use team operations).
           KK_KERNEL_ASSERT_MSG(rf.diag != -1, "Sorted should always know diag");
           if constexpr (!UseThreadVec) {
-            Base::add_and_divide(*team, lhs_val, rhs_val, Base::vget(rf.diag));
+            Base::add_and_solve_diag(*team, lhs_val, rhs_val, rowid, rf.diag);
           } else {
-            Base::add_and_divide(lhs_val, rhs_val, Base::vget(rf.diag));
+            Base::add_and_solve_diag(lhs_val, rhs_val, rowid, rf.diag);
           }
         } else {
           // Parallel unsorted case. Only one thread should know what the diag
           // item is. We have that one do the add_and_divide.
           if (rf.diag != -1) {
-            Base::add_and_divide(lhs_val, rhs_val, Base::vget(rf.diag));
+            Base::add_and_solve_diag(lhs_val, rhs_val, rowid, rf.diag);
           }
         }
       }
@@ -1268,6 +1340,18 @@ struct SptrsvWrap {
 #define FunctorTypeMacro(Functor, IsLower, BlockEnabled) \
   Functor<RowMapType, EntriesType, ValuesType, LHSType, RHSType, IsLower, BlockEnabled>
 
+  // Hand the pre-inverted diagonal blocks to a block-enabled functor, if
+  // sptrsv_numeric was called with the values being solved with; otherwise
+  // the functor factors the diagonal blocks itself
+  template <bool BlockEnabled, class Functor>
+  static void set_diag_inverse(Functor &functor, const TriSolveHandle &thandle) {
+    if constexpr (BlockEnabled) {
+      if (thandle.is_block_diag_inverse_computed_for(functor.values.data())) {
+        functor.set_diag_inverse(thandle.get_block_diag_inverse());
+      }
+    }
+  }
+
   template <bool BlockEnabled, class RowMapType, class EntriesType, class ValuesType, class RHSType, class LHSType>
   static void lower_tri_solve(execution_space &space, TriSolveHandle &thandle, const RowMapType row_map,
                               const EntriesType entries, const ValuesType values, const RHSType &rhs, LHSType &lhs) {
@@ -1332,6 +1416,15 @@ struct SptrsvWrap {
     work_view_int_t work_offset          = thandle.get_work_offset();
     integer_view_host_t work_offset_host = thandle.get_work_offset_host();
     auto work                            = thandle.get_workspace();
+    // the kernels expect a zeroed workspace: one drawn from the handle's
+    // workspace arena is zeroed for each solve
+    auto *workspace = thandle.get_workspace_arena();
+    typename TriSolveHandle::workspace_arena_t::Scope workspace_scope(workspace, space);
+    if (workspace != nullptr || work.extent(0) != size_t(thandle.get_workspace_size())) {
+      work = KokkosKernels::Impl::make_workspace_view<decltype(work)>(space, workspace, "work",
+                                                                      thandle.get_workspace_size());
+      Kokkos::deep_copy(space, work, zero);
+    }
 #endif
 
     size_type node_count = 0;
@@ -1350,6 +1443,7 @@ struct SptrsvWrap {
 #endif
         if (thandle.get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_RP) {
           LowerRPFunc lrpp(row_map, entries, values, lhs, rhs, nodes_grouped_by_level, block_size);
+          set_diag_inverse<BlockEnabled>(lrpp, thandle);
 
           Kokkos::parallel_for("parfor_fixed_lvl",
                                Kokkos::Experimental::require(range_policy(space, node_count, node_count + lvl_nodes),
@@ -1357,6 +1451,7 @@ struct SptrsvWrap {
                                lrpp);
         } else if (thandle.get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1) {
           LowerTPFunc ltpp(row_map, entries, values, lhs, rhs, nodes_grouped_by_level, node_count, block_size);
+          set_diag_inverse<BlockEnabled>(ltpp, thandle);
           int team_size = thandle.get_team_size();
           auto tp =
               team_size == -1 ? team_policy(space, lvl_nodes, Kokkos::AUTO) : team_policy(space, lvl_nodes, team_size);
@@ -1626,6 +1721,15 @@ struct SptrsvWrap {
     work_view_int_t work_offset          = thandle.get_work_offset();
     integer_view_host_t work_offset_host = thandle.get_work_offset_host();
     auto work                            = thandle.get_workspace();
+    // the kernels expect a zeroed workspace: one drawn from the handle's
+    // workspace arena is zeroed for each solve
+    auto *workspace = thandle.get_workspace_arena();
+    typename TriSolveHandle::workspace_arena_t::Scope workspace_scope(workspace, space);
+    if (workspace != nullptr || work.extent(0) != size_t(thandle.get_workspace_size())) {
+      work = KokkosKernels::Impl::make_workspace_view<decltype(work)>(space, workspace, "work",
+                                                                      thandle.get_workspace_size());
+      Kokkos::deep_copy(space, work, zero);
+    }
 #endif
 
     size_type node_count = 0;
@@ -1646,12 +1750,14 @@ struct SptrsvWrap {
 
         if (thandle.get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_RP) {
           UpperRPFunc urpp(row_map, entries, values, lhs, rhs, nodes_grouped_by_level, block_size);
+          set_diag_inverse<BlockEnabled>(urpp, thandle);
           Kokkos::parallel_for("parfor_fixed_lvl",
                                Kokkos::Experimental::require(range_policy(space, node_count, node_count + lvl_nodes),
                                                              Kokkos::Experimental::WorkItemProperty::HintLightWeight),
                                urpp);
         } else if (thandle.get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1) {
           UpperTPFunc utpp(row_map, entries, values, lhs, rhs, nodes_grouped_by_level, node_count, block_size);
+          set_diag_inverse<BlockEnabled>(utpp, thandle);
           int team_size = thandle.get_team_size();
           auto tp =
               team_size == -1 ? team_policy(space, lvl_nodes, Kokkos::AUTO) : team_policy(space, lvl_nodes, team_size);
@@ -2117,16 +2223,18 @@ struct SptrsvWrap {
           KK_REQUIRE(block_enabled == BlockEnabled);
           if (lvl_nodes != 0) {
             if (thandle_v[i]->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_RP) {
+              RPFunctor rpf(row_map_v[i], entries_v[i], values_v[i], lhs_v[i], rhs_v[i], nodes_grouped_by_level_v[i],
+                            block_size);
+              set_diag_inverse<BlockEnabled>(rpf, *thandle_v[i]);
               Kokkos::parallel_for("parfor_fixed_lvl",
-                                   range_policy(execspace_v[i], node_count_v[i], node_count_v[i] + lvl_nodes),
-                                   RPFunctor(row_map_v[i], entries_v[i], values_v[i], lhs_v[i], rhs_v[i],
-                                             nodes_grouped_by_level_v[i], block_size));
+                                   range_policy(execspace_v[i], node_count_v[i], node_count_v[i] + lvl_nodes), rpf);
             } else if (thandle_v[i]->get_algorithm() == KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1) {
               int team_size = thandle_v[i]->get_team_size();
               auto tp       = team_size == -1 ? team_policy(execspace_v[i], lvl_nodes, Kokkos::AUTO)
                                               : team_policy(execspace_v[i], lvl_nodes, team_size);
               TPFunctor tstf(row_map_v[i], entries_v[i], values_v[i], lhs_v[i], rhs_v[i], nodes_grouped_by_level_v[i],
                              node_count_v[i], block_size);
+              set_diag_inverse<BlockEnabled>(tstf, *thandle_v[i]);
               const int scratch_size = TPFunctor::SBlock::shmem_size(block_size, block_size);
               tp                     = tp.set_scratch_size(0, Kokkos::PerTeam(scratch_size));
               Kokkos::parallel_for("parfor_l_team", tp, tstf);
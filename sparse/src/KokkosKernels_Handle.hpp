@@ -24,6 +24,8 @@
 #include "KokkosSparse_par_ilut_handle.hpp"
 #include "KokkosSparse_gmres_handle.hpp"
 #include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_WorkspaceArena.hpp"
+#include <memory>
 
 #ifndef KOKKOSKERNELS_HANDLE_HPP
 #define KOKKOSKERNELS_HANDLE_HPP
@@ -60,6 +62,8 @@ class KokkosKernelsHandle {
   typedef typename std::remove_const<scalar_t_>::type nnz_scalar_t;
   typedef const nnz_scalar_t const_nnz_scalar_t;
 
+  typedef KokkosKernels::Impl::WorkspaceArena<HandleExecSpace, HandleTempMemorySpace> workspace_arena_t;
+
   template <typename right_size_type_, typename right_lno_t_, typename right_scalar_t_, typename right_ExecutionSpace,
             typename right_TemporaryMemorySpace, typename right_PersistentMemorySpace>
   // KokkosKernelsHandle<const_size_type,const_nnz_lno_t, const_nnz_scalar_t,
@@ -153,6 +157,14 @@ class KokkosKernelsHandle {
     this->shared_memory_size  = right_side_handle.get_shmem_size();
     this->suggested_team_size = right_side_handle.get_set_suggested_team_size();
 
+    // handles converted for const types share the workspace of the original
+    using right_arena_t = typename KokkosKernelsHandle<right_size_type_, right_lno_t_, right_scalar_t_,
+                                                       right_ExecutionSpace, right_TemporaryMemorySpace,
+                                                       right_PersistentMemorySpace>::workspace_arena_t;
+    if constexpr (std::is_same_v<right_arena_t, workspace_arena_t>) {
+      this->workspace_arena = right_side_handle.get_shared_workspace_arena();
+    }
+
     this->my_exec_space          = right_side_handle.get_handle_exec_space();
     this->use_dynamic_scheduling = right_side_handle.is_dynamic_scheduling();
     this->KKVERBOSE              = right_side_handle.get_verbose();
@@ -276,6 +288,8 @@ class KokkosKernelsHandle {
   PAR_ILUTHandleType *par_ilutHandle;
   GMRESHandleType *gmresHandle;
 
+  std::shared_ptr<workspace_arena_t> workspace_arena;
+
   int team_work_size;
   size_t shared_memory_size;
   int suggested_team_size;
@@ -357,6 +371,39 @@ class KokkosKernelsHandle {
     this->destroy_gmres_handle();
   }
 
+  /**
+   * \brief Makes the kernels driven by this handle draw their large
+   * temporaries from a persistent workspace owned by the handle, instead of
+   * allocating them at every call: the SpGEMM accumulator pools, the unsorted
+   * spadd symbolic temporaries, the Gauss-Seidel long row counts, the
+   * par_ilut row maps and the supernodal sptrsv solve workspace.
+   * The workspace grows to the high-water mark of the first calls, after which
+   * repeated calls with the same sizes allocate nothing.
+   * \param initial_bytes: input, bytes to reserve up front (0 to only grow on
+   * demand).
+   * \param exec: input, instance the workspace is first touched and fenced
+   * on, unless a kernel scopes its temporaries on another one.
+   */
+  void enable_workspace_arena(size_t initial_bytes = 0, const HandleExecSpace &exec = HandleExecSpace()) {
+    this->set_shared_workspace_arena(std::make_shared<workspace_arena_t>(initial_bytes, exec));
+  }
+  /// \brief Releases the workspace; kernels allocate their temporaries again.
+  void disable_workspace_arena() { this->set_shared_workspace_arena(nullptr); }
+  /// \brief Returns the workspace, or nullptr when it is not enabled.
+  workspace_arena_t *get_workspace_arena() { return this->workspace_arena.get(); }
+  std::shared_ptr<workspace_arena_t> get_shared_workspace_arena() { return this->workspace_arena; }
+  /// \brief Uses arena for this handle and the sub-handles created so far or
+  /// later; sub-handles only keep a pointer to it.
+  void set_shared_workspace_arena(const std::shared_ptr<workspace_arena_t> &arena) {
+    this->workspace_arena = arena;
+    if (this->gsHandle) this->gsHandle->set_workspace_arena(arena.get());
+    if (this->gs_sptrsvLHandle) this->gs_sptrsvLHandle->set_shared_workspace_arena(arena);
+    if (this->gs_sptrsvUHandle) this->gs_sptrsvUHandle->set_shared_workspace_arena(arena);
+    if (this->spaddHandle) this->spaddHandle->set_workspace_arena(arena.get());
+    if (this->sptrsvHandle) this->sptrsvHandle->set_workspace_arena(arena.get());
+    if (this->par_ilutHandle) this->par_ilutHandle->set_workspace_arena(arena.get());
+  }
+
   void set_verbose(bool verbose_) { this->KKVERBOSE = verbose_; }
   bool get_verbose() { return this->KKVERBOSE; }
   /**
@@ -574,6 +621,9 @@ class KokkosKernelsHandle {
    *                           KokkosGraph::COLORING_EB       Edge Based Coloring
    *                           KokkosGraph::COLORING_SERIAL2  Serial Distance-2 Graph Coloring (kept here for
    *                                                           backwards compatibility for SPGEMM and other use cases)
+   *                           KokkosGraph::COLORING_VBH      Vertex Based Hybrid Coloring: VBBIT, with a team per
+   *                                                           high-degree vertex
+   *                           KokkosGraph::COLORING_BALANCED VBBIT, then balances the sizes of the color sets
    */
   // clang-format on
   void create_gs_handle(const HandleExecSpace &handle_exec_space, int num_streams,
@@ -587,6 +637,7 @@ class KokkosKernelsHandle {
       this->gsHandle = new TwoStageGaussSeidelHandleType(handle_exec_space, num_streams);
     else
       this->gsHandle = new PointGaussSeidelHandleType(handle_exec_space, num_streams, gs_algorithm, coloring_algorithm);
+    this->gsHandle->set_workspace_arena(this->workspace_arena.get());
   }
 
   // clang-format off
@@ -617,6 +668,9 @@ class KokkosKernelsHandle {
    *                           KokkosGraph::COLORING_EB       Edge Based Coloring
    *                           KokkosGraph::COLORING_SERIAL2  Serial Distance-2 Graph Coloring (kept here for
    *                                                           backwards compatibility for SPGEMM and other use cases)
+   *                           KokkosGraph::COLORING_VBH      Vertex Based Hybrid Coloring: VBBIT, with a team per
+   *                                                           high-degree vertex
+   *                           KokkosGraph::COLORING_BALANCED VBBIT, then balances the sizes of the color sets
    */
   // clang-format on
   void create_gs_handle(KokkosSparse::GSAlgorithm gs_algorithm            = KokkosSparse::GS_DEFAULT,
@@ -702,6 +756,9 @@ class KokkosKernelsHandle {
    *                           KokkosGraph::COLORING_EB       Edge Based Coloring
    *                           KokkosGraph::COLORING_SERIAL2  Serial Distance-2 Graph Coloring (kept here for
    *                                                           backwards compatibility for SPGEMM and other use cases)
+   *                           KokkosGraph::COLORING_VBH      Vertex Based Hybrid Coloring: VBBIT, with a team per
+   *                                                           high-degree vertex
+   *                           KokkosGraph::COLORING_BALANCED VBBIT, then balances the sizes of the color sets
    */
   // clang-format on
   void create_gs_handle(KokkosSparse::ClusteringAlgorithm clusterAlgo, nnz_lno_t hint_verts_per_cluster,
@@ -709,6 +766,7 @@ class KokkosKernelsHandle {
     this->destroy_gs_handle();
     this->is_owner_of_the_gs_handle = true;
     this->gsHandle = new ClusterGaussSeidelHandleType(clusterAlgo, hint_verts_per_cluster, coloring_algorithm);
+    this->gsHandle->set_workspace_arena(this->workspace_arena.get());
   }
   void destroy_gs_handle() {
     if (is_owner_of_the_gs_handle && this->gsHandle != NULL) {
@@ -725,12 +783,14 @@ class KokkosKernelsHandle {
     this->destroy_gs_sptrsvL_handle();
     this->is_owner_of_the_gs_sptrsvL_handle = true;
     this->gs_sptrsvLHandle                  = new TwoStageGaussSeidelSPTRSVHandleType();
+    this->gs_sptrsvLHandle->set_shared_workspace_arena(this->workspace_arena);
     this->gs_sptrsvLHandle->create_sptrsv_handle(algm, nrows, true);
   }
   void create_gs_sptrsvU_handle(KokkosSparse::Experimental::SPTRSVAlgorithm algm, size_type nrows) {
     this->destroy_gs_sptrsvU_handle();
     this->is_owner_of_the_gs_sptrsvU_handle = true;
     this->gs_sptrsvUHandle                  = new TwoStageGaussSeidelSPTRSVHandleType();
+    this->gs_sptrsvUHandle->set_shared_workspace_arena(this->workspace_arena);
     this->gs_sptrsvUHandle->create_sptrsv_handle(algm, nrows, false);
   }
   void destroy_gs_sptrsvL_handle() {
@@ -752,6 +812,7 @@ class KokkosKernelsHandle {
     this->destroy_spadd_handle();
     this->is_owner_of_the_spadd_handle = true;
     this->spaddHandle                  = new SPADDHandleType(input_sorted, input_merged);
+    this->spaddHandle->set_workspace_arena(this->workspace_arena.get());
   }
   void destroy_spadd_handle() {
     if (is_owner_of_the_spadd_handle && this->spaddHandle != NULL) {
@@ -770,6 +831,7 @@ class KokkosKernelsHandle {
     //    this->sptrsvHandle->init_handle(nrows);
     this->sptrsvHandle->set_team_size(this->team_work_size);
     this->sptrsvHandle->set_vector_size(this->vector_size);
+    this->sptrsvHandle->set_workspace_arena(this->workspace_arena.get());
 
 #ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
     // default SpMV option
@@ -876,6 +938,7 @@ class KokkosKernelsHandle {
         new PAR_ILUTHandleType(max_iter, residual_norm_delta_stop, fill_in_limit, async_update, verbose);
     this->par_ilutHandle->set_team_size(this->team_work_size);
     this->par_ilutHandle->set_vector_size(this->vector_size);
+    this->par_ilutHandle->set_workspace_arena(this->workspace_arena.get());
   }
   void destroy_par_ilut_handle() {
     if (is_owner_of_the_par_ilut_handle && this->par_ilutHandle != nullptr) {
@@ -17,7 +17,9 @@
 #define KOKKOSSPARSE_IOUTILS_HPP
 
 #include "KokkosKernels_IOUtils.hpp"
+#include "KokkosKernels_Error.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
 
 #include <regex>
 
@@ -427,61 +429,174 @@ void convert_crs_to_edge_list(idx nv, idx *xadj, idx *srcs) {
   }
 }
 
+/// \brief Parallel edge list to CRS conversion, in passes over the edges:
+/// the degrees are counted with atomic increments, scanned into the row map,
+/// and every edge is scattered to the next free position of its row. The
+/// order of the entries within a row depends on the schedule; callers sort the
+/// rows afterwards. With symmetrize, (dst, src) is added for every (src, dst).
+template <typename rowmap_t, typename entries_t, typename values_t, typename srcs_t, typename dsts_t,
+          typename weights_t>
+struct EdgeListToCrsFunctor {
+  struct CountTag {};
+  struct FillTag {};
+  using size_type = typename rowmap_t::non_const_value_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+
+  srcs_t srcs;
+  dsts_t dsts;
+  weights_t weights;
+  rowmap_t counts;  // degrees, then the next free position of every row
+  entries_t entries;
+  values_t values;
+  bool symmetrize;
+  bool remove_self_loops;
+
+  EdgeListToCrsFunctor(const srcs_t &srcs_, const dsts_t &dsts_, const weights_t &weights_, const rowmap_t &counts_,
+                       const entries_t &entries_, const values_t &values_, bool symmetrize_, bool remove_self_loops_)
+      : srcs(srcs_),
+        dsts(dsts_),
+        weights(weights_),
+        counts(counts_),
+        entries(entries_),
+        values(values_),
+        symmetrize(symmetrize_),
+        remove_self_loops(remove_self_loops_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const CountTag &, const size_t e) const {
+    const lno_t src = srcs(e), dst = dsts(e);
+    if (remove_self_loops && src == dst) return;
+    Kokkos::atomic_inc(&counts(src));
+    if (symmetrize) Kokkos::atomic_inc(&counts(dst));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void insert(const lno_t row, const lno_t col, const size_t e) const {
+    const size_type pos = Kokkos::atomic_fetch_add(&counts(row), size_type(1));
+    entries(pos)        = col;
+    if (values.extent(0)) values(pos) = weights(e);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const FillTag &, const size_t e) const {
+    const lno_t src = srcs(e), dst = dsts(e);
+    if (remove_self_loops && src == dst) return;
+    insert(src, dst, e);
+    if (symmetrize) insert(dst, src, e);
+  }
+};
+
+/// \brief Counts the degrees of the edge list and scans them into rowmap
+/// (nv + 1 entries). Returns the number of entries of the CRS graph.
+template <typename exec_space, typename rowmap_t, typename srcs_t, typename dsts_t>
+typename rowmap_t::non_const_value_type edge_list_to_crs_rowmap(const exec_space &exec, const rowmap_t &rowmap,
+                                                                const srcs_t &srcs, const dsts_t &dsts,
+                                                                bool symmetrize, bool remove_self_loops) {
+  using functor_t = EdgeListToCrsFunctor<rowmap_t, rowmap_t, rowmap_t, srcs_t, dsts_t, srcs_t>;
+  using size_type = typename rowmap_t::non_const_value_type;
+  if (srcs.extent(0) != dsts.extent(0)) {
+    KokkosKernels::Impl::throw_runtime_exception("edge_list_to_crs: srcs and dsts must have the same length");
+  }
+  Kokkos::deep_copy(exec, rowmap, size_type(0));
+  Kokkos::parallel_for("KokkosSparse::EdgeListToCrs::Count",
+                       Kokkos::RangePolicy<exec_space, typename functor_t::CountTag>(exec, 0, srcs.extent(0)),
+                       functor_t(srcs, dsts, srcs, rowmap, rowmap_t(), rowmap_t(), symmetrize, remove_self_loops));
+  size_type numEntries = 0;
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(exec, size_type(rowmap.extent(0)), rowmap, numEntries);
+  return numEntries;
+}
+
+/// \brief Scatters the edges into entries (and the weights into values, if
+/// not empty), given the rowmap from edge_list_to_crs_rowmap. The rows are
+/// not sorted.
+template <typename exec_space, typename rowmap_t, typename entries_t, typename values_t, typename srcs_t,
+          typename dsts_t, typename weights_t>
+void edge_list_to_crs_fill(const exec_space &exec, const rowmap_t &rowmap, const entries_t &entries,
+                           const values_t &values, const srcs_t &srcs, const dsts_t &dsts, const weights_t &weights,
+                           bool symmetrize, bool remove_self_loops) {
+  using cursor_t  = Kokkos::View<typename rowmap_t::non_const_value_type *, typename rowmap_t::device_type>;
+  using functor_t = EdgeListToCrsFunctor<cursor_t, entries_t, values_t, srcs_t, dsts_t, weights_t>;
+  const size_t nv = rowmap.extent(0) - 1;
+  cursor_t cursor(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "EdgeListToCrs cursor"), nv);
+  Kokkos::deep_copy(exec, cursor, Kokkos::subview(rowmap, Kokkos::make_pair(size_t(0), nv)));
+  Kokkos::parallel_for("KokkosSparse::EdgeListToCrs::Fill",
+                       Kokkos::RangePolicy<exec_space, typename functor_t::FillTag>(exec, 0, srcs.extent(0)),
+                       functor_t(srcs, dsts, weights, cursor, entries, values, symmetrize, remove_self_loops));
+}
+
+/// \brief Builds a graph from an edge list, in parallel.
+///
+/// Counting the degrees, scanning them and scattering the edges are parallel
+/// passes over the edge list, after which the rows are sorted and duplicate
+/// edges merged (KokkosSparse::sort_and_merge_graph). There is no serial step,
+/// so the construction is limited by memory bandwidth.
+///
+/// \tparam crsGraph_t A Kokkos::StaticCrsGraph with non-const entries
+/// \param exec The execution space instance to run on
+/// \param nv Number of vertices; every source and destination must be in [0, nv)
+/// \param srcs Sources of the edges, a view accessible from exec
+/// \param dsts Destinations of the edges, same length as srcs
+/// \param symmetrize Whether the edges are undirected: (dst, src) is added for
+///   every edge (src, dst)
+/// \param remove_self_loops Whether the edges (v, v) are dropped
+/// \return The graph, with nv rows sorted by column and without duplicates
+template <typename crsGraph_t, typename srcs_t, typename dsts_t>
+crsGraph_t kk_edge_list_to_crs_graph(const typename crsGraph_t::execution_space &exec,
+                                     typename crsGraph_t::data_type nv, const srcs_t &srcs, const dsts_t &dsts,
+                                     bool symmetrize = false, bool remove_self_loops = true) {
+  using rowmap_t  = typename crsGraph_t::row_map_type::non_const_type;
+  using entries_t = typename crsGraph_t::entries_type::non_const_type;
+  using lno_t     = typename entries_t::non_const_value_type;
+
+  rowmap_t rowmap(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "EdgeListToCrs rowmap"), nv + 1);
+  const auto numEntries = edge_list_to_crs_rowmap(exec, rowmap, srcs, dsts, symmetrize, remove_self_loops);
+  entries_t entries(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "EdgeListToCrs entries"), numEntries);
+  edge_list_to_crs_fill(exec, rowmap, entries, entries_t(), srcs, dsts, srcs, symmetrize, remove_self_loops);
+
+  rowmap_t mergedRowmap;
+  entries_t mergedEntries;
+  KokkosSparse::sort_and_merge_graph(exec, rowmap, entries, mergedRowmap, mergedEntries, lno_t(nv));
+  return crsGraph_t(mergedEntries, mergedRowmap);
+}
+
+template <typename crsGraph_t, typename srcs_t, typename dsts_t>
+crsGraph_t kk_edge_list_to_crs_graph(typename crsGraph_t::data_type nv, const srcs_t &srcs, const dsts_t &dsts,
+                                     bool symmetrize = false, bool remove_self_loops = true) {
+  return kk_edge_list_to_crs_graph<crsGraph_t>(typename crsGraph_t::execution_space(), nv, srcs, dsts, symmetrize,
+                                               remove_self_loops);
+}
+
+// Host arrays in, host arrays out: the edge list to CRS conversions below keep
+// duplicates and self loops, and sort every row by destination.
 template <typename size_type, typename lno_t, typename wt>
 void convert_edge_list_to_csr(lno_t nv, size_type ne, lno_t *srcs, lno_t *dests, wt *ew, size_type *xadj, lno_t *adj,
                               wt *crs_ew) {
-  std::vector<struct KokkosKernels::Impl::Edge<lno_t, wt>> edges(ne);
-  for (size_type i = 0; i < ne; ++i) {
-    edges[i].src = srcs[i];
-    edges[i].dst = dests[i];
-    edges[i].ew  = ew[i];
-  }
-  std::sort(edges.begin(), edges.begin() + ne);
-
-  size_type eind = 0;
-  for (lno_t i = 0; i < nv; ++i) {
-    (xadj)[i] = eind;
-    while (edges[eind].src == i) {
-      (adj)[eind]     = edges[eind].dst;
-      (*crs_ew)[eind] = edges[eind].ew;
-      ++eind;
-    }
-  }
-  xadj[nv] = eind;
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+  using unmanaged  = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  Kokkos::View<size_type *, Kokkos::HostSpace, unmanaged> rowmap(xadj, nv + 1);
+  Kokkos::View<lno_t *, Kokkos::HostSpace, unmanaged> srcs_v(srcs, ne), dsts_v(dests, ne), entries(adj, ne);
+  Kokkos::View<wt *, Kokkos::HostSpace, unmanaged> weights(ew, ne), values(crs_ew, ne);
+  exec_space exec;
+  edge_list_to_crs_rowmap(exec, rowmap, srcs_v, dsts_v, false, false);
+  edge_list_to_crs_fill(exec, rowmap, entries, values, srcs_v, dsts_v, weights, false, false);
+  KokkosSparse::sort_crs_matrix(exec, rowmap, entries, values, nv);
+  exec.fence();
 }
 
 template <typename in_lno_t, typename size_type, typename lno_t>
 void convert_undirected_edge_list_to_csr(lno_t nv, size_type ne, in_lno_t *srcs, in_lno_t *dests, size_type *xadj,
                                          lno_t *adj) {
-  std::vector<struct KokkosKernels::Impl::Edge<lno_t, double>> edges(ne * 2);
-  for (size_type i = 0; i < ne; ++i) {
-    edges[i * 2].src = srcs[i];
-    edges[i * 2].dst = dests[i];
-
-    edges[i * 2 + 1].src = dests[i];
-    edges[i * 2 + 1].dst = srcs[i];
-  }
-#ifdef KOKKOSKERNELS_HAVE_OUTER
-#include <parallel/multiseq_selection.h>
-#include <parallel/multiway_merge.h>
-#include <parallel/merge.h>
-#include <parallel/multiway_mergesort.h>
-  __gnu_parallel::parallel_sort_mwms<false, true, struct KokkosKernels::Impl::Edge<lno_t, double> *>(
-      &(edges[0]), &(edges[0]) + ne * 2, std::less<struct KokkosKernels::Impl::Edge<lno_t, double>>(), 64);
-#else
-  std::sort(edges.begin(), edges.begin() + ne * 2);
-#endif
-
-  size_type eind = 0;
-  for (lno_t i = 0; i < nv; ++i) {
-    (xadj)[i] = eind;
-    while (edges[eind].src == i) {
-      (adj)[eind] = edges[eind].dst;
-      //(*crs_ew)[eind] = edges[eind].ew;
-      ++eind;
-    }
-  }
-  xadj[nv] = eind;
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+  using unmanaged  = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  Kokkos::View<size_type *, Kokkos::HostSpace, unmanaged> rowmap(xadj, nv + 1);
+  Kokkos::View<in_lno_t *, Kokkos::HostSpace, unmanaged> srcs_v(srcs, ne), dsts_v(dests, ne);
+  Kokkos::View<lno_t *, Kokkos::HostSpace, unmanaged> entries(adj, 2 * ne);
+  // every edge is stored in both directions, including self loops
+  exec_space exec;
+  edge_list_to_crs_rowmap(exec, rowmap, srcs_v, dsts_v, true, false);
+  edge_list_to_crs_fill(exec, rowmap, entries, decltype(entries)(), srcs_v, dsts_v, srcs_v, true, false);
+  KokkosSparse::sort_crs_graph(exec, rowmap, entries, nv);
+  exec.fence();
 }
 
 template <typename lno_t, typename size_type, typename scalar_t>
@@ -36,7 +36,12 @@ namespace KokkosSparse {
 // duplicated entries in A, A is sorted and returned (instead of a newly
 // allocated matrix).
 
-enum class SortAlgorithm { DEFAULT, PARALLEL_THREAD_LEVEL, BULK_SORT };
+// BINNED groups the rows by length: short rows are sorted with sorting
+// networks, medium rows by one team each, and the few very long rows of a
+// skewed matrix by one device-wide segmented radix sort, so that no single
+// thread or team ends up with most of the work. It is only implemented for
+// matrices: the graph sorts throw if given BINNED.
+enum class SortAlgorithm { DEFAULT, PARALLEL_THREAD_LEVEL, BULK_SORT, BINNED };
 
 // Sort a CRS matrix: within each row, sort entries ascending by column.
 // At the same time, permute the values.
@@ -66,6 +71,10 @@ void sort_crs_matrix(const execution_space& exec, const rowmap_t& rowmap, const
     return;
   }
   Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
+  if (option == SortAlgorithm::BINNED) {
+    KokkosSparse::Impl::sortCrsMatrixBinned(exec, rowmap, entries, values);
+    return;
+  }
   if constexpr (!KokkosKernels::Impl::is_gpu_exec_space_v<execution_space>) {
     // On CPUs, use a sequential radix sort within each row.
     Kokkos::parallel_for("sort_crs_matrix[CPU,radix]",
@@ -73,13 +82,18 @@ void sort_crs_matrix(const execution_space& exec, const rowmap_t& rowmap, const
                          Impl::MatrixRadixSortFunctor<rowmap_t, entries_t, values_t>(rowmap, entries, values));
   } else {
     // On GPUs:
-    //   If the matrix is highly imbalanced, or has long rows AND the dimensions
-    //   are not too large to do one large bulk sort, do that. Otherwise, sort
-    //   using one Kokkos thread per row.
+    //   If the matrix is highly imbalanced, sort its rows binned by length.
+    //   If it has long rows AND the dimensions are not too large to do one
+    //   large bulk sort, do that. Otherwise, sort using one Kokkos thread per
+    //   row.
     Ordinal avgDeg   = (entries.extent(0) + numRows - 1) / numRows;
     bool useBulkSort = option == SortAlgorithm::BULK_SORT;
     if (option == SortAlgorithm::DEFAULT) {
       Ordinal maxDeg = KokkosSparse::Impl::graph_max_degree(exec, rowmap);
+      if (maxDeg / 10 > avgDeg && maxDeg > KokkosSparse::Impl::BinnedSortThresholds::longRowLength) {
+        KokkosSparse::Impl::sortCrsMatrixBinned(exec, rowmap, entries, values);
+        return;
+      }
       if (KokkosSparse::Impl::useBulkSortHeuristic<execution_space>(avgDeg, maxDeg)) {
         // Calculate the true number of columns if user didn't pass it in
         if (numCols == Kokkos::ArithTraits<Ordinal>::max()) {
@@ -219,6 +233,8 @@ void sort_crs_graph(const execution_space& exec, const rowmap_t& rowmap, const e
                 "sort_crs_graph: entries_t is not accessible from the given execution "
                 "space");
   static_assert(!std::is_const_v<typename entries_t::value_type>, "sort_crs_graph: entries_t must not be const-valued");
+  if (option == SortAlgorithm::BINNED)
+    KokkosKernels::Impl::throw_runtime_exception("sort_crs_graph: SortAlgorithm::BINNED is only for matrices");
   Ordinal numRows = rowmap.extent(0) ? rowmap.extent(0) - 1 : 0;
   if (entries.extent(0) <= size_t(1)) {
     return;
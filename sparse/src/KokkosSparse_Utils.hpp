@@ -15,15 +15,18 @@
 //@HEADER
 #ifndef KOKKOSKERNELS_SPARSEUTILS_HPP
 #define KOKKOSKERNELS_SPARSEUTILS_HPP
+#include <string>
 #include <vector>
 
 #include "Kokkos_Core.hpp"
 #include "KokkosKernels_SimpleUtils.hpp"
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Sorting.hpp"
 #include "KokkosKernels_PrintUtils.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_BsrMatrix.hpp"
+#include "KokkosSparse_sort_crs_impl.hpp"
 #include "Kokkos_Bitset.hpp"
 #include "KokkosGraph_RCM.hpp"
 #include "KokkosGraph_RCB.hpp"
@@ -242,20 +245,49 @@ void kk_create_bsr_from_bsr_formatted_point_crs(int block_size, size_t num_rows,
   out_num_cols = out.numCols();
 }
 
+/// \brief Transpose of a CRS matrix (or graph), with sorted rows.
+///
+/// On host backends this is a stable counting sort of the entries by column,
+/// without atomics. The entries are split into num_blocks contiguous slices of
+/// equal length, one per thread. Each thread counts the columns of its slice
+/// into its own row of a num_blocks x num_cols histogram; the histogram is
+/// scanned column-major, and each thread then scatters its slice to the
+/// offsets of its row. The entries of each row of the transpose come out
+/// ordered by slice, and within a slice by position: the output is sorted by
+/// row index and does not depend on the schedule.
+///
+/// When the histogram would leave too few slices to keep the device busy (on
+/// GPU backends, or on host when num_cols is large compared to nnz), the
+/// entries are instead radix sorted by column with radixSortByKey, whose
+/// passes are themselves device-wide stable counting sorts. The row pointers
+/// of the transpose are then read off the sorted columns, and the entries
+/// gathered in sorted order. Both ways give the same output.
 template <typename in_row_view_t, typename in_nnz_view_t, typename in_scalar_view_t, typename out_row_view_t,
           typename out_nnz_view_t, typename out_scalar_view_t, typename tempwork_row_view_t, typename MyExecSpace>
 struct TransposeMatrix {
   struct CountTag {};
+  struct ScanTag {};
   struct FillTag {};
+  struct SortKeysTag {};
+  struct SortedRowMapTag {};
+  struct SortedFillTag {};
+
+  using count_policy_t         = Kokkos::RangePolicy<CountTag, MyExecSpace>;
+  using scan_policy_t          = Kokkos::RangePolicy<ScanTag, MyExecSpace>;
+  using fill_policy_t          = Kokkos::RangePolicy<FillTag, MyExecSpace>;
+  using sort_keys_policy_t     = Kokkos::RangePolicy<SortKeysTag, MyExecSpace>;
+  using sorted_rowmap_policy_t = Kokkos::RangePolicy<SortedRowMapTag, MyExecSpace>;
+  using sorted_fill_policy_t   = Kokkos::RangePolicy<SortedFillTag, MyExecSpace>;
 
-  using team_count_policy_t = Kokkos::TeamPolicy<CountTag, MyExecSpace>;
-  using team_fill_policy_t  = Kokkos::TeamPolicy<FillTag, MyExecSpace>;
+  using nnz_lno_t  = typename in_nnz_view_t::non_const_value_type;
+  using size_type  = typename in_row_view_t::non_const_value_type;
+  using value_type = size_type;  // of the scan
 
-  using team_count_member_t = typename team_count_policy_t::member_type;
-  using team_fill_member_t  = typename team_fill_policy_t::member_type;
+  using sort_key_t    = std::make_unsigned_t<nnz_lno_t>;
+  using sort_keys_t   = Kokkos::View<sort_key_t *, MyExecSpace>;
+  using sort_values_t = Kokkos::View<size_type *, MyExecSpace>;
 
-  using nnz_lno_t = typename in_nnz_view_t::non_const_value_type;
-  using size_type = typename in_row_view_t::non_const_value_type;
+  static constexpr bool use_radix_sort = KokkosKernels::Impl::is_gpu_exec_space_v<MyExecSpace>;
 
   nnz_lno_t num_rows;
   nnz_lno_t num_cols;
@@ -265,13 +297,19 @@ struct TransposeMatrix {
   out_row_view_t t_xadj;     // allocated
   out_nnz_view_t t_adj;      // allocated
   out_scalar_view_t t_vals;  // allocated
-  tempwork_row_view_t tmp_txadj;
+  // num_blocks x num_cols: entries of each slice per column, then the next
+  // position of the slice in each row of the transpose
+  tempwork_row_view_t block_offsets;
+  // With the radix sort: the column of each entry (num_cols past the
+  // entries of the rows), and the entry itself
+  sort_keys_t sort_keys;
+  sort_values_t sort_values;
   bool transpose_values;
-  nnz_lno_t team_work_size;
+  size_type num_blocks;  // slices of the counting sort
 
   TransposeMatrix(nnz_lno_t num_rows_, nnz_lno_t num_cols_, in_row_view_t xadj_, in_nnz_view_t adj_,
                   in_scalar_view_t vals_, out_row_view_t t_xadj_, out_nnz_view_t t_adj_, out_scalar_view_t t_vals_,
-                  tempwork_row_view_t tmp_txadj_, bool transpose_values_, nnz_lno_t team_row_work_size_)
+                  bool transpose_values_)
       : num_rows(num_rows_),
         num_cols(num_cols_),
         xadj(xadj_),
@@ -280,101 +318,198 @@ struct TransposeMatrix {
         t_xadj(t_xadj_),
         t_adj(t_adj_),
         t_vals(t_vals_),
-        tmp_txadj(tmp_txadj_),
+        block_offsets(),
+        sort_keys(),
+        sort_values(),
         transpose_values(transpose_values_),
-        team_work_size(team_row_work_size_) {}
+        num_blocks(1) {}
+
+  // Number of slices: one per thread of the device, while keeping the
+  // num_blocks x num_cols histogram within a few times nnz.
+  static size_type suggested_num_blocks(const MyExecSpace &space, nnz_lno_t num_cols_, size_type nnz) {
+    if (num_cols_ == 0 || nnz == 0) return 1;
+    size_t blocks = (size_t(4) * nnz) / size_t(num_cols_);
+    blocks        = KOKKOSKERNELS_MACRO_MIN(blocks, size_t(space.concurrency()));
+    blocks        = KOKKOSKERNELS_MACRO_MIN(blocks, size_t(nnz));
+    return KOKKOSKERNELS_MACRO_MAX(size_type(blocks), size_type(1));
+  }
+
+  // Start of part i when splitting n into parts as evenly as possible
+  template <typename T>
+  KOKKOS_INLINE_FUNCTION static T split_begin(const T n, const T parts, const T i) {
+    const T q = n / parts, r = n % parts;
+    return i * q + KOKKOSKERNELS_MACRO_MIN(i, r);
+  }
+
+  // The row containing entry k: xadj(row) <= k < xadj(row + 1)
+  KOKKOS_INLINE_FUNCTION nnz_lno_t row_of_entry(const size_type k) const {
+    nnz_lno_t lo = 0, hi = num_rows;
+    while (hi - lo > 1) {
+      const nnz_lno_t mid = lo + (hi - lo) / 2;
+      if (size_type(xadj(mid)) <= k)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+
+  // Call f(row, entry) for the entries of slice b, in order
+  template <typename F>
+  KOKKOS_INLINE_FUNCTION void for_each_block_entry(const size_type b, const F &f) const {
+    if (num_rows == 0) return;
+    const size_type nnz_begin = xadj(0);
+    const size_type nnz       = xadj(num_rows) - nnz_begin;
+    const size_type begin     = nnz_begin + split_begin(nnz, num_blocks, b);
+    const size_type end       = nnz_begin + split_begin(nnz, num_blocks, b + 1);
+    if (begin == end) return;
+    nnz_lno_t row = row_of_entry(begin);
+    for (size_type k = begin; k < end; ++k) {
+      while (size_type(xadj(row + 1)) <= k) ++row;
+      f(row, k);
+    }
+  }
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(const CountTag &, const team_count_member_t &teamMember) const {
-    const nnz_lno_t team_row_begin = teamMember.league_rank() * team_work_size;
-    const nnz_lno_t team_row_end   = KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, num_rows);
-    // TODO we dont need to go over rows
-    // just go over nonzeroes.
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(teamMember, team_row_begin, team_row_end),
-                         [&](const nnz_lno_t &row_index) {
-                           const size_type col_begin = xadj[row_index];
-                           const size_type col_end   = xadj[row_index + 1];
-                           const nnz_lno_t left_work = col_end - col_begin;
-                           Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, left_work), [&](nnz_lno_t i) {
-                             const size_type adjind   = i + col_begin;
-                             const nnz_lno_t colIndex = adj[adjind];
-                             typedef typename std::remove_reference<decltype(t_xadj(0))>::type atomic_incr_type;
-                             Kokkos::atomic_fetch_add(&(t_xadj(colIndex)), atomic_incr_type(1));
-                           });
-                         });
+  void operator()(const CountTag &, const size_type b) const {
+    const size_type base = b * size_type(num_cols);
+    for (nnz_lno_t c = 0; c < num_cols; ++c) block_offsets(base + c) = 0;
+    for_each_block_entry(b, [&](const nnz_lno_t, const size_type k) { ++block_offsets(base + adj(k)); });
   }
 
+  // Exclusive scan of the counts in (column, slice) order; the offset of
+  // slice 0 in each column is the row pointer of the transpose.
   KOKKOS_INLINE_FUNCTION
-  void operator()(const FillTag &, const team_fill_member_t &teamMember) const {
-    const nnz_lno_t team_row_begin = teamMember.league_rank() * team_work_size;
-    const nnz_lno_t team_row_end   = KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, num_rows);
+  void operator()(const ScanTag &, const size_type i, size_type &update, const bool final) const {
+    const nnz_lno_t c     = i / num_blocks;
+    const size_type b     = i % num_blocks;
+    const size_type idx   = b * size_type(num_cols) + c;
+    const size_type count = block_offsets(idx);
+    if (final) {
+      block_offsets(idx) = update;
+      if (b == 0) t_xadj(c) = update;
+      if (i + 1 == num_blocks * size_type(num_cols)) t_xadj(num_cols) = update + count;
+    }
+    update += count;
+  }
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(teamMember, team_row_begin, team_row_end), [&](const nnz_lno_t &row_index) {
-          // const nnz_lno_t teamsize = teamMember.team_size();
-          // for (nnz_lno_t row_index = team_row_begin + teamMember.team_rank();
-          // row_index < team_row_end; row_index += teamsize){
-          const size_type col_begin = xadj[row_index];
-          const size_type col_end   = xadj[row_index + 1];
-          const nnz_lno_t left_work = col_end - col_begin;
-          Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, left_work), [&](nnz_lno_t i) {
-            const size_type adjind   = i + col_begin;
-            const nnz_lno_t colIndex = adj[adjind];
-            typedef typename std::remove_reference<decltype(tmp_txadj(0))>::type atomic_incr_type;
-            const size_type pos = Kokkos::atomic_fetch_add(&(tmp_txadj(colIndex)), atomic_incr_type(1));
-
-            t_adj(pos) = row_index;
-            if (transpose_values) {
-              t_vals(pos) = vals[adjind];
-            }
-          });
-          //}
-        });
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const FillTag &, const size_type b) const {
+    const size_type base = b * size_type(num_cols);
+    for_each_block_entry(b, [&](const nnz_lno_t row_index, const size_type k) {
+      const size_type pos = block_offsets(base + adj(k))++;
+      t_adj(pos)          = row_index;
+      if (transpose_values) {
+        t_vals(pos) = vals[k];
+      }
+    });
+  }
+
+  // Entry k sorts by its column; the positions of adj outside of the rows
+  // sort last, under the key num_cols.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const SortKeysTag &, const size_type k) const {
+    const bool in_rows = num_rows > 0 && size_type(xadj(0)) <= k && k < size_type(xadj(num_rows));
+    sort_keys(k)       = in_rows ? sort_key_t(adj(k)) : sort_key_t(num_cols);
+    sort_values(k)     = k;
+  }
+
+  // t_xadj(c) is the first sorted position with a column >= c. Position pos
+  // sets it for the columns between the one before it and its own, and
+  // position nnz for the columns after the last entry.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const SortedRowMapTag &, const size_type pos) const {
+    const size_type nnz   = sort_keys.extent(0);
+    const sort_key_t from = pos == 0 ? sort_key_t(0) : sort_key_t(sort_keys(pos - 1) + 1);
+    const sort_key_t to   = pos == nnz ? sort_key_t(num_cols) : sort_keys(pos);
+    for (sort_key_t c = from; c <= to; ++c) t_xadj(c) = pos;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const SortedFillTag &, const size_type pos) const {
+    if (sort_keys(pos) == sort_key_t(num_cols)) return;
+    const size_type k = sort_values(pos);
+    t_adj(pos)        = row_of_entry(k);
+    if (transpose_values) {
+      t_vals(pos) = vals[k];
+    }
   }
 };
 
+/// \brief Run TransposeMatrix on space: the counting sort when there are
+///   enough slices to use all of the threads, and the radix sort by column
+///   otherwise. Either way the rows of the transpose are sorted and the
+///   result is the same on every run.
+template <typename ExecSpace, typename TransposeFunctor_t>
+void run_transpose(const ExecSpace &space, TransposeFunctor_t tm, const std::string &label) {
+  using size_type = typename TransposeFunctor_t::size_type;
+  using work_t    = decltype(tm.block_offsets);
+
+  const size_type nnz = tm.adj.extent(0);
+
+  if (tm.num_cols == 0) return;  // t_xadj stays 0
+
+  tm.num_blocks = TransposeFunctor_t::suggested_num_blocks(space, tm.num_cols, nnz);
+  const size_type busy_blocks =
+      KOKKOSKERNELS_MACRO_MIN(size_type(space.concurrency()), KOKKOSKERNELS_MACRO_MAX(nnz, size_type(1)));
+  if (TransposeFunctor_t::use_radix_sort || tm.num_blocks < busy_blocks) {
+    using keys_t   = typename TransposeFunctor_t::sort_keys_t;
+    using values_t = typename TransposeFunctor_t::sort_values_t;
+
+    tm.sort_keys   = keys_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "transpose keys"), nnz);
+    tm.sort_values = values_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "transpose entries"), nnz);
+    Kokkos::parallel_for(label + "::keys", typename TransposeFunctor_t::sort_keys_policy_t(space, 0, nnz), tm);
+    KokkosKernels::radixSortByKey(space, tm.sort_keys, tm.sort_values);
+    Kokkos::parallel_for(label + "::row_map", typename TransposeFunctor_t::sorted_rowmap_policy_t(space, 0, nnz + 1),
+                         tm);
+    Kokkos::parallel_for(label + "::fill", typename TransposeFunctor_t::sorted_fill_policy_t(space, 0, nnz), tm);
+  } else {
+    using count_tp_t = typename TransposeFunctor_t::count_policy_t;
+    using scan_tp_t  = typename TransposeFunctor_t::scan_policy_t;
+    using fill_tp_t  = typename TransposeFunctor_t::fill_policy_t;
+
+    tm.block_offsets = work_t(Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "block_offsets"),
+                              tm.num_blocks * size_type(tm.num_cols));
+    Kokkos::parallel_for(label + "::count", count_tp_t(space, 0, tm.num_blocks), tm);
+    Kokkos::parallel_scan(label + "::scan", scan_tp_t(space, 0, tm.num_blocks * size_type(tm.num_cols)), tm);
+    Kokkos::parallel_for(label + "::fill", fill_tp_t(space, 0, tm.num_blocks), tm);
+  }
+}
+
+/// \brief Transpose of a CRS matrix, running on the given execution space
+///   instance. Unlike the overload without it, this one does not fence.
 template <typename in_row_view_t, typename in_nnz_view_t, typename in_scalar_view_t, typename out_row_view_t,
           typename out_nnz_view_t, typename out_scalar_view_t, typename tempwork_row_view_t, typename MyExecSpace>
-void transpose_matrix(typename in_nnz_view_t::non_const_value_type num_rows,
+void transpose_matrix(const MyExecSpace &space, typename in_nnz_view_t::non_const_value_type num_rows,
                       typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj, in_nnz_view_t adj,
                       in_scalar_view_t vals,
                       out_row_view_t t_xadj,    // pre-allocated -- initialized with 0
                       out_nnz_view_t t_adj,     // pre-allocated -- no need for initialize
                       out_scalar_view_t t_vals  // pre-allocated -- no need for initialize
 ) {
-  // allocate some memory for work for row pointers
-  tempwork_row_view_t tmp_row_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "tmp_row_view"), num_cols + 1);
-
   // create the functor for tranpose.
   typedef TransposeMatrix<in_row_view_t, in_nnz_view_t, in_scalar_view_t, out_row_view_t, out_nnz_view_t,
                           out_scalar_view_t, tempwork_row_view_t, MyExecSpace>
       TransposeFunctor_t;
 
-  typedef typename TransposeFunctor_t::team_count_policy_t count_tp_t;
-  typedef typename TransposeFunctor_t::team_fill_policy_t fill_tp_t;
-
-  typename in_row_view_t::non_const_value_type nnz = adj.extent(0);
+  TransposeFunctor_t tm(num_rows, num_cols, xadj, adj, vals, t_xadj, t_adj, t_vals, true);
 
-  // determine vector lanes per thread
-  int thread_size =
-      kk_get_suggested_vector_size(num_rows, nnz, KokkosKernels::Impl::kk_get_exec_space_type<MyExecSpace>());
-
-  // determine threads per team
-  int team_size = kk_get_suggested_team_size(thread_size, KokkosKernels::Impl::kk_get_exec_space_type<MyExecSpace>());
-
-  TransposeFunctor_t tm(num_rows, num_cols, xadj, adj, vals, t_xadj, t_adj, t_vals, tmp_row_view, true, team_size);
-
-  Kokkos::parallel_for("KokkosSparse::Impl::transpose_matrix::S0",
-                       count_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
-
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(num_cols + 1, t_xadj);
-
-  Kokkos::deep_copy(tmp_row_view, t_xadj);
-
-  Kokkos::parallel_for("KokkosSparse::Impl::transpose_matrix::S1",
-                       fill_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
+  run_transpose(space, tm, "KokkosSparse::Impl::transpose_matrix");
+}
 
-  MyExecSpace().fence();
+template <typename in_row_view_t, typename in_nnz_view_t, typename in_scalar_view_t, typename out_row_view_t,
+          typename out_nnz_view_t, typename out_scalar_view_t, typename tempwork_row_view_t, typename MyExecSpace>
+void transpose_matrix(typename in_nnz_view_t::non_const_value_type num_rows,
+                      typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj, in_nnz_view_t adj,
+                      in_scalar_view_t vals,
+                      out_row_view_t t_xadj,    // pre-allocated -- initialized with 0
+                      out_nnz_view_t t_adj,     // pre-allocated -- no need for initialize
+                      out_scalar_view_t t_vals  // pre-allocated -- no need for initialize
+) {
+  MyExecSpace space;
+  transpose_matrix<in_row_view_t, in_nnz_view_t, in_scalar_view_t, out_row_view_t, out_nnz_view_t, out_scalar_view_t,
+                   tempwork_row_view_t, MyExecSpace>(space, num_rows, num_cols, xadj, adj, vals, t_xadj, t_adj, t_vals);
+  space.fence();
 }
 
 template <typename crsMat_t>
@@ -403,9 +538,6 @@ void transpose_graph(typename in_nnz_view_t::non_const_value_type num_rows,
                      out_row_view_t t_xadj,  // pre-allocated -- initialized with 0
                      out_nnz_view_t t_adj    // pre-allocated -- no need for initialize
 ) {
-  // allocate some memory for work for row pointers
-  tempwork_row_view_t tmp_row_view(Kokkos::view_alloc(Kokkos::WithoutInitializing, "tmp_row_view"), num_cols + 1);
-
   in_nnz_view_t tmp1;
   out_nnz_view_t tmp2;
 
@@ -414,31 +546,12 @@ void transpose_graph(typename in_nnz_view_t::non_const_value_type num_rows,
                           tempwork_row_view_t, MyExecSpace>
       TransposeFunctor_t;
 
-  typedef typename TransposeFunctor_t::team_count_policy_t count_tp_t;
-  typedef typename TransposeFunctor_t::team_fill_policy_t fill_tp_t;
+  MyExecSpace space;
+  TransposeFunctor_t tm(num_rows, num_cols, xadj, adj, tmp1, t_xadj, t_adj, tmp2, false);
 
-  typename in_row_view_t::non_const_value_type nnz = adj.extent(0);
+  run_transpose(space, tm, "KokkosKernels::Impl::transpose_graph");
 
-  // determine vector lanes per thread
-  int thread_size =
-      kk_get_suggested_vector_size(num_rows, nnz, KokkosKernels::Impl::kk_get_exec_space_type<MyExecSpace>());
-
-  // determine threads per team
-  int team_size = kk_get_suggested_team_size(thread_size, KokkosKernels::Impl::kk_get_exec_space_type<MyExecSpace>());
-
-  TransposeFunctor_t tm(num_rows, num_cols, xadj, adj, tmp1, t_xadj, t_adj, tmp2, tmp_row_view, false, team_size);
-
-  Kokkos::parallel_for("KokkosKernels::Impl::transpose_graph::S0",
-                       count_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
-
-  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<MyExecSpace>(num_cols + 1, t_xadj);
-
-  Kokkos::deep_copy(tmp_row_view, t_xadj);
-
-  Kokkos::parallel_for("KokkosKernels::Impl::transpose_graph::S1",
-                       fill_tp_t((num_rows + team_size - 1) / team_size, team_size, thread_size), tm);
-
-  MyExecSpace().fence();
+  space.fence();
 }
 
 template <typename in_row_view_t, typename in_nnz_view_t, typename in_scalar_view_t, typename out_row_view_t,
@@ -0,0 +1,283 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_VbrMatrix.hpp
+/// \brief Local sparse matrix interface
+///
+/// This file provides KokkosSparse::Experimental::VbrMatrix.
+/// This implements a local (no MPI) sparse matrix stored in variable block
+/// row (VBR) format: the point rows and point columns are partitioned into
+/// contiguous blocks of possibly different sizes, and every stored block is
+/// a dense (row block size) x (column block size) matrix.
+
+#ifndef KOKKOSSPARSE_VBRMATRIX_HPP_
+#define KOKKOSSPARSE_VBRMATRIX_HPP_
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosSparse_StaticCrsGraph.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_default_types.hpp"
+
+namespace KokkosSparse {
+
+namespace Experimental {
+
+/// \class VbrMatrix
+/// \brief Variable block row implementation of a sparse matrix.
+/// \tparam ScalarType The type of entries in the sparse matrix.
+/// \tparam OrdinalType The type of (block) column indices in the sparse matrix.
+/// \tparam Device The Kokkos Device type.
+/// \tparam MemoryTraits Traits describing how Kokkos manages and
+///   accesses data.  The default parameter suffices for most users.
+/// \tparam SizeType The type of the block row map and of the value offsets.
+///
+/// The storage follows the classical VBR layout (Saad, SPARSKIT):
+/// <ul>
+/// <li> \c block_row_ptr (rpntr) holds the first point row of each block row,
+///      length numRows()+1 </li>
+/// <li> \c block_col_ptr (cpntr) holds the first point column of each block
+///      column, length numCols()+1 </li>
+/// <li> \c graph holds the block sparsity pattern: graph.row_map (bpntr) and
+///      graph.entries (bindx, block column indices) </li>
+/// <li> \c block_val_ptr (indx) holds the offset of each stored block into
+///      \c values, length nnz()+1 </li>
+/// <li> \c values holds the blocks one after the other, each one in
+///      LayoutRight (row major) order </li>
+/// </ul>
+///
+/// As with BsrMatrix, numRows(), numCols() and nnz() count blocks; the point
+/// dimensions are available through numPointRows() and numPointCols().
+template <class ScalarType, class OrdinalType, class Device, class MemoryTraits = void,
+          class SizeType = KokkosKernels::default_size_type>
+class VbrMatrix {
+  static_assert(std::is_signed<OrdinalType>::value, "VbrMatrix requires that OrdinalType is a signed integer type.");
+  static_assert(Kokkos::is_memory_traits_v<MemoryTraits> || std::is_void_v<MemoryTraits>,
+                "VbrMatrix: MemoryTraits (4th template param) must be a Kokkos "
+                "MemoryTraits or void");
+
+ private:
+  typedef typename Kokkos::ViewTraits<ScalarType*, Device, void, void>::host_mirror_space host_mirror_space;
+
+ public:
+  //! Type of the matrix's execution space.
+  typedef typename Device::execution_space execution_space;
+  //! Type of the matrix's memory space.
+  typedef typename Device::memory_space memory_space;
+  //! Type of the matrix's device type.
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+
+  //! Type of each value in the matrix.
+  typedef ScalarType value_type;
+  //! Type of each (block column) index in the matrix.
+  typedef OrdinalType ordinal_type;
+  typedef MemoryTraits memory_traits;
+  //! Type of each entry of the block row map and of the value offsets.
+  typedef SizeType size_type;
+
+  //! Type of a host-memory mirror of the sparse matrix.
+  typedef VbrMatrix<ScalarType, OrdinalType, host_mirror_space, MemoryTraits, size_type> HostMirror;
+  //! Type of the graph structure (block sparsity pattern) of the sparse matrix.
+  typedef StaticCrsGraph<ordinal_type, Kokkos::LayoutLeft, device_type, memory_traits, size_type> StaticCrsGraphType;
+  //! Type of the graph structure of the sparse matrix - consistent with Kokkos.
+  typedef StaticCrsGraph<ordinal_type, Kokkos::LayoutLeft, device_type, memory_traits, size_type> staticcrsgraph_type;
+  //! Type of block column indices in the sparse matrix.
+  typedef typename staticcrsgraph_type::entries_type index_type;
+  //! Const version of the type of column indices in the sparse matrix.
+  typedef typename index_type::const_value_type const_ordinal_type;
+  //! Nonconst version of the type of column indices in the sparse matrix.
+  typedef typename index_type::non_const_value_type non_const_ordinal_type;
+  //! Type of the "row map" (which contains the offset for each block row's blocks).
+  typedef typename staticcrsgraph_type::row_map_type row_map_type;
+  //! Const version of the type of row offsets in the sparse matrix.
+  typedef typename row_map_type::const_value_type const_size_type;
+  //! Nonconst version of the type of row offsets in the sparse matrix.
+  typedef typename row_map_type::non_const_value_type non_const_size_type;
+  //! Type of the point partition of the rows (rpntr) and of the columns (cpntr).
+  typedef Kokkos::View<const ordinal_type*, Kokkos::LayoutLeft, device_type, MemoryTraits> partition_type;
+  //! Type of the offsets of the blocks into \c values (indx).
+  typedef Kokkos::View<const size_type*, Kokkos::LayoutLeft, device_type, MemoryTraits> block_offsets_type;
+  //! Kokkos Array type of the entries (values) in the sparse matrix.
+  typedef Kokkos::View<value_type*, Kokkos::LayoutRight, device_type, MemoryTraits> values_type;
+  //! Const version of the type of the entries in the sparse matrix.
+  typedef typename values_type::const_value_type const_value_type;
+  //! Nonconst version of the type of the entries in the sparse matrix.
+  typedef typename values_type::non_const_value_type non_const_value_type;
+
+  //! Every block is stored contiguously in row major order
+  using block_layout_type = Kokkos::LayoutRight;
+
+  //! Type returned by \c unmanaged_block
+  using block_type = Kokkos::View<value_type**, block_layout_type, device_type, Kokkos::MemoryUnmanaged>;
+
+  //! Type returned by \c unmanaged_block_const
+  using const_block_type = Kokkos::View<const value_type**, block_layout_type, device_type, Kokkos::MemoryUnmanaged>;
+
+  /// \name Storage of the actual sparsity structure and values.
+  //@{
+  //! The block sparsity structure of the sparse matrix.
+  staticcrsgraph_type graph;
+  //! First point row of each block row (rpntr).
+  partition_type block_row_ptr;
+  //! First point column of each block column (cpntr).
+  partition_type block_col_ptr;
+  //! Offset of each stored block into \c values (indx).
+  block_offsets_type block_val_ptr;
+  //! The 1-D array of values of the sparse matrix.
+  values_type values;
+  //@}
+
+  /// \brief Default constructor; constructs an empty sparse matrix.
+  VbrMatrix() : graph(), block_row_ptr(), block_col_ptr(), block_val_ptr(), values() {}
+
+  //! Copy constructor (shallow copy).
+  template <typename SType, typename OType, class DType, class MTType, typename IType>
+  explicit VbrMatrix(const VbrMatrix<SType, OType, DType, MTType, IType>& B)
+      : graph(B.graph),
+        block_row_ptr(B.block_row_ptr),
+        block_col_ptr(B.block_col_ptr),
+        block_val_ptr(B.block_val_ptr),
+        values(B.values),
+        numCols_(B.numCols()),
+        numPointRows_(B.numPointRows()),
+        numPointCols_(B.numPointCols()) {}
+
+  /// \brief Constructor that accepts the full VBR description of the matrix.
+  ///
+  /// The matrix will store and use the input Views directly (by view
+  /// semantics, not by deep copy).
+  ///
+  /// \param label [in] The sparse matrix's label.
+  /// \param rowPtr [in] First point row of each block row, length nBlockRows+1.
+  /// \param colPtr [in] First point column of each block column, length
+  ///   nBlockCols+1.
+  /// \param rows [in] The block row map (bpntr), length nBlockRows+1.
+  /// \param cols [in] The block column indices (bindx).
+  /// \param valPtr [in] Offset of each block into \c vals, length cols.extent(0)+1.
+  /// \param vals [in] The blocks, each stored in row major order.
+  VbrMatrix(const std::string& /*label*/, const partition_type& rowPtr, const partition_type& colPtr,
+            const row_map_type& rows, const index_type& cols, const block_offsets_type& valPtr,
+            const values_type& vals)
+      : graph(cols, rows), block_row_ptr(rowPtr), block_col_ptr(colPtr), block_val_ptr(valPtr), values(vals) {
+    if (rowPtr.extent(0) != rows.extent(0)) {
+      std::ostringstream os;
+      os << "KokkosSparse::Experimental::VbrMatrix: rowPtr has length " << rowPtr.extent(0)
+         << " but the block row map has length " << rows.extent(0);
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    if (colPtr.extent(0) == 0) {
+      KokkosKernels::Impl::throw_runtime_exception(
+          "KokkosSparse::Experimental::VbrMatrix: colPtr must have at least one entry");
+    }
+    if (valPtr.extent(0) != cols.extent(0) + 1) {
+      std::ostringstream os;
+      os << "KokkosSparse::Experimental::VbrMatrix: valPtr has length " << valPtr.extent(0) << " but there are "
+         << cols.extent(0) << " blocks";
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    numCols_ = static_cast<ordinal_type>(colPtr.extent(0)) - 1;
+
+    ordinal_type lastRow = 0, lastCol = 0;
+    if (rowPtr.extent(0) > 0) {
+      Kokkos::deep_copy(lastRow, Kokkos::subview(rowPtr, rowPtr.extent(0) - 1));
+    }
+    Kokkos::deep_copy(lastCol, Kokkos::subview(colPtr, colPtr.extent(0) - 1));
+    numPointRows_ = lastRow;
+    numPointCols_ = lastCol;
+  }
+
+  //! Attempt to assign the input matrix to \c *this.
+  template <typename aScalarType, typename aOrdinalType, class aDevice, class aMemoryTraits, typename aSizeType>
+  VbrMatrix& operator=(const VbrMatrix<aScalarType, aOrdinalType, aDevice, aMemoryTraits, aSizeType>& mtx) {
+    graph         = mtx.graph;
+    block_row_ptr = mtx.block_row_ptr;
+    block_col_ptr = mtx.block_col_ptr;
+    block_val_ptr = mtx.block_val_ptr;
+    values        = mtx.values;
+    numCols_      = mtx.numCols();
+    numPointRows_ = mtx.numPointRows();
+    numPointCols_ = mtx.numPointCols();
+    return *this;
+  }
+
+  //! The number of block rows in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numRows() const { return graph.numRows(); }
+
+  //! The number of block columns in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numCols() const { return numCols_; }
+
+  //! The number of "point" (non-block) rows in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointRows() const { return numPointRows_; }
+
+  //! The number of "point" (non-block) columns in the matrix.
+  KOKKOS_INLINE_FUNCTION ordinal_type numPointCols() const { return numPointCols_; }
+
+  //! The number of stored blocks in the sparse matrix.
+  KOKKOS_INLINE_FUNCTION size_type nnz() const { return graph.entries.extent(0); }
+
+  //! The number of stored point entries (including explicit zeros inside blocks).
+  KOKKOS_INLINE_FUNCTION size_type numPointNnz() const { return values.extent(0); }
+
+  //! The number of point rows of block row \c i.
+  KOKKOS_INLINE_FUNCTION ordinal_type blockRowDim(const ordinal_type i) const {
+    return block_row_ptr(i + 1) - block_row_ptr(i);
+  }
+
+  //! The number of point columns of block column \c j.
+  KOKKOS_INLINE_FUNCTION ordinal_type blockColDim(const ordinal_type j) const {
+    return block_col_ptr(j + 1) - block_col_ptr(j);
+  }
+
+  /*! \brief return an unmanaged view of block k, which lives in block row i */
+  KOKKOS_INLINE_FUNCTION
+  block_type unmanaged_block(const ordinal_type i, const size_type k) const {
+    return block_type(&values(block_val_ptr(k)), blockRowDim(i), blockColDim(graph.entries(k)));
+  }
+  KOKKOS_INLINE_FUNCTION
+  const_block_type unmanaged_block_const(const ordinal_type i, const size_type k) const {
+    return const_block_type(&values(block_val_ptr(k)), blockRowDim(i), blockColDim(graph.entries(k)));
+  }
+
+ private:
+  ordinal_type numCols_      = 0;
+  ordinal_type numPointRows_ = 0;
+  ordinal_type numPointCols_ = 0;
+};
+
+//----------------------------------------------------------------------------
+/// \class is_vbr_matrix
+/// \brief is_vbr_matrix<T>::value is true if T is a VbrMatrix<...>, false
+/// otherwise
+template <typename>
+struct is_vbr_matrix : public std::false_type {};
+template <typename... P>
+struct is_vbr_matrix<VbrMatrix<P...>> : public std::true_type {};
+template <typename... P>
+struct is_vbr_matrix<const VbrMatrix<P...>> : public std::true_type {};
+
+/// \brief Equivalent to is_vbr_matrix<T>::value.
+template <typename T>
+inline constexpr bool is_vbr_matrix_v = is_vbr_matrix<T>::value;
+//----------------------------------------------------------------------------
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+#endif  // KOKKOSSPARSE_VBRMATRIX_HPP_
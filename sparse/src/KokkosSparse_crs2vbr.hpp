@@ -0,0 +1,193 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+
+#ifndef KOKKOSSPARSE_CRS2VBR_HPP
+#define KOKKOSSPARSE_CRS2VBR_HPP
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Check that \c ptr is a non-decreasing partition of [0, n)
+template <class HostPartition, class OrdinalType>
+void check_vbr_partition(const HostPartition &ptr, const OrdinalType n, const char *which) {
+  std::ostringstream os;
+  if (ptr.extent(0) == 0 || ptr(0) != 0 || ptr(ptr.extent(0) - 1) != n) {
+    os << "KokkosSparse::crs2vbr: the " << which << " partition must start at 0 and end at " << n;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  for (size_t i = 1; i < ptr.extent(0); ++i) {
+    if (ptr(i) <= ptr(i - 1)) {
+      os << "KokkosSparse::crs2vbr: the " << which << " partition is not strictly increasing at " << i;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+  }
+}
+
+/// \brief Build a VbrMatrix from a CrsMatrix and its row/column partitions.
+///
+/// The symbolic structure is built on the host (as in the BsrMatrix
+/// constructor that takes a CrsMatrix); block columns within each block row
+/// come out sorted. Point entries of the CrsMatrix that map to the same
+/// location are summed, and block entries without a CrsMatrix counterpart
+/// are explicit zeros.
+template <class Vbr, class Crs, class RowPartition, class ColPartition>
+Vbr crs2vbr(const Crs &crs, const RowPartition &rowPtr, const ColPartition &colPtr) {
+  using ordinal_type = typename Vbr::non_const_ordinal_type;
+  using size_type    = typename Vbr::non_const_size_type;
+  using value_type   = typename Vbr::non_const_value_type;
+  using device_type  = typename Vbr::device_type;
+
+  using partition_view_type = Kokkos::View<ordinal_type *, Kokkos::LayoutLeft, device_type>;
+  using offsets_view_type   = Kokkos::View<size_type *, Kokkos::LayoutLeft, device_type>;
+  using row_map_view_type   = typename Vbr::row_map_type::non_const_type;
+  using entries_view_type   = typename Vbr::index_type::non_const_type;
+  using values_view_type    = typename Vbr::values_type::non_const_type;
+
+  auto hRowPtr = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowPtr);
+  auto hColPtr = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), colPtr);
+  check_vbr_partition(hRowPtr, crs.numRows(), "row");
+  check_vbr_partition(hColPtr, crs.numCols(), "column");
+
+  const ordinal_type nBlockRows = static_cast<ordinal_type>(hRowPtr.extent(0)) - 1;
+  const ordinal_type nBlockCols = static_cast<ordinal_type>(hColPtr.extent(0)) - 1;
+
+  auto hRowMap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs.graph.row_map);
+  auto hEntries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs.graph.entries);
+  auto hValues  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs.values);
+
+  // point column -> block column
+  std::vector<ordinal_type> colToBlock(crs.numCols());
+  for (ordinal_type jb = 0; jb < nBlockCols; ++jb) {
+    for (ordinal_type j = hColPtr(jb); j < hColPtr(jb + 1); ++j) colToBlock[j] = jb;
+  }
+
+  // symbolic: distinct block columns of every block row, sorted
+  std::vector<size_type> blockRowMap(nBlockRows + 1, 0);
+  std::vector<ordinal_type> blockEntries;
+  std::vector<size_type> blockValPtr(1, 0);
+  std::vector<ordinal_type> lastSeen(nBlockCols, -1);
+  for (ordinal_type ib = 0; ib < nBlockRows; ++ib) {
+    const size_type rowBegin = blockEntries.size();
+    for (ordinal_type i = hRowPtr(ib); i < hRowPtr(ib + 1); ++i) {
+      for (auto k = hRowMap(i); k < hRowMap(i + 1); ++k) {
+        const ordinal_type jb = colToBlock[hEntries(k)];
+        if (lastSeen[jb] != ib) {
+          lastSeen[jb] = ib;
+          blockEntries.push_back(jb);
+        }
+      }
+    }
+    std::sort(blockEntries.begin() + rowBegin, blockEntries.end());
+    const size_type r = hRowPtr(ib + 1) - hRowPtr(ib);
+    for (size_type k = rowBegin; k < blockEntries.size(); ++k) {
+      const size_type c = hColPtr(blockEntries[k] + 1) - hColPtr(blockEntries[k]);
+      blockValPtr.push_back(blockValPtr.back() + r * c);
+    }
+    blockRowMap[ib + 1] = blockEntries.size();
+  }
+  const size_type nBlocks = blockEntries.size();
+
+  // numeric: scatter point values into their blocks
+  typename values_view_type::HostMirror hVbrValues("hVbrValues", blockValPtr.back());
+  std::vector<size_type> blockPos(nBlockCols);
+  for (ordinal_type ib = 0; ib < nBlockRows; ++ib) {
+    for (size_type k = blockRowMap[ib]; k < blockRowMap[ib + 1]; ++k) blockPos[blockEntries[k]] = k;
+    for (ordinal_type i = hRowPtr(ib); i < hRowPtr(ib + 1); ++i) {
+      for (auto k = hRowMap(i); k < hRowMap(i + 1); ++k) {
+        const ordinal_type j  = hEntries(k);
+        const ordinal_type jb = colToBlock[j];
+        const size_type c     = hColPtr(jb + 1) - hColPtr(jb);
+        hVbrValues(blockValPtr[blockPos[jb]] + (i - hRowPtr(ib)) * c + (j - hColPtr(jb))) +=
+            static_cast<value_type>(hValues(k));
+      }
+    }
+  }
+
+  partition_view_type vbrRowPtr(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrRowPtr"), nBlockRows + 1);
+  partition_view_type vbrColPtr(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrColPtr"), nBlockCols + 1);
+  row_map_view_type vbrRowMap(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrRowMap"), nBlockRows + 1);
+  entries_view_type vbrEntries(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrEntries"), nBlocks);
+  offsets_view_type vbrValPtr(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrValPtr"), nBlocks + 1);
+  values_view_type vbrValues(Kokkos::view_alloc(Kokkos::WithoutInitializing, "vbrValues"), hVbrValues.extent(0));
+  {
+    auto h = Kokkos::create_mirror_view(vbrRowPtr);
+    for (ordinal_type i = 0; i <= nBlockRows; ++i) h(i) = hRowPtr(i);
+    Kokkos::deep_copy(vbrRowPtr, h);
+  }
+  {
+    auto h = Kokkos::create_mirror_view(vbrColPtr);
+    for (ordinal_type i = 0; i <= nBlockCols; ++i) h(i) = hColPtr(i);
+    Kokkos::deep_copy(vbrColPtr, h);
+  }
+  {
+    auto h = Kokkos::create_mirror_view(vbrRowMap);
+    for (ordinal_type i = 0; i <= nBlockRows; ++i) h(i) = blockRowMap[i];
+    Kokkos::deep_copy(vbrRowMap, h);
+  }
+  {
+    auto hInd = Kokkos::create_mirror_view(vbrEntries);
+    auto hPtr = Kokkos::create_mirror_view(vbrValPtr);
+    for (size_type k = 0; k < nBlocks; ++k) hInd(k) = blockEntries[k];
+    for (size_type k = 0; k <= nBlocks; ++k) hPtr(k) = blockValPtr[k];
+    Kokkos::deep_copy(vbrEntries, hInd);
+    Kokkos::deep_copy(vbrValPtr, hPtr);
+  }
+  Kokkos::deep_copy(vbrValues, hVbrValues);
+
+  return Vbr("VbrMatrix", vbrRowPtr, vbrColPtr, vbrRowMap, vbrEntries, vbrValPtr, vbrValues);
+}
+}  // namespace Impl
+
+///
+/// \brief Blocking function that converts a CrsMatrix to a VbrMatrix.
+///
+/// \tparam VbrType The KokkosSparse::Experimental::VbrMatrix type to build.
+/// \param crsMatrix The KokkosSparse::CrsMatrix.
+/// \param rowPtr First point row of each block row, length nBlockRows+1.
+/// \param colPtr First point column of each block column, length nBlockCols+1.
+/// \return A KokkosSparse::Experimental::VbrMatrix.
+template <class VbrType, class CrsType, class RowPartition, class ColPartition>
+VbrType crs2vbr(const CrsType &crsMatrix, const RowPartition &rowPtr, const ColPartition &colPtr) {
+  static_assert(Experimental::is_vbr_matrix_v<VbrType>, "crs2vbr: VbrType must be a VbrMatrix");
+  static_assert(is_crs_matrix_v<CrsType>, "crs2vbr: CrsType must be a CrsMatrix");
+  return Impl::crs2vbr<VbrType>(crsMatrix, rowPtr, colPtr);
+}
+
+///
+/// \brief Blocking function that converts a square CrsMatrix to a VbrMatrix,
+/// given a node-to-dof map.
+///
+/// Node n owns the degrees of freedom (point rows and columns)
+/// [nodeToDof(n), nodeToDof(n+1)), so the same partition is used for rows
+/// and columns. Nodes may carry different numbers of dofs (e.g. 1, 3 or 5).
+///
+/// \tparam VbrType The KokkosSparse::Experimental::VbrMatrix type to build.
+/// \param crsMatrix The KokkosSparse::CrsMatrix.
+/// \param nodeToDof First dof of each node, length numNodes+1.
+/// \return A KokkosSparse::Experimental::VbrMatrix.
+template <class VbrType, class CrsType, class NodePartition>
+VbrType crs2vbr(const CrsType &crsMatrix, const NodePartition &nodeToDof) {
+  return crs2vbr<VbrType>(crsMatrix, nodeToDof, nodeToDof);
+}
+}  // namespace KokkosSparse
+#endif  //  KOKKOSSPARSE_CRS2VBR_HPP
@@ -16,6 +16,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <KokkosKernels_Utils.hpp>
+#include <KokkosKernels_WorkspaceArena.hpp>
 // needed for two-stage/classical GS
 #include <KokkosSparse_CrsMatrix.hpp>
 // needed for the set of available coloring algorithms
@@ -74,10 +75,15 @@ class GaussSeidelHandle {
   typedef typename Kokkos::View<nnz_lno_t *, HandlePersistentMemorySpace> nnz_lno_persistent_work_view_t;
   typedef typename nnz_lno_persistent_work_view_t::HostMirror nnz_lno_persistent_work_host_view_t;  // Host view type
 
+  typedef KokkosKernels::Impl::WorkspaceArena<HandleExecSpace, HandleTempMemorySpace> workspace_arena_t;
+
  protected:
   HandleExecSpace execution_space;
   int num_streams;
 
+  // workspace of the KokkosKernelsHandle owning this handle, if enabled
+  workspace_arena_t *workspace_arena = nullptr;
+
   GSAlgorithm algorithm_type;
 
   nnz_lno_persistent_work_host_view_t color_xadj;
@@ -131,6 +137,16 @@ class GaussSeidelHandle {
   nnz_lno_persistent_work_view_t get_color_adj() const { return this->color_adj; }
   nnz_lno_t get_num_colors() const { return this->numColors; }
 
+  /// \brief Number of rows (clusters for cluster GS) in each color set.
+  /// Each color set is swept by one kernel, so the smallest sets bound the
+  /// parallelism of the apply (see KokkosGraph::COLORING_BALANCED).
+  nnz_lno_persistent_work_host_view_t get_color_set_sizes() const {
+    nnz_lno_persistent_work_host_view_t sizes(Kokkos::view_alloc(Kokkos::WithoutInitializing, "color set sizes"),
+                                              this->numColors);
+    for (nnz_lno_t c = 0; c < this->numColors; c++) sizes(c) = this->color_xadj(c + 1) - this->color_xadj(c);
+    return sizes;
+  }
+
   bool is_symbolic_called() const { return this->called_symbolic; }
   bool is_numeric_called() const { return this->called_numeric; }
 
@@ -160,6 +176,11 @@ class GaussSeidelHandle {
   void set_call_symbolic(bool call = true) { this->called_symbolic = call; }
   void set_call_numeric(bool call = true) { this->called_numeric = call; }
 
+  /// \brief Makes the setup phases draw their temporaries from arena (nullptr
+  /// to allocate them).
+  void set_workspace_arena(workspace_arena_t *arena) { this->workspace_arena = arena; }
+  workspace_arena_t *get_workspace_arena() const { return this->workspace_arena; }
+
   void set_color_xadj(const nnz_lno_persistent_work_host_view_t &color_xadj_) { this->color_xadj = color_xadj_; }
   void set_color_adj(const nnz_lno_persistent_work_view_t &color_adj_) { this->color_adj = color_adj_; }
   void set_num_colors(const nnz_lno_t &numColors_) { this->numColors = numColors_; }
@@ -17,6 +17,7 @@
 #include <Kokkos_Core.hpp>
 #include <iostream>
 #include <string>
+#include "KokkosKernels_WorkspaceArena.hpp"
 
 #ifndef KOKKOSSPARSE_PAR_ILUTHANDLE_HPP
 #define KOKKOSSPARSE_PAR_ILUTHANDLE_HPP
@@ -66,6 +67,8 @@ class PAR_ILUTHandle {
       Kokkos::View<signed_integral_t *, typename nnz_row_view_t::array_layout, typename nnz_row_view_t::device_type,
                    typename nnz_row_view_t::memory_traits>;
 
+  using workspace_arena_t = KokkosKernels::Impl::WorkspaceArena<HandleExecSpace, HandleTempMemorySpace>;
+
  private:
   // User inputs
   size_type max_iter;                /// Hard cap on the number of par_ilut iterations
@@ -95,6 +98,7 @@ class PAR_ILUTHandle {
   int team_size;    /// Kokkos team size. Set by the parent handle. -1 implies
                     /// AUTO
   int vector_size;  /// Kokkos vector size. Set by the parent handle.
+  workspace_arena_t *workspace_arena = nullptr;  /// Workspace of the parent handle, if enabled
 
   // Stored by symbolic phase
   size_type nrows;         /// Number of rows in the CSRs given to the symbolic par_ilut
@@ -160,6 +164,9 @@ class PAR_ILUTHandle {
   void set_vector_size(const int vs) { this->vector_size = vs; }
   int get_vector_size() const { return this->vector_size; }
 
+  void set_workspace_arena(workspace_arena_t *arena) { this->workspace_arena = arena; }
+  workspace_arena_t *get_workspace_arena() const { return this->workspace_arena; }
+
   void set_max_iter(const size_type max_iter_) { this->max_iter = max_iter_; }
   int get_max_iter() const { return this->max_iter; }
 
@@ -17,6 +17,7 @@
 #include <Kokkos_Core.hpp>
 #include <iostream>
 #include <string>
+#include "KokkosKernels_WorkspaceArena.hpp"
 
 #ifndef KOKKOSSPARSE_SPADDHANDLE_HPP
 #define KOKKOSSPARSE_SPADDHANDLE_HPP
@@ -31,6 +32,7 @@ class SPADDHandle {
   typedef typename lno_row_view_t_::non_const_type nnz_row_view_t;
   typedef typename lno_row_view_t_::non_const_value_type size_type;
   typedef ExecutionSpace execution_space;
+  typedef KokkosKernels::Impl::WorkspaceArena<ExecutionSpace, MemorySpace> workspace_arena_t;
 
 #ifdef KOKKOSKERNELS_ENABLE_TPL_CUSPARSE
   struct SpaddCusparseData {
@@ -80,6 +82,9 @@ class SPADDHandle {
   nnz_lno_view_t a_pos;
   nnz_lno_view_t b_pos;
 
+  // workspace of the KokkosKernelsHandle owning this handle, if enabled
+  workspace_arena_t* workspace_arena = nullptr;
+
  public:
   /// \brief sets the result nnz size.
   /// \param a_pos_in The offset into a.
@@ -132,6 +137,11 @@ class SPADDHandle {
   bool is_input_sorted() { return input_sorted; }
   bool is_input_merged() { return input_merged; }
   bool is_input_strict_crs() { return input_sorted && input_merged; }
+
+  /// \brief Makes the symbolic phase draw its temporaries from arena (nullptr
+  /// to allocate them).
+  void set_workspace_arena(workspace_arena_t* arena) { this->workspace_arena = arena; }
+  workspace_arena_t* get_workspace_arena() const { return this->workspace_arena; }
 };
 
 }  // namespace KokkosSparse
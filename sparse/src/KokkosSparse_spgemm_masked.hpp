@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spgemm_masked.hpp
+/// \brief Masked sparse matrix-matrix multiply with a fused diagonal scaling,
+///   C<M> = alpha * A * diag(d) * B.
+
+#ifndef KOKKOSSPARSE_SPGEMM_MASKED_HPP_
+#define KOKKOSSPARSE_SPGEMM_MASKED_HPP_
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spgemm_masked_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+///
+/// @brief Symbolic phase of the masked SpGEMM C<M> = alpha * A * diag(d) * B.
+///
+/// C gets the entries of the mask M that the structure of A*B reaches;
+/// products outside of M are never formed. Within each row, the entries of C
+/// keep the order of M, so C is sorted when M is. The values of C are
+/// allocated and zeroed; spgemm_masked_numeric fills them, and may be called
+/// again with new values of A, d and B as long as their structure is the same.
+///
+/// @tparam ExecSpace A Kokkos execution space
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam MaskGraph A KokkosSparse::StaticCrsGraph (e.g. M.graph of a
+///   CrsMatrix); rows must not contain duplicate columns
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with managed memory
+/// @param space The execution space instance this kernel will run on
+/// @param A The left operand, m x k
+/// @param B The right operand, k x n
+/// @param M The output mask, m x n
+/// @param C [out] The output matrix, allocated by this function
+///
+template <class ExecSpace, class AMatrix, class BMatrix, class MaskGraph, class CMatrix>
+void spgemm_masked_symbolic(const ExecSpace& space, const AMatrix& A, const BMatrix& B, const MaskGraph& M,
+                            CMatrix& C) {
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<BMatrix> && is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::spgemm_masked_symbolic: A, B and C must be CrsMatrix");
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, typename CMatrix::memory_space>::accessible,
+                "KokkosSparse::spgemm_masked_symbolic: C must be accessible from ExecSpace");
+  KokkosSparse::Impl::check_spgemm_masked_dims(A, B, M.numRows(), B.numCols(), "spgemm_masked_symbolic");
+
+  KokkosSparse::Impl::spgemm_masked_symbolic(space, A, B, M, C);
+}
+
+///
+/// @brief Symbolic phase of the masked SpGEMM, run on the default instance of
+///   A's execution space.
+///
+template <class AMatrix, class BMatrix, class MaskGraph, class CMatrix>
+void spgemm_masked_symbolic(const AMatrix& A, const BMatrix& B, const MaskGraph& M, CMatrix& C) {
+  spgemm_masked_symbolic(typename AMatrix::execution_space{}, A, B, M, C);
+}
+
+///
+/// @brief Numeric phase of the masked SpGEMM C<M> = alpha * A * diag(d) * B.
+///
+/// The structure of C (from spgemm_masked_symbolic, or any other pattern the
+/// caller wants recomputed) acts as the mask; every value of C is
+/// overwritten, entries that A*B does not reach become zero.
+///
+/// @tparam ExecSpace A Kokkos execution space
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam DVector A rank-1 Kokkos::View of length A.numCols(), or of length
+///   0 for no scaling (d = 1)
+/// @tparam BMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix
+/// @param space The execution space instance this kernel will run on
+/// @param alpha Scalar multiplier of the product
+/// @param A The left operand, m x k
+/// @param d The diagonal scaling between A and B
+/// @param B The right operand, k x n
+/// @param C [in/out] The output matrix; its structure is kept, its values
+///   are overwritten
+///
+template <class ExecSpace, class AMatrix, class DVector, class BMatrix, class CMatrix>
+void spgemm_masked_numeric(const ExecSpace& space, const typename CMatrix::const_value_type alpha, const AMatrix& A,
+                           const DVector& d, const BMatrix& B, const CMatrix& C) {
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<BMatrix> && is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::spgemm_masked_numeric: A, B and C must be CrsMatrix");
+  static_assert(Kokkos::is_view<DVector>::value && DVector::rank() == size_t(1),
+                "KokkosSparse::spgemm_masked_numeric: d must be a rank-1 Kokkos::View");
+  static_assert(!std::is_const_v<typename CMatrix::value_type>,
+                "KokkosSparse::spgemm_masked_numeric: C must have non-const values");
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, typename DVector::memory_space>::accessible,
+                "KokkosSparse::spgemm_masked_numeric: d must be accessible from ExecSpace");
+  KokkosSparse::Impl::check_spgemm_masked_dims(A, B, C.numRows(), C.numCols(), "spgemm_masked_numeric");
+  if (d.extent(0) != 0 && d.extent(0) != size_t(A.numCols())) {
+    std::ostringstream os;
+    os << "KokkosSparse::spgemm_masked_numeric: d has length " << d.extent(0) << ", expected 0 or "
+       << A.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  KokkosSparse::Impl::spgemm_masked_numeric(space, alpha, A, d, B, C);
+}
+
+///
+/// @brief Numeric phase of the masked SpGEMM, run on the default instance of
+///   A's execution space.
+///
+template <class AMatrix, class DVector, class BMatrix, class CMatrix>
+void spgemm_masked_numeric(const typename CMatrix::const_value_type alpha, const AMatrix& A, const DVector& d,
+                           const BMatrix& B, const CMatrix& C) {
+  spgemm_masked_numeric(typename AMatrix::execution_space{}, alpha, A, d, B, C);
+}
+
+///
+/// @brief Masked SpGEMM C<M> = alpha * A * diag(d) * B (symbolic + numeric).
+///
+/// @tparam CMatrix The KokkosSparse::CrsMatrix type to return
+/// @return The product, restricted to the mask M
+///
+template <class CMatrix, class ExecSpace, class AMatrix, class DVector, class BMatrix, class MaskGraph>
+CMatrix spgemm_masked(const ExecSpace& space, const typename CMatrix::const_value_type alpha, const AMatrix& A,
+                      const DVector& d, const BMatrix& B, const MaskGraph& M) {
+  CMatrix C;
+  spgemm_masked_symbolic(space, A, B, M, C);
+  spgemm_masked_numeric(space, alpha, A, d, B, C);
+  return C;
+}
+
+///
+/// @brief Masked SpGEMM C<M> = alpha * A * diag(d) * B (symbolic + numeric),
+///   run on the default instance of A's execution space.
+///
+template <class CMatrix, class AMatrix, class DVector, class BMatrix, class MaskGraph>
+CMatrix spgemm_masked(const typename CMatrix::const_value_type alpha, const AMatrix& A, const DVector& d,
+                      const BMatrix& B, const MaskGraph& M) {
+  return spgemm_masked<CMatrix>(typename AMatrix::execution_space{}, alpha, A, d, B, M);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_MASKED_HPP_
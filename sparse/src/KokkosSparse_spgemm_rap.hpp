@@ -0,0 +1,155 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spgemm_rap.hpp
+/// \brief Galerkin triple product C = P^T * A * P, as used to build the
+///   coarse operators of algebraic multigrid.
+
+#ifndef KOKKOSSPARSE_SPGEMM_RAP_HPP_
+#define KOKKOSSPARSE_SPGEMM_RAP_HPP_
+
+#include <sstream>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spgemm_rap_handle.hpp"
+#include "KokkosSparse_spgemm_rap_impl.hpp"
+
+namespace KokkosSparse {
+
+namespace Impl {
+template <class AMatrix, class PMatrix>
+void check_spgemm_rap_dims(const AMatrix& A, const PMatrix& P, const char* name) {
+  if (A.numRows() != A.numCols() || A.numCols() != P.numRows()) {
+    std::ostringstream os;
+    os << "KokkosSparse::" << name << ": A (" << A.numRows() << "x" << A.numCols() << ") must be square and match P ("
+       << P.numRows() << "x" << P.numCols() << ")";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+
+///
+/// @brief Symbolic phase of the triple product C = P^T * A * P.
+///
+/// Computes the index structure of P^T and the sorted structure of C
+/// directly from A and P: neither P^T nor A*P is formed. The values of C are
+/// allocated and zeroed; call spgemm_rap_numeric to fill them.
+///
+/// @tparam ExecSpace A Kokkos execution space
+/// @tparam RAPHandleType A KokkosSparse::RAPHandle
+/// @tparam AMatrix A KokkosSparse::CrsMatrix
+/// @tparam PMatrix A KokkosSparse::CrsMatrix
+/// @tparam CMatrix A KokkosSparse::CrsMatrix with managed memory
+/// @param space The execution space instance to run on
+/// @param handle The handle, reused by spgemm_rap_numeric
+/// @param A The fine operator, n x n
+/// @param P The prolongator, n x nc
+/// @param C [out] The coarse operator, nc x nc, allocated by this function
+///
+template <class ExecSpace, class RAPHandleType, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_symbolic(const ExecSpace& space, RAPHandleType& handle, const AMatrix& A, const PMatrix& P,
+                         CMatrix& C) {
+  static_assert(Kokkos::is_execution_space_v<ExecSpace>,
+                "KokkosSparse::spgemm_rap_symbolic: ExecSpace must be a Kokkos execution space");
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<PMatrix> && is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::spgemm_rap_symbolic: A, P and C must be CrsMatrix");
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, typename CMatrix::memory_space>::accessible,
+                "KokkosSparse::spgemm_rap_symbolic: C must be accessible from ExecSpace");
+  KokkosSparse::Impl::check_spgemm_rap_dims(A, P, "spgemm_rap_symbolic");
+
+  KokkosSparse::Impl::spgemm_rap_symbolic(space, handle, A, P, C);
+}
+
+///
+/// @brief Symbolic phase of the triple product C = P^T * A * P, on a default
+///   instance of the handle's execution space.
+///
+template <class RAPHandleType, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_symbolic(RAPHandleType& handle, const AMatrix& A, const PMatrix& P, CMatrix& C) {
+  spgemm_rap_symbolic(typename RAPHandleType::execution_space(), handle, A, P, C);
+}
+
+///
+/// @brief Numeric phase of the triple product C = P^T * A * P.
+///
+/// Recomputes the values of C from those of A and P. May be called any number
+/// of times after spgemm_rap_symbolic, as long as the structures of A and P
+/// have not changed.
+///
+/// @param space The execution space instance to run on
+/// @param handle A handle on which spgemm_rap_symbolic has been called
+/// @param A The fine operator, n x n
+/// @param P The prolongator, n x nc
+/// @param C [in/out] The coarse operator from spgemm_rap_symbolic; its values
+///   are overwritten
+///
+template <class ExecSpace, class RAPHandleType, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_numeric(const ExecSpace& space, RAPHandleType& handle, const AMatrix& A, const PMatrix& P,
+                        const CMatrix& C) {
+  static_assert(Kokkos::is_execution_space_v<ExecSpace>,
+                "KokkosSparse::spgemm_rap_numeric: ExecSpace must be a Kokkos execution space");
+  static_assert(is_crs_matrix_v<AMatrix> && is_crs_matrix_v<PMatrix> && is_crs_matrix_v<CMatrix>,
+                "KokkosSparse::spgemm_rap_numeric: A, P and C must be CrsMatrix");
+  static_assert(!std::is_const_v<typename CMatrix::value_type>,
+                "KokkosSparse::spgemm_rap_numeric: C must have non-const values");
+  if (!handle.is_symbolic_complete()) {
+    KokkosKernels::Impl::throw_runtime_exception(
+        "KokkosSparse::spgemm_rap_numeric: spgemm_rap_symbolic must be called first");
+  }
+  KokkosSparse::Impl::check_spgemm_rap_dims(A, P, "spgemm_rap_numeric");
+  if (C.numRows() != P.numCols() || C.numCols() != P.numCols()) {
+    std::ostringstream os;
+    os << "KokkosSparse::spgemm_rap_numeric: C (" << C.numRows() << "x" << C.numCols() << ") must be "
+       << P.numCols() << "x" << P.numCols();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  KokkosSparse::Impl::spgemm_rap_numeric(space, handle, A, P, C);
+}
+
+///
+/// @brief Numeric phase of the triple product C = P^T * A * P, on a default
+///   instance of the handle's execution space.
+///
+template <class RAPHandleType, class AMatrix, class PMatrix, class CMatrix>
+void spgemm_rap_numeric(RAPHandleType& handle, const AMatrix& A, const PMatrix& P, const CMatrix& C) {
+  spgemm_rap_numeric(typename RAPHandleType::execution_space(), handle, A, P, C);
+}
+
+///
+/// @brief Triple product C = P^T * A * P (symbolic + numeric), with a
+///   temporary handle.
+///
+/// @tparam CMatrix The KokkosSparse::CrsMatrix type to return
+/// @param space The execution space instance to run on
+/// @return The coarse operator
+///
+template <class CMatrix, class ExecSpace, class AMatrix, class PMatrix>
+CMatrix spgemm_rap(const ExecSpace& space, const AMatrix& A, const PMatrix& P) {
+  RAPHandle<CMatrix> handle;
+  CMatrix C;
+  spgemm_rap_symbolic(space, handle, A, P, C);
+  spgemm_rap_numeric(space, handle, A, P, C);
+  return C;
+}
+
+template <class CMatrix, class AMatrix, class PMatrix>
+CMatrix spgemm_rap(const AMatrix& A, const PMatrix& P) {
+  return spgemm_rap<CMatrix>(typename CMatrix::execution_space(), A, P);
+}
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_RAP_HPP_
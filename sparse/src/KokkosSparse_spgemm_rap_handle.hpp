@@ -0,0 +1,80 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spgemm_rap_handle.hpp
+/// \brief Handle holding the reusable state of the triple product
+///   C = P^T * A * P (see KokkosSparse_spgemm_rap.hpp)
+
+#ifndef KOKKOSSPARSE_SPGEMM_RAP_HANDLE_HPP_
+#define KOKKOSSPARSE_SPGEMM_RAP_HANDLE_HPP_
+
+#include "KokkosSparse_CrsMatrix.hpp"
+
+namespace KokkosSparse {
+
+/// \class RAPHandle
+/// \brief State shared by spgemm_rap_symbolic and spgemm_rap_numeric.
+///
+/// A*P is not formed, and neither are the values of P^T. The handle does keep
+/// the index structure of the rows of P^T: for every coarse row I, the fine
+/// rows i with P(i,I) != 0 and the offset of P(i,I) in P's values. It costs
+/// (numCols(P) + 1 + 2 * nnz(P)) * sizeof(size_type) + nnz(P) *
+/// sizeof(ordinal_type) bytes (see Pt_bytes()), as much as a copy of P's
+/// graph plus one offset per entry. This is all the numeric phase needs to
+/// recompute C when the values of A (or P) change but their structure does
+/// not.
+template <class crs_matrix_type>
+struct RAPHandle {
+  using execution_space = typename crs_matrix_type::execution_space;
+  using memory_space    = typename crs_matrix_type::memory_space;
+  using size_type       = typename crs_matrix_type::non_const_size_type;
+  using ordinal_type    = typename crs_matrix_type::non_const_ordinal_type;
+  using scalar_type     = typename crs_matrix_type::non_const_value_type;
+
+  using row_map_type = Kokkos::View<size_type *, typename crs_matrix_type::device_type>;
+  using entries_type = Kokkos::View<ordinal_type *, typename crs_matrix_type::device_type>;
+  using offsets_type = Kokkos::View<size_type *, typename crs_matrix_type::device_type>;
+
+  RAPHandle() : max_c_row(0), symbolic_complete(false) {}
+
+  RAPHandle(const RAPHandle &)            = delete;
+  RAPHandle &operator=(const RAPHandle &) = delete;
+
+  bool is_symbolic_complete() const { return symbolic_complete; }
+
+  /// \brief Bytes held by the index structure of P^T
+  size_t Pt_bytes() const {
+    return Pt_row_map.span() * sizeof(size_type) + Pt_entries.span() * sizeof(ordinal_type) +
+           Pt_offsets.span() * sizeof(size_type);
+  }
+  void set_symbolic_complete() { symbolic_complete = true; }
+
+  // Index structure of P^T: row map, fine row of every entry and offset of
+  // the entry in P's values
+  row_map_type Pt_row_map;
+  entries_type Pt_entries;
+  offsets_type Pt_offsets;
+
+  // Longest row of C, sizes the numeric accumulator
+  ordinal_type max_c_row;
+
+ private:
+  bool symbolic_complete;
+};
+
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPGEMM_RAP_HANDLE_HPP_
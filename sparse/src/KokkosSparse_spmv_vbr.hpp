@@ -0,0 +1,101 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_vbr.hpp
+/// \brief Sparse matrix-vector multiply for variable block row matrices
+
+#ifndef KOKKOSSPARSE_SPMV_VBR_HPP_
+#define KOKKOSSPARSE_SPMV_VBR_HPP_
+
+#include <sstream>
+
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+#include "KokkosSparse_spmv_vbrmatrix_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Kokkos sparse matrix-vector multiply for a VbrMatrix.
+///   Computes y := alpha*Op(A)*x + beta*y, where Op(A) is
+///   controlled by mode (see below).
+///
+/// Every stored block is applied with a small dense GEMV; blocks of
+/// dimension up to 5x5 use fully unrolled micro-kernels.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of A, x, and y.
+/// \tparam AMatrix A KokkosSparse::Experimental::VbrMatrix
+/// \tparam XVector Type of x, must be a rank-1 Kokkos::View
+/// \tparam YVector Type of y, must be a rank-1 Kokkos::View
+///
+/// \param space [in] The execution space instance on which to run the kernel.
+/// \param mode [in] Select A's operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector, class BetaType, class YVector>
+void spmv_vbr(const ExecutionSpace& space, const char mode[], const AlphaType& alpha, const AMatrix& A,
+              const XVector& x, const BetaType& beta, const YVector& y) {
+  static_assert(is_vbr_matrix_v<AMatrix>, "KokkosSparse::spmv_vbr: AMatrix must be a VbrMatrix.");
+  static_assert(Kokkos::is_view<XVector>::value, "KokkosSparse::spmv_vbr: XVector must be a Kokkos::View.");
+  static_assert(Kokkos::is_view<YVector>::value, "KokkosSparse::spmv_vbr: YVector must be a Kokkos::View.");
+  static_assert(XVector::rank() == size_t(1) && YVector::rank() == size_t(1),
+                "KokkosSparse::spmv_vbr: Both Vector inputs must have rank 1.");
+  static_assert(!std::is_const_v<typename YVector::value_type>,
+                "KokkosSparse::spmv_vbr: Output Vector must be non-const.");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename AMatrix::memory_space>::accessible,
+                "KokkosSparse::spmv_vbr: AMatrix must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename XVector::memory_space>::accessible,
+                "KokkosSparse::spmv_vbr: XVector must be accessible from ExecutionSpace");
+  static_assert(Kokkos::SpaceAccessibility<ExecutionSpace, typename YVector::memory_space>::accessible,
+                "KokkosSparse::spmv_vbr: YVector must be accessible from ExecutionSpace");
+
+  if ((mode[0] != 'N' && mode[0] != 'T' && mode[0] != 'C' && mode[0] != 'H') || mode[1] != '\0') {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_vbr: Invalid mode \"" << mode << "\", must be one of N, T, C or H.";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  const bool transpose = (mode[0] == 'T' || mode[0] == 'H');
+  const auto numYRows  = transpose ? A.numPointCols() : A.numPointRows();
+  const auto numXRows  = transpose ? A.numPointRows() : A.numPointCols();
+  if (y.extent(0) != size_t(numYRows) || x.extent(0) != size_t(numXRows)) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_vbr: Dimensions do not match: "
+       << ", A: " << A.numPointRows() << " x " << A.numPointCols() << ", x: " << x.extent(0)
+       << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  Impl::Vbr::spmv_vbr(space, mode, alpha, A, x, beta, y);
+}
+
+/// \brief Kokkos sparse matrix-vector multiply for a VbrMatrix, run on the
+///   default instance of the matrix's execution space.
+template <class AlphaType, class AMatrix, class XVector, class BetaType, class YVector>
+void spmv_vbr(const char mode[], const AlphaType& alpha, const AMatrix& A, const XVector& x, const BetaType& beta,
+              const YVector& y) {
+  spmv_vbr(typename AMatrix::execution_space{}, mode, alpha, A, x, beta, y);
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_VBR_HPP_
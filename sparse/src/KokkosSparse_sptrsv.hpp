@@ -30,6 +30,7 @@
 #include "KokkosKernels_helpers.hpp"
 #include "KokkosSparse_sptrsv_symbolic_spec.hpp"
 #include "KokkosSparse_sptrsv_solve_spec.hpp"
+#include "KokkosSparse_sptrsv_numeric_impl.hpp"
 
 #include "KokkosSparse_sptrsv_cuSPARSE_impl.hpp"
 
@@ -246,6 +247,75 @@ void sptrsv_symbolic(KernelHandle *handle, lno_row_view_t_ rowmap, lno_nnz_view_
   sptrsv_symbolic(my_exec_space, handle, rowmap, entries, values);
 }
 
+/**
+ * @brief sptrsv numeric phase for a block (BSR) linear system Ax=b
+ *
+ * Inverts the diagonal blocks of A once and stores them in the handle, so
+ * that subsequent calls to sptrsv_solve apply each diagonal block with a
+ * small GEMV instead of refactoring it. The inverses are tied to the values
+ * view passed here: a solve with another values view, or after
+ * sptrsv_symbolic, factors the diagonal blocks on the fly. Values changed in
+ * place are not detected, so call sptrsv_numeric again after changing them.
+ *
+ * @tparam ExecutionSpace This kernels execution space type
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam lno_row_view_t_ The BSR matrix's (A) rowmap type
+ * @tparam lno_nnz_view_t_ The BSR matrix's (A) entries type
+ * @tparam scalar_nnz_view_t_ The BSR matrix's (A) values type
+ * @param space The execution space instance this kernel will run on
+ * @param handle KernelHandle instance, created with a block size > 0
+ * @param rowmap The BSR matrix's (A) rowmap
+ * @param entries The BSR matrix's (A) entries
+ * @param values The BSR matrix's (A) values
+ */
+template <typename ExecutionSpace, typename KernelHandle, typename lno_row_view_t_, typename lno_nnz_view_t_,
+          typename scalar_nnz_view_t_>
+void sptrsv_numeric(const ExecutionSpace &space, KernelHandle *handle, lno_row_view_t_ rowmap, lno_nnz_view_t_ entries,
+                    scalar_nnz_view_t_ values) {
+  typedef typename KernelHandle::size_type size_type;
+  typedef typename KernelHandle::nnz_lno_t ordinal_type;
+  typedef typename KernelHandle::nnz_scalar_t scalar_type;
+
+  static_assert(KOKKOSKERNELS_SPTRSV_SAME_TYPE(typename lno_row_view_t_::non_const_value_type, size_type),
+                "sptrsv_numeric: A size_type must match KernelHandle "
+                "size_type (const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_SPTRSV_SAME_TYPE(typename lno_nnz_view_t_::non_const_value_type, ordinal_type),
+                "sptrsv_numeric: A entry type must match KernelHandle entry type (aka "
+                "nnz_lno_t, and const doesn't matter)");
+
+  static_assert(KOKKOSKERNELS_SPTRSV_SAME_TYPE(typename scalar_nnz_view_t_::value_type, scalar_type),
+                "sptrsv_numeric: A scalar type must match KernelHandle entry "
+                "type (aka nnz_scalar_t, and const doesn't matter)");
+
+  auto sptrsv_handle = handle->get_sptrsv_handle();
+  KK_REQUIRE_MSG(sptrsv_handle->is_symbolic_complete(), "sptrsv_numeric: sptrsv_symbolic must be called first");
+
+  KokkosSparse::Impl::Experimental::sptrsv_block_diag_inverse(space, *sptrsv_handle, rowmap, entries, values);
+}
+
+/**
+ * @brief sptrsv numeric phase for a block (BSR) linear system Ax=b
+ *
+ * @tparam KernelHandle A specialization of
+ * KokkosKernels::Experimental::KokkosKernelsHandle
+ * @tparam lno_row_view_t_ The BSR matrix's (A) rowmap type
+ * @tparam lno_nnz_view_t_ The BSR matrix's (A) entries type
+ * @tparam scalar_nnz_view_t_ The BSR matrix's (A) values type
+ * @param handle KernelHandle instance, created with a block size > 0
+ * @param rowmap The BSR matrix's (A) rowmap
+ * @param entries The BSR matrix's (A) entries
+ * @param values The BSR matrix's (A) values
+ */
+template <typename KernelHandle, typename lno_row_view_t_, typename lno_nnz_view_t_, typename scalar_nnz_view_t_>
+void sptrsv_numeric(KernelHandle *handle, lno_row_view_t_ rowmap, lno_nnz_view_t_ entries, scalar_nnz_view_t_ values) {
+  using ExecutionSpace = typename KernelHandle::HandleExecSpace;
+  auto my_exec_space   = ExecutionSpace();
+
+  sptrsv_numeric(my_exec_space, handle, rowmap, entries, values);
+}
+
 /**
  * @brief sptrsv solve phase of x for linear system Ax=b
  *
@@ -17,6 +17,7 @@
 #include <Kokkos_Core.hpp>
 #include <iostream>
 #include <string>
+#include "KokkosKernels_WorkspaceArena.hpp"
 
 #ifndef KOKKOSSPARSE_SPTRSVHANDLE_HPP
 #define KOKKOSSPARSE_SPTRSVHANDLE_HPP
@@ -62,6 +63,8 @@ class SPTRSVHandle {
   using execution_space = ExecutionSpace;
   using memory_space    = HandlePersistentMemorySpace;
 
+  using workspace_arena_t = KokkosKernels::Impl::WorkspaceArena<ExecutionSpace, TemporaryMemorySpace>;
+
   using TeamPolicy  = Kokkos::TeamPolicy<execution_space>;
   using RangePolicy = Kokkos::RangePolicy<execution_space>;
 
@@ -286,6 +289,9 @@ class SPTRSVHandle {
   int team_size;
   int vector_size;
 
+  // workspace of the KokkosKernelsHandle owning this handle, if enabled
+  workspace_arena_t *workspace_arena = nullptr;
+
   bool stored_diagonal;
   nnz_lno_view_t diagonal_offsets;
   nnz_scalar_view_t diagonal_values;  // inserted by rowid
@@ -293,6 +299,12 @@ class SPTRSVHandle {
   host_nnz_lno_view_t hdiagonal_offsets;
   host_nnz_scalar_view_t hdiagonal_values;  // inserted by rowid
 
+  // Numeric: inverted diagonal blocks (block_size^2 entries per block row,
+  // inserted by rowid), empty until sptrsv_numeric is called, and the data of
+  // the values they were computed from
+  nnz_scalar_view_t block_diag_inverse;
+  const void *block_diag_inverse_source;
+
   // Symbolic: Single-block chain data
   host_signed_nnz_lno_view_t h_chain_ptr;
   size_type num_chain_entries;
@@ -428,6 +440,8 @@ class SPTRSVHandle {
         diagonal_values(),  // inserted by rowid
         hdiagonal_offsets(),
         hdiagonal_values(),
+        block_diag_inverse(),
+        block_diag_inverse_source(nullptr),
         h_chain_ptr(),
         num_chain_entries(0),
         chain_threshold(-1),
@@ -562,10 +576,11 @@ class SPTRSVHandle {
   // return parents info in etree of supernodes
   host_graph_t get_supernodal_dag() { return this->dag_host; }
 
-  // workspace size
+  // workspace size. With a workspace arena, the solve draws the workspace
+  // from it instead of keeping one per handle.
   void set_workspace_size(signed_integral_t lwork_) {
     this->lwork = lwork_;
-    this->work  = workspace_t("work", lwork);
+    this->work  = this->workspace_arena ? workspace_t() : workspace_t("work", lwork);
   }
   signed_integral_t get_workspace_size() { return this->lwork; }
 
@@ -710,6 +725,8 @@ class SPTRSVHandle {
   void new_init_handle(const size_type nrows_) {
     // set_nrows(nrows_);
     nrows = nrows_;
+    // the structure may have changed, sptrsv_numeric must be called again
+    reset_block_diag_inverse();
     // Assumed that level scheduling occurs during symbolic phase for all
     // algorithms, for now
 
@@ -943,6 +960,23 @@ class SPTRSVHandle {
   void set_block_size(const size_type block_size_) { this->block_size = block_size_; }
 
   bool is_block_enabled() const { return block_size > 0; }
+
+  nnz_scalar_view_t get_block_diag_inverse() const { return block_diag_inverse; }
+  void set_block_diag_inverse(const nnz_scalar_view_t &dinv, const void *source) {
+    this->block_diag_inverse        = dinv;
+    this->block_diag_inverse_source = source;
+  }
+  // Go back to factoring the diagonal blocks during the solve
+  void reset_block_diag_inverse() {
+    this->block_diag_inverse        = nnz_scalar_view_t();
+    this->block_diag_inverse_source = nullptr;
+  }
+  bool is_block_diag_inverse_computed() const { return block_diag_inverse.extent(0) > 0; }
+  // True if the inverted diagonal blocks were computed from the values at
+  // values_data (they are stale if those values were changed in place)
+  bool is_block_diag_inverse_computed_for(const void *values_data) const {
+    return is_block_diag_inverse_computed() && block_diag_inverse_source == values_data;
+  }
   void set_symbolic_complete() { this->symbolic_complete = true; }
   void set_symbolic_incomplete() { this->symbolic_complete = false; }
 
@@ -959,6 +993,10 @@ class SPTRSVHandle {
   // Called by user at setup - should only set a value, no alloc
   void set_vector_size(const int vs) { this->vector_size = vs; }
 
+  // Set by the parent handle - the solve temporaries come from arena (nullptr to allocate them)
+  void set_workspace_arena(workspace_arena_t *arena) { this->workspace_arena = arena; }
+  workspace_arena_t *get_workspace_arena() const { return this->workspace_arena; }
+
   KOKKOS_INLINE_FUNCTION
   int get_num_chain_entries() const { return this->num_chain_entries; }
   void set_num_chain_entries(const int nce) { this->num_chain_entries = nce; }
@@ -20,5 +20,6 @@
 #include "Test_Sparse_BsrMatrix.hpp"
 #include "Test_Sparse_bspgemm.hpp"
 #include "Test_Sparse_spmv_bsr.hpp"
+#include "Test_Sparse_VbrMatrix.hpp"
 
 #endif  // TEST_BLOCKSPARSE_HPP
@@ -29,6 +29,8 @@
 #include "Test_Sparse_spadd.hpp"
 #include "Test_Sparse_spgemm_jacobi.hpp"
 #include "Test_Sparse_spgemm.hpp"
+#include "Test_Sparse_spgemm_masked.hpp"
+#include "Test_Sparse_spgemm_rap.hpp"
 #include "Test_Sparse_SortCrs.hpp"
 #include "Test_Sparse_spiluk.hpp"
 #include "Test_Sparse_spmv.hpp"
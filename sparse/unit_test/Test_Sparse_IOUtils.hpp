@@ -17,7 +17,10 @@
 #include "KokkosSparse_Utils.hpp"
 #include "Test_vector_fixtures.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <set>
+#include <Kokkos_Random.hpp>
 
 namespace Test {
 
@@ -176,4 +179,69 @@ struct TestIOUtils {
 // Test randomly generated Cs matrices
 TEST_F(TestCategory, sparse_ioutils) { TestIOUtils::test(); }
 
+// Random edges, with duplicates and self loops, converted on the device and
+// compared with a host reference: sorted rows, no duplicates.
+template <typename lno_t, typename size_type, typename device>
+void test_edge_list_to_crs(lno_t nv, size_t ne, bool symmetrize, bool remove_self_loops) {
+  using graph_t    = Kokkos::StaticCrsGraph<lno_t, Kokkos::LayoutLeft, device, void, size_type>;
+  using edges_t    = Kokkos::View<lno_t*, device>;
+  using exec_space = typename device::execution_space;
+  edges_t srcs("srcs", ne), dsts("dsts", ne);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718 + ne);
+  Kokkos::fill_random(srcs, rand_pool, nv);
+  Kokkos::fill_random(dsts, rand_pool, nv);
+
+  graph_t G = KokkosSparse::Impl::kk_edge_list_to_crs_graph<graph_t>(nv, srcs, dsts, symmetrize, remove_self_loops);
+
+  auto hsrcs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), srcs);
+  auto hdsts = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dsts);
+  std::vector<std::set<lno_t>> ref(nv);
+  for (size_t e = 0; e < ne; e++) {
+    if (remove_self_loops && hsrcs(e) == hdsts(e)) continue;
+    ref[hsrcs(e)].insert(hdsts(e));
+    if (symmetrize) ref[hdsts(e)].insert(hsrcs(e));
+  }
+  auto rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), G.entries);
+  ASSERT_EQ(rowmap.extent(0), size_t(nv + 1));
+  for (lno_t v = 0; v < nv; v++) {
+    ASSERT_EQ(size_t(rowmap(v + 1) - rowmap(v)), ref[v].size()) << "row " << v;
+    size_type k = rowmap(v);
+    for (lno_t u : ref[v]) EXPECT_EQ(entries(k++), u) << "row " << v;
+  }
+}
+
+// The host conversion keeps every edge, in both directions, rows sorted
+inline void test_undirected_edge_list_to_csr() {
+  using size_type    = size_t;
+  using lno_t        = int;
+  const lno_t nv     = 50;
+  const size_type ne = 1000;
+  std::vector<lno_t> srcs(ne), dsts(ne), adj(2 * ne);
+  std::vector<size_type> xadj(nv + 1);
+  std::vector<std::vector<lno_t>> ref(nv);
+  for (size_type e = 0; e < ne; e++) {
+    srcs[e] = (e * 7) % nv;
+    dsts[e] = (e * 13 + e / nv) % nv;
+    ref[srcs[e]].push_back(dsts[e]);
+    ref[dsts[e]].push_back(srcs[e]);
+  }
+  KokkosSparse::Impl::convert_undirected_edge_list_to_csr(nv, ne, srcs.data(), dsts.data(), xadj.data(), adj.data());
+  ASSERT_EQ(xadj[nv], 2 * ne);
+  for (lno_t v = 0; v < nv; v++) {
+    std::sort(ref[v].begin(), ref[v].end());
+    ASSERT_EQ(xadj[v + 1] - xadj[v], ref[v].size()) << "row " << v;
+    for (size_type k = 0; k < ref[v].size(); k++) EXPECT_EQ(adj[xadj[v] + k], ref[v][k]) << "row " << v;
+  }
+}
+
+TEST_F(TestCategory, sparse_edge_list_to_crs) {
+  test_edge_list_to_crs<int, size_t, TestDevice>(0, 0, false, true);
+  test_edge_list_to_crs<int, size_t, TestDevice>(10, 200, false, true);
+  test_edge_list_to_crs<int, size_t, TestDevice>(1000, 20000, true, true);
+  test_edge_list_to_crs<int, int, TestDevice>(1000, 20000, true, false);
+  test_edge_list_to_crs<int64_t, size_t, TestDevice>(100000, 1000000, false, false);
+  test_undirected_edge_list_to_csr();
+}
+
 }  // namespace Test
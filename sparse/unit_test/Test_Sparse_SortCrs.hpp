@@ -31,6 +31,7 @@
 #include <Kokkos_ArithTraits.hpp>
 #include <Kokkos_Complex.hpp>
 #include <cstdlib>
+#include <vector>
 
 namespace SortCrsTest {
 enum : int {
@@ -170,6 +171,63 @@ void testSortCRSUnmanaged(bool doValues, bool doStructInterface) {
   }
 }
 
+// Matrix with a skewed row length distribution: mostly short rows, some
+// medium rows and a few very long rows, so every bin of the binned sort is
+// exercised.
+template <typename device_t>
+void testSortCRSSkewed(KokkosSparse::SortAlgorithm option) {
+  using scalar_t   = KokkosKernels::default_scalar;
+  using lno_t      = KokkosKernels::default_lno_t;
+  using size_type  = KokkosKernels::default_size_type;
+  using exec_space = typename device_t::execution_space;
+  const lno_t numRows = 1000;
+  const lno_t numCols = 20000;
+  std::vector<lno_t> cols(numCols);
+  for (lno_t j = 0; j < numCols; j++) cols[j] = j;
+  std::srand(4357);
+  Kokkos::View<size_type*, Kokkos::HostSpace> rowmapHost("rowmap host", numRows + 1);
+  std::vector<lno_t> entriesVec;
+  for (lno_t i = 0; i < numRows; i++) {
+    lno_t rowLength = i % 17;
+    if (i % 7 == 0) rowLength = 100 + i;
+    if (i % 250 == 0) rowLength = 6000 + 10 * i;
+    // first rowLength columns of a random permutation: distinct and unsorted
+    for (lno_t j = 0; j < rowLength; j++) std::swap(cols[j], cols[j + std::rand() % (numCols - j)]);
+    entriesVec.insert(entriesVec.end(), cols.begin(), cols.begin() + rowLength);
+    rowmapHost(i + 1) = entriesVec.size();
+  }
+  const size_type nnz = entriesVec.size();
+  Kokkos::View<lno_t*, Kokkos::HostSpace> entriesHost("entries host", nnz);
+  Kokkos::View<scalar_t*, Kokkos::HostSpace> valuesHost("values host", nnz);
+  for (size_type k = 0; k < nnz; k++) {
+    entriesHost(k) = entriesVec[k];
+    valuesHost(k)  = scalar_t(std::rand() % 1000);
+  }
+  Kokkos::View<size_type*, device_t> rowmap("rowmap", numRows + 1);
+  Kokkos::View<lno_t*, device_t> entries("entries", nnz);
+  Kokkos::View<scalar_t*, device_t> values("values", nnz);
+  Kokkos::deep_copy(rowmap, rowmapHost);
+  Kokkos::deep_copy(entries, entriesHost);
+  Kokkos::deep_copy(values, valuesHost);
+  // Reference: sort each row on host by column, values follow
+  for (lno_t i = 0; i < numRows; i++) {
+    std::vector<std::pair<lno_t, scalar_t>> row;
+    for (size_type k = rowmapHost(i); k < rowmapHost(i + 1); k++) row.emplace_back(entriesHost(k), valuesHost(k));
+    std::sort(row.begin(), row.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t k = 0; k < row.size(); k++) {
+      entriesHost(rowmapHost(i) + k) = row[k].first;
+      valuesHost(rowmapHost(i) + k)  = row[k].second;
+    }
+  }
+  KokkosSparse::sort_crs_matrix(exec_space(), rowmap, entries, values, numCols, option);
+  auto entriesOut = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  auto valuesOut  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+  for (size_type k = 0; k < nnz; k++) {
+    ASSERT_EQ(entriesHost(k), entriesOut(k)) << "Sorted column indices are wrong!";
+    ASSERT_EQ(valuesHost(k), valuesOut(k)) << "Sorted values are wrong!";
+  }
+}
+
 template <typename device_t>
 void testSortAndMerge(bool justGraph, int howExecSpecified, bool doStructInterface, bool inPlace, int testCase) {
   using size_type  = KokkosKernels::default_size_type;
@@ -464,6 +522,17 @@ TEST_F(TestCategory, common_sort_crs_longrows) {
   testSortCRS<TestDevice>(1, 50000, 10000, true, false, SortCrsTest::ImplicitType);
 }
 
+TEST_F(TestCategory, common_sort_crsmatrix_skewed) {
+  testSortCRSSkewed<TestDevice>(KokkosSparse::SortAlgorithm::DEFAULT);
+  testSortCRSSkewed<TestDevice>(KokkosSparse::SortAlgorithm::BINNED);
+  // BINNED is only implemented for matrices
+  Kokkos::View<KokkosKernels::default_size_type*, TestDevice> rowmap("rowmap", 2);
+  Kokkos::View<KokkosKernels::default_lno_t*, TestDevice> entries("entries", 2);
+  EXPECT_THROW(KokkosSparse::sort_crs_graph(TestDevice::execution_space(), rowmap, entries, 2,
+                                            KokkosSparse::SortAlgorithm::BINNED),
+               std::runtime_error);
+}
+
 TEST_F(TestCategory, common_sort_merge_crsmatrix) {
   for (int testCase = 0; testCase < 5; testCase++) {
     for (int doStructInterface = 0; doStructInterface < 2; doStructInterface++) {
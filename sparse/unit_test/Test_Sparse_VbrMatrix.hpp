@@ -0,0 +1,106 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <KokkosKernels_TestUtils.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_VbrMatrix.hpp"
+#include "KokkosSparse_crs2vbr.hpp"
+#include "KokkosSparse_spmv.hpp"
+#include "KokkosSparse_spmv_vbr.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+
+using kokkos_complex_double = Kokkos::complex<double>;
+using kokkos_complex_float  = Kokkos::complex<float>;
+
+namespace Test_Vbr {
+
+// Mixed 1-, 3- and 5-dof nodes, optionally with one large (generic kernel) node
+template <typename lno_t, typename device>
+Kokkos::View<lno_t *, device> make_node_to_dof(const lno_t numNodes, const bool withLargeNode, lno_t &numDofs) {
+  Kokkos::View<lno_t *, device> nodeToDof("nodeToDof", numNodes + 1);
+  auto h                 = Kokkos::create_mirror_view(nodeToDof);
+  const lno_t dofSizes[] = {1, 3, 5};
+  h(0)                   = 0;
+  for (lno_t n = 0; n < numNodes; ++n) {
+    const lno_t sz = (withLargeNode && n == numNodes / 2) ? 7 : dofSizes[n % 3];
+    h(n + 1)       = h(n) + sz;
+  }
+  numDofs = h(numNodes);
+  Kokkos::deep_copy(nodeToDof, h);
+  return nodeToDof;
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_vbr_spmv(const lno_t numNodes, const bool withLargeNode) {
+  using crs_t       = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vbr_t       = KokkosSparse::Experimental::VbrMatrix<scalar_t, lno_t, device, void, size_type>;
+  using vector_t    = Kokkos::View<scalar_t *, device>;
+  using mag_t       = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using exec_space  = typename device::execution_space;
+  const mag_t eps   = Kokkos::ArithTraits<mag_t>::epsilon();
+  const scalar_t s1 = Kokkos::ArithTraits<scalar_t>::one();
+
+  lno_t numDofs   = 0;
+  auto nodeToDof  = make_node_to_dof<lno_t, device>(numNodes, withLargeNode, numDofs);
+  size_type nnz   = 8 * numDofs;
+  const crs_t crs = KokkosSparse::Impl::kk_generate_sparse_matrix<crs_t>(numDofs, numDofs, nnz, 3, numDofs / 4);
+  const vbr_t vbr = KokkosSparse::crs2vbr<vbr_t>(crs, nodeToDof);
+
+  EXPECT_EQ(vbr.numRows(), numNodes);
+  EXPECT_EQ(vbr.numCols(), numNodes);
+  EXPECT_EQ(vbr.numPointRows(), numDofs);
+  EXPECT_EQ(vbr.numPointCols(), numDofs);
+  EXPECT_GE(vbr.numPointNnz(), size_type(crs.nnz()));
+
+  vector_t x("x", numDofs), y("y", numDofs), yRef("yRef", numDofs);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, s1);
+
+  const scalar_t alpha = 1.5 * s1;
+  for (const char *mode : {"N", "T", "C", "H"}) {
+    for (const scalar_t beta : {0.0 * s1, 1.0 * s1, -0.5 * s1}) {
+      Kokkos::fill_random(y, rand_pool, s1);
+      Kokkos::deep_copy(yRef, y);
+
+      KokkosSparse::spmv(mode, alpha, crs, x, beta, yRef);
+      KokkosSparse::Experimental::spmv_vbr(mode, alpha, vbr, x, beta, y);
+
+      EXPECT_NEAR_KK_1DVIEW(y, yRef, 100 * numDofs * eps);
+    }
+  }
+}
+
+}  // namespace Test_Vbr
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void testVbrMatrix() {
+  Test_Vbr::test_vbr_spmv<scalar_t, lno_t, size_type, device>(0, false);
+  Test_Vbr::test_vbr_spmv<scalar_t, lno_t, size_type, device>(30, false);
+  Test_Vbr::test_vbr_spmv<scalar_t, lno_t, size_type, device>(301, true);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                         \
+  TEST_F(TestCategory, sparse##_##vbrmatrix##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testVbrMatrix<SCALAR, ORDINAL, OFFSET, DEVICE>();                                       \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
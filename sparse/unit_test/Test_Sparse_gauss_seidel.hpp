@@ -615,6 +615,47 @@ void test_gauss_seidel_custom_coloring(lno_t numRows, lno_t nnzPerRow) {
   EXPECT_LT(result_norm_res, 0.25 * initial_norm_res);
 }
 
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_gauss_seidel_balanced_coloring(lno_t numRows, lno_t nnzPerRow) {
+  using namespace Test;
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+  typedef typename Kokkos::ArithTraits<scalar_t>::mag_type mag_t;
+  const scalar_t one = Kokkos::ArithTraits<scalar_t>::one();
+  size_type nnz      = nnzPerRow * numRows;
+  crsMat_t input_mat = KokkosSparse::Impl::kk_generate_diagonally_dominant_sparse_matrix<crsMat_t>(
+      numRows, numRows, nnz, 0, numRows / 10, 2.0 * one);
+  input_mat = Test::symmetrize<scalar_t, lno_t, size_type, device, crsMat_t>(input_mat);
+  input_mat = KokkosSparse::sort_and_merge_matrix(input_mat);
+  scalar_view_t solution_x(Kokkos::view_alloc(Kokkos::WithoutInitializing, "X (correct)"), numRows);
+  create_random_x_vector(solution_x);
+  mag_t initial_norm_res = KokkosBlas::nrm2(solution_x);
+  scalar_view_t y_vector = create_random_y_vector(input_mat, solution_x);
+  scalar_view_t x_vector("x vector", numRows);
+  typedef KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                              typename device::memory_space, typename device::memory_space>
+      KernelHandle;
+
+  KernelHandle kh;
+  kh.create_gs_handle(GS_DEFAULT);
+  kh.get_point_gs_handle()->set_coloring_algorithm(KokkosGraph::COLORING_BALANCED);
+  run_gauss_seidel(kh, input_mat, x_vector, y_vector, true, 0.9, 0);
+  KokkosBlas::axpby(one, solution_x, -one, x_vector);
+  mag_t result_norm_res = KokkosBlas::nrm2(x_vector);
+  EXPECT_LT(result_norm_res, 0.25 * initial_norm_res);
+
+  // the color sets partition the rows, and none is empty
+  auto sizes = kh.get_gs_handle()->get_color_set_sizes();
+  ASSERT_EQ(sizes.extent(0), size_t(kh.get_gs_handle()->get_num_colors()));
+  lno_t total = 0;
+  for (size_t c = 0; c < sizes.extent(0); c++) {
+    EXPECT_GT(sizes(c), lno_t(0));
+    total += sizes(c);
+  }
+  EXPECT_EQ(total, numRows);
+  kh.destroy_gs_handle();
+}
+
 template <typename scalar_t, typename lno_t, typename size_type, typename device>
 void test_gauss_seidel_streams_rank1(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance,
                                      bool symmetric, double omega,
@@ -750,6 +791,9 @@ void test_gauss_seidel_streams_rank1(lno_t numRows, size_type nnz, lno_t bandwid
   }                                                                                                                    \
   TEST_F(TestCategory, sparse##_##gauss_seidel_custom_coloring##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {         \
     test_gauss_seidel_custom_coloring<SCALAR, ORDINAL, OFFSET, DEVICE>(500, 10);                                       \
+  }                                                                                                                    \
+  TEST_F(TestCategory, sparse##_##gauss_seidel_balanced_coloring##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {       \
+    test_gauss_seidel_balanced_coloring<SCALAR, ORDINAL, OFFSET, DEVICE>(2000, 10);                                    \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
@@ -93,7 +93,8 @@ crsMat_t randomMatrix(ordinal_type nrows, ordinal_type ncols, ordinal_type minNN
 }
 
 template <typename scalar_t, typename lno_t, typename size_type, class Device>
-void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ, bool sortRows) {
+void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ, bool sortRows,
+                bool useArena = false) {
   typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device, void, size_type> crsMat_t;
 
   typedef Kokkos::ArithTraits<scalar_t> KAT;
@@ -124,6 +125,19 @@ void test_spadd(lno_t numRows, lno_t numCols, size_type minNNZ, size_type maxNNZ
   typename Device::execution_space exec{};
   KokkosSparse::spadd_symbolic(exec, &handle, numRows, numCols, A.graph.row_map, A.graph.entries, B.graph.row_map,
                                B.graph.entries, c_row_map);
+  if (useArena) {
+    // The unsorted symbolic draws its temporaries from the arena of the
+    // handle; once the arena has grown, repeated calls allocate nothing
+    handle.enable_workspace_arena();
+    auto *arena = handle.get_workspace_arena();
+    for (int iter = 0; iter < 3; iter++) {
+      if (iter == 2) arena->reset_stats();
+      KokkosSparse::spadd_symbolic(exec, &handle, numRows, numCols, A.graph.row_map, A.graph.entries,
+                                   B.graph.row_map, B.graph.entries, c_row_map);
+    }
+    EXPECT_EQ(arena->get_num_allocations(), size_t(sortRows ? 0 : 3));
+    EXPECT_EQ(arena->get_num_buffer_allocations(), size_t(0));
+  }
   size_type c_nnz = addHandle->get_c_nnz();
   // Fill values, entries with incorrect incorret
   values_type c_values(Kokkos::view_alloc(Kokkos::WithoutInitializing, "C values"), c_nnz);
@@ -243,6 +257,7 @@ void test_spadd_known_columns() {
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 10, 0, 2, false);                                  \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 50, 100, false);                             \
     test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(50, 50, 75, 100, false);                               \
+    test_spadd<SCALAR, ORDINAL, OFFSET, DEVICE>(100, 100, 50, 100, false, true);                       \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
@@ -480,6 +480,45 @@ void test_issue1738() {
 #endif
 }
 
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_workspace_arena() {
+  // With the workspace arena enabled, repeated numeric calls reuse the
+  // handle's workspace: only the first calls allocate.
+  using crsMat_t = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle =
+      KokkosKernels::Experimental::KokkosKernelsHandle<size_type, lno_t, scalar_t, typename device::execution_space,
+                                                       typename device::memory_space, typename device::memory_space>;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(2000, 1500, 2000 * 10, 10, 500);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(1500, 1800, 1500 * 10, 10, 500);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+  crsMat_t Cgold;
+  Test::run_spgemm<crsMat_t, device>(A, B, SPGEMM_DEBUG, Cgold, false);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle(SPGEMM_KK);
+  kh.enable_workspace_arena();
+  auto *arena = kh.get_workspace_arena();
+  ASSERT_NE(arena, nullptr);
+  crsMat_t C;
+  KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  EXPECT_TRUE(is_same_matrix<crsMat_t, device>(C, Cgold));
+  EXPECT_LE(arena->get_high_water_mark(), arena->capacity());
+
+  arena->reset_stats();
+  for (int iter = 0; iter < 3; iter++) {
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  }
+  EXPECT_EQ(arena->get_num_buffer_allocations(), size_t(0));
+  EXPECT_TRUE(is_same_matrix<crsMat_t, device>(C, Cgold));
+
+  kh.disable_workspace_arena();
+  EXPECT_EQ(kh.get_workspace_arena(), nullptr);
+  KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+  EXPECT_TRUE(is_same_matrix<crsMat_t, device>(C, Cgold));
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                                   \
   TEST_F(TestCategory, sparse##_##spgemm##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {                              \
     test_spgemm<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 8000, 6000, 8000 * 20, 500, 10, ::Test::spgemm_reuse_matrix); \
@@ -508,6 +547,7 @@ void test_issue1738() {
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(false, false);                                              \
     test_issue402<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                                 \
     test_issue1738<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                                \
+    test_spgemm_workspace_arena<SCALAR, ORDINAL, OFFSET, DEVICE>();                                                   \
   }
 
 // test_spgemm<SCALAR,ORDINAL,OFFSET,DEVICE>(50000, 50000 * 30, 100, 10);
@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <vector>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosSparse_spgemm_masked.hpp"
+#include "KokkosBlas1_scal.hpp"
+
+namespace Test_SpgemmMasked {
+
+// Host reference: C<M> = alpha * A * diag(d) * B, keeping the mask order
+template <typename crsMat_t, typename dview_t>
+void check_masked_product(const crsMat_t &A, const dview_t &d, const crsMat_t &B, const crsMat_t &M,
+                          const crsMat_t &C, const typename crsMat_t::value_type alpha) {
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using size_type = typename crsMat_t::non_const_size_type;
+  using KAT       = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename KAT::mag_type;
+
+  auto Arow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto Aent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto Aval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto Brow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.row_map);
+  auto Bent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.graph.entries);
+  auto Bval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B.values);
+  auto Mrow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M.graph.row_map);
+  auto Ment = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M.graph.entries);
+  auto Crow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.row_map);
+  auto Cent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.entries);
+  auto Cval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+  auto hd   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d);
+
+  const lno_t n = B.numCols();
+  std::vector<scalar_t> acc(n);
+  std::vector<mag_t> mags(n);  // sum of |terms|, scales the tolerance
+  std::vector<char> reached(n);
+  const mag_t tol = 1000 * KAT::eps();
+  for (lno_t i = 0; i < A.numRows(); ++i) {
+    std::fill(acc.begin(), acc.end(), KAT::zero());
+    std::fill(mags.begin(), mags.end(), mag_t(0));
+    std::fill(reached.begin(), reached.end(), 0);
+    for (size_type ka = Arow(i); ka < Arow(i + 1); ++ka) {
+      const lno_t k        = Aent(ka);
+      const scalar_t scale = hd.extent(0) ? Aval(ka) * hd(k) : Aval(ka);
+      for (size_type kb = Brow(k); kb < Brow(k + 1); ++kb) {
+        acc[Bent(kb)] += scale * Bval(kb);
+        mags[Bent(kb)] += KAT::abs(scale * Bval(kb));
+        reached[Bent(kb)] = 1;
+      }
+    }
+    size_type c = Crow(i);
+    for (size_type km = Mrow(i); km < Mrow(i + 1); ++km) {
+      const lno_t j = Ment(km);
+      if (!reached[j]) continue;
+      ASSERT_LT(c, Crow(i + 1)) << "row " << i;
+      EXPECT_EQ(Cent(c), j) << "row " << i;
+      const scalar_t expected = alpha * acc[j];
+      EXPECT_LE(KAT::abs(Cval(c) - expected), tol * (1 + KAT::abs(alpha) * mags[j]))
+          << "row " << i << ", col " << j;
+      ++c;
+    }
+    EXPECT_EQ(c, Crow(i + 1)) << "row " << i;
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_masked(const lno_t m, const lno_t k, const lno_t n, const bool scale_by_d) {
+  using crsMat_t   = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using dview_t    = Kokkos::View<scalar_t *, device>;
+  using exec_space = typename device::execution_space;
+
+  size_type nnzA = 6 * m, nnzB = 6 * k, nnzM = 4 * m;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m, k, nnzA, 3, k / 2 + 1);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(k, n, nnzB, 3, n / 2 + 1);
+  crsMat_t M = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(m, n, nnzM, 3, n / 2 + 1);
+  // the mask must not repeat columns within a row
+  M = KokkosSparse::sort_and_merge_matrix(M);
+
+  dview_t d("d", scale_by_d ? k : 0);
+  Kokkos::Random_XorShift64_Pool<exec_space> rand_pool(13718);
+  Kokkos::fill_random(d, rand_pool, Kokkos::ArithTraits<scalar_t>::one());
+
+  const scalar_t alpha = 1.5;
+  crsMat_t C           = KokkosSparse::Experimental::spgemm_masked<crsMat_t>(alpha, A, d, B, M.graph);
+  check_masked_product(A, d, B, M, C, alpha);
+
+  // numeric reuse with new values of A
+  KokkosBlas::scal(A.values, scalar_t(-2), A.values);
+  KokkosSparse::Experimental::spgemm_masked_numeric(alpha, A, d, B, C);
+  check_masked_product(A, d, B, M, C, alpha);
+}
+
+}  // namespace Test_SpgemmMasked
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void testSpgemmMasked() {
+  Test_SpgemmMasked::test_spgemm_masked<scalar_t, lno_t, size_type, device>(0, 0, 0, true);
+  Test_SpgemmMasked::test_spgemm_masked<scalar_t, lno_t, size_type, device>(50, 40, 60, false);
+  Test_SpgemmMasked::test_spgemm_masked<scalar_t, lno_t, size_type, device>(500, 300, 400, true);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                             \
+  TEST_F(TestCategory, sparse##_##spgemm_masked##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testSpgemmMasked<SCALAR, ORDINAL, OFFSET, DEVICE>();                                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <map>
+#include <vector>
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_spgemm_rap.hpp"
+#include "KokkosBlas1_scal.hpp"
+
+namespace Test_SpgemmRAP {
+
+// Host reference: sorted rows of P^T * A * P, compared entry by entry
+template <typename crsMat_t>
+void check_rap(const crsMat_t &A, const crsMat_t &P, const crsMat_t &C) {
+  using scalar_t  = typename crsMat_t::non_const_value_type;
+  using lno_t     = typename crsMat_t::non_const_ordinal_type;
+  using size_type = typename crsMat_t::non_const_size_type;
+  using KAT       = Kokkos::ArithTraits<scalar_t>;
+  using mag_t     = typename KAT::mag_type;
+
+  auto Arow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto Aent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto Aval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto Prow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), P.graph.row_map);
+  auto Pent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), P.graph.entries);
+  auto Pval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), P.values);
+  auto Crow = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.row_map);
+  auto Cent = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.graph.entries);
+  auto Cval = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C.values);
+
+  const lno_t nc = P.numCols();
+  // (I, J) -> value and sum of |terms|, which scales the tolerance
+  std::vector<std::map<lno_t, std::pair<scalar_t, mag_t>>> ref(nc);
+  for (lno_t i = 0; i < A.numRows(); ++i) {
+    for (size_type ka = Arow(i); ka < Arow(i + 1); ++ka) {
+      const lno_t k = Aent(ka);
+      for (size_type kp = Prow(k); kp < Prow(k + 1); ++kp) {
+        const scalar_t ap = Aval(ka) * Pval(kp);
+        for (size_type ki = Prow(i); ki < Prow(i + 1); ++ki) {
+          auto &e = ref[Pent(ki)][Pent(kp)];
+          e.first += Pval(ki) * ap;
+          e.second += KAT::abs(Pval(ki) * ap);
+        }
+      }
+    }
+  }
+
+  ASSERT_EQ(C.numRows(), nc);
+  ASSERT_EQ(C.numCols(), nc);
+  const mag_t tol = 1000 * KAT::eps();
+  for (lno_t I = 0; I < nc; ++I) {
+    ASSERT_EQ(size_t(Crow(I + 1) - Crow(I)), ref[I].size()) << "row " << I;
+    size_type c = Crow(I);
+    for (const auto &e : ref[I]) {
+      EXPECT_EQ(Cent(c), e.first) << "row " << I;
+      EXPECT_LE(KAT::abs(Cval(c) - e.second.first), tol * (1 + e.second.second)) << "row " << I << ", col " << e.first;
+      ++c;
+    }
+  }
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_spgemm_rap(const lno_t n, const lno_t nc) {
+  using crsMat_t = KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+
+  size_type nnzA = 8 * n, nnzP = 2 * n;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(n, n, nnzA, 3, n / 2 + 1);
+  crsMat_t P = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(n, nc, nnzP, 1, nc / 2 + 1);
+
+  KokkosSparse::RAPHandle<crsMat_t> handle;
+  crsMat_t C;
+  KokkosSparse::spgemm_rap_symbolic(handle, A, P, C);
+  KokkosSparse::spgemm_rap_numeric(handle, A, P, C);
+  check_rap(A, P, C);
+  // only the index structure of P^T is kept
+  EXPECT_EQ(handle.Pt_bytes(),
+            (size_t(nc) + 1 + 2 * size_t(P.nnz())) * sizeof(size_type) + size_t(P.nnz()) * sizeof(lno_t));
+
+  // numeric reuse with new values of A and P
+  KokkosBlas::scal(A.values, scalar_t(-2), A.values);
+  KokkosBlas::scal(P.values, scalar_t(0.5), P.values);
+  KokkosSparse::spgemm_rap_numeric(handle, A, P, C);
+  check_rap(A, P, C);
+
+  crsMat_t C2 = KokkosSparse::spgemm_rap<crsMat_t>(A, P);
+  check_rap(A, P, C2);
+
+  // on an execution space instance
+  crsMat_t C3 = KokkosSparse::spgemm_rap<crsMat_t>(typename device::execution_space(), A, P);
+  check_rap(A, P, C3);
+}
+
+}  // namespace Test_SpgemmRAP
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void testSpgemmRAP() {
+  Test_SpgemmRAP::test_spgemm_rap<scalar_t, lno_t, size_type, device>(0, 0);
+  Test_SpgemmRAP::test_spgemm_rap<scalar_t, lno_t, size_type, device>(60, 20);
+  // few coarse columns: every row of C gets the same columns from many
+  // products at once
+  Test_SpgemmRAP::test_spgemm_rap<scalar_t, lno_t, size_type, device>(400, 3);
+  Test_SpgemmRAP::test_spgemm_rap<scalar_t, lno_t, size_type, device>(1000, 150);
+}
+
+#define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                          \
+  TEST_F(TestCategory, sparse##_##spgemm_rap##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testSpgemmRAP<SCALAR, ORDINAL, OFFSET, DEVICE>();                                        \
+  }
+
+#include <Test_Common_Test_All_Type_Combos.hpp>
+
+#undef KOKKOSKERNELS_EXECUTE_TEST
@@ -221,6 +221,28 @@ struct SptrsvTest {
 
       Kokkos::deep_copy(lhs, scalar_t(0));
 
+      if (block_size != 0) {
+        // Solve again, applying the pre-inverted diagonal blocks
+        using mag_t = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+        KokkosSparse::sptrsv_numeric(&kh, row_map, entries, values);
+        EXPECT_TRUE(kh.get_sptrsv_handle()->is_block_diag_inverse_computed());
+
+        KokkosSparse::sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+        Kokkos::fence();
+
+        sum = 0.0;
+        Kokkos::parallel_reduce(range_policy_t(0, lhs.extent(0)), ReductionCheck(lhs), sum);
+        EXPECT_NEAR(Kokkos::ArithTraits<scalar_t>::abs(sum - scalar_t(lhs.extent(0))), mag_t(0),
+                    100 * lhs.extent(0) * Kokkos::ArithTraits<mag_t>::epsilon());
+
+        Kokkos::deep_copy(lhs, scalar_t(0));
+
+        // The inverses belong to these values, and a new symbolic phase drops them
+        EXPECT_TRUE(kh.get_sptrsv_handle()->is_block_diag_inverse_computed_for(values.data()));
+        KokkosSparse::sptrsv_symbolic(&kh, row_map, entries, values);
+        EXPECT_FALSE(kh.get_sptrsv_handle()->is_block_diag_inverse_computed());
+      }
+
       kh.destroy_sptrsv_handle();
     }
   }